@@ -44,7 +44,9 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
+#include <blaze/math/BandedMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/CompactDiagonalMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
@@ -66,18 +68,23 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/PackedFlag.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/SolverFlag.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
 #include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/Thresholds.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/math/TypeTraits.h>
@@ -86,6 +93,7 @@
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
 #include <blaze/math/UpperMatrix.h>
+#include <blaze/math/VectorBatch.h>
 #include <blaze/math/Views.h>
 #include <blaze/math/ZeroMatrix.h>
 #include <blaze/math/ZeroVector.h>
@@ -165,6 +165,7 @@
 //             <ul>
 //                <li> \ref schur_product </li>
 //                <li> \ref matrix_product </li>
+//                <li> \ref matrix_strassen_product </li>
 //                <li> \ref matrix_kronecker_product </li>
 //             </ul>
 //          </li>
@@ -254,6 +255,12 @@
 // values \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either
 // of these features is used it is necessary to link the LAPACK library to the final executable.
 // If no LAPACK library is available the use of these features will result in a linker error.
+// Alternatively, the LAPACK mode can be disabled via the \c BLAZE_LAPACK_MODE switch (see the
+// <tt>./blaze/config/BLAS.h</tt> configuration file). In this case the LU, Cholesky, QR, and LQ
+// decompositions and all functions based on them (as for instance the determinant, the dense
+// matrix inversion, and the solution of linear systems) as well as the eigenvalues of symmetric
+// and Hermitian matrices and the singular value decomposition are computed by native, blocked
+// implementations and don't require LAPACK.
 //
 // Furthermore, it is possible to use Boost threads to run numeric operations in parallel. In this
 // case the Boost library is required to be installed on your system. It is recommended to use the
@@ -6455,6 +6462,22 @@
 // peak performance. However, it is also possible to create vectorized custom operations. See
 // \ref custom_operations for a detailed overview of the possibilities of custom operations.
 //
+// In case the unary \c map() function is applied to a dense matrix multiplication, optionally
+// scaled and/or combined with the addition of a dense matrix (as for instance a row vector that
+// is expanded via the \c expand() function), the custom operation is fused into the evaluation
+// of the multiplication: For large single and double precision matrices the operation is applied
+// to each block of the target matrix directly after the block has been computed, which avoids a
+// second pass over the target matrix:
+
+   \code
+   blaze::DynamicMatrix<float> A, B, C;
+   blaze::DynamicVector<float,blaze::rowVector> bias;
+   // ... Resizing and initialization
+
+   // The ReLU activation is applied while the blocks of C are still in cache
+   C = map( A * B + expand( bias, A.rows() ), []( float x ){ return blaze::max( x, 0.0F ); } );
+   \endcode
+
 // Please note that unary custom operations on vectors have been introduced in \b Blaze 3.0 in
 // form of the \c forEach() function. With the introduction of binary custom functions, the
 // \c forEach() function has been renamed to \c map(). The \c forEach() function can still be
@@ -7663,6 +7686,31 @@
 // \note The inversion functions do not provide any exception safety guarantee, i.e. in case an
 // exception is thrown the matrix may already have been modified.
 //
+// In case a large number of independent small matrices has to be inverted (as for instance the
+// 3x3 inertia tensors of a rigid body simulation), the inversion of every single matrix leaves
+// most SIMD lanes idle. For this purpose \b Blaze provides the \c MatrixBatch class template,
+// which interleaves the elements of the matrices across SIMD lanes. All matrices of a batch can
+// be inverted, multiplied, and used as system matrices of LSEs at once, where every SIMD lane
+// processes a different matrix and the batch is processed in parallel (see the
+// \c BLAZE_SMP_BATCH_THRESHOLD in the <tt>./blaze/config/Thresholds.h</tt> configuration file):
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 100000UL ), B( 100000UL ), C;
+   blaze::VectorBatch<double,3UL> x( 100000UL ), y;
+   blaze::DynamicVector<double> d;
+   // ... Initialization via A( k, i, j ), A.set( k, M ), ...
+
+   mult( C, A, B );   // C[k] = A[k] * B[k] for all 100000 matrices
+   mult( y, A, x );   // y[k] = A[k] * x[k] for all 100000 matrices
+   det( A, d );       // d[k] = det( A[k] ) for all 100000 matrices
+   solve( A, y, x );  // Solves A[k] * y[k] = x[k] for all 100000 matrices
+   invert( A );       // In-place inversion of all 100000 matrices
+   \endcode
+
+// 2x2 and 3x3 matrices are processed by SIMD versions of the closed-form kernels, larger matrices
+// by the kernels of the \c invert(), \c det(), and \c solve() functions for single matrices.
+// In case any matrix of a batch is singular, a \c std::runtime_error exception is thrown.
+//
 //
 // \n \section matrix_operations_matrix_exponential Matrix Exponential
 // <hr>
@@ -7680,6 +7728,12 @@
    B = matexp( A );  // Compute the exponential of A
    \endcode
 
+// The exponential is computed by means of the scaling and squaring method based on diagonal
+// Pad&eacute; approximants (N.J. Higham, "The Scaling and Squaring Method for the Matrix Exponential
+// Revisited", 2005). The degree of the approximant and the number of squarings are chosen
+// adaptively from 1-norm estimates of \c A, which keeps the number of matrix products small and
+// retains the accuracy for badly scaled matrices.
+//
 // \note The matrix exponential can only be used for dense matrices with \c float, \c double,
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type results in a compile time error!
@@ -8004,6 +8058,27 @@
 // \note The \c solve() functions do not provide any exception safety guarantee, i.e. in case an
 // exception is thrown the solution vector or matrix may already have been modified.
 //
+// For \c double and \c complex<double> systems the three-argument \c solve() functions can
+// alternatively compute the solution by means of mixed precision iterative refinement: the system
+// matrix is decomposed in single precision and the solution is refined by means of residuals
+// computed in double precision until it achieves double precision accuracy. Since the
+// decomposition is the dominating part of the computation this approximately halves both the
+// runtime and the memory traffic. The decomposition is selected via a blaze::SolverFlag:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, X;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   solve<blaze::byMixedLU>( A, x, b );   // Single precision LU decomposition of a general matrix
+   solve<blaze::byMixedLLH>( A, X, B );  // Single precision Cholesky decomposition of a positive definite matrix
+   \endcode
+
+// In case the system matrix cannot be decomposed in single precision or in case the refinement
+// stalls since the matrix is too ill-conditioned for single precision, the regular \c solve()
+// function is used as fallback. Note that the mixed precision solvers are restricted to column
+// vectors and are not available via the two-argument \c solve() functions.
+//
 //
 // \n \section matrix_operations_eigenvalues Eigenvalues/Eigenvectors
 // <hr>
@@ -8847,6 +8922,40 @@
    C = A * B;  // Is not guaranteed to result in a symmetric matrix; some runtime overhead
    \endcode
 
+// \n \subsection adaptors_symmetric_matrices_packed_storage Packed Storage
+//
+// A SymmetricMatrix is built on top of a full \f$ N \times N \f$ dense matrix, i.e. it stores all
+// elements of the matrix although half of them are redundant. For very large matrices the
+// \c PackedMatrix class template provides an alternative, which stores the lower part of the
+// matrix only (\f$ N(N+1)/2 \f$ elements in the packed format of LAPACK). Packed matrices are
+// also available for Hermitian (\c packedHermitian), lower (\c packedLower), and upper
+// (\c packedUpper) matrices. All operations on packed matrices read and write the stored half
+// only, which halves both the memory requirements and the memory bandwidth:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< DynamicMatrix<double> > S( 40000UL );
+   // ... Initialization
+
+   PackedMatrix<double,blaze::packedSymmetric> A( S );  // Packing the lower part of S
+
+   DynamicVector<double> x( 40000UL ), y;
+   DynamicMatrix<double> B( 40000UL, 10UL ), C;
+
+   mult( y, A, x );  // Computes y = A * x in a single pass over the stored elements
+   mult( C, A, B );  // Computes C = A * B
+   unpack( A, S );   // Converts the packed matrix back into a symmetric matrix
+   \endcode
+
+// Note that packed matrices are no dense matrices, i.e. they cannot be used within expressions.
+// Elements are accessed via the function call operator and modified via the \c set() function.
+// Packed matrices can be serialized via the \b Blaze serialization, which writes the stored
+// elements only.
+//
 // \n Previous: \ref adaptors &nbsp; &nbsp; Next: \ref adaptors_hermitian_matrices
 */
 //*************************************************************************************************
@@ -10277,6 +10386,29 @@
    using LargeDiagonalMatrix = blaze::DiagonalMatrix< blaze::CompressedMatrix<float> >;
    \endcode
 
+// Alternatively, the \c CompactDiagonalMatrix class template stores the \f$ N \f$ diagonal
+// elements only, in a single contiguous dense vector without any index overhead. It is a sparse
+// matrix for which \c IsDiagonal_v evaluates to \a true, i.e. it takes part in all optimizations
+// for diagonal matrices. Its multiplication with dense and sparse vectors is evaluated as an
+// elementwise scaling with the diagonal, its multiplication with dense matrices as a vectorized
+// row or column scaling:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   CompactDiagonalMatrix<float> D( 10000UL );  // Stores 10000 diagonal elements
+   D.values() = 2.0F;                          // Sets all diagonal elements at once
+   D.set( 3UL, 3UL, 5.0F );                    // Sets a single diagonal element
+
+   DynamicVector<float> x( 10000UL ), y;
+   DynamicMatrix<float,blaze::columnMajor> A( 10000UL, 100UL ), B;
+
+   y = D * x;  // Elementwise scaling of x
+   B = D * A;  // Scaling of the rows of A
+   \endcode
+
 // \n \subsection adaptors_triangular_matrices_scaling Unitriangular Matrices Cannot Be Scaled!
 //
 // Since the diagonal elements of a unitriangular matrix have a fixed value of 1 it is not possible
@@ -13344,6 +13476,7 @@
 //       <ul>
 //          <li> \ref schur_product </li>
 //          <li> \ref matrix_product </li>
+//          <li> \ref matrix_strassen_product </li>
 //          <li> \ref matrix_kronecker_product </li>
 //       </ul>
 //    </li>
@@ -14036,6 +14169,62 @@
 // behavior!
 //
 //
+// \n \section matrix_strassen_product Strassen-Winograd Multiplication
+// <hr>
+//
+// For very large dense matrices the number of floating point operations of a matrix product can
+// be reduced by means of the Winograd variant of Strassen's algorithm, which splits the product
+// into seven instead of eight half-size products. Since the algorithm trades multiplications for
+// additions and changes the rounding behavior of the product, it is disabled by default and has
+// to be enabled explicitly via the \c BLAZE_USE_STRASSEN switch (see the
+// <tt>./blaze/config/Optimizations.h</tt> configuration file):
+
+   \code
+   #define BLAZE_USE_STRASSEN 1
+   #include <blaze/Math.h>
+
+   using blaze::DynamicMatrix;
+
+   DynamicMatrix<double> A( 8192UL, 8192UL ), B( 8192UL, 8192UL ), C;
+
+   // ... Initialization of the matrices
+
+   C = A * B;  // Evaluated via two levels of the Strassen-Winograd recursion
+   \endcode
+
+// The recursion is applied to the assignment of the product of two row-major dense matrices of
+// \c float, \c double, \c complex<float>, or \c complex<double> elements as long as the smallest
+// dimension of the product is equal or higher than the \c STRASSEN_THRESHOLD. Below this cutoff
+// (per default 2048, see <tt>./blaze/config/Thresholds.h</tt>) the classical kernel or the BLAS
+// kernel is used. Each level of recursion saves 12.5% of the floating point operations, i.e.
+// two levels save about 23% and three levels about 33%. Odd dimensions are handled by means of
+// dynamic peeling. The temporary memory amounts to two quarter-size matrices per level, which
+// are taken from a thread-local scratch arena and reused by all subsequent multiplications. All
+// sub-products and sums are parallelized via the active \ref shared_memory_parallelization
+// backend. Products with declared symmetric, Hermitian, or triangular result, products involving
+// triangular operands, as well as the addition and subtraction assignment of products are always
+// computed by means of the classical algorithm.
+//
+// Due to the different order of operations the Strassen-Winograd algorithm is not as accurate
+// as the classical algorithm. For \f$ n \times n \f$ matrices, a cutoff \f$ n_0 \f$ and the unit
+// roundoff \f$ u \f$, the classical algorithm satisfies the componentwise error bound
+
+      \f[ |C - \hat{C}| \leq n u |A| |B| + O(u^2), \f]
+
+// whereas the Winograd variant only satisfies the normwise error bound (Higham, "Accuracy and
+// Stability of Numerical Algorithms", 2nd ed., Section 23.2.2)
+
+      \f[ \|C - \hat{C}\| \leq \left[ \left(\frac{n}{n_0}\right)^{\log_2 18}
+          \left( n_0^2 + 6 n_0 \right) - 6 n \right] u \|A\| \|B\| + O(u^2), \f]
+
+// where \f$ \|\cdot\| \f$ denotes the maximum norm. Thus every level of recursion increases the
+// constant of the error bound by a factor of up to 18/4 = 4.5, and small elements of the result
+// may have a large relative error in case \a A and \a B are badly scaled. In practice the error
+// is usually much smaller than the bound, but the cutoff should be chosen such that no more than
+// two or three levels of recursion are performed. The \c strassen benchmark of the \b Blazemark
+// measures both the performance gain and the deviation from the classical algorithm.
+//
+//
 // \n \section matrix_kronecker_product Kronecker Product
 // <hr>
 //
@@ -14058,6 +14247,30 @@
 // possible to multiply two matrices with different element type, as long as the element types
 // themselves can be multiplied.
 //
+// In case a Kronecker product is directly multiplied with a dense vector or a dense matrix, the
+// Kronecker product is never formed. Instead, the multiplication is evaluated matrix-free by
+// means of the identity \f$ (A \otimes B) vec(X) = vec(B X A^T) \f$, i.e. via two small matrix
+// multiplications instead of one large matrix/vector multiplication. This also applies to
+// chains of Kronecker products, which are evaluated as a sequence of small matrix multiplications
+// (one per factor):
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 30UL, 30UL ), B( 40UL, 40UL ), C( 50UL, 50UL );
+   DynamicVector<double> x( 60000UL );
+
+   // ... Initialization of the matrices and the vector
+
+   DynamicVector<double> y1 = kron( A, B ) * subvector( x, 0UL, 1200UL );  // Two small multiplications
+   DynamicVector<double> y2 = kron( kron( A, B ), C ) * x;                 // Three small multiplications
+   \endcode
+
+// In case the shared memory parallelization is active, the batches of small matrix
+// multiplications are executed in parallel (see the \c BLAZE_SMP_KRONMULT_THRESHOLD in the
+// <tt>./blaze/config/Thresholds.h</tt> configuration file).
+//
 // \n Previous: \ref matrix_vector_multiplication &nbsp; &nbsp; Next: \ref bitwise_operations
 */
 //*************************************************************************************************
@@ -14781,6 +14994,47 @@
 //
 //  - \ref serial_execution
 //
+// Furthermore, the \c asyncAssign() and \c async() functions evaluate an expression in the
+// background by means of the active parallelization and immediately return a \c std::shared_future,
+// which allows to overlap large operations with other work of the calling thread:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   std::shared_future<void> done = blaze::asyncAssign( C, A * B );
+   auto result = blaze::async( A * trans( B ) );
+
+   // ... Work that does not involve A, B, or C
+
+   done.get();
+   blaze::DynamicMatrix<double> D( result.get() );
+   \endcode
+
+// The asynchronous operations of an application thread are executed in program order and an
+// asynchronous assignment is only started after all pending asynchronous assignments to the same
+// target have been completed. However, the operands of a pending operation must neither be
+// destroyed nor modified and the target of a pending assignment must not be accessed before the
+// operation has been completed. In combination with the OpenMP and HPX parallelization, which
+// share the flags of parallel sections between all threads, the calling thread must furthermore
+// not evaluate any other expression while an asynchronous operation is pending.
+//
+// A batch of independent statements can be evaluated via a \c TaskGraph. Instead of evaluating
+// one statement at a time with a barrier after every statement, the task graph determines the
+// dependencies between the statements and evaluates all independent statements concurrently:
+
+   \code
+   blaze::TaskGraph graph;
+   graph.assign( y1, A * x1 );
+   graph.assign( y2, B * x2 );
+   graph.assign( z, trans( A ) * w );
+
+   graph.run();  // Evaluating all three statements concurrently
+   \endcode
+
+// In combination with the OpenMP and HPX parallelization the statements of a task graph are
+// evaluated one after another, each one in parallel.
+//
 // \n Previous: \ref logical_or &nbsp; &nbsp; Next: \ref hpx_parallelization
 */
 //*************************************************************************************************
@@ -14937,6 +15191,110 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_work_stealing Work-Stealing Scheduler
+// <hr>
+//
+// By default, all tasks of the C++11 thread parallelization are managed by means of a single
+// task queue, which is shared by all threads. On systems with many cores the synchronization
+// of this task queue can become a bottleneck. Additionally, a single slow thread can delay the
+// completion of an entire operation. For these situations \b Blaze provides a work-stealing
+// scheduler, which can be activated via the \c BLAZE_USE_WORK_STEALING switch:
+
+   \code
+   ... -std=c++11 -DBLAZE_USE_CPP_THREADS -DBLAZE_USE_WORK_STEALING=1 ...
+   \endcode
+
+// In work-stealing mode every thread owns a separate task queue and idle threads steal tasks
+// from randomly selected threads. Additionally, every operation is split into more tasks than
+// threads (by default 4 tasks per thread, see \c BLAZE_WORK_STEALING_TASKS_PER_THREAD in
+// <tt><blaze/config/SMP.h></tt>), which enables fast threads to take over the work of slow
+// threads. Note that the work-stealing scheduler is also available for the Boost thread
+// parallelization, but has no effect on the HPX and OpenMP parallelization.
+//
+//
+// \n \section cpp_threads_spinning Spin-Then-Park Synchronization
+// <hr>
+//
+// By default, idle threads immediately go to sleep and the thread waiting for the completion of
+// a parallel operation is immediately parked on a condition variable. For operations only
+// slightly above the SMP thresholds the cost of waking up and putting to sleep the threads can
+// exceed the cost of the actual computation. Via the \c BLAZE_THREAD_SPIN_COUNT setting in
+// <tt><blaze/config/SMP.h></tt> or the \c BLAZE_SPIN_COUNT environment variable it is possible
+// to specify a number of spin iterations before a thread is parked:
+
+   \code
+   export BLAZE_SPIN_COUNT=10000  // Unix systems
+   set BLAZE_SPIN_COUNT=10000     // Windows systems
+   \endcode
+
+// With a sufficient spin budget small parallel operations are joined within microseconds, which
+// allows to considerably lower the SMP thresholds in <tt><blaze/config/Thresholds.h></tt>. Note
+// however that spinning threads consume CPU time and that spinning is counterproductive in case
+// there are more threads than available cores.
+//
+//
+// \n \section cpp_threads_concurrency Concurrent Use and Thread Limits
+// <hr>
+//
+// The C++11 thread parallelization can be used from several application threads at the same
+// time. Every application thread joins only the tasks that it has scheduled itself, i.e. two
+// threads that concurrently evaluate large matrix operations share the same pool of threads,
+// but do not wait for the completion of each other's operations. Additionally it is possible to
+// limit the number of threads used for the operations of the calling thread via the
+// \c ThreadLimit class:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   {
+      blaze::ThreadLimit limit( 2UL );  // At most 2 threads within this scope
+
+      C = A * B;
+   }
+
+   C = A * B;  // Using all available threads
+   \endcode
+
+// The limit only affects the thread that created the \c ThreadLimit object. It cannot increase
+// the number of threads beyond the size of the thread pool and nested limits can only further
+// reduce the number of threads. On destruction, the previous limit is restored. The same class
+// can be used in combination with the HPX and OpenMP parallelization. Please note that any
+// operation that is executed by a thread of the thread pool is run serially, as are all
+// operations within a serial section (see \ref serial_execution), which only affects the thread
+// that entered it.
+//
+//
+// \n \section cpp_threads_numa NUMA Mode
+// <hr>
+//
+// On ccNUMA architectures the performance of memory-bound operations depends on the memory
+// pages of a vector or matrix being located in the locality domain of the threads that later
+// work on them. For the C++11 and Boost thread parallelizations \b Blaze provides a NUMA mode,
+// which can be activated via the \c BLAZE_USE_NUMA switch:
+
+   \code
+   ... -std=c++11 -DBLAZE_USE_CPP_THREADS -DBLAZE_USE_NUMA=1 ...
+   \endcode
+
+// In NUMA mode every thread of the thread pool is bound to a fixed core and the parts of every
+// parallel operation are always assigned to the same threads. Additionally, large dynamic vectors
+// and matrices of numeric element type are initialized in parallel, following the same partition
+// as all subsequent SMP assignments (first touch policy). By default, thread \c i is bound to
+// core \c i. Via the \c BLAZE_CPU_AFFINITY environment variable it is possible to specify a
+// different list of cores:
+
+   \code
+   export BLAZE_CPU_AFFINITY=0-7,16-23  // Unix systems
+   \endcode
+
+// Note that in NUMA mode the (otherwise uninitialized) elements of large dynamic matrices are
+// initialized to their default value and that the NUMA mode implies the work stealing
+// scheduler (see \ref cpp_threads_work_stealing). Currently, threads can only be bound
+// on Linux systems. For the OpenMP parallelization the binding is controlled via the standard
+// \c OMP_PROC_BIND and \c OMP_PLACES environment variables (see also \ref openmp_first_touch).
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -15125,6 +15483,17 @@
 // performance for all possible situations and configurations. They merely provide a reasonable
 // standard for the current CPU generation.
 //
+// The same mechanism applies to total reductions of dense vectors and dense matrices (as for
+// instance \c sum(), \c prod(), \c min(), \c max() and \c reduce()), to the inner product of
+// two dense vectors (\c dot() and \c inner()) and to dense vector norms (as for instance
+// \c norm(), \c sqrNorm() or \c l1Norm()). In case the size of the operand exceeds the according
+// threshold (\c BLAZE_SMP_DVECREDUCE_THRESHOLD, \c BLAZE_SMP_DVECDVECINNER_THRESHOLD,
+// \c BLAZE_SMP_DVECNORM_THRESHOLD and \c BLAZE_SMP_DMATFULLREDUCE_THRESHOLD), the operand is
+// partitioned into one contiguous range per thread, the partial results are computed in parallel
+// and are finally combined in a fixed order. Thus, for a given number of threads, the result of
+// a parallel reduction is reproducible, but it might differ from the result of the serial
+// reduction within the usual floating point rounding errors.
+//
 //
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
@@ -15353,8 +15722,11 @@
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that in combination with the C++11 and Boost thread parallelization the serial section
+// only affects the thread of execution that enters it. Several concurrent threads can use serial
+// sections independently of each other, but a serial section of one thread does not serialize
+// the operations of any other thread. In combination with the OpenMP and HPX parallelization a
+// serial section affects all threads.
 //
 //
 // \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
@@ -15784,6 +16156,41 @@
 // limitation for a large number of operations!
 //
 //
+// \n \section runtime_dispatch Runtime Dispatch
+// <hr>
+//
+// By default, the instruction set used for the vectorization is selected at compile time (e.g.
+// via \c -mavx2 or \c -march=native). In order to run a single executable on a heterogeneous
+// set of machines, it is possible to compile the most performance critical kernels for several
+// instruction sets and to select the widest instruction set supported by the executing CPU at
+// runtime:
+
+   \code
+   g++ ... -mavx2 -mfma -DBLAZE_USE_RUNTIME_DISPATCH=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+
+// In case the switch is set to 1, \b Blaze compiles the dense matrix multiplication, the dense
+// matrix/dense vector multiplication, the elementwise addition, subtraction, and multiplication
+// assignment of dense vectors, and the summation and inner product of dense vectors of single
+// and double precision for SSE2, AVX2, and AVX-512. On the first use of one of these kernels,
+// the instruction set is selected via the \c cpuid instruction. All other operations are still
+// vectorized for the instruction set selected at compile time. The selection can be restricted
+// by means of the \c BLAZE_INSTRUCTION_SET environment variable (\c sse2, \c avx2, or
+// \c avx512f), for instance for performance comparisons:
+
+   \code
+   export BLAZE_INSTRUCTION_SET=avx2  // Unix systems
+   \endcode
+
+// Note that the runtime dispatch is currently only available for the GNU and Clang compilers on
+// x86-64 platforms. For all other compilers and platforms the switch has no effect.
+//
+//
 // \n \section sleef Sleef
 // <hr>
 //
@@ -15853,6 +16260,24 @@
 // thread-based parallelization, are contained within the configuration file
 // <tt><blaze/config/Thresholds.h></tt>.
 //
+// The values in the configuration file only represent the default values of the thresholds. All
+// thresholds can also be adjusted at runtime, either individually via the \c setThreshold()
+// function or by means of a threshold profile:
+
+   \code
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 20000UL );  // Adjusting a single threshold
+   blaze::loadThresholds( "machine.thresholds" );               // Loading a threshold profile
+   blaze::resetThresholds();                                    // Restoring the default values
+   \endcode
+
+// A threshold profile is a text file containing one \c NAME \c = \c VALUE pair per line. In
+// case the \c BLAZE_THRESHOLDS environment variable refers to such a profile, it is loaded on
+// program start. Additionally, every threshold can be overridden by an environment variable of
+// the same name prefixed by \c BLAZE_ (as for instance \c BLAZE_SMP_DVECDVECADD_THRESHOLD=20000).
+// The \c calibrate tool of the \b Blaze benchmark suite measures the crossover points of the
+// target platform and creates a matching threshold profile. Note that thresholds must not be
+// changed while another thread executes a \b Blaze operation.
+//
 //
 // \n \section alignment Alignment
 // <hr>
@@ -18444,6 +18869,89 @@
 // must be performed prior to calling this function!
 //
 //
+// \n \subsection lapack_banded_linear_system_solver Linear System Solver for Banded Matrices
+//
+// The following functions provide an interface for the LAPACK functions \c sgbtrf(), \c dgbtrf(),
+// \c cgbtrf(), \c zgbtrf(), \c sgbtrs(), \c dgbtrs(), \c cgbtrs(), and \c zgbtrs(), which compute
+// the LU decomposition of a general banded matrix and solve the according linear system:
+
+   \code
+   namespace blaze {
+
+   void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, float* AB, blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+   void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, double* AB, blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+   void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<float>* AB, blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+   void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<double>* AB, blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+   template< typename Type >
+   void gbtrf( BandedMatrix<Type,columnMajor>& A, blas_int_t* ipiv );
+
+   void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, const float* AB, blas_int_t ldab, const blas_int_t* ipiv, float* B, blas_int_t ldb, blas_int_t* info );
+
+   void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, const double* AB, blas_int_t ldab, const blas_int_t* ipiv, double* B, blas_int_t ldb, blas_int_t* info );
+
+   void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, const complex<float>* AB, blas_int_t ldab, const blas_int_t* ipiv, complex<float>* B, blas_int_t ldb, blas_int_t* info );
+
+   void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs, const complex<double>* AB, blas_int_t ldab, const blas_int_t* ipiv, complex<double>* B, blas_int_t ldb, blas_int_t* info );
+
+   template< typename Type, typename VT, bool TF >
+   void gbtrs( const BandedMatrix<Type,columnMajor>& A, DenseVector<VT,TF>& b, char trans, const blas_int_t* ipiv );
+
+   template< typename Type, typename MT, bool SO >
+   void gbtrs( const BandedMatrix<Type,columnMajor>& A, DenseMatrix<MT,SO>& B, char trans, const blas_int_t* ipiv );
+
+   } // namespace blaze
+   \endcode
+
+// The \c BandedMatrix class template stores a banded matrix in the LAPACK band storage format.
+// Since the LU decomposition requires \f$ kl \f$ additional superdiagonals for the row
+// interchanges, the upper bandwidth of the matrix passed to \c gbtrf() has to be at least as
+// large as its lower bandwidth. The functions \c pbtrf() and \c pbtrs() provide the according
+// Cholesky decomposition and solver for symmetric positive definite (or Hermitian positive
+// definite) banded matrices:
+
+   \code
+   namespace blaze {
+
+   template< typename Type >
+   void pbtrf( BandedMatrix<Type,columnMajor>& A, char uplo );
+
+   template< typename Type, typename VT, bool TF >
+   void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseVector<VT,TF>& b, char uplo );
+
+   template< typename Type, typename MT, bool SO >
+   void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseMatrix<MT,SO>& B, char uplo );
+
+   } // namespace blaze
+   \endcode
+
+// In case the Blaze library is used without LAPACK support (see \c BLAZE_LAPACK_MODE), all four
+// functions fall back to native band kernels. The \c solve() function for banded matrices
+// combines both steps and leaves the given system matrix untouched:
+
+   \code
+   blaze::BandedMatrix<double> A( 1000UL, 1000UL, 2UL, 3UL );  // Two sub-, three superdiagonals
+   blaze::DynamicVector<double> x, b;
+   // ... Initialization
+
+   solve( A, x, b );  // Computes the solution x of A*x=b in O(N*kl*(kl+ku)) operations
+   \endcode
+
+// The functions fail if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a trans argument is neither 'N' nor 'T' nor 'C';
+//  - ... the given \a uplo argument is neither 'L' nor 'U';
+//  - ... the sizes of the system matrix and the right-hand side do not match;
+//  - ... the given system matrix is singular or not positive definite, respectively.
+//
+// The wrapper functions and \c solve() throw a \c std::invalid_argument or a
+// \c std::runtime_error exception in case of an error.
+//
+//
 // \n \section lapack_eigenvalues Eigenvalues/Eigenvectors
 //
 // \subsection lapack_eigenvalues_general General Matrices
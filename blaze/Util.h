@@ -57,6 +57,7 @@
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Indices.h>
 #include <blaze/util/InitializerList.h>
+#include <blaze/util/InstructionSet.h>
 #include <blaze/util/IntegerSequence.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
@@ -86,5 +87,6 @@
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/WorkStealingPool.h>
 
 #endif
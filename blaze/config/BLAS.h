@@ -232,3 +232,41 @@
 #define BLAZE_BLAS_INCLUDE_FILE <cblas.h>
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK mode.
+// \ingroup config
+//
+// This compilation switch enables/disables the LAPACK mode. In case the LAPACK mode is enabled,
+// the dense matrix decompositions (lu(), llh(), qr(), lq()) as well as the functions based on them
+// (as for instance inv(), det(), and solve()) are handled by the according LAPACK functions.
+// Note that in this case it is mandatory to link a fitting LAPACK library to the executable.
+// In case the LAPACK mode is disabled, the LU, Cholesky, QR, and LQ decompositions are computed by
+// the native, cache-blocked implementations of the Blaze library and LAPACK is not required
+// for these functions. The same holds for the eigenvalues and eigenvectors of symmetric and
+// Hermitian matrices (eigen()) and for the singular value decomposition (svd()).
+//
+// Possible settings for the LAPACK switch:
+//  - Disabled: \b 0
+//  - Enabled : \b 1 (default)
+//
+// \warning Changing the setting of the LAPACK mode requires a recompilation of all code using
+// the Blaze library!
+//
+// \note It is possible to (de-)activate the LAPACK mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_LAPACK_MODE=0 ...
+   \endcode
+
+   \code
+   #define BLAZE_LAPACK_MODE 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_LAPACK_MODE
+#define BLAZE_LAPACK_MODE 1
+#endif
+//*************************************************************************************************
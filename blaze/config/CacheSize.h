@@ -59,3 +59,32 @@
 #define BLAZE_CACHE_SIZE 3145728UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cache line size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of a single cache line in Byte of the used target architecture.
+// The shared-memory parallelization uses this setting to align the boundaries of the parts of
+// a parallel operation to cache lines in order to avoid false sharing between threads.
+//
+// The cache line size must be a power of two in the range \f$[16..1024]\f$. The default setting
+// is 64, which corresponds to the cache line size of most x86-64 and ARM architectures.
+//
+// \note It is possible to specify the cache line size via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_CACHE_LINE_SIZE=128 ...
+   \endcode
+
+   \code
+   #define BLAZE_CACHE_LINE_SIZE 128UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_CACHE_LINE_SIZE
+#define BLAZE_CACHE_LINE_SIZE 64UL
+#endif
+//*************************************************************************************************
@@ -167,3 +167,44 @@
 #define BLAZE_USE_DEFAULT_INITIALIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the Strassen-Winograd matrix multiplication.
+// \ingroup config
+//
+// This configuration switch enables/disables the Strassen-Winograd recursion for the
+// multiplication of large row-major dense matrices. In case the switch is set to 1, every
+// dense matrix/dense matrix multiplication of \c float, \c double, \c complex<float>, or
+// \c complex<double> matrices whose smallest dimension is equal or higher than the
+// BLAZE_STRASSEN_THRESHOLD (see <tt>./blaze/config/Thresholds.h</tt>) is split into seven
+// half-size products instead of eight, which reduces the number of floating point operations
+// by up to 12.5% per level of recursion. In case the switch is set to 0, the classical
+// algorithm is used for all sizes.
+//
+// Possible settings for the Strassen-Winograd multiplication:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \warning The Strassen-Winograd algorithm only satisfies a normwise error bound (see the
+// \ref matrix_strassen_product section of the tutorial), but not the componentwise error
+// bound of the classical algorithm. Therefore small elements of the result may be computed
+// with a considerably larger relative error. Additionally, every level of recursion requires
+// temporary memory for two quarter-size matrices.
+//
+// \note It is possible to (de-)activate the Strassen-Winograd multiplication via command line
+// or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_STRASSEN=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_STRASSEN 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_STRASSEN
+#define BLAZE_USE_STRASSEN 0
+#endif
+//*************************************************************************************************
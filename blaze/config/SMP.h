@@ -62,3 +62,177 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing scheduler of the C++11/Boost thread backend.
+// \ingroup config
+//
+// This compilation switch selects the scheduler of the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 0, all tasks are scheduled via a single, shared
+// task queue (see the ThreadPool class template). In case the switch is set to 1, every thread
+// owns a separate task queue and idle threads steal tasks from randomly selected threads (see
+// the WorkStealingPool class template). The work-stealing scheduler reduces the contention on
+// systems with many cores and automatically rebalances the workload in case individual threads
+// are slowed down. Note that this setting has no effect on the OpenMP and HPX parallelization.
+//
+// Possible settings for the work-stealing switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the work-stealing scheduler via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_WORK_STEALING=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_WORK_STEALING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_WORK_STEALING
+#define BLAZE_USE_WORK_STEALING 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of tasks per thread for the work-stealing scheduler.
+// \ingroup config
+//
+// This setting specifies into how many tasks per thread a single SMP assignment is split in
+// case the work-stealing scheduler is active (see the \c BLAZE_USE_WORK_STEALING switch). A
+// value larger than 1 results in smaller tasks, which enables idle threads to take over work
+// from slow threads. Note that this setting has no effect in case the work-stealing scheduler
+// is not active.
+//
+// The default setting for this value is 4. Note that the value must be in the range
+// \f$[1..\infty)\f$.
+//
+// \note It is possible to specify this value via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_WORK_STEALING_TASKS_PER_THREAD=4 ...
+   \endcode
+
+   \code
+   #define BLAZE_WORK_STEALING_TASKS_PER_THREAD 4UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_WORK_STEALING_TASKS_PER_THREAD
+#define BLAZE_WORK_STEALING_TASKS_PER_THREAD 4UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the padding-aware partitioning of parallel dense matrix operations.
+// \ingroup config
+//
+// All parallel assignments to dense vectors and matrices align the boundaries of the individual
+// parts to cache lines (see \c BLAZE_CACHE_LINE_SIZE in <tt><blaze/config/CacheSize.h></tt>).
+// Within a single row of a row-major matrix (or a single column of a column-major matrix) this
+// is always possible. However, in case the spacing between two rows (columns) is not a multiple
+// of the cache line size, i.e. in case the matrix is not sufficiently padded, a 2D partitioning
+// of the matrix inevitably results in cache lines that are split between several threads. In
+// case this switch is set to 1, dense matrices of this kind are only partitioned along their
+// rows (row-major) or columns (column-major), which avoids split cache lines entirely at the
+// cost of a less balanced partitioning. This setting affects the C++11, Boost, OpenMP, and HPX
+// parallelization.
+//
+// Possible settings for the padding-aware partitioning switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the padding-aware partitioning via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_PADDING_AWARE_PARTITIONING=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_PADDING_AWARE_PARTITIONING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_PADDING_AWARE_PARTITIONING
+#define BLAZE_USE_PADDING_AWARE_PARTITIONING 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Spin budget of the C++11/Boost thread backend.
+// \ingroup config
+//
+// This setting specifies the number of spin iterations of an idle thread of the C++11 and Boost
+// thread-based parallelization before it is parked on a condition variable. The same budget is
+// used by the thread that waits for the completion of an SMP assignment. In case the setting is
+// 0, threads are immediately parked. Spinning considerably reduces the latency of short SMP
+// assignments, which in turn allows to lower the SMP thresholds, but consumes CPU time while
+// threads are idle. Note that the default value can be overridden at runtime via the
+// \c BLAZE_SPIN_COUNT environment variable and that this setting has no effect on the OpenMP
+// and HPX parallelization.
+//
+// The default setting for this value is 0.
+//
+// \note It is possible to specify this value via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_THREAD_SPIN_COUNT=10000 ...
+   \endcode
+
+   \code
+   #define BLAZE_THREAD_SPIN_COUNT 10000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_THREAD_SPIN_COUNT
+#define BLAZE_THREAD_SPIN_COUNT 0UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA mode of the C++11/Boost thread backend.
+// \ingroup config
+//
+// This compilation switch (de-)activates the NUMA mode of the C++11 and Boost thread-based
+// parallelization. In NUMA mode all threads of the thread pool are bound to logical CPUs, the
+// tasks of an SMP assignment are always assigned to the same threads in the same order, and
+// the elements of large dense matrices and vectors are initialized in parallel with the same
+// partitioning as the subsequent SMP assignments. Since the operating system places memory
+// pages on the NUMA node of the thread that touches them first, every thread primarily works
+// on memory local to its own NUMA node. By default the threads are bound to the logical CPUs
+// 0, 1, 2, ... in ascending order. The order can be specified at runtime via the
+// \c BLAZE_CPU_AFFINITY environment variable (e.g. "0-7,16-23"). Note that the NUMA mode
+// implies the work-stealing scheduler (see \c BLAZE_USE_WORK_STEALING), that thread binding
+// is only supported on Linux systems, and that this setting has no effect on the OpenMP and
+// HPX parallelization (which provide their own means to bind threads).
+//
+// Possible settings for the NUMA switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the NUMA mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_NUMA=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_NUMA 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_NUMA
+#define BLAZE_USE_NUMA 0
+#endif
+//*************************************************************************************************
@@ -423,6 +423,40 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Strassen-Winograd dense matrix/dense matrix multiplication threshold.
+// \ingroup config
+//
+// This setting specifies the cutoff of the Strassen-Winograd recursion for row-major dense
+// matrix/row-major dense matrix multiplications (see the BLAZE_USE_STRASSEN switch in
+// <tt>./blaze/config/Optimizations.h</tt>). In case the smallest of the three dimensions of a
+// multiplication (i.e. the number of rows of the left-hand side operand, the number of columns
+// of the left-hand side operand, and the number of columns of the right-hand side operand) is
+// equal or higher than this value, one level of the Strassen-Winograd recursion is applied. In
+// case the smallest dimension is smaller, the classical kernel (i.e. the packed kernel or BLAS)
+// is used.
+//
+// The default setting for this threshold is 2048. Note that in case the Blaze debug mode is
+// active, this threshold will be replaced by the blaze::STRASSEN_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_STRASSEN_THRESHOLD=2048 ...
+   \endcode
+
+   \code
+   #define BLAZE_STRASSEN_THRESHOLD 2048UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_STRASSEN_THRESHOLD
+#define BLAZE_STRASSEN_THRESHOLD 2048UL
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2276,3 +2310,305 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense vector (as for instance sum(),
+// prod(), min() or max()) can be executed in parallel. In case the number of elements of the
+// dense vector is larger or equal to this threshold, the reduction is executed in parallel. If
+// the number of elements is below this threshold the reduction is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DVECREDUCE_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector norm threshold.
+// \ingroup config
+//
+// This threshold specifies when the computation of a norm of a dense vector (as for instance
+// norm(), sqrNorm(), l1Norm() or lpNorm()) can be executed in parallel. In case the number of
+// elements of the dense vector is larger or equal to this threshold, the norm is computed in
+// parallel. If the number of elements is below this threshold the norm is computed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DVECNORM_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DVECNORM_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECNORM_THRESHOLD
+#define BLAZE_SMP_DVECNORM_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector inner product (scalar product) can
+// be executed in parallel. In case the number of elements of the dense vectors is larger or equal
+// to this threshold, the inner product is executed in parallel. If the number of elements is
+// below this threshold the inner product is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DVECDVECINNER_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense matrix (as for instance sum(),
+// prod(), min() or max()) can be executed in parallel. In case the number of elements of the
+// dense matrix is larger or equal to this threshold, the reduction is executed in parallel. If
+// the number of elements is below this threshold the reduction is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DMATFULLREDUCE_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DMATFULLREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATFULLREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATFULLREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP compressed matrix assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment to a compressed matrix can be executed in parallel.
+// In case the number of elements to be processed (i.e. all elements of a dense right-hand side
+// operand or the non-zero elements of a sparse right-hand side operand) is larger or equal to
+// this threshold, the right-hand side operand is evaluated in parallel and the rows (or columns)
+// of the compressed matrix are filled concurrently. If the number of elements is below this
+// threshold the assignment is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SMATASSIGN_THRESHOLD=48400 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SMATASSIGN_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSIGN_THRESHOLD
+#define BLAZE_SMP_SMATASSIGN_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP compressed vector assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment to a compressed vector can be executed in parallel.
+// In case the number of elements to be processed (i.e. all elements of a dense right-hand side
+// operand or the non-zero elements of a sparse right-hand side operand) is larger or equal to
+// this threshold, the right-hand side operand is evaluated in parallel. If the number of elements
+// is below this threshold the assignment is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_SVECASSIGN_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_SVECASSIGN_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SVECASSIGN_THRESHOLD
+#define BLAZE_SMP_SVECASSIGN_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when an operation on a MatrixBatch or VectorBatch (i.e. a batched
+// multiplication, inversion, determinant computation, or solution of linear systems) can be
+// executed in parallel. In case the number of matrices in the batch is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of matrices is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 4096. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_BATCH_THRESHOLD=4096 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_BATCH_THRESHOLD 4096UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BATCH_THRESHOLD
+#define BLAZE_SMP_BATCH_THRESHOLD 4096UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP matrix-free Kronecker product multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when the batch of small matrix multiplications of a matrix-free
+// Kronecker product multiplication (as for instance \f$ \vec{y}=(A \otimes B \otimes C)*\vec{x}
+// \f$) can be executed in parallel. In case the number of elements computed by the batch is
+// larger or equal to this threshold, the multiplications of the batch are executed in parallel.
+// If the number of elements is below this threshold the batch is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 3025. In case the threshold is set to 0, the batch
+// is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_KRONMULT_THRESHOLD=3025 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_KRONMULT_THRESHOLD 3025UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_KRONMULT_THRESHOLD
+#define BLAZE_SMP_KRONMULT_THRESHOLD 3025UL
+#endif
+//*************************************************************************************************
@@ -129,3 +129,43 @@
 #define BLAZE_USE_XSIMD 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of the SIMD kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime selection of the instruction set for
+// the performance critical kernels. In case the switch is set to 1, Blaze compiles the dense
+// matrix multiplication, the dense matrix/dense vector multiplication, the elementwise addition,
+// subtraction and multiplication assignment of dense vectors, and the summation and the inner
+// product of dense vectors of single and double precision several times (for SSE2, AVX2, and
+// AVX-512). On the first use the widest instruction set supported by the executing CPU is
+// selected (see blaze::getInstructionSet()). Thus a single binary, for instance compiled for
+// AVX2, is able to exploit AVX-512 on machines that support it. All remaining operations are
+// still vectorized based on the instruction set selected at compile time. In case the switch
+// is set to 0, the instruction set is exclusively selected at compile time.
+//
+// The runtime dispatch is only available for the GNU and Clang compilers on x86-64 platforms.
+// On all other platforms the switch has no effect.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the runtime dispatch via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_RUNTIME_DISPATCH=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
@@ -112,6 +112,8 @@
 #include <blaze/math/expressions/DMatTSMatSubExpr.h>
 #include <blaze/math/expressions/DMatVarExpr.h>
 #include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/KronDMatMultExpr.h>
+#include <blaze/math/expressions/KronDVecMultExpr.h>
 #include <blaze/math/expressions/SMatDMatMultExpr.h>
 #include <blaze/math/expressions/SMatDMatSubExpr.h>
 #include <blaze/math/expressions/SMatTDMatMultExpr.h>
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/gbtrf.h>
+#include <blaze/math/lapack/gbtrs.h>
 #include <blaze/math/lapack/geev.h>
 #include <blaze/math/lapack/gelqf.h>
 #include <blaze/math/lapack/geqlf.h>
@@ -73,6 +75,8 @@
 #include <blaze/math/lapack/ormql.h>
 #include <blaze/math/lapack/ormqr.h>
 #include <blaze/math/lapack/ormrq.h>
+#include <blaze/math/lapack/pbtrf.h>
+#include <blaze/math/lapack/pbtrs.h>
 #include <blaze/math/lapack/posv.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
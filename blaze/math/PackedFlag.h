@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedFlag.h
+//  \brief Header file for the packed storage flags
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_PACKEDFLAG_H_
+#define _BLAZE_MATH_PACKEDFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Packed storage flag.
+// \ingroup math
+//
+// The PackedFlag type enumeration represents the different structures of square matrices that
+// can be stored in packed format by means of the PackedMatrix class template. In packed format
+// only one triangular half of the matrix is stored, which halves the memory requirements and
+// the memory bandwidth of all operations on the matrix. The following flags are available:
+//
+//  - \c packedSymmetric: The matrix is symmetric; only the lower part is stored.
+//  - \c packedHermitian: The matrix is Hermitian; only the lower part is stored.
+//  - \c packedLower: The matrix is lower triangular; only the lower part is stored.
+//  - \c packedUpper: The matrix is upper triangular; only the upper part is stored.
+*/
+enum PackedFlag
+{
+   packedSymmetric = 0,  //!< Flag for packed symmetric matrices.
+   packedHermitian = 1,  //!< Flag for packed Hermitian matrices.
+   packedLower     = 2,  //!< Flag for packed lower triangular matrices.
+   packedUpper     = 3   //!< Flag for packed upper triangular matrices.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
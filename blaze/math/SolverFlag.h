@@ -0,0 +1,74 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SolverFlag.h
+//  \brief Header file for the dense linear system solver flags
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERFLAG_H_
+#define _BLAZE_MATH_SOLVERFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SOLVER FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solver flag.
+// \ingroup math
+//
+// The SolverFlag type enumeration represents the different types of mixed precision solvers for
+// dense linear systems of equations that are available within the Blaze library. Both solvers
+// decompose the system matrix in single precision and subsequently refine the solution by means
+// of iterative refinement in the working precision. The following flags are available:
+//
+//  - \c byMixedLU: The mixed precision solver for general square systems. It uses the LU
+//          algorithm to decompose the system matrix in single precision (\f$ A = P L U \f$).
+//  - \c byMixedLLH: The mixed precision solver for Hermitian positive definite systems. It uses
+//          the Cholesky algorithm to decompose the system matrix in single precision
+//          (\f$ A = L L^H \f$).
+//
+// In case the iterative refinement does not converge, the system is solved again in the working
+// precision.
+*/
+enum SolverFlag
+{
+   byMixedLU  = 0,  //!< Flag for the mixed precision LU-based solver.
+   byMixedLLH = 1   //!< Flag for the mixed precision Cholesky-based solver for positive-definite matrices.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -51,6 +51,7 @@
 #include <blaze/math/expressions/DMatSMatSchurExpr.h>
 #include <blaze/math/expressions/DMatTSMatSchurExpr.h>
 #include <blaze/math/expressions/DVecSVecOuterExpr.h>
+#include <blaze/math/expressions/KronDVecMultExpr.h>
 #include <blaze/math/expressions/SMatDeclDiagExpr.h>
 #include <blaze/math/expressions/SMatDeclHermExpr.h>
 #include <blaze/math/expressions/SMatDeclLowExpr.h>
@@ -0,0 +1,550 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Thresholds.h
+//  \brief Runtime configuration of the kernel and SMP thresholds.
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_THRESHOLDS_H_
+#define _BLAZE_MATH_THRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THRESHOLD TABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Entry of the table of all runtime thresholds.
+// \ingroup math
+*/
+struct ThresholdEntry
+{
+   const char* name;          //!< The name of the threshold.
+   size_t*     value;         //!< Pointer to the current value of the threshold.
+   size_t      defaultValue;  //!< The default value of the threshold.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of all runtime thresholds.
+// \ingroup math
+//
+// The table is implemented as class template to allow its definition in a header file (see
+// the RuntimeThresholds class template). The number of runtime thresholds is derived from the
+// size of the table.
+*/
+template< typename T >
+struct ThresholdTable
+{
+   static constexpr ThresholdEntry entries[] = {
+      { "DMATDVECMULT_THRESHOLD",       &DMATDVECMULT_THRESHOLD,       DMATDVECMULT_DEFAULT_THRESHOLD },
+      { "TDMATDVECMULT_THRESHOLD",      &TDMATDVECMULT_THRESHOLD,      TDMATDVECMULT_DEFAULT_THRESHOLD },
+      { "TDVECDMATMULT_THRESHOLD",      &TDVECDMATMULT_THRESHOLD,      TDVECDMATMULT_DEFAULT_THRESHOLD },
+      { "TDVECTDMATMULT_THRESHOLD",     &TDVECTDMATMULT_THRESHOLD,     TDVECTDMATMULT_DEFAULT_THRESHOLD },
+      { "DMATDMATMULT_THRESHOLD",       &DMATDMATMULT_THRESHOLD,       DMATDMATMULT_DEFAULT_THRESHOLD },
+      { "DMATTDMATMULT_THRESHOLD",      &DMATTDMATMULT_THRESHOLD,      DMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "TDMATDMATMULT_THRESHOLD",      &TDMATDMATMULT_THRESHOLD,      TDMATDMATMULT_DEFAULT_THRESHOLD },
+      { "TDMATTDMATMULT_THRESHOLD",     &TDMATTDMATMULT_THRESHOLD,     TDMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "DMATSMATMULT_THRESHOLD",       &DMATSMATMULT_THRESHOLD,       DMATSMATMULT_DEFAULT_THRESHOLD },
+      { "TDMATSMATMULT_THRESHOLD",      &TDMATSMATMULT_THRESHOLD,      TDMATSMATMULT_DEFAULT_THRESHOLD },
+      { "TSMATDMATMULT_THRESHOLD",      &TSMATDMATMULT_THRESHOLD,      TSMATDMATMULT_DEFAULT_THRESHOLD },
+      { "TSMATTDMATMULT_THRESHOLD",     &TSMATTDMATMULT_THRESHOLD,     TSMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "STRASSEN_THRESHOLD",           &STRASSEN_THRESHOLD,           STRASSEN_DEFAULT_THRESHOLD },
+      { "SMP_DVECASSIGN_THRESHOLD",     &SMP_DVECASSIGN_THRESHOLD,     SMP_DVECASSIGN_DEFAULT_THRESHOLD },
+      { "SMP_DVECSCALARMULT_THRESHOLD", &SMP_DVECSCALARMULT_THRESHOLD, SMP_DVECSCALARMULT_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECADD_THRESHOLD",    &SMP_DVECDVECADD_THRESHOLD,    SMP_DVECDVECADD_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECSUB_THRESHOLD",    &SMP_DVECDVECSUB_THRESHOLD,    SMP_DVECDVECSUB_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECMULT_THRESHOLD",   &SMP_DVECDVECMULT_THRESHOLD,   SMP_DVECDVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECDIV_THRESHOLD",    &SMP_DVECDVECDIV_THRESHOLD,    SMP_DVECDVECDIV_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECOUTER_THRESHOLD",  &SMP_DVECDVECOUTER_THRESHOLD,  SMP_DVECDVECOUTER_DEFAULT_THRESHOLD },
+      { "SMP_DMATDVECMULT_THRESHOLD",   &SMP_DMATDVECMULT_THRESHOLD,   SMP_DMATDVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATDVECMULT_THRESHOLD",  &SMP_TDMATDVECMULT_THRESHOLD,  SMP_TDMATDVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDVECDMATMULT_THRESHOLD",  &SMP_TDVECDMATMULT_THRESHOLD,  SMP_TDVECDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDVECTDMATMULT_THRESHOLD", &SMP_TDVECTDMATMULT_THRESHOLD, SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATSVECMULT_THRESHOLD",   &SMP_DMATSVECMULT_THRESHOLD,   SMP_DMATSVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATSVECMULT_THRESHOLD",  &SMP_TDMATSVECMULT_THRESHOLD,  SMP_TDMATSVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSVECDMATMULT_THRESHOLD",  &SMP_TSVECDMATMULT_THRESHOLD,  SMP_TSVECDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSVECTDMATMULT_THRESHOLD", &SMP_TSVECTDMATMULT_THRESHOLD, SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATDVECMULT_THRESHOLD",   &SMP_SMATDVECMULT_THRESHOLD,   SMP_SMATDVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATDVECMULT_THRESHOLD",  &SMP_TSMATDVECMULT_THRESHOLD,  SMP_TSMATDVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDVECSMATMULT_THRESHOLD",  &SMP_TDVECSMATMULT_THRESHOLD,  SMP_TDVECSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDVECTSMATMULT_THRESHOLD", &SMP_TDVECTSMATMULT_THRESHOLD, SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATSVECMULT_THRESHOLD",   &SMP_SMATSVECMULT_THRESHOLD,   SMP_SMATSVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATSVECMULT_THRESHOLD",  &SMP_TSMATSVECMULT_THRESHOLD,  SMP_TSMATSVECMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSVECSMATMULT_THRESHOLD",  &SMP_TSVECSMATMULT_THRESHOLD,  SMP_TSVECSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSVECTSMATMULT_THRESHOLD", &SMP_TSVECTSMATMULT_THRESHOLD, SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATASSIGN_THRESHOLD",     &SMP_DMATASSIGN_THRESHOLD,     SMP_DMATASSIGN_DEFAULT_THRESHOLD },
+      { "SMP_DMATSCALARMULT_THRESHOLD", &SMP_DMATSCALARMULT_THRESHOLD, SMP_DMATSCALARMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATDMATADD_THRESHOLD",    &SMP_DMATDMATADD_THRESHOLD,    SMP_DMATDMATADD_DEFAULT_THRESHOLD },
+      { "SMP_DMATTDMATADD_THRESHOLD",   &SMP_DMATTDMATADD_THRESHOLD,   SMP_DMATTDMATADD_DEFAULT_THRESHOLD },
+      { "SMP_DMATDMATSUB_THRESHOLD",    &SMP_DMATDMATSUB_THRESHOLD,    SMP_DMATDMATSUB_DEFAULT_THRESHOLD },
+      { "SMP_DMATTDMATSUB_THRESHOLD",   &SMP_DMATTDMATSUB_THRESHOLD,   SMP_DMATTDMATSUB_DEFAULT_THRESHOLD },
+      { "SMP_DMATDMATSCHUR_THRESHOLD",  &SMP_DMATDMATSCHUR_THRESHOLD,  SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD },
+      { "SMP_DMATTDMATSCHUR_THRESHOLD", &SMP_DMATTDMATSCHUR_THRESHOLD, SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD },
+      { "SMP_DMATDMATMULT_THRESHOLD",   &SMP_DMATDMATMULT_THRESHOLD,   SMP_DMATDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATTDMATMULT_THRESHOLD",  &SMP_DMATTDMATMULT_THRESHOLD,  SMP_DMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATDMATMULT_THRESHOLD",  &SMP_TDMATDMATMULT_THRESHOLD,  SMP_TDMATDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATTDMATMULT_THRESHOLD", &SMP_TDMATTDMATMULT_THRESHOLD, SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATSMATMULT_THRESHOLD",   &SMP_DMATSMATMULT_THRESHOLD,   SMP_DMATSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATTSMATMULT_THRESHOLD",  &SMP_DMATTSMATMULT_THRESHOLD,  SMP_DMATTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATSMATMULT_THRESHOLD",  &SMP_TDMATSMATMULT_THRESHOLD,  SMP_TDMATSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TDMATTSMATMULT_THRESHOLD", &SMP_TDMATTSMATMULT_THRESHOLD, SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATDMATMULT_THRESHOLD",   &SMP_SMATDMATMULT_THRESHOLD,   SMP_SMATDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATTDMATMULT_THRESHOLD",  &SMP_SMATTDMATMULT_THRESHOLD,  SMP_SMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATDMATMULT_THRESHOLD",  &SMP_TSMATDMATMULT_THRESHOLD,  SMP_TSMATDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATTDMATMULT_THRESHOLD", &SMP_TSMATTDMATMULT_THRESHOLD, SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATSMATMULT_THRESHOLD",   &SMP_SMATSMATMULT_THRESHOLD,   SMP_SMATSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_SMATTSMATMULT_THRESHOLD",  &SMP_SMATTSMATMULT_THRESHOLD,  SMP_SMATTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATSMATMULT_THRESHOLD",  &SMP_TSMATSMATMULT_THRESHOLD,  SMP_TSMATSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_TSMATTSMATMULT_THRESHOLD", &SMP_TSMATTSMATMULT_THRESHOLD, SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD },
+      { "SMP_DMATREDUCE_THRESHOLD",     &SMP_DMATREDUCE_THRESHOLD,     SMP_DMATREDUCE_DEFAULT_THRESHOLD },
+      { "SMP_SMATREDUCE_THRESHOLD",     &SMP_SMATREDUCE_THRESHOLD,     SMP_SMATREDUCE_DEFAULT_THRESHOLD },
+      { "SMP_DVECREDUCE_THRESHOLD",     &SMP_DVECREDUCE_THRESHOLD,     SMP_DVECREDUCE_DEFAULT_THRESHOLD },
+      { "SMP_DVECNORM_THRESHOLD",       &SMP_DVECNORM_THRESHOLD,       SMP_DVECNORM_DEFAULT_THRESHOLD },
+      { "SMP_DVECDVECINNER_THRESHOLD",  &SMP_DVECDVECINNER_THRESHOLD,  SMP_DVECDVECINNER_DEFAULT_THRESHOLD },
+      { "SMP_DMATFULLREDUCE_THRESHOLD", &SMP_DMATFULLREDUCE_THRESHOLD, SMP_DMATFULLREDUCE_DEFAULT_THRESHOLD },
+      { "SMP_SMATASSIGN_THRESHOLD",     &SMP_SMATASSIGN_THRESHOLD,     SMP_SMATASSIGN_DEFAULT_THRESHOLD },
+      { "SMP_SVECASSIGN_THRESHOLD",     &SMP_SVECASSIGN_THRESHOLD,     SMP_SVECASSIGN_DEFAULT_THRESHOLD },
+      { "SMP_BATCH_THRESHOLD",          &SMP_BATCH_THRESHOLD,          SMP_BATCH_DEFAULT_THRESHOLD },
+      { "SMP_KRONMULT_THRESHOLD",       &SMP_KRONMULT_THRESHOLD,       SMP_KRONMULT_DEFAULT_THRESHOLD }
+   
+   };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+constexpr ThresholdEntry ThresholdTable<T>::entries[];
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of runtime thresholds.
+// \ingroup math
+//
+// \return The number of runtime thresholds.
+*/
+constexpr size_t thresholdCount() noexcept
+{
+   return sizeof( ThresholdTable<int>::entries ) / sizeof( ThresholdEntry );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of all runtime thresholds.
+// \ingroup math
+//
+// \return Pointer to the first entry of the threshold table.
+*/
+inline const ThresholdEntry* thresholdTable()
+{
+   return ThresholdTable<int>::entries;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches the threshold with the given name.
+// \ingroup math
+//
+// \param name The name of the threshold.
+// \return Pointer to the table entry of the threshold, \c nullptr if the threshold does not exist.
+*/
+inline const ThresholdEntry* findThreshold( const std::string& name )
+{
+   const ThresholdEntry* table( thresholdTable() );
+
+   for( size_t i=0UL; i<thresholdCount(); ++i ) {
+      if( name == table[i].name )
+         return table + i;
+   }
+
+   return nullptr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Threshold functions */
+//@{
+inline size_t getThreshold( const std::string& name );
+inline void setThreshold( const std::string& name, size_t value );
+inline void resetThreshold( const std::string& name );
+inline void resetThresholds();
+inline void loadThresholds( const std::string& filename );
+inline void saveThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup math
+//
+// \param name The name of the threshold (e.g. \c "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function returns the current value of the threshold with the given name. The name of a
+// threshold corresponds to the name of the according config switch without the \c BLAZE_ prefix
+// (see the <tt>./blaze/config/Thresholds.h</tt> configuration file). In case no threshold with
+// the given name exists, a \a std::invalid_argument exception is thrown.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   const ThresholdEntry* entry( findThreshold( name ) );
+
+   if( entry == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold name" );
+   }
+
+   return *entry->value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the given threshold.
+// \ingroup math
+//
+// \param name The name of the threshold (e.g. \c "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function changes the value of the threshold with the given name at runtime. The new
+// value is used by all subsequent operations:
+
+   \code
+   // Executing all dense vector assignments with at least 10000 elements in parallel
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 10000UL );
+   \endcode
+
+// In case no threshold with the given name exists or in case the given value is 0, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note This function must not be called while a Blaze operation is executed by another thread.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   const ThresholdEntry* entry( findThreshold( name ) );
+
+   if( entry == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold name" );
+   }
+
+   if( value == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   *entry->value = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given threshold to its default value.
+// \ingroup math
+//
+// \param name The name of the threshold (e.g. \c "SMP_DVECASSIGN_THRESHOLD").
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function resets the threshold with the given name to its compile time default (see the
+// <tt>./blaze/config/Thresholds.h</tt> configuration file).
+//
+// \note This function must not be called while a Blaze operation is executed by another thread.
+*/
+inline void resetThreshold( const std::string& name )
+{
+   const ThresholdEntry* entry( findThreshold( name ) );
+
+   if( entry == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold name" );
+   }
+
+   *entry->value = entry->defaultValue;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting all thresholds to their default values.
+// \ingroup math
+//
+// \return void
+//
+// \note This function must not be called while a Blaze operation is executed by another thread.
+*/
+inline void resetThresholds()
+{
+   const ThresholdEntry* table( thresholdTable() );
+
+   for( size_t i=0UL; i<thresholdCount(); ++i ) {
+      *table[i].value = table[i].defaultValue;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading a threshold profile from the given file.
+// \ingroup math
+//
+// \param filename The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Unable to open threshold profile.
+// \exception std::runtime_error Invalid threshold profile.
+//
+// This function reads the values of a set of thresholds from the given threshold profile. A
+// threshold profile is a text file that contains one threshold per line. Each line consists of
+// the name of a threshold and its value, optionally separated by an equal sign. Empty lines and
+// everything following a \c # is ignored:
+
+   \code
+   # Threshold profile for a 16-core machine
+   SMP_DVECASSIGN_THRESHOLD = 48000
+   SMP_DMATDMATMULT_THRESHOLD = 2500
+   \endcode
+
+// All thresholds that are not mentioned in the profile retain their current value. In case the
+// file cannot be opened or in case the file contains an invalid line, a \a std::runtime_error
+// exception is thrown. In this case none of the thresholds is changed. Threshold profiles can
+// be created by saveThresholds() or by the \c calibrate tool of the Blaze benchmark suite.
+//
+// \note This function must not be called while a Blaze operation is executed by another thread.
+*/
+inline void loadThresholds( const std::string& filename )
+{
+   std::ifstream file( filename.c_str() );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to open threshold profile" );
+   }
+
+   size_t values[thresholdCount()];
+   bool   changed[thresholdCount()] = {};
+
+   std::string line;
+
+   while( std::getline( file, line ) )
+   {
+      const std::string::size_type comment( line.find( '#' ) );
+      if( comment != std::string::npos )
+         line.erase( comment );
+
+      for( char& c : line ) {
+         if( c == '=' ) c = ' ';
+      }
+
+      std::istringstream iss( line );
+      std::string name, rest;
+      long long value( 0LL );
+
+      if( !( iss >> name ) )
+         continue;
+
+      const ThresholdEntry* entry( findThreshold( name ) );
+
+      if( entry == nullptr || !( iss >> value ) || value <= 0LL || ( iss >> rest ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid threshold profile" );
+      }
+
+      const size_t index( static_cast<size_t>( entry - thresholdTable() ) );
+      values [index] = static_cast<size_t>( value );
+      changed[index] = true;
+   }
+
+   const ThresholdEntry* table( thresholdTable() );
+
+   for( size_t i=0UL; i<thresholdCount(); ++i ) {
+      if( changed[i] )
+         *table[i].value = values[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Saving the current values of all thresholds to the given file.
+// \ingroup math
+//
+// \param filename The name of the threshold profile.
+// \return void
+// \exception std::runtime_error Unable to write threshold profile.
+//
+// This function writes the current values of all thresholds to the given file. The resulting
+// threshold profile can be loaded via the loadThresholds() function or via the \c BLAZE_THRESHOLDS
+// environment variable.
+*/
+inline void saveThresholds( const std::string& filename )
+{
+   std::ofstream file( filename.c_str() );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write threshold profile" );
+   }
+
+   const ThresholdEntry* table( thresholdTable() );
+
+   for( size_t i=0UL; i<thresholdCount(); ++i ) {
+      file << table[i].name << " = " << *table[i].value << "\n";
+   }
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unable to write threshold profile" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ENVIRONMENT CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the thresholds from the environment.
+// \ingroup math
+//
+// \return \a true after the thresholds have been initialized.
+//
+// This function adjusts the thresholds according to the environment of the process. In case the
+// \c BLAZE_THRESHOLDS environment variable is defined, the threshold profile it refers to is
+// loaded (see loadThresholds()). Afterwards every threshold can be individually overridden by
+// an environment variable consisting of the \c BLAZE_ prefix and the name of the threshold (as
+// for instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD=48000). Invalid profiles and invalid values are
+// ignored. The initialization is performed only once per process.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline bool initThresholds()
+{
+   static const bool initialized = []()
+   {
+      const char* profile = std::getenv( "BLAZE_THRESHOLDS" );
+
+      if( profile != nullptr && std::strlen( profile ) > 0UL ) {
+         try {
+            loadThresholds( profile );
+         }
+         catch( const std::exception& ) {}
+      }
+
+      const ThresholdEntry* table( thresholdTable() );
+
+      for( size_t i=0UL; i<thresholdCount(); ++i )
+      {
+         const std::string variable( std::string( "BLAZE_" ) + table[i].name );
+         const char* env = std::getenv( variable.c_str() );
+
+         if( env == nullptr )
+            continue;
+
+         char* end( nullptr );
+         const long long value( std::strtoll( env, &end, 10 ) );
+
+         if( end != env && *end == '\0' && value > 0LL )
+            *table[i].value = static_cast<size_t>( value );
+      }
+
+      return true;
+   }();
+
+   return initialized;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool thresholdsInitialized = initThresholds();
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1492 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandedMatrix.h
+//  \brief Header file for the implementation of band matrices
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/lapack/clapack/gbtrf.h>
+#include <blaze/math/lapack/clapack/gbtrs.h>
+#include <blaze/math/lapack/native/gbtrf.h>
+#include <blaze/math/lapack/native/gbtrs.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief General matrix in band storage.
+// \ingroup dense_matrix
+//
+// The BandedMatrix class template represents a general \f$ M \times N \f$ matrix, whose non-zero
+// elements are restricted to a band of \a kl subdiagonals and \a ku superdiagonals around the
+// diagonal. In contrast to a dense matrix, which stores all \f$ M \cdot N \f$ elements, and to a
+// sparse matrix, which stores an index for every non-zero element, a BandedMatrix stores only the
+// \f$ kl+ku+1 \f$ diagonals of the band contiguously. The type of the elements and the storage
+// order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandedMatrix can be used with any
+//          non-cv-qualified, non-reference element type.
+//  - SO  : specifies the storage order (\c columnMajor or \c rowMajor) of the matrix. The
+//          default value is \c blaze::defaultStorageOrder.
+//
+// In case of a column-major band matrix the \f$ kl+ku+1 \f$ band elements of every column are
+// stored contiguously in the band storage format of LAPACK, i.e. element \f$ (i,j) \f$ is stored
+// in row \f$ ku+i-j \f$ of column \a j of a \f$ (kl+ku+1) \times N \f$ array. In case of a
+// row-major band matrix the band elements of every row are stored contiguously, i.e. element
+// \f$ (i,j) \f$ is stored in column \f$ kl+j-i \f$ of row \a i of a \f$ M \times (kl+ku+1) \f$
+// array. Accesses to elements outside the band return zero, the attempt to set a non-zero value
+// outside the band results in an exception:
+
+   \code
+   using blaze::BandedMatrix;
+   using blaze::columnMajor;
+
+   blaze::DynamicMatrix<double> T( 1000UL, 1000UL );
+   // ... Initialization of a tridiagonal matrix
+
+   BandedMatrix<double,columnMajor> A( T );            // Detects the bandwidths kl=1 and ku=1
+   BandedMatrix<double,columnMajor> B( T, 2UL, 1UL );  // Stores the band with kl=2 and ku=1
+   A.set( 1UL, 2UL, 3.0 );                             // Sets element (1,2)
+   A.set( 1UL, 3UL, 3.0 );                             // Throws a std::invalid_argument exception
+
+   unpack( A, T );  // Converts the band matrix back into a dense matrix
+   \endcode
+
+// The conversion into and from band storage works for both dense and sparse matrices. The
+// matrix/vector and matrix/matrix multiplications are performed by vectorized kernels that touch
+// the elements of the band only, i.e. with a complexity of \f$ O(N \cdot (kl+ku+1)) \f$ per
+// vector instead of \f$ O(M \cdot N) \f$. Banded linear systems of equations are solved by means
+// of the band LU decomposition of LAPACK (gbtrf() and gbtrs(), see \ref lapack_functions) with a
+// complexity of \f$ O(N \cdot kl \cdot (kl+ku)) \f$:
+
+   \code
+   BandedMatrix<double,columnMajor> A( 1000UL, 1000UL, 1UL, 1UL );
+   blaze::DynamicMatrix<double> B( 1000UL, 100UL ), C;
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization
+
+   mult( y, A, x );   // Computes y = A * x
+   mult( C, A, B );   // Computes C = A * B
+   solve( A, x, y );  // Solves the linear system A * x = y
+   \endcode
+
+// For symmetric or Hermitian positive definite band matrices the band Cholesky decomposition is
+// available via the pbtrf() and pbtrs() functions.
+*/
+template< typename Type                    // Data type of the elements
+        , bool SO = defaultStorageOrder >  // Storage order
+class BandedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the vectorized matrix/vector multiplication.
+   static constexpr bool simdEnabled =
+      ( IsVectorizable_v<Type> && HasSIMDAdd_v<Type,Type> && HasSIMDMult_v<Type,Type> );
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandedMatrix( size_t m = 0UL, size_t n = 0UL, size_t kl = 0UL, size_t ku = 0UL );
+            inline BandedMatrix( const BandedMatrix& m );
+            inline BandedMatrix( BandedMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO2 >
+   explicit inline BandedMatrix( const Matrix<MT,SO2>& m );
+
+   template< typename MT, bool SO2 >
+   inline BandedMatrix( const Matrix<MT,SO2>& m, size_t kl, size_t ku );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BandedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type        operator()( size_t i, size_t j ) const;
+   inline Type*       data() noexcept;
+   inline const Type* data() const noexcept;
+   inline Type*       data( size_t i ) noexcept;
+   inline const Type* data( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandedMatrix& operator=( const BandedMatrix& rhs );
+   inline BandedMatrix& operator=( BandedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 >
+   inline BandedMatrix& operator=( const Matrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows          () const noexcept;
+   inline size_t columns       () const noexcept;
+   inline size_t lowerBandwidth() const noexcept;
+   inline size_t upperBandwidth() const noexcept;
+   inline size_t spacing       () const noexcept;
+   inline size_t capacity      () const noexcept;
+   inline bool   inBand        ( size_t i, size_t j ) const noexcept;
+   inline void   set           ( size_t i, size_t j, const Type& value );
+   inline void   reset         ();
+   inline void   resize        ( size_t m, size_t n, bool preserve=true );
+   inline void   swap          ( BandedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t index( size_t i, size_t j ) const noexcept;
+
+   template< typename MT, bool SO2 >
+   static inline void bandwidth( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT, bool SO2 >
+   static inline void bandwidth( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT, bool SO2 >
+   inline void assign( const DenseMatrix<MT,SO2>& m );
+
+   template< typename MT, bool SO2 >
+   inline void assign( const SparseMatrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;   //!< The current number of rows of the matrix.
+   size_t n_;   //!< The current number of columns of the matrix.
+   size_t kl_;  //!< The number of subdiagonals within the band.
+   size_t ku_;  //!< The number of superdiagonals within the band.
+   Type*  v_;   //!< The elements of the band.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for BandedMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals within the band.
+// \param ku The number of superdiagonals within the band.
+//
+// All elements of the band are initialized to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>::BandedMatrix( size_t m, size_t n, size_t kl, size_t ku )
+   : m_ ( m  )       // The current number of rows of the matrix
+   , n_ ( n  )       // The current number of columns of the matrix
+   , kl_( kl )       // The number of subdiagonals within the band
+   , ku_( ku )       // The number of superdiagonals within the band
+   , v_ ( nullptr )  // The elements of the band
+{
+   if( capacity() > 0UL ) {
+      v_ = allocate<Type>( capacity() );
+      reset();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>::BandedMatrix( const BandedMatrix& m )
+   : BandedMatrix( m.m_, m.n_, m.kl_, m.ku_ )
+{
+   std::copy( m.v_, m.v_ + capacity(), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BandedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>::BandedMatrix( BandedMatrix&& m ) noexcept
+   : m_ ( m.m_  )  // The current number of rows of the matrix
+   , n_ ( m.n_  )  // The current number of columns of the matrix
+   , kl_( m.kl_ )  // The number of subdiagonals within the band
+   , ku_( m.ku_ )  // The number of superdiagonals within the band
+   , v_ ( m.v_  )  // The elements of the band
+{
+   m.m_  = 0UL;
+   m.n_  = 0UL;
+   m.kl_ = 0UL;
+   m.ku_ = 0UL;
+   m.v_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense or sparse matrix.
+//
+// \param m Dense or sparse matrix to be converted.
+//
+// This constructor determines the smallest band that contains all non-zero elements of the given
+// matrix and copies the elements of this band into the band storage.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the matrix
+        , bool SO2 >     // Storage order of the matrix
+inline BandedMatrix<Type,SO>::BandedMatrix( const Matrix<MT,SO2>& m )
+   : BandedMatrix()
+{
+   CompositeType_t<MT> tmp( *m );
+
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidth( tmp, kl, ku );
+
+   BandedMatrix B( tmp.rows(), tmp.columns(), kl, ku );
+   B.assign( tmp );
+   swap( B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense or sparse matrix with a given band.
+//
+// \param m Dense or sparse matrix to be converted.
+// \param kl The number of subdiagonals within the band.
+// \param ku The number of superdiagonals within the band.
+// \exception std::invalid_argument Invalid setup of banded matrix.
+//
+// This constructor copies the elements of the band of the given matrix into the band storage.
+// In case the given matrix contains a non-zero element outside the band, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the matrix
+        , bool SO2 >     // Storage order of the matrix
+inline BandedMatrix<Type,SO>::BandedMatrix( const Matrix<MT,SO2>& m, size_t kl, size_t ku )
+   : BandedMatrix( (*m).rows(), (*m).columns(), kl, ku )
+{
+   CompositeType_t<MT> tmp( *m );
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BandedMatrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>::~BandedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// For elements outside the band the function returns the default value of \a Type. Note that
+// in contrast to the other dense matrices the function returns the element by value. Elements
+// can be modified via the set() function.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline Type BandedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   return ( inBand( i, j ) )?( v_[index(i,j)] ):( Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band storage.
+//
+// \return Pointer to the band storage of the matrix.
+//
+// The elements of the band are stored in the band storage format of LAPACK (see the BandedMatrix
+// class description). Note that the storage contains elements that are not part of the matrix
+// (the upper left and lower right corners of the band), which are always zero.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline Type* BandedMatrix<Type,SO>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band storage.
+//
+// \return Pointer to the band storage of the matrix.
+//
+// The elements of the band are stored in the band storage format of LAPACK (see the BandedMatrix
+// class description). Note that the storage contains elements that are not part of the matrix
+// (the upper left and lower right corners of the band), which are always zero.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline const Type* BandedMatrix<Type,SO>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements of the given column/row.
+//
+// \param i The column index (in case of a column-major matrix) or row index (in case of a
+//          row-major matrix).
+// \return Pointer to the \f$ kl+ku+1 \f$ band elements of column/row \a i.
+//
+// In case of a column-major matrix element \f$ (k,i) \f$ is stored at position \f$ ku+k-i \f$,
+// in case of a row-major matrix element \f$ (i,k) \f$ is stored at position \f$ kl+k-i \f$.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline Type* BandedMatrix<Type,SO>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return v_ + i*spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements of the given column/row.
+//
+// \param i The column index (in case of a column-major matrix) or row index (in case of a
+//          row-major matrix).
+// \return Pointer to the \f$ kl+ku+1 \f$ band elements of column/row \a i.
+//
+// In case of a column-major matrix element \f$ (k,i) \f$ is stored at position \f$ ku+k-i \f$,
+// in case of a row-major matrix element \f$ (i,k) \f$ is stored at position \f$ kl+k-i \f$.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline const Type* BandedMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid dense matrix row/column access index" );
+   return v_ + i*spacing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>& BandedMatrix<Type,SO>::operator=( const BandedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BandedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BandedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline BandedMatrix<Type,SO>& BandedMatrix<Type,SO>::operator=( BandedMatrix&& rhs ) noexcept
+{
+   BandedMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Dense or sparse matrix to be converted.
+// \return Reference to the assigned matrix.
+//
+// The band of the matrix is adapted to the smallest band that contains all non-zero elements
+// of the given matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the matrix
+        , bool SO2 >     // Storage order of the matrix
+inline BandedMatrix<Type,SO>& BandedMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   BandedMatrix tmp( *rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of subdiagonals within the band.
+//
+// \return The lower bandwidth \a kl of the matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of superdiagonals within the band.
+//
+// \return The upper bandwidth \a ku of the matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two columns/rows of the band storage.
+//
+// \return The number of stored elements per column/row \f$ kl+ku+1 \f$.
+//
+// In case of a column-major matrix, the spacing corresponds to the leading dimension \c ldab of
+// the band storage format of LAPACK.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::spacing() const noexcept
+{
+   return kl_ + ku_ + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements \f$ N \cdot (kl+ku+1) \f$ (column-major) or
+//         \f$ M \cdot (kl+ku+1) \f$ (row-major).
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::capacity() const noexcept
+{
+   return ( SO ? n_ : m_ ) * spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given element is part of the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is part of the band, \a false if not.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline bool BandedMatrix<Type,SO>::inBand( size_t i, size_t j ) const noexcept
+{
+   return ( i <= j+kl_ ) && ( j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of a single matrix element.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The new value of the element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to banded matrix element.
+//
+// In case a non-default value is assigned to an element outside the band, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void BandedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   if( inBand( i, j ) ) {
+      v_[index(i,j)] = value;
+   }
+   else if( !isDefault( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to banded matrix element" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void BandedMatrix<Type,SO>::reset()
+{
+   std::fill( v_, v_ + capacity(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function changes the size of the matrix, the bandwidths remain unchanged. During this
+// operation, new dynamic memory is allocated. In case \a preserve is set to \a true, the band
+// elements of the leading min(\a m,rows()) by min(\a n,columns()) submatrix are preserved. All
+// new elements are initialized to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void BandedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+{
+   if( m == m_ && n == n_ ) return;
+
+   BandedMatrix tmp( m, n, kl_, ku_ );
+
+   if( preserve ) {
+      const size_t iend( min( m, m_ ) );
+      const size_t jend( min( n, n_ ) );
+      for( size_t i=0UL; i<iend; ++i ) {
+         for( size_t j=( i > kl_ ? i-kl_ : 0UL ); j<min( jend, i+ku_+1UL ); ++j ) {
+            tmp.v_[tmp.index(i,j)] = v_[index(i,j)];
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void BandedMatrix<Type,SO>::swap( BandedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_ , m.m_  );
+   swap( n_ , m.n_  );
+   swap( kl_, m.kl_ );
+   swap( ku_, m.ku_ );
+   swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the index of the given band element within the band storage.
+//
+// \param i The row index of the band element.
+// \param j The column index of the band element.
+// \return The index of the element within the band storage.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline size_t BandedMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( inBand( i, j ), "Invalid band element" );
+
+   return ( SO )?( j*spacing() + ku_ + i - j ):( i*spacing() + kl_ + j - i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the bandwidths of the given dense matrix.
+//
+// \param m The dense matrix.
+// \param kl The resulting number of subdiagonals.
+// \param ku The resulting number of superdiagonals.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+inline void
+   BandedMatrix<Type,SO>::bandwidth( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   for( size_t i=0UL; i<(*m).rows(); ++i ) {
+      for( size_t j=0UL; j<(*m).columns(); ++j ) {
+         if( !isDefault( (*m)(i,j) ) ) {
+            if( i > j ) kl = max( kl, i-j );
+            else        ku = max( ku, j-i );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the bandwidths of the given sparse matrix.
+//
+// \param m The sparse matrix.
+// \param kl The resulting number of subdiagonals.
+// \param ku The resulting number of superdiagonals.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline void
+   BandedMatrix<Type,SO>::bandwidth( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   const size_t kend( SO2 ? (*m).columns() : (*m).rows() );
+
+   for( size_t k=0UL; k<kend; ++k ) {
+      for( auto element=(*m).begin(k); element!=(*m).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( !isDefault( element->value() ) ) {
+            if( i > j ) kl = max( kl, i-j );
+            else        ku = max( ku, j-i );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies the band of the given dense matrix into the band storage.
+//
+// \param m The dense matrix.
+// \return void
+// \exception std::invalid_argument Invalid setup of banded matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+inline void BandedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& m )
+{
+   BLAZE_INTERNAL_ASSERT( (*m).rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*m).columns() == n_, "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         if( inBand( i, j ) ) {
+            v_[index(i,j)] = (*m)(i,j);
+         }
+         else if( !isDefault( (*m)(i,j) ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of banded matrix" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies the band of the given sparse matrix into the band storage.
+//
+// \param m The sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid setup of banded matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+template< typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+inline void BandedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO2>& m )
+{
+   BLAZE_INTERNAL_ASSERT( (*m).rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*m).columns() == n_, "Invalid number of columns" );
+
+   const size_t kend( SO2 ? n_ : m_ );
+
+   for( size_t k=0UL; k<kend; ++k ) {
+      for( auto element=(*m).begin(k); element!=(*m).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( inBand( i, j ) ) {
+            v_[index(i,j)] = element->value();
+         }
+         else if( !isDefault( element->value() ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of banded matrix" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandedMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( BandedMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( BandedMatrix<Type,SO>& a, BandedMatrix<Type,SO>& b ) noexcept;
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void unpack( const BandedMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B );
+
+template< typename Type, bool SO, typename MT, bool SO2 >
+void unpack( const BandedMatrix<Type,SO>& A, SparseMatrix<MT,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup dense_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void reset( BandedMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup dense_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+inline void swap( BandedMatrix<Type,SO>& a, BandedMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a band matrix into a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The band matrix to be converted.
+// \param B The target dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function resizes the given dense matrix to the size of \a A, resets it and copies the
+// elements of the band of \a A. In case \a B cannot be resized to the size of \a A, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+void unpack( const BandedMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   const size_t M ( A.rows() );
+   const size_t N ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   resize( *B, M, N, false );
+   reset( *B );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=( j > ku ? j-ku : 0UL ); i<min( M, j+kl+1UL ); ++i ) {
+         (*B)(i,j) = A(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a band matrix into a sparse matrix.
+// \ingroup dense_matrix
+//
+// \param A The band matrix to be converted.
+// \param B The target sparse matrix.
+// \return void
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function resizes the given sparse matrix to the size of \a A and appends the non-zero
+// elements of the band of \a A in a single pass, i.e. without any element search. In case \a B
+// cannot be resized to the size of \a A, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the sparse matrix
+        , bool SO2 >     // Storage order of the sparse matrix
+void unpack( const BandedMatrix<Type,SO>& A, SparseMatrix<MT,SO2>& B )
+{
+   const size_t M ( A.rows() );
+   const size_t N ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   resize( *B, M, N, false );
+   reset( *B );
+   (*B).reserve( A.capacity() );
+
+   if( SO2 == columnMajor ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t i=( j > ku ? j-ku : 0UL ); i<min( M, j+kl+1UL ); ++i ) {
+            const Type value( A(i,j) );
+            if( !isDefault( value ) )
+               (*B).append( i, j, value );
+         }
+         (*B).finalize( j );
+      }
+   }
+   else {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=( i > kl ? i-kl : 0UL ); j<min( N, i+ku+1UL ); ++j ) {
+            const Type value( A(i,j) );
+            if( !isDefault( value ) )
+               (*B).append( i, j, value );
+         }
+         (*B).finalize( i );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a band matrix and a vector (\f$ y+=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the contiguous result vector.
+// \param A The band matrix.
+// \param x Pointer to the first element of the contiguous right-hand side vector.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+auto bandedMv( Type* y, const BandedMatrix<Type,SO>& A, const Type* x )
+   -> DisableIf_t< BandedMatrix<Type,SO>::simdEnabled >
+{
+   const size_t M ( A.rows() );
+   const size_t N ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   if( SO == columnMajor )
+   {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         const size_t ibegin( j > ku ? j-ku : 0UL );
+         const size_t iend  ( min( M, j+kl+1UL ) );
+
+         const Type* a( A.data(j) + ( ku+ibegin-j ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            y[i] += a[i-ibegin] * x[j];
+         }
+      }
+   }
+   else
+   {
+      for( size_t i=0UL; i<M; ++i )
+      {
+         const size_t jbegin( i > kl ? i-kl : 0UL );
+         const size_t jend  ( min( N, i+ku+1UL ) );
+
+         const Type* a( A.data(i) + ( kl+jbegin-i ) );
+
+         Type tmp{};
+         for( size_t j=jbegin; j<jend; ++j ) {
+            tmp += a[j-jbegin] * x[j];
+         }
+         y[i] += tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a band matrix and a vector (\f$ y+=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the contiguous result vector.
+// \param A The band matrix.
+// \param x Pointer to the first element of the contiguous right-hand side vector.
+// \return void
+//
+// This kernel traverses every stored column/row of \a A exactly once. For column-major matrices
+// every column contributes to the \f$ kl+ku+1 \f$ according elements of \a y, for row-major
+// matrices every element of \a y is computed as the dot product of a row of the band and the
+// according elements of \a x.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+auto bandedMv( Type* y, const BandedMatrix<Type,SO>& A, const Type* x )
+   -> EnableIf_t< BandedMatrix<Type,SO>::simdEnabled >
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t M ( A.rows() );
+   const size_t N ( A.columns() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   if( SO == columnMajor )
+   {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         const size_t ibegin( j > ku ? j-ku : 0UL );
+         const size_t iend  ( min( M, j+kl+1UL ) );
+
+         if( iend <= ibegin ) continue;
+
+         const Type* a( A.data(j) + ( ku+ibegin-j ) );
+         Type* py( y+ibegin );
+
+         const size_t isize( iend-ibegin );
+         const size_t ipos( prevMultiple( isize, SIMDSIZE ) );
+         const SIMDType x1( set( x[j] ) );
+
+         size_t i( 0UL );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            const SIMDType y1( loadu( py+i ) + loadu( a+i ) * x1 );
+            storeu( py+i, y1 );
+         }
+         for( ; i<isize; ++i ) {
+            py[i] += a[i] * x[j];
+         }
+      }
+   }
+   else
+   {
+      for( size_t i=0UL; i<M; ++i )
+      {
+         const size_t jbegin( i > kl ? i-kl : 0UL );
+         const size_t jend  ( min( N, i+ku+1UL ) );
+
+         if( jend <= jbegin ) continue;
+
+         const Type* a( A.data(i) + ( kl+jbegin-i ) );
+         const Type* px( x+jbegin );
+
+         const size_t jsize( jend-jbegin );
+         const size_t jpos( prevMultiple( jsize, SIMDSIZE ) );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += loadu( a+j ) * loadu( px+j );
+         }
+
+         Type tmp( sum( xmm1 ) );
+
+         for( ; j<jsize; ++j ) {
+            tmp += a[j] * px[j];
+         }
+
+         y[i] += tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a band matrix and a dense vector (\f$ y=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y The resulting dense vector.
+// \param A The band matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the band matrix \a A and the dense vector \a x by means
+// of a single pass over the band of \a A. The vector \a y is resized to the number of rows of
+// \a A (in case it is resizable) and may alias \a x.
+*/
+template< typename VT1   // Type of the resulting vector
+        , typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename VT2 > // Type of the right-hand side vector
+void mult( DenseVector<VT1,false>& y, const BandedMatrix<Type,SO>& A,
+           const DenseVector<VT2,false>& x )
+{
+   if( A.columns() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const DynamicVector<Type,false> tmpx( *x );
+   DynamicVector<Type,false> tmpy( A.rows(), Type() );
+
+   bandedMv( tmpy.data(), A, tmpx.data() );
+
+   (*y) = tmpy;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a band matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The resulting dense matrix.
+// \param A The band matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the band matrix \a A and the dense matrix \a B column
+// by column by means of the vectorized band matrix/vector multiplication kernel. The matrix \a C
+// is resized to the according size (in case it is resizable) and may alias \a B.
+*/
+template< typename MT1   // Type of the resulting matrix
+        , bool SO1       // Storage order of the resulting matrix
+        , typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void mult( DenseMatrix<MT1,SO1>& C, const BandedMatrix<Type,SO>& A, const DenseMatrix<MT2,SO2>& B )
+{
+   if( A.columns() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const DynamicMatrix<Type,columnMajor> tmpb( *B );
+   DynamicMatrix<Type,columnMajor> tmpc( A.rows(), tmpb.columns(), Type() );
+
+   for( size_t k=0UL; k<tmpb.columns(); ++k ) {
+      bandedMv( tmpc.data(k), A, tmpb.data(k) );
+   }
+
+   (*C) = tmpc;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LINEAR SYSTEM SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving the given banded linear system of equations in place (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The square band matrix.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param nrhs The number of right-hand side vectors.
+// \param ldb The total number of elements between two columns of \a B.
+// \return void
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function copies the band of \a A into a column-major band storage with \a kl additional
+// superdiagonals for the fill-in of the pivoting, decomposes it via the band LU decomposition
+// (gbtrf()) and solves the system via gbtrs().
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order of the band matrix
+void bandedSolve( const BandedMatrix<Type,SO>& A, Type* B, size_t nrhs, size_t ldb )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t N ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   if( N == 0UL || nrhs == 0UL ) {
+      return;
+   }
+
+   BandedMatrix<Type,columnMajor> LU( N, N, kl, kl+ku );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=( j > ku ? j-ku : 0UL ); i<min( N, j+kl+1UL ); ++i ) {
+         LU.set( i, j, A(i,j) );
+      }
+   }
+
+   const blas_int_t n    ( numeric_cast<blas_int_t>( N ) );
+   const blas_int_t bkl  ( numeric_cast<blas_int_t>( kl ) );
+   const blas_int_t bku  ( numeric_cast<blas_int_t>( ku ) );
+   const blas_int_t bnrhs( numeric_cast<blas_int_t>( nrhs ) );
+   const blas_int_t ldab ( numeric_cast<blas_int_t>( LU.spacing() ) );
+   const blas_int_t bldb ( numeric_cast<blas_int_t>( ldb ) );
+   blas_int_t info( 0 );
+
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+
+#if BLAZE_LAPACK_MODE
+   gbtrf( n, n, bkl, bku, LU.data(), ldab, ipiv.get(), &info );
+#else
+   nativeGbtrf( n, n, bkl, bku, LU.data(), ldab, ipiv.get(), &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for band LU decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+   }
+
+#if BLAZE_LAPACK_MODE
+   gbtrs( 'N', n, bkl, bku, bnrhs, LU.data(), ldab, ipiv.get(), B, bldb, &info );
+#else
+   nativeGbtrs( 'N', n, bkl, bku, bnrhs, LU.data(), ldab, ipiv.get(), B, bldb, &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given banded linear system of equations (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The square band matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the given banded linear system of equations by means of the band LU
+// decomposition with partial pivoting. In contrast to the solve() function for dense matrices
+// the complexity is \f$ O(N \cdot kl \cdot (kl+ku)) \f$ and only \f$ N \cdot (2 \cdot kl+ku+1)
+// \f$ elements of temporary memory are required. The vector \a x is resized to the size of
+// \a b (in case it is resizable) and may alias \a b.
+//
+// \note This function can only be used for band matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void solve( const BandedMatrix<Type,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b )
+{
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( A.rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type,false> tmp( *b );
+   bandedSolve( A, tmp.data(), 1UL, tmp.size() );
+
+   (*x) = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given banded linear system of equations (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The square band matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the given banded linear system of equations for all columns of \a B by
+// means of a single band LU decomposition of \a A. The matrix \a X is resized to the size of
+// \a B (in case it is resizable) and may alias \a B.
+//
+// \note This function can only be used for band matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created.
+*/
+template< typename Type  // Data type of the elements
+        , bool SO        // Storage order of the band matrix
+        , typename MT1   // Type of the solution matrix
+        , bool SO1       // Storage order of the solution matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void solve( const BandedMatrix<Type,SO>& A, DenseMatrix<MT1,SO1>& X,
+            const DenseMatrix<MT2,SO2>& B )
+{
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( A.rows() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicMatrix<Type,columnMajor> tmp( *B );
+   bandedSolve( A, tmp.data(), tmp.columns(), tmp.spacing() );
+
+   (*X) = tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
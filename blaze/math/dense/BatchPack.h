@@ -0,0 +1,234 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchPack.h
+//  \brief Header file for the SIMD pack functionality of the batched small matrix operations
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHPACK_H_
+#define _BLAZE_MATH_DENSE_BATCHPACK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHPACK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Properties of the SIMD packs of the MatrixBatch and VectorBatch class templates.
+// \ingroup dense_matrix
+//
+// The MatrixBatch and VectorBatch class templates interleave the elements of \a size consecutive
+// matrices (vectors) of a batch, i.e. the same element of \a size different matrices is stored
+// in one SIMD pack. Therefore every SIMD lane processes a different matrix and all operations
+// on the batch are performed with the full SIMD width. In case the element type \a Type does
+// not support vectorized addition, subtraction, multiplication, and division, \a size is 1 and
+// the operations on the batch are performed element-wise.
+*/
+template< typename Type >  // Data type of the elements
+struct BatchPack
+{
+   //! Compilation flag for the vectorized operations on the batch.
+   static constexpr bool vectorizable =
+      ( IsVectorizable_v<Type> &&
+        HasSIMDAdd_v<Type,Type> && HasSIMDSub_v<Type,Type> &&
+        HasSIMDMult_v<Type,Type> && HasSIMDDiv_v<Type,Type> );
+
+   //! The number of matrices (vectors) per SIMD pack.
+   static constexpr size_t size = ( vectorizable ? SIMDTrait<Type>::size : 1UL );
+
+   //! Type of a SIMD pack.
+   using Type_ = If_t< vectorizable, SIMDTrait_t<Type>, Type >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Alias declaration for the SIMD pack type of the given element type.
+// \ingroup dense_matrix
+*/
+template< typename Type >  // Data type of the elements
+using BatchPack_t = typename BatchPack<Type>::Type_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD pack of a matrix or vector batch.
+// \ingroup dense_matrix
+//
+// \param address The aligned address of the SIMD pack.
+// \return The loaded SIMD pack.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto loadPack( const Type* address ) noexcept
+   -> EnableIf_t< BatchPack<Type>::vectorizable, BatchPack_t<Type> >
+{
+   return loada( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a single element of a matrix or vector batch.
+// \ingroup dense_matrix
+//
+// \param address The address of the element.
+// \return The loaded element.
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto loadPack( const Type* address )
+   -> DisableIf_t< BatchPack<Type>::vectorizable, BatchPack_t<Type> >
+{
+   return *address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a SIMD pack of a matrix or vector batch.
+// \ingroup dense_matrix
+//
+// \param address The aligned target address of the SIMD pack.
+// \param value The SIMD pack to be stored.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto storePack( Type* address, const BatchPack_t<Type>& value ) noexcept
+   -> EnableIf_t< BatchPack<Type>::vectorizable >
+{
+   storea( address, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a single element of a matrix or vector batch.
+// \ingroup dense_matrix
+//
+// \param address The target address of the element.
+// \param value The element to be stored.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+BLAZE_ALWAYS_INLINE auto storePack( Type* address, const BatchPack_t<Type>& value )
+   -> DisableIf_t< BatchPack<Type>::vectorizable >
+{
+   *address = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given kernel for all SIMD packs of a matrix or vector batch.
+// \ingroup dense_matrix
+//
+// \param size The number of matrices (vectors) of the batch.
+// \param packs The number of SIMD packs of the batch.
+// \param kernel The serial kernel for the SIMD packs in the range \f$ [begin..end) \f$.
+// \return void
+//
+// This function calls the given \a kernel for all SIMD packs of a batch. In case the number of
+// matrices (vectors) of the batch is larger or equal to the SMP_BATCH_THRESHOLD, the packs are
+// split into blocks of consecutive packs, which are processed in parallel by means of smpLoop().
+// Therefore the kernel has to be safe for the concurrent execution on disjoint pack ranges.
+*/
+template< typename Kernel >  // Type of the serial kernel
+void batchLoop( size_t size, size_t packs, Kernel kernel )
+{
+   constexpr size_t block( 64UL );
+
+   const size_t blocks( ( packs + block - 1UL ) / block );
+
+   if( size < SMP_BATCH_THRESHOLD || blocks < 2UL ) {
+      kernel( 0UL, packs );
+      return;
+   }
+
+   std::vector<size_t> work( blocks+1UL );
+   for( size_t i=0UL; i<=blocks; ++i ) {
+      work[i] = i;
+   }
+
+   smpLoop( work, [&kernel,packs]( size_t begin, size_t end )
+   {
+      kernel( begin*block, min( end*block, packs ) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,6 +50,7 @@
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/potrf.h>
+#include <blaze/math/lapack/native/potrf.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/Conjugate.h>
@@ -84,6 +85,7 @@
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -2649,8 +2651,9 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a call to this function will result in a linker error.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
@@ -2671,7 +2674,11 @@ bool isPositiveDefinite( const DenseMatrix<MT,SO>& dm )
    blas_int_t lda ( numeric_cast<blas_int_t>( (*L).spacing()) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    potrf( uplo, n, (*L).data(), lda, &info );
+#else
+   nativePotrf( uplo, n, (*L).data(), lda, &info );
+#endif
 
    return ( info == 0 );
 }
@@ -115,6 +115,7 @@
 #include <blaze/system/NoUniqueAddress.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AlignedAllocator.h>
@@ -131,6 +132,7 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
@@ -716,6 +718,14 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, cons
 {
    using blaze::clear;
 
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && m_*n_ >= SMP_DMATASSIGN_THRESHOLD ) {
+      smpConstruct( *this, Type() );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
@@ -746,12 +756,31 @@ template< typename Type   // Data type of the matrix
         , typename Alloc  // Type of the allocator
         , typename Tag >  // Type tag
 inline DynamicMatrix<Type,SO,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
-   : DynamicMatrix( m, n, alloc )
+   : DynamicMatrix( m, n, addPadding(n), alloc, Uninitialized{} )
 {
-   for( size_t i=0UL; i<m; ++i ) {
+   using blaze::clear;
+
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && m_*n_ >= SMP_DMATASSIGN_THRESHOLD ) {
+      smpConstruct( *this, init );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
+   blaze::uninitialized_default_construct_n( v_, capacity_ );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
       for( size_t j=0UL; j<n_; ++j ) {
          v_[i*nn_+j] = init;
       }
+
+      if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            clear( v_[i*nn_+j] );
+         }
+      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -2054,6 +2083,19 @@ void DynamicMatrix<Type,SO,Alloc,Tag>::resize( size_t m, size_t n, bool preserve
    {
       DynamicMatrix tmp( m, n, nn, Alloc{}, Uninitialized{} );
 
+#if BLAZE_NUMA_MODE
+      if( IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         std::swap( capacity_, tmp.capacity_ );
+         std::swap( v_, tmp.v_ );
+         m_  = m;
+         n_  = n;
+         nn_ = nn;
+         smpConstruct( *this, Type() );
+         BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+         return;
+      }
+#endif
+
       blaze::uninitialized_default_construct( tmp.v_, tmp.v_+tmp.capacity_ );
 
       std::swap( capacity_, tmp.capacity_ );
@@ -4038,6 +4080,14 @@ inline DynamicMatrix<Type,true,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, co
 {
    using blaze::clear;
 
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && m_*n_ >= SMP_DMATASSIGN_THRESHOLD ) {
+      smpConstruct( *this, Type() );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
@@ -4069,12 +4119,31 @@ template< typename Type   // Data type of the matrix
         , typename Alloc  // Type of the allocator
         , typename Tag >  // Type tag
 inline DynamicMatrix<Type,true,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
-   : DynamicMatrix( m, n, alloc )
+   : DynamicMatrix( m, addPadding(m), n, alloc, Uninitialized{} )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
+   using blaze::clear;
+
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && m_*n_ >= SMP_DMATASSIGN_THRESHOLD ) {
+      smpConstruct( *this, init );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
+   blaze::uninitialized_default_construct_n( v_, capacity_ );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
       for( size_t i=0UL; i<m_; ++i ) {
          v_[i+j*mm_] = init;
       }
+
+      if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            clear( v_[i+j*mm_] );
+         }
+      }
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
@@ -5395,6 +5464,19 @@ void DynamicMatrix<Type,true,Alloc,Tag>::resize( size_t m, size_t n, bool preser
    {
       DynamicMatrix tmp( m, mm, n, Alloc{}, Uninitialized{} );
 
+#if BLAZE_NUMA_MODE
+      if( IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         std::swap( capacity_, tmp.capacity_ );
+         std::swap( v_, tmp.v_ );
+         m_  = m;
+         mm_ = mm;
+         n_  = n;
+         smpConstruct( *this, Type() );
+         BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+         return;
+      }
+#endif
+
       blaze::uninitialized_default_construct( tmp.v_, tmp.v_+tmp.capacity_ );
 
       std::swap( capacity_, tmp.capacity_ );
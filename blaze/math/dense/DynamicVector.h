@@ -52,6 +52,7 @@
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/RuntimeDispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -113,6 +114,7 @@
 #include <blaze/system/NoUniqueAddress.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/Algorithms.h>
@@ -128,6 +130,8 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
 #include <blaze/util/typetraits/RemoveCV.h>
@@ -423,6 +427,17 @@ class DynamicVector
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool DispatchedAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        IsDispatchableVector_v<VT> &&
+        IsSame_v< Type, ElementType_t<VT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -476,7 +491,13 @@ class DynamicVector
    inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<VT> >;
 
    template< typename VT >
-   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT> >;
+   inline auto addAssign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedAddAssign_v<VT> && !DispatchedAssign_v<VT> >;
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchedAssign_v<VT> >;
+#endif
 
    template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
 
@@ -484,7 +505,13 @@ class DynamicVector
    inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<VT> >;
 
    template< typename VT >
-   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT> >;
+   inline auto subAssign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedSubAssign_v<VT> && !DispatchedAssign_v<VT> >;
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchedAssign_v<VT> >;
+#endif
 
    template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
 
@@ -492,7 +519,13 @@ class DynamicVector
    inline auto multAssign( const DenseVector<VT,TF>& rhs ) -> DisableIf_t< VectorizedMultAssign_v<VT> >;
 
    template< typename VT >
-   inline auto multAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT> >;
+   inline auto multAssign( const DenseVector<VT,TF>& rhs )
+      -> EnableIf_t< VectorizedMultAssign_v<VT> && !DispatchedAssign_v<VT> >;
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,TF>& rhs ) -> EnableIf_t< DispatchedAssign_v<VT> >;
+#endif
 
    template< typename VT > inline void multAssign( const SparseVector<VT,TF>& rhs );
 
@@ -650,6 +683,14 @@ inline DynamicVector<Type,TF,Alloc,Tag>::DynamicVector( size_t n, const Alloc& a
 {
    using blaze::clear;
 
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && size_ >= SMP_DVECASSIGN_THRESHOLD ) {
+      smpConstruct( *this, Type() );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
@@ -676,11 +717,28 @@ template< typename Type   // Data type of the vector
         , typename Alloc  // Type of the allocator
         , typename Tag >  // Type tag
 inline DynamicVector<Type,TF,Alloc,Tag>::DynamicVector( size_t n, const Type& init, const Alloc& alloc )
-   : DynamicVector( n, alloc )
+   : DynamicVector( n, addPadding(n), alloc, Uninitialized{} )
 {
+   using blaze::clear;
+
+#if BLAZE_NUMA_MODE
+   if( IsNumeric_v<Type> && size_ >= SMP_DVECASSIGN_THRESHOLD ) {
+      smpConstruct( *this, init );
+      BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+      return;
+   }
+#endif
+
+   blaze::uninitialized_default_construct_n( v_, capacity_ );
+
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = init;
 
+   if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         clear( v_[i] );
+   }
+
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 //*************************************************************************************************
@@ -2462,7 +2520,7 @@ template< typename Type   // Data type of the vector
         , typename Tag >  // Type tag
 template< typename VT >   // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF,Alloc,Tag>::addAssign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedAddAssign_v<VT> >
+   -> EnableIf_t< VectorizedAddAssign_v<VT> && !DispatchedAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2493,6 +2551,34 @@ inline auto DynamicVector<Type,TF,Alloc,Tag>::addAssign( const DenseVector<VT,TF
 //*************************************************************************************************
 
 
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Alloc  // Type of the allocator
+        , typename Tag >  // Type tag
+template< typename VT >   // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc,Tag>::addAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchedAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   getDispatchKernels<Type>().add( v_, (*rhs).data(), size_ );
+}
+//*************************************************************************************************
+#endif
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the addition assignment of a sparse vector.
 //
@@ -2570,7 +2656,7 @@ template< typename Type   // Data type of the vector
         , typename Tag >  // Type tag
 template< typename VT >   // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF,Alloc,Tag>::subAssign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedSubAssign_v<VT> >
+   -> EnableIf_t< VectorizedSubAssign_v<VT> && !DispatchedAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2601,6 +2687,34 @@ inline auto DynamicVector<Type,TF,Alloc,Tag>::subAssign( const DenseVector<VT,TF
 //*************************************************************************************************
 
 
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Alloc  // Type of the allocator
+        , typename Tag >  // Type tag
+template< typename VT >   // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc,Tag>::subAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchedAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   getDispatchKernels<Type>().sub( v_, (*rhs).data(), size_ );
+}
+//*************************************************************************************************
+#endif
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
 //
@@ -2678,7 +2792,7 @@ template< typename Type   // Data type of the vector
         , typename Tag >  // Type tag
 template< typename VT >   // Type of the right-hand side dense vector
 inline auto DynamicVector<Type,TF,Alloc,Tag>::multAssign( const DenseVector<VT,TF>& rhs )
-   -> EnableIf_t< VectorizedMultAssign_v<VT> >
+   -> EnableIf_t< VectorizedMultAssign_v<VT> && !DispatchedAssign_v<VT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
@@ -2709,6 +2823,34 @@ inline auto DynamicVector<Type,TF,Alloc,Tag>::multAssign( const DenseVector<VT,T
 //*************************************************************************************************
 
 
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*!\brief Runtime dispatched implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Alloc  // Type of the allocator
+        , typename Tag >  // Type tag
+template< typename VT >   // Type of the right-hand side dense vector
+inline auto DynamicVector<Type,TF,Alloc,Tag>::multAssign( const DenseVector<VT,TF>& rhs )
+   -> EnableIf_t< DispatchedAssign_v<VT> >
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   getDispatchKernels<Type>().mult( v_, (*rhs).data(), size_ );
+}
+//*************************************************************************************************
+#endif
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the multiplication assignment of a sparse vector.
 //
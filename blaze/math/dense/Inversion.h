@@ -70,6 +70,7 @@
 #include <blaze/math/typetraits/IsUniLower.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -3371,8 +3372,10 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created. In case the LAPACK mode is disabled, the matrix is
+// inverted by means of the native LU decomposition of Blaze.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3386,6 +3389,7 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isSymmetric( *dm ), "Invalid non-symmetric matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[(*dm).rows()] );
 
@@ -3406,6 +3410,9 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
          }
       }
    }
+#else
+   invertByLU( *dm );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3472,8 +3479,10 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created. In case the LAPACK mode is disabled, the matrix is
+// inverted by means of the native LU decomposition of Blaze.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3488,6 +3497,7 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isHermitian( *dm ), "Invalid non-Hermitian matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[(*dm).rows()] );
 
@@ -3508,6 +3518,9 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
          }
       }
    }
+#else
+   invertByLU( *dm );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/KronMult.h
+//  \brief Header file for the matrix-free Kronecker product multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_KRONMULT_H_
+#define _BLAZE_MATH_DENSE_KRONMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/MatMatKronExpr.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsMatMatKronExpr.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MATRIX-FREE KRONECKER PRODUCT MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the number of factors and the size of the intermediate results of a
+//        matrix-free Kronecker product multiplication.
+// \ingroup dense_matrix
+//
+// \param A The factor of the Kronecker product.
+// \param p The number of elements of all faster running modes.
+// \param q The number of elements of all slower running modes.
+// \param factors The number of visited factors.
+// \param current The size of the result of the last visited factor.
+// \param capacity The size of the largest intermediate result.
+// \return void
+//
+// This function visits the factors of a Kronecker product in the same order as the
+// kronMultKernel() function. It counts the factors and determines the size of the largest
+// intermediate result, i.e. the largest result of all factors except the last one.
+*/
+template< typename MT >  // Type of the factor
+auto kronMultSizes( const MT& A, size_t p, size_t q,
+                    size_t& factors, size_t& current, size_t& capacity )
+   -> DisableIf_t< IsMatMatKronExpr_v<MT> >
+{
+   capacity = max( capacity, current );
+   current  = p * A.rows() * q;
+   ++factors;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the number of factors and the size of the intermediate results of a
+//        matrix-free Kronecker product multiplication.
+// \ingroup dense_matrix
+//
+// \param K The (nested) Kronecker product.
+// \param p The number of elements of all faster running modes.
+// \param q The number of elements of all slower running modes.
+// \param factors The number of visited factors.
+// \param current The size of the result of the last visited factor.
+// \param capacity The size of the largest intermediate result.
+// \return void
+*/
+template< typename MT >  // Type of the Kronecker product
+auto kronMultSizes( const MT& K, size_t p, size_t q,
+                    size_t& factors, size_t& current, size_t& capacity )
+   -> EnableIf_t< IsMatMatKronExpr_v<MT> >
+{
+   decltype(auto) lhs( K.leftOperand()  );
+   decltype(auto) rhs( K.rightOperand() );
+
+   kronMultSizes( rhs, p, lhs.columns()*q, factors, current, capacity );
+   kronMultSizes( lhs, p*rhs.rows(), q, factors, current, capacity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a single factor of a matrix-free Kronecker product multiplication.
+// \ingroup dense_matrix
+//
+// \param A The \f$ m \times n \f$ factor of the Kronecker product.
+// \param p The number of elements of all faster running modes.
+// \param q The number of elements of all slower running modes.
+// \param x The input of the first factor.
+// \param y The output of the last factor.
+// \param buffer The two buffers for the intermediate results.
+// \param capacity The size of a single intermediate buffer.
+// \param factor The index of the factor.
+// \param factors The total number of factors.
+// \param parallel \a true in case the factor may be applied in parallel, \a false if not.
+// \return void
+//
+// This function interprets its input as column-major \f$ p \times n \times q \f$ tensor \f$ X \f$
+// and computes the mode product \f$ Y(:,i,:) = \sum_j A(i,j) X(:,j,:) \f$. The first factor
+// reads from \a x, the last factor writes to \a y, and all factors in between alternate between
+// the two halves of \a buffer. In case \a p or \a q is 1, the mode product is the single matrix
+// multiplication \f$ Y=A*X \f$ or \f$ Y=X*A^T \f$, respectively, which is parallelized by the
+// active SMP backend. Otherwise it is the batch of the \a q independent multiplications
+// \f$ Y_r=X_r*A^T \f$, which are distributed among the threads by means of smpLoop().
+*/
+template< typename MT      // Type of the factor
+        , typename Type >  // Element type of the input and output
+auto kronMultKernel( const MT& A, size_t p, size_t q, const Type* x, Type* y, Type* buffer,
+                     size_t capacity, size_t& factor, size_t factors, bool parallel )
+   -> DisableIf_t< IsMatMatKronExpr_v<MT> >
+{
+   // The input is never modified. However, the default multiplication kernels (as for instance
+   // used for integral element types) cannot handle matrices of const-qualified elements.
+   using InputType  = CustomMatrix<Type,unaligned,unpadded,columnMajor>;
+   using OutputType = CustomMatrix<Type,unaligned,unpadded,columnMajor>;
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+
+   Type* src( ( factor == 0UL )?( const_cast<Type*>( x ) )
+                                :( buffer + ( ( factor-1UL ) % 2UL ) * capacity ) );
+   Type* dst( ( factor+1UL == factors )?( y ):( buffer + ( factor % 2UL ) * capacity ) );
+
+   ++factor;
+
+   CompositeType_t<MT> F( serial( A ) );  // Evaluation of the factor
+
+   if( p == 1UL )
+   {
+      const InputType X( src, n, q );
+      OutputType Y( dst, m, q );
+
+      if( parallel ) Y = F * X;
+      else Y = serial( F * X );
+   }
+   else if( q == 1UL )
+   {
+      const InputType X( src, p, n );
+      OutputType Y( dst, p, m );
+
+      if( parallel ) Y = X * trans( F );
+      else Y = serial( X * trans( F ) );
+   }
+   else
+   {
+      const auto kernel = [&F,src,dst,p,m,n]( size_t begin, size_t end )
+      {
+         for( size_t r=begin; r<end; ++r ) {
+            const InputType X( src + r*p*n, p, n );
+            OutputType Y( dst + r*p*m, p, m );
+            Y = serial( X * trans( F ) );
+         }
+      };
+
+      if( parallel && p*m*q >= SMP_KRONMULT_THRESHOLD )
+      {
+         std::vector<size_t> work( q+1UL );
+         for( size_t r=0UL; r<=q; ++r ) {
+            work[r] = r;
+         }
+
+         smpLoop( work, kernel );
+      }
+      else
+      {
+         kernel( 0UL, q );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies all factors of a (nested) Kronecker product in a matrix-free Kronecker product
+//        multiplication.
+// \ingroup dense_matrix
+//
+// \param K The (nested) Kronecker product.
+// \param p The number of elements of all faster running modes.
+// \param q The number of elements of all slower running modes.
+// \param x The input of the first factor.
+// \param y The output of the last factor.
+// \param buffer The two buffers for the intermediate results.
+// \param capacity The size of a single intermediate buffer.
+// \param factor The index of the next factor.
+// \param factors The total number of factors.
+// \param parallel \a true in case the factors may be applied in parallel, \a false if not.
+// \return void
+//
+// The mode of size \f$ n_A n_B \f$ of a Kronecker product \f$ A \otimes B \f$ consists of the
+// faster running mode of size \f$ n_B \f$ and the slower running mode of size \f$ n_A \f$.
+// Therefore the function first applies the right-hand side and then the left-hand side operand.
+*/
+template< typename MT      // Type of the Kronecker product
+        , typename Type >  // Element type of the input and output
+auto kronMultKernel( const MT& K, size_t p, size_t q, const Type* x, Type* y, Type* buffer,
+                     size_t capacity, size_t& factor, size_t factors, bool parallel )
+   -> EnableIf_t< IsMatMatKronExpr_v<MT> >
+{
+   decltype(auto) lhs( K.leftOperand()  );
+   decltype(auto) rhs( K.rightOperand() );
+
+   kronMultKernel( rhs, p, lhs.columns()*q, x, y, buffer, capacity, factor, factors, parallel );
+   kronMultKernel( lhs, p*rhs.rows(), q, x, y, buffer, capacity, factor, factors, parallel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Matrix-free multiplication of a Kronecker product and a dense matrix
+//        (\f$ Y=(A \otimes B)*X \f$).
+// \ingroup dense_matrix
+//
+// \param K The \f$ M \times N \f$ Kronecker product.
+// \param x Pointer to the \f$ N \times s \f$ input matrix.
+// \param y Pointer to the \f$ M \times s \f$ output matrix.
+// \param s The number of columns of the input and output matrix.
+// \param parallel \a true in case the multiplication may be executed in parallel, \a false if not.
+// \return void
+//
+// This function computes the product of the Kronecker product \a K and the matrix \a x without
+// forming \a K. It is based on the identity \f$ (A \otimes B) vec(X) = vec(B X A^T) \f$, i.e. for
+// a single Kronecker product and a single column it performs the two small matrix multiplications
+// \f$ Z=B*X \f$ and \f$ Y=Z*A^T \f$. Nested Kronecker products (as for instance \f$ A \otimes B
+// \otimes C \f$) are treated as chains of factors, which are applied one by one to the according
+// mode of the tensor that is formed by \a x (see kronMultKernel()). In case \a SO is set to
+// \a columnMajor, \a x and \a y are interpreted as column-major matrices, in case \a SO is set
+// to \a rowMajor as row-major matrices. In both cases they have to be contiguous arrays without
+// padding and must not overlap.
+*/
+template< bool SO          // Storage order of the input and output
+        , typename MT      // Type of the Kronecker product
+        , typename Type >  // Element type of the input and output
+void kronMult( const MT& K, const Type* x, Type* y, size_t s, bool parallel )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATMATKRONEXPR_TYPE( MT );
+
+   const size_t p( ( SO == columnMajor )?( 1UL ):( s ) );
+   const size_t q( ( SO == columnMajor )?( s ):( 1UL ) );
+
+   size_t factors ( 0UL );
+   size_t current ( 0UL );
+   size_t capacity( 0UL );
+
+   kronMultSizes( K, p, q, factors, current, capacity );
+
+   const size_t size( ( ( factors > 2UL )?( 2UL ):( 1UL ) ) * capacity );
+   const std::unique_ptr<Type[]> buffer( new Type[size] );
+
+   size_t factor( 0UL );
+
+   kronMultKernel( K, p, q, x, y, buffer.get(), capacity, factor, factors, parallel );
+
+   BLAZE_INTERNAL_ASSERT( factor == factors, "Invalid number of factors detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,20 +40,34 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/ColumnVector.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/getrf.h>
+#include <blaze/math/lapack/clapack/potrf.h>
 #include <blaze/math/lapack/gesv.h>
+#include <blaze/math/lapack/getrs.h>
 #include <blaze/math/lapack/hesv.h>
+#include <blaze/math/lapack/native/getrf.h>
+#include <blaze/math/lapack/native/potrf.h>
+#include <blaze/math/lapack/potrs.h>
 #include <blaze/math/lapack/sysv.h>
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
+#include <blaze/math/SolverFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsGeneral.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -64,13 +78,18 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsDouble.h>
 
 
 namespace blaze {
@@ -6483,6 +6502,476 @@ void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseM
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  FUNCTIONS FOR SOLVING LINEAR SYSTEMS BY MEANS OF MIXED PRECISION ITERATIVE REFINEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single precision LU decomposition of the given column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major single precision matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= N.
+// \return \a true in case the decomposition succeeded, \a false if the matrix is singular.
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT >  // Type of the dense matrix
+auto mixedDecompose( MT& A, blas_int_t* ipiv )
+   -> EnableIf_t< SF == byMixedLU, bool >
+{
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows()    ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t info( 0 );
+
+#if BLAZE_LAPACK_MODE
+   getrf( n, n, A.data(), lda, ipiv, &info );
+#else
+   nativeGetrf( n, n, A.data(), lda, ipiv, &info );
+#endif
+
+   return ( info == 0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single precision Cholesky decomposition of the given column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major single precision matrix to be decomposed.
+// \return \a true in case the decomposition succeeded, \a false if the matrix is not positive
+//         definite.
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT >  // Type of the dense matrix
+auto mixedDecompose( MT& A, blas_int_t* /*ipiv*/ )
+   -> EnableIf_t< SF == byMixedLLH, bool >
+{
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT );
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows()    ) );
+   blas_int_t lda ( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t info( 0 );
+
+#if BLAZE_LAPACK_MODE
+   potrf( 'L', n, A.data(), lda, &info );
+#else
+   nativePotrf( 'L', n, A.data(), lda, &info );
+#endif
+
+   return ( info == 0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution step of the mixed precision LU-based solver.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed single precision system matrix.
+// \param B The single precision right-hand side vector(s), overwritten by the solution.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT1   // Type of the decomposed system matrix
+        , typename MT2 > // Type of the right-hand side
+auto mixedSubstitute( const MT1& A, MT2& B, const blas_int_t* ipiv )
+   -> EnableIf_t< SF == byMixedLU >
+{
+   getrs( A, B, 'N', ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Substitution step of the mixed precision Cholesky-based solver.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed single precision system matrix.
+// \param B The single precision right-hand side vector(s), overwritten by the solution.
+// \return void
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT1   // Type of the decomposed system matrix
+        , typename MT2 > // Type of the right-hand side
+auto mixedSubstitute( const MT1& A, MT2& B, const blas_int_t* /*ipiv*/ )
+   -> EnableIf_t< SF == byMixedLLH >
+{
+   potrs( A, B, 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Convergence check of the iterative refinement for a single right-hand side vector.
+// \ingroup dense_matrix
+//
+// \param r The current residual vector.
+// \param x The current solution vector.
+// \param tol The relative tolerance.
+// \return \a true if \f$ \|r\|_\infty \leq tol \cdot \|x\|_\infty \f$, \a false if not.
+*/
+template< typename VT1  // Type of the residual vector
+        , typename VT2  // Type of the solution vector
+        , typename BT > // Type of the tolerance
+bool isRefined( const DenseVector<VT1,columnVector>& r, const DenseVector<VT2,columnVector>& x, BT tol )
+{
+   return ( maxNorm( *r ) <= maxNorm( *x ) * tol );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Convergence check of the iterative refinement for multiple right-hand side vectors.
+// \ingroup dense_matrix
+//
+// \param R The current residual matrix.
+// \param X The current solution matrix.
+// \param tol The relative tolerance.
+// \return \a true if \f$ \|r_j\|_\infty \leq tol \cdot \|x_j\|_\infty \f$ for all columns, \a false if not.
+*/
+template< typename MT1  // Type of the residual matrix
+        , typename MT2  // Type of the solution matrix
+        , typename BT > // Type of the tolerance
+bool isRefined( const DenseMatrix<MT1,columnMajor>& R, const DenseMatrix<MT2,columnMajor>& X, BT tol )
+{
+   for( size_t j=0UL; j<(*R).columns(); ++j )
+   {
+      BT rnorm{}, xnorm{};
+
+      for( size_t i=0UL; i<(*R).rows(); ++i ) {
+         rnorm = max( rnorm, abs( (*R)(i,j) ) );
+         xnorm = max( xnorm, abs( (*X)(i,j) ) );
+      }
+
+      if( !( rnorm <= xnorm * tol ) )
+         return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed precision iterative refinement for the given linear system of equations.
+// \ingroup dense_matrix
+//
+// \param A The double precision system matrix.
+// \param X The double precision solution vector(s).
+// \param B The double precision right-hand side vector(s).
+// \return \a true in case the iterative refinement converged, \a false if not.
+//
+// This function decomposes the given system matrix in single precision and computes the double
+// precision solution of the system by means of iterative refinement. Per step the residual
+// \f$ R = B - A X \f$ is computed in double precision, the correction is computed via the single
+// precision decomposition and added to \a X in double precision. The refinement is considered
+// converged as soon as the residual of every right-hand side satisfies
+
+      \f[ \|r_j\|_\infty \leq \|x_j\|_\infty \|A\|_\infty \varepsilon \sqrt{N}, \f]
+
+// where \f$ \varepsilon \f$ is the double precision machine epsilon. The function returns \a false
+// in case the system matrix cannot be represented or decomposed in single precision, in case the
+// residual does not decrease at least by a factor of two per step (i.e. the condition number of
+// the system matrix is too large for single precision), or in case no convergence is achieved
+// within 30 steps.
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT1   // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename MT2   // Type of the solution
+        , typename MT3 > // Type of the right-hand side
+bool refineMixed( const DenseMatrix<MT1,SO>& A, MT2& X, const MT3& B )
+{
+   using ET = ElementType_t<MT1>;
+   using BT = UnderlyingBuiltin_t<ET>;
+   using LT = If_t< IsComplex_v<ET>, complex<float>, float >;
+
+   constexpr size_t maxIterations( 30UL );
+
+   const size_t N( (*A).rows() );
+
+   const auto lower ( []( const ET& a ){ return LT( a ); } );
+   const auto higher( []( const LT& a ){ return ET( a ); } );
+
+   if( !( maxNorm( *A ) < BT( std::numeric_limits<float>::max() ) ) ) {
+      return false;
+   }
+
+   DynamicMatrix<LT,columnMajor> As( map( *A, lower ) );
+
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+
+   if( !mixedDecompose<SF>( As, ipiv.get() ) ) {
+      return false;
+   }
+
+   const BT tol( max( sum<rowwise>( abs( *A ) ) ) *
+                 std::numeric_limits<BT>::epsilon() * std::sqrt( BT( N ) ) );
+
+   auto Xs( evaluate( map( B, lower ) ) );
+   mixedSubstitute<SF>( As, Xs, ipiv.get() );
+   X = map( Xs, higher );
+
+   MT2 R( B - (*A) * X );
+
+   BT residual( maxNorm( R ) );
+   BT previous( std::numeric_limits<BT>::infinity() );
+
+   for( size_t iteration=0UL; ; ++iteration )
+   {
+      if( isRefined( R, X, tol ) ) {
+         return true;
+      }
+
+      if( iteration == maxIterations || !( residual <= previous * BT( 0.5 ) ) ) {
+         return false;
+      }
+
+      Xs = map( R, lower );
+      mixedSubstitute<SF>( As, Xs, ipiv.get() );
+      X += map( Xs, higher );
+      R = B - (*A) * X;
+
+      previous = residual;
+      residual = maxNorm( R );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given \f$ N \times N \f$ linear system of equations (\f$ A*x=b \f$) by means
+//        of mixed precision iterative refinement.
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*x=b \f$ by
+// decomposing the system matrix in single precision and refining the solution in the working
+// precision. Since the decomposition is the dominating part of the computation, the solver is
+// up to twice as fast as the regular solve() function for \c double and \c complex<double>
+// systems and requires only half the memory bandwidth, while the solution achieves the accuracy
+// of the working precision. The decomposition is selected via the given solver flag:
+
+   \code
+   blaze::DynamicMatrix<double> A;  // The square system matrix
+   blaze::DynamicVector<double> b;  // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+
+   solve<byMixedLU>( A, x, b );   // Solving the LSE by means of a single precision LU decomposition
+   solve<byMixedLLH>( A, x, b );  // Solving the LSE by means of a single precision Cholesky decomposition
+   \endcode
+
+// The \c byMixedLLH flag may only be used for Hermitian positive definite system matrices (the
+// lower part of the matrix is used). In case the matrix cannot be decomposed in single precision
+// (e.g. due to overflow, singularity in single precision, or an indefinite matrix), or in case
+// the iterative refinement stalls since the matrix is too ill-conditioned for single precision,
+// the system is solved again by means of the regular solve() function in the working precision.
+// For \c float and \c complex<float> systems, for triangular and diagonal system matrices, and
+// for matrices of up to 6x6 the regular solve() function is used directly.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used for dense matrices and column vectors with \c float,
+// \c double, \c complex<float> or \c complex<double> element type. The attempt to call the
+// function with matrices and vectors of any other element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a x may already have been modified.
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , bool TF1       // Transpose flag of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+void solve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIFORM_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT>  );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT2> );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT2> );
+
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT2 );
+
+   using ET = ElementType_t<MT>;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( !IsDouble_v< UnderlyingBuiltin_t<ET> > || IsLower_v<MT> || IsUpper_v<MT> || (*A).rows() <= 6UL ) {
+      solve( *A, *x, *b );
+      return;
+   }
+
+   const DynamicVector<ET,columnVector> btmp( *b );
+   DynamicVector<ET,columnVector> xtmp( btmp.size() );
+
+   if( refineMixed<SF>( *A, xtmp, btmp ) ) {
+      resize( *x, xtmp.size() );
+      smpAssign( *x, xtmp );
+   }
+   else {
+      solve( *A, *x, btmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( *x ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given \f$ N \times N \f$ linear system of equations (\f$ A*X=B \f$) by means
+//        of mixed precision iterative refinement.
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param X The dense solution matrix.
+// \param B The N-dimensional dense right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*X=B \f$ by
+// decomposing the system matrix in single precision and refining the solution in the working
+// precision, where the columns of \a X are the solution vectors and the columns of \a B are the
+// given right-hand side vectors:
+
+   \code
+   blaze::DynamicMatrix<double> A;  // The square system matrix
+   blaze::DynamicMatrix<double> B;  // The right-hand side matrix
+   // ... Resizing and initialization
+
+   blaze::DynamicMatrix<double> X;  // The solution matrix
+
+   solve<byMixedLU>( A, X, B );   // Solving the LSE by means of a single precision LU decomposition
+   solve<byMixedLLH>( A, X, B );  // Solving the LSE by means of a single precision Cholesky decomposition
+   \endcode
+
+// The refinement is considered converged as soon as all right-hand sides have converged. For
+// the details of the algorithm and the fallback to the regular solve() function see the solve()
+// function for a single right-hand side vector.
+//
+// The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the number of rows of the right-hand side matrix doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note The \c solve() function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library is available and linked to the executable.
+// Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a X may already have been modified.
+*/
+template< SolverFlag SF  // Solver algorithm
+        , typename MT1   // Type of the system matrix
+        , bool SO1       // Storage order of the system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2       // Storage order of the solution matrix
+        , typename MT3   // Type of the right-hand side matrix
+        , bool SO3 >     // Storage order of the right-hand side matrix
+void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIFORM_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT3> );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT2> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT1>, ElementType_t<MT3> );
+
+   using ET = ElementType_t<MT1>;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( !IsDouble_v< UnderlyingBuiltin_t<ET> > || IsLower_v<MT1> || IsUpper_v<MT1> || (*A).rows() <= 6UL ) {
+      solve( *A, *X, *B );
+      return;
+   }
+
+   const DynamicMatrix<ET,columnMajor> Btmp( *B );
+   DynamicMatrix<ET,columnMajor> Xtmp( Btmp.rows(), Btmp.columns() );
+
+   if( refineMixed<SF>( *A, Xtmp, Btmp ) ) {
+      resize( *X, Xtmp.rows(), Xtmp.columns() );
+      smpAssign( *X, Xtmp );
+   }
+   else {
+      solve( *A, *X, Btmp );
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact( *X ), "Broken invariant detected" );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -56,23 +56,31 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMMM.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/Blocking.h>
+#include <blaze/system/Debugging.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -103,7 +111,8 @@ namespace blaze {
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+auto mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> DisableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3,ST> >
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -603,7 +612,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 // combinable, i.e. must provide a common SIMD interface.
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+auto mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> DisableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3,ST> >
 {
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
@@ -1067,6 +1077,104 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general single or double precision dense matrix/dense matrix
+//        multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$ for matrices of single or double
+// precision floating point elements. Both \a A and \a B must be non-expression dense matrix
+// types, \a C must be a non-expression, non-adaptor dense matrix type. The multiplication is
+// performed by the packed, cache-blocked kernel (see packedMmm()).
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST >
+auto mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> EnableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3,ST> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   if( isDefault( beta ) ) {
+      reset( *C );
+   }
+   else if( !isOne( beta ) ) {
+      (*C) *= beta;
+   }
+
+   packedMmm( C, A, B, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general single or double precision dense matrix/dense matrix
+//        multiplication with a fused custom operation (\f$ C=op(\alpha*A*B+\beta*C) \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \param op The custom operation to be applied to each element of the result.
+// \return void
+//
+// This function implements the compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=op(\alpha*A*B+\beta*C) \f$ for matrices of single or
+// double precision floating point elements. The custom operation \a op is applied to every
+// block of \a C directly after the block has been computed by the packed, cache-blocked kernel
+// (see packedMmm()). Both \a A and \a B must be non-expression dense matrix types, \a C must
+// be a non-expression, non-adaptor dense matrix type.
+*/
+template< typename MT1, bool SO, typename MT2, typename MT3, typename ST, typename OP >
+auto mmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta, OP op )
+   -> EnableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3,ST> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE     ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   if( isDefault( beta ) ) {
+      reset( *C );
+   }
+   else if( !isOne( beta ) ) {
+      (*C) *= beta;
+   }
+
+   packedMmm( C, A, B, alpha, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Compute kernel for a general dense matrix/dense matrix multiplication (\f$ C=A*B \f$).
@@ -3245,6 +3353,141 @@ inline void ummm( MT1& C, const MT2& A, const MT3& B )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the two given operands represent a matrix and its own transpose.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return \a true in case \f$ B = A^T \f$ on the data level, \a false if not.
+//
+// This function checks whether the product \f$ A*B \f$ of the two given dense matrix operands
+// of opposite storage order is a Gram matrix of the form \f$ A*A^T \f$ (or \f$ A^T*A \f$),
+// i.e. whether both operands alias the very same data with the same spacing. In this case the
+// product is symmetric and it suffices to compute a single triangle of the result.
+*/
+template< typename MT1  // Type of the left-hand side matrix operand
+        , typename MT2  // Type of the right-hand side matrix operand
+        , EnableIf_t< HasConstDataAccess_v<MT1> && HasConstDataAccess_v<MT2> &&
+                      IsRowMajorMatrix_v<MT1> != IsRowMajorMatrix_v<MT2> &&
+                      IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > >* = nullptr >
+inline bool isGramian( const MT1& A, const MT2& B ) noexcept
+{
+   return A.rows()    == B.columns() &&
+          A.columns() == B.rows()    &&
+          A.spacing() == B.spacing() &&
+          A.data()    == B.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the two given operands represent a matrix and its own transpose.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return \a false.
+//
+// This overload handles all operands without data access, which are never considered a Gram
+// matrix product.
+*/
+template< typename MT1  // Type of the left-hand side matrix operand
+        , typename MT2  // Type of the right-hand side matrix operand
+        , DisableIf_t< HasConstDataAccess_v<MT1> && HasConstDataAccess_v<MT2> &&
+                       IsRowMajorMatrix_v<MT1> != IsRowMajorMatrix_v<MT2> &&
+                       IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > >* = nullptr >
+inline bool isGramian( const MT1& /*A*/, const MT2& /*B*/ ) noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mirrors the lower triangle of the given row-major square matrix into its upper triangle.
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \return void
+*/
+template< typename MT >  // Type of the target dense matrix
+void symmetrize( DenseMatrix<MT,false>& C )
+{
+   const size_t M( (*C).rows()    );
+   const size_t N( (*C).columns() );
+
+   BLAZE_INTERNAL_ASSERT( M == N, "Non-square matrix detected" );
+
+   for( size_t ii=0UL; ii<M; ii+=BLOCK_SIZE )
+   {
+      const size_t iend( min( M, ii+BLOCK_SIZE ) );
+
+      for( size_t i=ii; i<iend; ++i ) {
+         for( size_t j=i+1UL; j<iend; ++j ) {
+            (*C)(i,j) = (*C)(j,i);
+         }
+      }
+
+      for( size_t jj=ii+BLOCK_SIZE; jj<N; jj+=BLOCK_SIZE ) {
+         const size_t jend( min( N, jj+BLOCK_SIZE ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               (*C)(i,j) = (*C)(j,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mirrors the upper triangle of the given column-major square matrix into its lower triangle.
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \return void
+*/
+template< typename MT >  // Type of the target dense matrix
+void symmetrize( DenseMatrix<MT,true>& C )
+{
+   const size_t M( (*C).rows()    );
+   const size_t N( (*C).columns() );
+
+   BLAZE_INTERNAL_ASSERT( M == N, "Non-square matrix detected" );
+
+   for( size_t jj=0UL; jj<N; jj+=BLOCK_SIZE )
+   {
+      const size_t jend( min( N, jj+BLOCK_SIZE ) );
+
+      for( size_t j=jj; j<jend; ++j ) {
+         for( size_t i=jj+1UL; i<jend; ++i ) {
+            (*C)(i,j) = (*C)(j,i);
+         }
+      }
+
+      for( size_t ii=jj+BLOCK_SIZE; ii<M; ii+=BLOCK_SIZE ) {
+         const size_t iend( min( M, ii+BLOCK_SIZE ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               (*C)(i,j) = (*C)(j,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Compute kernel for a symmetric dense matrix/dense matrix multiplication
@@ -3284,32 +3527,10 @@ void smmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha )
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
    lmmm( C, A, B, alpha, ST(0) );
-
-   for( size_t ii=0UL; ii<M; ii+=BLOCK_SIZE )
-   {
-      const size_t iend( min( M, ii+BLOCK_SIZE ) );
-
-      for( size_t i=ii; i<iend; ++i ) {
-         for( size_t j=i+1UL; j<iend; ++j ) {
-            (*C)(i,j) = (*C)(j,i);
-         }
-      }
-
-      for( size_t jj=ii+BLOCK_SIZE; jj<N; jj+=BLOCK_SIZE ) {
-         const size_t jend( min( N, jj+BLOCK_SIZE ) );
-         for( size_t i=ii; i<iend; ++i ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               (*C)(i,j) = (*C)(j,i);
-            }
-         }
-      }
-   }
+   symmetrize( C );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3354,32 +3575,10 @@ void smmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha )
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
    ummm( C, A, B, alpha, ST(0) );
-
-   for( size_t jj=0UL; jj<N; jj+=BLOCK_SIZE )
-   {
-      const size_t jend( min( N, jj+BLOCK_SIZE ) );
-
-      for( size_t j=jj; j<jend; ++j ) {
-         for( size_t i=jj+1UL; i<jend; ++i ) {
-            (*C)(i,j) = (*C)(j,i);
-         }
-      }
-
-      for( size_t ii=jj+BLOCK_SIZE; ii<M; ii+=BLOCK_SIZE ) {
-         const size_t iend( min( M, ii+BLOCK_SIZE ) );
-         for( size_t j=jj; j<jend; ++j ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               (*C)(i,j) = (*C)(j,i);
-            }
-         }
-      }
-   }
+   symmetrize( C );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3596,6 +3795,116 @@ inline void hmmm( MT1& C, const MT2& A, const MT3& B )
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  MAPPED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused evaluation of a mapped dense matrix/dense matrix multiplication
+//        (\f$ C=op(\alpha*A*B+\beta*C) \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param left The left-hand side multiplication operand.
+// \param right The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \param op The custom operation to be applied to each element of the result.
+// \param threshold The minimum number of elements of \a C for the fused kernel.
+// \return \a true in case the multiplication has been evaluated, \a false if not.
+//
+// This function implements the mapAssign() and mapAddAssign() functions of the dense matrix
+// multiplication expressions. The two operands are evaluated into the types \a LT and \a RT
+// and the custom operation is fused into the packed kernel (see mmm()). Empty products, small
+// matrices, diagonal operands and Gram matrix products are not handled by this function and
+// \a C is left unchanged. In that case the function returns \a false and the calling expression
+// evaluates the multiplication and applies the custom operation in two separate passes.
+*/
+template< bool Fused     // Compile time switch for the fused kernel
+        , typename LT    // Evaluation type of the left-hand side operand
+        , typename RT    // Evaluation type of the right-hand side operand
+        , typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side multiplication operand
+        , typename MT3   // Type of the right-hand side multiplication operand
+        , typename ST    // Type of the scaling factors
+        , typename OP >  // Type of the custom operation
+inline auto mapmmm( DenseMatrix<MT1,SO>& C, const MT2& left, const MT3& right,
+                    ST alpha, ST beta, OP op, size_t threshold )
+   -> EnableIf_t< Fused, bool >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT1> >::size );
+
+   BLAZE_INTERNAL_ASSERT( (*C).rows()    == left.rows()    , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*C).columns() == right.columns(), "Invalid number of columns" );
+
+   if( ( IsDiagonal_v<MT2> || IsDiagonal_v<MT3> ) ||
+       ( (*C).rows() == 0UL || (*C).columns() == 0UL || left.columns() == 0UL ) ||
+       ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT1> && right.columns() <= SIMDSIZE*10UL ) ||
+       ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT1> && left.rows() <= SIMDSIZE*10UL ) ||
+       ( (*C).rows() * (*C).columns() < threshold ) ||
+       isGramian( left, right ) ) {
+      return false;
+   }
+
+   LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
+   RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == left.rows()    , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == left.columns() , "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( B.rows()    == right.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == right.columns(), "Invalid number of columns" );
+
+   mmm( C, A, B, alpha, beta, op );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused evaluation of a mapped dense matrix/dense matrix multiplication
+//        (\f$ C=op(\alpha*A*B+\beta*C) \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param left The left-hand side multiplication operand.
+// \param right The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \param op The custom operation to be applied to each element of the result.
+// \param threshold The minimum number of elements of \a C for the fused kernel.
+// \return \a false.
+//
+// This overload handles all multiplications that cannot be computed by the packed kernel. It
+// leaves \a C unchanged and returns \a false.
+*/
+template< bool Fused     // Compile time switch for the fused kernel
+        , typename LT    // Evaluation type of the left-hand side operand
+        , typename RT    // Evaluation type of the right-hand side operand
+        , typename MT1   // Type of the left-hand side target matrix
+        , bool SO        // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side multiplication operand
+        , typename MT3   // Type of the right-hand side multiplication operand
+        , typename ST    // Type of the scaling factors
+        , typename OP >  // Type of the custom operation
+inline auto mapmmm( DenseMatrix<MT1,SO>& /*C*/, const MT2& /*left*/, const MT3& /*right*/,
+                    ST /*alpha*/, ST /*beta*/, OP /*op*/, size_t /*threshold*/ )
+   -> DisableIf_t< Fused, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,1587 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size dense matrices
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <utility>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/LSE.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDetExpr.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batch of fixed-size dense matrices.
+// \ingroup dense_matrix
+//
+// The MatrixBatch class template represents a batch of an arbitrary number of dense \a M by
+// \a N matrices. It is designed for applications that operate on a large number of independent
+// small matrices (as for instance the 3x3 and 6x6 matrices of rigid body simulations), where the
+// operations on a single StaticMatrix leave most SIMD lanes idle. The type of the elements and
+// the dimensions of the matrices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class MatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MatrixBatch can be used with any
+//          non-cv-qualified, non-reference element type.
+//  - M   : specifies the number of rows of every matrix of the batch.
+//  - N   : specifies the number of columns of every matrix of the batch.
+//
+// In contrast to a std::vector of StaticMatrix, MatrixBatch interleaves the elements of the
+// matrices across SIMD lanes: The same element of \a S consecutive matrices is stored in a
+// single SIMD pack, where \a S is the number of elements per SIMD pack of the element type (see
+// packSize()). Therefore every SIMD lane processes a different matrix and all batched operations
+// are performed with the full SIMD width, independent of the size of the matrices. Additionally,
+// in case the number of matrices of the batch exceeds the SMP_BATCH_THRESHOLD, the batched
+// operations are parallelized across blocks of SIMD packs:
+
+   \code
+   using blaze::MatrixBatch;
+   using blaze::VectorBatch;
+
+   MatrixBatch<double,3UL,3UL> A( 1000000UL ), B( 1000000UL ), C;
+   VectorBatch<double,3UL> x( 1000000UL ), y;
+   // ... Initialization
+
+   mult( C, A, B );  // Computes C[k] = A[k] * B[k] for all matrices of the batch
+   mult( y, A, x );  // Computes y[k] = A[k] * x[k] for all matrices of the batch
+   invert( A );      // Inverts all matrices of the batch
+   solve( A, y, x ); // Solves the LSEs A[k]*y[k] = x[k] for all matrices of the batch
+   \endcode
+
+// Due to the interleaved storage, the single matrices cannot be accessed via a contiguous array.
+// Instead, the matrices can be accessed element-wise via the function call operator or as a
+// whole via the get() and set() functions:
+
+   \code
+   MatrixBatch<double,3UL,3UL> A( 100UL );
+
+   A( 5UL, 1UL, 2UL ) = 2.0;  // Setting element (1,2) of matrix 5
+
+   blaze::StaticMatrix<double,3UL,3UL> M{ { 1.0, 2.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 3.0 } };
+   A.set( 7UL, M );  // Setting matrix 7
+   M = A.get( 5UL );  // Extracting matrix 5
+   \endcode
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+class MatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using MatrixType  = StaticMatrix<Type,M,N,rowMajor>;  //!< Type of a single matrix of the batch.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the vectorized operations on the batch.
+   static constexpr bool simdEnabled = BatchPack<Type>::vectorizable;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixBatch( size_t n = 0UL );
+            inline MatrixBatch( const MatrixBatch& b );
+            inline MatrixBatch( MatrixBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type&       operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline const Type& operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Type*       data  () noexcept;
+   inline const Type* data  () const noexcept;
+   inline Type*       data  ( size_t p ) noexcept;
+   inline const Type* data  ( size_t p ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MatrixBatch& operator=( const MatrixBatch& rhs );
+   inline MatrixBatch& operator=( MatrixBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static constexpr size_t rows    () noexcept;
+   static constexpr size_t columns () noexcept;
+   static constexpr size_t packSize() noexcept;
+
+   inline size_t     size  () const noexcept;
+   inline size_t     packs () const noexcept;
+   inline MatrixType get   ( size_t k ) const;
+   inline void       reset ();
+   inline void       resize( size_t n, bool preserve=true );
+   inline void       swap  ( MatrixBatch& b ) noexcept;
+
+   template< typename MT, bool SO >
+   inline void set( size_t k, const DenseMatrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t packsFor( size_t n ) noexcept;
+   static inline size_t index( size_t k, size_t i, size_t j ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;   //!< The current number of matrices of the batch.
+   size_t packs_;  //!< The current number of SIMD packs of the batch.
+   Type*  v_;      //!< The interleaved elements of all matrices of the batch.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are initialized to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n )
+   : size_ ( n )              // The current number of matrices of the batch
+   , packs_( packsFor( n ) )  // The current number of SIMD packs of the batch
+   , v_    ( nullptr )        // The interleaved elements of all matrices of the batch
+{
+   if( packs_ > 0UL ) {
+      v_ = allocate<Type>( packs_*M*N*packSize() );
+      reset();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for MatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( const MatrixBatch& b )
+   : MatrixBatch( b.size_ )
+{
+   std::copy( b.v_, b.v_ + packs_*M*N*packSize(), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MatrixBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( MatrixBatch&& b ) noexcept
+   : size_ ( b.size_  )  // The current number of matrices of the batch
+   , packs_( b.packs_ )  // The current number of SIMD packs of the batch
+   , v_    ( b.v_     )  // The interleaved elements of all matrices of the batch
+{
+   b.size_  = 0UL;
+   b.packs_ = 0UL;
+   b.v_     = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>::~MatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the matrices of the batch.
+//
+// \param k Index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed element.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline Type& MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"   );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the matrices of the batch.
+//
+// \param k Index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed element.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline const Type& MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"   );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// The elements of the \a p-th SIMD pack are stored in the range \f$ [p*M*N*S..(p+1)*M*N*S) \f$,
+// where \a S is the number of matrices per SIMD pack (see packSize()). Within a SIMD pack the
+// element \f$ (i,j) \f$ of the \a l-th matrix of the pack is stored at the offset
+// \f$ (i*N+j)*S+l \f$.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline Type* MatrixBatch<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline const Type* MatrixBatch<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the given SIMD pack.
+//
+// \param p Index of the SIMD pack. The index has to be in the range \f$[0..packs-1]\f$.
+// \return Pointer to the first element of the SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline Type* MatrixBatch<Type,M,N>::data( size_t p ) noexcept
+{
+   BLAZE_USER_ASSERT( p < packs_, "Invalid pack access index" );
+   return v_ + p*M*N*packSize();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the given SIMD pack.
+//
+// \param p Index of the SIMD pack. The index has to be in the range \f$[0..packs-1]\f$.
+// \return Pointer to the first element of the SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline const Type* MatrixBatch<Type,M,N>::data( size_t p ) const noexcept
+{
+   BLAZE_USER_ASSERT( p < packs_, "Invalid pack access index" );
+   return v_ + p*M*N*packSize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( const MatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   MatrixBatch tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MatrixBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( MatrixBatch&& rhs ) noexcept
+{
+   MatrixBatch tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of every matrix of the batch.
+//
+// \return The number of rows per matrix.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+constexpr size_t MatrixBatch<Type,M,N>::rows() noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of every matrix of the batch.
+//
+// \return The number of columns per matrix.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+constexpr size_t MatrixBatch<Type,M,N>::columns() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of matrices per SIMD pack.
+//
+// \return The number of matrices per SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+constexpr size_t MatrixBatch<Type,M,N>::packSize() noexcept
+{
+   return BatchPack<Type>::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline size_t MatrixBatch<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of SIMD packs of the batch.
+//
+// \return The number of SIMD packs of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline size_t MatrixBatch<Type,M,N>::packs() const noexcept
+{
+   return packs_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th matrix of the batch.
+//
+// \param k Index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th matrix of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline typename MatrixBatch<Type,M,N>::MatrixType MatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+
+   MatrixType m;
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         m(i,j) = v_[index(k,i,j)];
+      }
+   }
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th matrix of the batch.
+//
+// \param k Index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The dense matrix to be copied into the batch.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline void MatrixBatch<Type,M,N>::set( size_t k, const DenseMatrix<MT,SO>& m )
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+
+   if( (*m).rows() != M || (*m).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         v_[index(k,i,j)] = (*m)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline void MatrixBatch<Type,M,N>::reset()
+{
+   std::fill( v_, v_ + packs_*M*N*packSize(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old matrices of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function changes the number of matrices of the batch. During this operation, new dynamic
+// memory may be allocated in case the number of SIMD packs changes. In case \a preserve is set
+// to \a true, the first min(\a n,size()) matrices are preserved. All new matrices are initialized
+// to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline void MatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   if( n == size_ ) return;
+
+   MatrixBatch tmp( n );
+
+   if( preserve ) {
+      const size_t kend( min( n, size_ ) );
+      for( size_t k=0UL; k<kend; ++k ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               tmp.v_[index(k,i,j)] = v_[index(k,i,j)];
+            }
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline void MatrixBatch<Type,M,N>::swap( MatrixBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_ , b.size_  );
+   swap( packs_, b.packs_ );
+   swap( v_    , b.v_     );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of SIMD packs required for the given number of matrices.
+//
+// \param n The number of matrices.
+// \return The number of SIMD packs.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline size_t MatrixBatch<Type,M,N>::packsFor( size_t n ) noexcept
+{
+   return ( n + packSize() - 1UL ) / packSize();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the storage index of the given element.
+//
+// \param k Index of the matrix of the batch.
+// \param i Row index of the element.
+// \param j Column index of the element.
+// \return The index of the element in the internal storage.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline size_t MatrixBatch<Type,M,N>::index( size_t k, size_t i, size_t j ) noexcept
+{
+   return ( ( k / packSize() )*M*N + i*N + j )*packSize() + k % packSize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given matrix batch.
+// \ingroup dense_matrix
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline void reset( MatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrix batches.
+// \ingroup dense_matrix
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows per matrix
+        , size_t N >     // Number of columns per matrix
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the determinants of a SIMD pack of matrices for singularity.
+// \ingroup dense_matrix
+//
+// \param det The SIMD pack of determinants.
+// \param lanes The number of valid SIMD lanes (i.e. the number of matrices) of the pack.
+// \return \a true if all valid lanes are invertible, \a false if not.
+//
+// This function checks the first \a lanes lanes of the given SIMD pack of determinants via
+// isDivisor(). All lanes that are no divisors, including the padding lanes of the last pack of
+// a batch, are set to 1 to keep the following division by the determinants well-defined.
+*/
+template< typename Type >  // Data type of the elements
+inline bool checkBatchDivisors( BatchPack_t<Type>& det, size_t lanes )
+{
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   alignas( AlignmentOf_v<Type> ) Type tmp[SS];
+   storePack( tmp, det );
+
+   bool valid( true );
+
+   for( size_t l=0UL; l<SS; ++l ) {
+      if( !isDivisor( tmp[l] ) ) {
+         if( l < lanes ) valid = false;
+         tmp[l] = Type(1);
+      }
+   }
+
+   det = loadPack( tmp );
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch multiplication functions */
+//@{
+template< typename Type, size_t M, size_t K, size_t N >
+void mult( MatrixBatch<Type,M,N>& C, const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t M, size_t N >
+void mult( VectorBatch<Type,M>& y, const MatrixBatch<Type,M,N>& A, const VectorBatch<Type,N>& x );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of two matrix batches (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense_matrix
+//
+// \param C The resulting batch of \a M by \a N matrices.
+// \param A The left-hand side batch of \a M by \a K matrices.
+// \param B The right-hand side batch of \a K by \a N matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products of all corresponding matrices of the two batches \a A
+// and \a B. Every SIMD lane computes the product of a different pair of matrices and the SIMD
+// packs are processed in parallel in case the batch size exceeds the SMP_BATCH_THRESHOLD. The
+// batch \a C is resized to the size of \a A. It may alias \a A or \a B.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void mult( MatrixBatch<Type,M,N>& C, const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   C.resize( A.size(), false );
+
+   batchLoop( A.size(), A.packs(), [&C,&A,&B]( size_t begin, size_t end )
+   {
+      for( size_t p=begin; p<end; ++p )
+      {
+         const Type* pa( A.data(p) );
+         const Type* pb( B.data(p) );
+         Type* pc( C.data(p) );
+
+         PT tmp[M*N]{};
+
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t k=0UL; k<K; ++k ) {
+               const PT a1( loadPack( pa + (i*K+k)*SS ) );
+               for( size_t j=0UL; j<N; ++j ) {
+                  tmp[i*N+j] = tmp[i*N+j] + a1 * loadPack( pb + (k*N+j)*SS );
+               }
+            }
+         }
+
+         for( size_t ij=0UL; ij<M*N; ++ij ) {
+            storePack( pc + ij*SS, tmp[ij] );
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of a matrix batch and a vector batch (\f$ y_k=A_k*x_k \f$).
+// \ingroup dense_matrix
+//
+// \param y The resulting batch of vectors with \a M elements.
+// \param A The batch of \a M by \a N matrices.
+// \param x The batch of vectors with \a N elements.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products of all corresponding matrices and vectors of the two
+// batches \a A and \a x. Every SIMD lane computes the product of a different matrix/vector pair
+// and the SIMD packs are processed in parallel in case the batch size exceeds the
+// SMP_BATCH_THRESHOLD. The batch \a y is resized to the size of \a A. It may alias \a x.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void mult( VectorBatch<Type,M>& y, const MatrixBatch<Type,M,N>& A, const VectorBatch<Type,N>& x )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   if( A.size() != x.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   y.resize( A.size(), false );
+
+   batchLoop( A.size(), A.packs(), [&y,&A,&x]( size_t begin, size_t end )
+   {
+      for( size_t p=begin; p<end; ++p )
+      {
+         const Type* pa( A.data(p) );
+         const Type* px( x.data(p) );
+         Type* py( y.data(p) );
+
+         PT tmp[M]{};
+
+         for( size_t j=0UL; j<N; ++j ) {
+            const PT x1( loadPack( px + j*SS ) );
+            for( size_t i=0UL; i<M; ++i ) {
+               tmp[i] = tmp[i] + loadPack( pa + (i*N+j)*SS ) * x1;
+            }
+         }
+
+         for( size_t i=0UL; i<M; ++i ) {
+            storePack( py + i*SS, tmp[i] );
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ 2 \times 2 \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all matrices were inverted, \a false if any matrix is singular.
+//
+// This function is the SIMD counterpart of the invertGeneral2x2() function: Every SIMD lane
+// inverts a different matrix of the batch via the rule of Sarrus.
+*/
+template< typename Type >  // Data type of the elements
+bool invertBatch( MatrixBatch<Type,2UL,2UL>& A, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      Type* pa( A.data(p) );
+
+      const PT a00( loadPack( pa      ) );
+      const PT a01( loadPack( pa+  SS ) );
+      const PT a10( loadPack( pa+2*SS ) );
+      const PT a11( loadPack( pa+3*SS ) );
+
+      PT det( a00*a11 - a01*a10 );
+
+      if( !checkBatchDivisors<Type>( det, min( SS, A.size()-p*SS ) ) ) {
+         valid = false;
+      }
+
+      storePack( pa     , a11 / det );
+      storePack( pa+  SS, ( PT() - a01 ) / det );
+      storePack( pa+2*SS, ( PT() - a10 ) / det );
+      storePack( pa+3*SS, a00 / det );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ 3 \times 3 \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all matrices were inverted, \a false if any matrix is singular.
+//
+// This function is the SIMD counterpart of the invertGeneral3x3() function: Every SIMD lane
+// inverts a different matrix of the batch via the rule of Sarrus.
+*/
+template< typename Type >  // Data type of the elements
+bool invertBatch( MatrixBatch<Type,3UL,3UL>& A, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      Type* pa( A.data(p) );
+
+      const PT a00( loadPack( pa      ) );
+      const PT a01( loadPack( pa+  SS ) );
+      const PT a02( loadPack( pa+2*SS ) );
+      const PT a10( loadPack( pa+3*SS ) );
+      const PT a11( loadPack( pa+4*SS ) );
+      const PT a12( loadPack( pa+5*SS ) );
+      const PT a20( loadPack( pa+6*SS ) );
+      const PT a21( loadPack( pa+7*SS ) );
+      const PT a22( loadPack( pa+8*SS ) );
+
+      const PT b00( a11*a22 - a12*a21 );
+      const PT b10( a12*a20 - a10*a22 );
+      const PT b20( a10*a21 - a11*a20 );
+
+      PT det( a00*b00 + a01*b10 + a02*b20 );
+
+      if( !checkBatchDivisors<Type>( det, min( SS, A.size()-p*SS ) ) ) {
+         valid = false;
+      }
+
+      storePack( pa     , b00 / det );
+      storePack( pa+  SS, ( a02*a21 - a01*a22 ) / det );
+      storePack( pa+2*SS, ( a01*a12 - a02*a11 ) / det );
+      storePack( pa+3*SS, b10 / det );
+      storePack( pa+4*SS, ( a00*a22 - a02*a20 ) / det );
+      storePack( pa+5*SS, ( a02*a10 - a00*a12 ) / det );
+      storePack( pa+6*SS, b20 / det );
+      storePack( pa+7*SS, ( a01*a20 - a00*a21 ) / det );
+      storePack( pa+8*SS, ( a00*a11 - a01*a10 ) / det );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ N \times N \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all matrices were inverted, \a false if any matrix is singular.
+//
+// This function inverts the matrices of the given SIMD packs one by one by means of the
+// invert() function for dense matrices, which selects the according closed-form kernel (as
+// for instance invertGeneral4x4()) or the LAPACK-based inversion for larger matrices.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns per matrix
+bool invertBatch( MatrixBatch<Type,N,N>& A, size_t begin, size_t end )
+{
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t k=begin*SS; k<min( end*SS, A.size() ); ++k )
+   {
+      StaticMatrix<Type,N,N,rowMajor> tmp( A.get(k) );
+
+      try {
+         invert( tmp );
+      }
+      catch( const std::exception& ) {
+         valid = false;
+         continue;
+      }
+
+      A.set( k, tmp );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of all matrices of the given batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of general square matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch. \f$ 2 \times 2 \f$ and \f$ 3 \times 3 \f$
+// matrices are inverted via the SIMD counterparts of the closed-form kernels of the invert()
+// function, where every SIMD lane inverts a different matrix. Larger matrices are inverted one
+// by one via invert(). In both cases the SIMD packs are processed in parallel in case the batch
+// size exceeds the SMP_BATCH_THRESHOLD.
+//
+// The inversion fails if any of the matrices is singular. In this case a \a std::runtime_error
+// exception is thrown after all other matrices have been inverted. The singular matrices are
+// left in an unspecified state.
+//
+// \note The batched inversion can only be used for batches with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// batches of any other element type results in a compile time error!
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns per matrix
+void invert( MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   std::atomic<bool> valid( true );
+
+   batchLoop( A.size(), A.packs(), [&A,&valid]( size_t begin, size_t end )
+   {
+      if( !invertBatch( A, begin, end ) ) {
+         valid = false;
+      }
+   } );
+
+   if( !valid ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DETERMINANT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores the determinants of a SIMD pack of matrices in the given dense vector.
+// \ingroup dense_matrix
+//
+// \param d The target dense vector.
+// \param k The index of the first matrix of the SIMD pack.
+// \param lanes The number of valid SIMD lanes (i.e. the number of matrices) of the pack.
+// \param det The SIMD pack of determinants.
+// \return void
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag of the dense vector
+        , typename Type >  // Data type of the elements
+inline void storeBatchDet( DenseVector<VT,TF>& d, size_t k, size_t lanes,
+                           const BatchPack_t<Type>& det )
+{
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   alignas( AlignmentOf_v<Type> ) Type tmp[SS];
+   storePack( tmp, det );
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      (*d)[k+l] = tmp[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinants of the SIMD packs \f$ [begin..end) \f$ of a batch of
+//        \f$ 2 \times 2 \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices.
+// \param d The dense vector for the determinants.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+void detBatch( const MatrixBatch<Type,2UL,2UL>& A, DenseVector<VT,TF>& d, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      const Type* pa( A.data(p) );
+
+      const PT det( loadPack( pa      ) * loadPack( pa+3*SS ) -
+                    loadPack( pa+  SS ) * loadPack( pa+2*SS ) );
+
+      storeBatchDet<VT,TF,Type>( d, p*SS, min( SS, A.size()-p*SS ), det );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinants of the SIMD packs \f$ [begin..end) \f$ of a batch of
+//        \f$ 3 \times 3 \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices.
+// \param d The dense vector for the determinants.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+void detBatch( const MatrixBatch<Type,3UL,3UL>& A, DenseVector<VT,TF>& d, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      const Type* pa( A.data(p) );
+
+      const PT a00( loadPack( pa      ) );
+      const PT a01( loadPack( pa+  SS ) );
+      const PT a02( loadPack( pa+2*SS ) );
+      const PT a10( loadPack( pa+3*SS ) );
+      const PT a11( loadPack( pa+4*SS ) );
+      const PT a12( loadPack( pa+5*SS ) );
+      const PT a20( loadPack( pa+6*SS ) );
+      const PT a21( loadPack( pa+7*SS ) );
+      const PT a22( loadPack( pa+8*SS ) );
+
+      const PT det( a00*( a11*a22 - a12*a21 ) +
+                    a01*( a12*a20 - a10*a22 ) +
+                    a02*( a10*a21 - a11*a20 ) );
+
+      storeBatchDet<VT,TF,Type>( d, p*SS, min( SS, A.size()-p*SS ), det );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinants of the SIMD packs \f$ [begin..end) \f$ of a batch of
+//        \f$ N \times N \f$ matrices.
+// \ingroup dense_matrix
+//
+// \param A The batch of matrices.
+// \param d The dense vector for the determinants.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N       // Number of rows and columns per matrix
+        , typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+void detBatch( const MatrixBatch<Type,N,N>& A, DenseVector<VT,TF>& d, size_t begin, size_t end )
+{
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   for( size_t k=begin*SS; k<min( end*SS, A.size() ); ++k ) {
+      (*d)[k] = det( A.get(k) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinants of all matrices of the given batch.
+// \ingroup dense_matrix
+//
+// \param A The batch of general square matrices.
+// \param d The resulting dense vector of determinants.
+// \return void
+// \exception std::invalid_argument Invalid vector size.
+//
+// This function computes the determinants of all matrices of the given batch and stores them
+// in the given dense vector, which is resized to the size of the batch. The determinants of
+// \f$ 2 \times 2 \f$ and \f$ 3 \times 3 \f$ matrices are computed via SIMD, where every SIMD
+// lane processes a different matrix. The determinants of larger matrices are computed one by
+// one via det(). In both cases the SIMD packs are processed in parallel in case the batch size
+// exceeds the SMP_BATCH_THRESHOLD. In case the size of \a d cannot be adapted, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N       // Number of rows and columns per matrix
+        , typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+void det( const MatrixBatch<Type,N,N>& A, DenseVector<VT,TF>& d )
+{
+   resize( *d, A.size(), false );
+
+   batchLoop( A.size(), A.packs(), [&A,&d]( size_t begin, size_t end )
+   {
+      detBatch( A, d, begin, end );
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LSE SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving the LSEs of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ 2 \times 2 \f$ systems.
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param x The batch of solution vectors.
+// \param b The batch of right-hand side vectors.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all LSEs were solved, \a false if any system matrix is singular.
+//
+// This function is the SIMD counterpart of the solve2x2() function: Every SIMD lane solves a
+// different LSE of the batch via Cramer's rule.
+*/
+template< typename Type >  // Data type of the elements
+bool solveBatch( const MatrixBatch<Type,2UL,2UL>& A, VectorBatch<Type,2UL>& x,
+                 const VectorBatch<Type,2UL>& b, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      const Type* pa( A.data(p) );
+      const Type* pb( b.data(p) );
+      Type* px( x.data(p) );
+
+      const PT a00( loadPack( pa      ) );
+      const PT a01( loadPack( pa+  SS ) );
+      const PT a10( loadPack( pa+2*SS ) );
+      const PT a11( loadPack( pa+3*SS ) );
+      const PT b0 ( loadPack( pb      ) );
+      const PT b1 ( loadPack( pb+  SS ) );
+
+      PT det( a00*a11 - a01*a10 );
+
+      if( !checkBatchDivisors<Type>( det, min( SS, A.size()-p*SS ) ) ) {
+         valid = false;
+      }
+
+      storePack( px   , ( a11*b0 - a01*b1 ) / det );
+      storePack( px+SS, ( a00*b1 - a10*b0 ) / det );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving the LSEs of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ 3 \times 3 \f$ systems.
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param x The batch of solution vectors.
+// \param b The batch of right-hand side vectors.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all LSEs were solved, \a false if any system matrix is singular.
+//
+// This function is the SIMD counterpart of the solve3x3() function: Every SIMD lane solves a
+// different LSE of the batch via Cramer's rule.
+*/
+template< typename Type >  // Data type of the elements
+bool solveBatch( const MatrixBatch<Type,3UL,3UL>& A, VectorBatch<Type,3UL>& x,
+                 const VectorBatch<Type,3UL>& b, size_t begin, size_t end )
+{
+   using PT = BatchPack_t<Type>;
+
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t p=begin; p<end; ++p )
+   {
+      const Type* pa( A.data(p) );
+      const Type* pb( b.data(p) );
+      Type* px( x.data(p) );
+
+      const PT a00( loadPack( pa      ) );
+      const PT a01( loadPack( pa+  SS ) );
+      const PT a02( loadPack( pa+2*SS ) );
+      const PT a10( loadPack( pa+3*SS ) );
+      const PT a11( loadPack( pa+4*SS ) );
+      const PT a12( loadPack( pa+5*SS ) );
+      const PT a20( loadPack( pa+6*SS ) );
+      const PT a21( loadPack( pa+7*SS ) );
+      const PT a22( loadPack( pa+8*SS ) );
+      const PT b0 ( loadPack( pb      ) );
+      const PT b1 ( loadPack( pb+  SS ) );
+      const PT b2 ( loadPack( pb+2*SS ) );
+
+      const PT c00( a11*a22 - a12*a21 );
+      const PT c10( a12*a20 - a10*a22 );
+      const PT c20( a10*a21 - a11*a20 );
+
+      PT det( a00*c00 + a01*c10 + a02*c20 );
+
+      if( !checkBatchDivisors<Type>( det, min( SS, A.size()-p*SS ) ) ) {
+         valid = false;
+      }
+
+      const PT c01( a02*a21 - a01*a22 );
+      const PT c11( a00*a22 - a02*a20 );
+      const PT c21( a01*a20 - a00*a21 );
+      const PT c02( a01*a12 - a02*a11 );
+      const PT c12( a02*a10 - a00*a12 );
+      const PT c22( a00*a11 - a01*a10 );
+
+      storePack( px     , ( c00*b0 + c01*b1 + c02*b2 ) / det );
+      storePack( px+  SS, ( c10*b0 + c11*b1 + c12*b2 ) / det );
+      storePack( px+2*SS, ( c20*b0 + c21*b1 + c22*b2 ) / det );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving the LSEs of the SIMD packs \f$ [begin..end) \f$ of a batch of general
+//        \f$ N \times N \f$ systems.
+// \ingroup dense_matrix
+//
+// \param A The batch of system matrices.
+// \param x The batch of solution vectors.
+// \param b The batch of right-hand side vectors.
+// \param begin The index of the first SIMD pack.
+// \param end The index one past the last SIMD pack.
+// \return \a true in case all LSEs were solved, \a false if any system matrix is singular.
+//
+// This function solves the LSEs of the given SIMD packs one by one by means of the solve()
+// function for dense matrices.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns per matrix
+bool solveBatch( const MatrixBatch<Type,N,N>& A, VectorBatch<Type,N>& x,
+                 const VectorBatch<Type,N>& b, size_t begin, size_t end )
+{
+   constexpr size_t SS( BatchPack<Type>::size );
+
+   bool valid( true );
+
+   for( size_t k=begin*SS; k<min( end*SS, A.size() ); ++k )
+   {
+      const StaticVector<Type,N,columnVector> rhs( b.get(k) );
+      StaticVector<Type,N,columnVector> tmp;
+
+      try {
+         solve( A.get(k), tmp, rhs );
+      }
+      catch( const std::exception& ) {
+         valid = false;
+         continue;
+      }
+
+      x.set( k, tmp );
+   }
+
+   return valid;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear systems of equations of a batch (\f$ A_k*x_k=b_k \f$).
+// \ingroup dense_matrix
+//
+// \param A The batch of general square system matrices.
+// \param x The resulting batch of solution vectors.
+// \param b The batch of right-hand side vectors.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the linear systems of equations of all corresponding matrices and
+// vectors of the batches \a A and \a b. \f$ 2 \times 2 \f$ and \f$ 3 \times 3 \f$ systems are
+// solved via Cramer's rule in SIMD, where every SIMD lane solves a different system. Larger
+// systems are solved one by one via solve(). In both cases the SIMD packs are processed in
+// parallel in case the batch size exceeds the SMP_BATCH_THRESHOLD. The batch \a x is resized
+// to the size of \a A. It may alias \a b.
+//
+// The function fails if any of the system matrices is singular. In this case a
+// \a std::runtime_error exception is thrown after all other systems have been solved. The
+// solutions of the singular systems are left in an unspecified state.
+//
+// \note The batched solver can only be used for batches with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// batches of any other element type results in a compile time error!
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns per matrix
+void solve( const MatrixBatch<Type,N,N>& A, VectorBatch<Type,N>& x, const VectorBatch<Type,N>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.size() != b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   x.resize( A.size(), false );
+
+   std::atomic<bool> valid( true );
+
+   batchLoop( A.size(), A.packs(), [&A,&x,&b,&valid]( size_t begin, size_t end )
+   {
+      if( !solveBatch( A, x, b, begin, end ) ) {
+         valid = false;
+      }
+   } );
+
+   if( !valid ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,887 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMMM.h
+//  \brief Header file for the packed dense matrix multiplication kernel
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_DENSE_PACKEDMMM_H_
+#define _BLAZE_MATH_DENSE_PACKEDMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/RuntimeDispatch.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Debugging.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/CacheInfo.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of rows of the register block of the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The microkernel of the packed dense matrix multiplication keeps a block of \f$ MR \times NR \f$
+// elements of the target matrix in SIMD registers, where \f$ NR \f$ is a multiple of the SIMD
+// width (see PACKED_MMM_VECTORS). With the 32 SIMD registers of AVX-512 an 8x3 block of SIMD
+// registers is used, with the 16 SIMD registers of SSE and AVX a 6x2 block.
+*/
+constexpr size_t PACKED_MMM_ROWS = ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE ? 8UL : 6UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of SIMD vectors per row of the register block of the packed dense matrix
+//        multiplication kernel.
+// \ingroup dense_matrix
+*/
+constexpr size_t PACKED_MMM_VECTORS = ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE ? 3UL : 2UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the packed dense matrix multiplication
+//        kernel.
+// \ingroup dense_matrix
+//
+// The packed kernel is used for all dense matrix multiplications of single and double precision
+// floating point matrices with a common element type and a built-in scaling factor. Matrices of
+// extended precision (\c long \c double) elements are not vectorized and therefore not handled by
+// the packed kernel.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+constexpr bool UsePackedMMMKernel_v =
+   ( ( IsFloat_v< ElementType_t<MT1> > || IsDouble_v< ElementType_t<MT1> > ) &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > &&
+     IsBuiltin_v<ST> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the runtime dispatched microkernel of
+//        the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// The runtime dispatched microkernel is used in case the runtime dispatch mode is enabled (see
+// the BLAZE_USE_RUNTIME_DISPATCH switch) and the target matrix provides access to its data.
+*/
+template< typename MT >
+constexpr bool UseDispatchedPackedMMMKernel_v =
+   ( IsDispatchable_v< ElementType_t<MT> > && HasMutableDataAccess_v<MT> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CACHE BLOCKING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache block sizes of the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The packed dense matrix multiplication \f$ C+=A*B \f$ splits the \f$ K \f$ dimension into
+// blocks of \a kc elements, the \f$ M \f$ dimension into blocks of \a mc rows, and the \f$ N \f$
+// dimension into blocks of \a nc columns. A packed \f$ mc \times kc \f$ block of \a A resides in
+// the level 2 cache, a packed \f$ kc \times nc \f$ block of \a B in the level 3 cache, and a
+// single \f$ kc \times NR \f$ panel of \a B in the level 1 cache (see createPackedMMMBlocking()).
+*/
+struct PackedMMMBlocking
+{
+   size_t mc;  //!< The number of rows of a block of the left-hand side matrix.
+   size_t kc;  //!< The number of columns of a block of the left-hand side matrix.
+   size_t nc;  //!< The number of columns of a block of the right-hand side matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the cache block sizes of the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \param bytes The size of a single element in Byte.
+// \param mr The number of rows of the register block.
+// \param nr The number of columns of the register block.
+// \param cache The sizes of the data caches.
+// \return The cache block sizes.
+//
+// A \f$ kc \times nr \f$ panel of the right-hand side operand fills the level 1 cache, a packed
+// \f$ mc \times kc \f$ block of the left-hand side operand a quarter of the level 2 cache, and a
+// packed \f$ kc \times nc \f$ block of the right-hand side operand half of the level 3 cache. In
+// debug mode small block sizes are used in order to exercise all code paths of the kernel with
+// small matrices.
+*/
+inline PackedMMMBlocking createPackedMMMBlocking( size_t bytes, size_t mr, size_t nr, const CacheInfo& cache )
+{
+   if( BLAZE_DEBUG_MODE ) {
+      return PackedMMMBlocking{ 2UL*mr, 16UL, 2UL*nr };
+   }
+
+   size_t kc( cache.l1 / ( nr * bytes ) );
+   kc = min( max( kc - kc % 8UL, 16UL ), 1024UL );
+
+   size_t mc( ( cache.l2 / 4UL ) / ( kc * bytes ) );
+   mc = max( mc - mc % mr, mr );
+
+   size_t nc( ( cache.l3 / 2UL ) / ( kc * bytes ) );
+   nc = min( max( nc - nc % nr, nr ), 4096UL - 4096UL % nr );
+
+   return PackedMMMBlocking{ mc, kc, nc };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cache block sizes of the packed dense matrix multiplication kernel for the
+//        given element type.
+// \ingroup dense_matrix
+//
+// \return The cache block sizes for the given element type and register block.
+//
+// The block sizes are derived from the cache sizes detected at runtime (see getCacheInfo()) on
+// the first call of the function.
+*/
+template< typename T                                             // Element type
+        , size_t MR = PACKED_MMM_ROWS                            // Rows of the register block
+        , size_t NR = PACKED_MMM_VECTORS * SIMDTrait<T>::size >  // Columns of the register block
+const PackedMMMBlocking& getPackedMMMBlocking()
+{
+   static const PackedMMMBlocking blocking( createPackedMMMBlocking( sizeof(T), MR, NR, getCacheInfo() ) );
+   return blocking;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a thread-local packing buffer of the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \param size The required number of elements.
+// \return Pointer to the first element of the aligned buffer.
+//
+// Every thread owns one buffer per element type and buffer index \a I. The buffer only grows
+// and is reused by all subsequent multiplications of the thread, which avoids the allocation
+// of temporary memory in every call of the kernel.
+*/
+template< typename T  // Element type
+        , size_t I >  // Index of the buffer
+T* getPackingBuffer( size_t size )
+{
+   static thread_local std::unique_ptr<T[],Deallocate> buffer;
+   static thread_local size_t capacity( 0UL );
+
+   if( size > capacity ) {
+      buffer.reset( allocate<T>( size ) );
+      capacity = size;
+   }
+
+   return buffer.get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a single element of a (transposed) operand of the packed kernel.
+// \ingroup dense_matrix
+//
+// \param A The dense matrix operand.
+// \param i The row index of the logical operand.
+// \param j The column index of the logical operand.
+// \return The element \f$ A(i,j) \f$ (\a TF = \a false) or \f$ A(j,i) \f$ (\a TF = \a true).
+*/
+template< bool TF        // Transposition flag
+        , typename MT >  // Type of the dense matrix
+BLAZE_ALWAYS_INLINE ElementType_t<MT> packedElement( const MT& A, size_t i, size_t j )
+{
+   return ( TF )?( A(j,i) ):( A(i,j) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand of the packed kernel.
+// \ingroup dense_matrix
+//
+// \param buffer The target packing buffer.
+// \param A The left-hand side operand.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param m The number of rows of the block.
+// \param k The number of columns of the block.
+// \return void
+//
+// This function copies the \f$ m \times k \f$ block into panels of \a MR rows. Within a panel
+// the elements are stored column by column, which allows the microkernel to traverse the panel
+// contiguously. The last panel is padded with zeros.
+*/
+template< size_t MR      // Number of rows of a panel
+        , bool TF        // Transposition flag
+        , typename MT    // Type of the left-hand side operand
+        , typename T >   // Element type
+void packLeftOperand( T* buffer, const MT& A, size_t row, size_t column, size_t m, size_t k )
+{
+   constexpr bool contiguous( IsRowMajorMatrix_v<MT> != TF );
+
+   for( size_t ii=0UL; ii<m; ii+=MR, buffer+=MR*k )
+   {
+      const size_t rows( min( MR, m-ii ) );
+
+      if( contiguous ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t l=0UL; l<k; ++l ) {
+               buffer[l*MR+i] = packedElement<TF>( A, row+ii+i, column+l );
+            }
+         }
+      }
+      else {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t i=0UL; i<rows; ++i ) {
+               buffer[l*MR+i] = packedElement<TF>( A, row+ii+i, column+l );
+            }
+         }
+      }
+
+      for( size_t l=0UL; l<k; ++l ) {
+         for( size_t i=rows; i<MR; ++i ) {
+            buffer[l*MR+i] = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the right-hand side operand of the packed kernel.
+// \ingroup dense_matrix
+//
+// \param buffer The target packing buffer.
+// \param B The right-hand side operand.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param k The number of rows of the block.
+// \param n The number of columns of the block.
+// \return void
+//
+// This function copies the \f$ k \times n \f$ block into panels of \a NR columns. Within a panel
+// the elements are stored row by row, which allows the microkernel to load each row of a panel
+// by means of aligned SIMD loads. The last panel is padded with zeros.
+*/
+template< size_t NR      // Number of columns of a panel
+        , bool TF        // Transposition flag
+        , typename MT    // Type of the right-hand side operand
+        , typename T >   // Element type
+void packRightOperand( T* buffer, const MT& B, size_t row, size_t column, size_t k, size_t n )
+{
+   constexpr bool contiguous( IsRowMajorMatrix_v<MT> != TF );
+
+   for( size_t jj=0UL; jj<n; jj+=NR, buffer+=NR*k )
+   {
+      const size_t columns( min( NR, n-jj ) );
+
+      if( contiguous ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t j=0UL; j<columns; ++j ) {
+               buffer[l*NR+j] = packedElement<TF>( B, row+l, column+jj+j );
+            }
+         }
+      }
+      else {
+         for( size_t j=0UL; j<columns; ++j ) {
+            for( size_t l=0UL; l<k; ++l ) {
+               buffer[l*NR+j] = packedElement<TF>( B, row+l, column+jj+j );
+            }
+         }
+      }
+
+      for( size_t l=0UL; l<k; ++l ) {
+         for( size_t j=columns; j<NR; ++j ) {
+            buffer[l*NR+j] = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Microkernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param i The first row of the register block within the logical target matrix.
+// \param j The first column of the register block within the logical target matrix.
+// \param m The number of valid rows of the register block.
+// \param n The number of valid columns of the register block.
+// \param k The number of columns of the packed left-hand side panel.
+// \param a Pointer to the packed left-hand side panel.
+// \param b Pointer to the packed right-hand side panel.
+// \param alpha The scaling factor.
+// \return void
+//
+// This function computes the product of a packed \f$ MR \times k \f$ panel and a packed
+// \f$ k \times NR \f$ panel in \f$ MR \cdot NV \f$ SIMD registers and adds the scaled result
+// to the according block of the target matrix. In case \a TF is \a true, the logical target
+// matrix is the transpose of the column-major matrix \a C.
+//
+// \note The microkernel is deliberately not forced inline: Inlined into the blocking loops the
+// compiler runs out of SIMD registers and spills the right-hand side panel to the stack.
+*/
+template< size_t MR      // Number of rows of the register block
+        , size_t NV      // Number of SIMD vectors per row of the register block
+        , bool TF        // Transposition flag
+        , typename MT    // Type of the target dense matrix
+        , typename T >   // Element type
+void packedMmmKernel( MT& C, size_t i, size_t j, size_t m, size_t n,
+                      size_t k, const T* a, const T* b, T alpha )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+   constexpr size_t NR( NV*SIMDSIZE );
+
+   BLAZE_STATIC_ASSERT( NV == 2UL || NV == 3UL );
+
+   SIMDType xmm[MR][NV];
+
+   for( size_t l=0UL; l<k; ++l, a+=MR, b+=NR )
+   {
+      const SIMDType b1( loada( b ) );
+      const SIMDType b2( loada( b+SIMDSIZE ) );
+      const SIMDType b3( NV > 2UL ? loada( b+2UL*SIMDSIZE ) : b2 );
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         const SIMDType a1( set( a[r] ) );
+         xmm[r][0] += a1 * b1;
+         xmm[r][1] += a1 * b2;
+         if( NV > 2UL ) {
+            xmm[r][NV-1UL] += a1 * b3;
+         }
+      }
+   }
+
+   if( m == MR && n == NR )
+   {
+      const SIMDType factor( set( alpha ) );
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t v=0UL; v<NV; ++v ) {
+            if( TF )
+               C.storeu( j+v*SIMDSIZE, i+r, C.loadu( j+v*SIMDSIZE, i+r ) + xmm[r][v] * factor );
+            else
+               C.storeu( i+r, j+v*SIMDSIZE, C.loadu( i+r, j+v*SIMDSIZE ) + xmm[r][v] * factor );
+         }
+      }
+   }
+   else
+   {
+      alignas( AlignmentOf_v<T> ) T tmp[MR*NR];
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t v=0UL; v<NV; ++v ) {
+            storea( tmp+r*NR+v*SIMDSIZE, xmm[r][v] );
+         }
+      }
+
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c ) {
+            ( TF ? C(j+c,i+r) : C(i+r,j+c) ) += tmp[r*NR+c] * alpha;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the packed dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param kernel The microkernel for a single \f$ MR \times NR \f$ block of the target matrix.
+// \param epilogue The epilogue for a single complete block of the target matrix.
+// \return void
+//
+// This function implements the three-level cache blocking of the packed dense matrix
+// multiplication. In case \a TF is \a false, it computes \f$ C+=\alpha*A*B \f$ for a row-major
+// matrix \a C. In case \a TF is \a true, it computes \f$ C^T+=\alpha*A^T*B^T \f$ for a column-
+// major matrix \a C, such that the microkernel always operates along the contiguous dimension
+// of the target matrix. The microkernel is called with the first row and column of the block
+// within the logical target matrix, the number of valid rows and columns of the block, the
+// number of columns of the packed left-hand side panel, and the two packed panels. As soon as
+// a block of the target matrix is complete, i.e. during the last pass over the \f$ K \f$
+// dimension, the epilogue is called with the first row and column and the number of rows and
+// columns of the block within \a C. Thus the epilogue can be applied while the block still
+// resides in the level 1 cache.
+*/
+template< bool TF              // Transposition flag
+        , size_t MR            // Number of rows of the register block
+        , size_t NR            // Number of columns of the register block
+        , typename MT1         // Type of the target dense matrix
+        , typename MT2         // Type of the left-hand side operand
+        , typename MT3         // Type of the right-hand side operand
+        , typename Kernel      // Type of the microkernel
+        , typename Epilogue >  // Type of the epilogue
+void packedMmmBackend( MT1& C, const MT2& A, const MT3& B, Kernel kernel, Epilogue epilogue )
+{
+   MAYBE_UNUSED( C );
+
+   using T = ElementType_t<MT1>;
+
+   const size_t M( TF ? A.columns() : A.rows() );
+   const size_t N( TF ? B.rows() : B.columns() );
+   const size_t K( TF ? A.rows() : A.columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   if( K == 0UL ) {
+      if( TF )
+         epilogue( 0UL, 0UL, N, M );
+      else
+         epilogue( 0UL, 0UL, M, N );
+      return;
+   }
+
+   const PackedMMMBlocking& blocking( getPackedMMMBlocking<T,MR,NR>() );
+
+   const size_t mc( min( blocking.mc, M + ( MR - M % MR ) % MR ) );
+   const size_t kc( min( blocking.kc, K ) );
+   const size_t nc( min( blocking.nc, N + ( NR - N % NR ) % NR ) );
+
+   T* const bufferA( getPackingBuffer<T,0UL>( mc*kc ) );
+   T* const bufferB( getPackingBuffer<T,1UL>( kc*nc ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t jblock( min( nc, N-jj ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kblock( min( kc, K-kk ) );
+         const bool last( kk + kblock == K );
+
+         packRightOperand<NR,TF>( bufferB, B, kk, jj, kblock, jblock );
+
+         for( size_t ii=0UL; ii<M; ii+=mc )
+         {
+            const size_t iblock( min( mc, M-ii ) );
+
+            packLeftOperand<MR,TF>( bufferA, A, ii, kk, iblock, kblock );
+
+            for( size_t j=0UL; j<jblock; j+=NR )
+            {
+               const T* const b( bufferB + j*kblock );
+
+               const size_t n( min( NR, jblock-j ) );
+
+               for( size_t i=0UL; i<iblock; i+=MR )
+               {
+                  const size_t m( min( MR, iblock-i ) );
+
+                  kernel( ii+i, jj+j, m, n, kblock, bufferA + i*kblock, b );
+
+                  if( !last ) continue;
+
+                  if( TF )
+                     epilogue( jj+j, ii+i, n, m );
+                  else
+                     epilogue( ii+i, jj+j, m, n );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication based on the SIMD types of Blaze
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param epilogue The epilogue for complete blocks of the target matrix.
+// \return void
+//
+// This function runs the packed dense matrix multiplication with the microkernel for the
+// instruction set selected at compile time (see packedMmmBackend()).
+*/
+template< bool TF              // Transposition flag
+        , typename MT1         // Type of the target dense matrix
+        , typename MT2         // Type of the left-hand side operand
+        , typename MT3         // Type of the right-hand side operand
+        , typename T           // Element type
+        , typename Epilogue >  // Type of the epilogue
+auto selectPackedMmmKernel( MT1& C, const MT2& A, const MT3& B, T alpha, Epilogue epilogue )
+   -> DisableIf_t< UseDispatchedPackedMMMKernel_v<MT1> >
+{
+   constexpr size_t MR( PACKED_MMM_ROWS );
+   constexpr size_t NV( PACKED_MMM_VECTORS );
+   constexpr size_t NR( NV * SIMDTrait<T>::size );
+
+   const auto kernel = [&C,alpha]( size_t i, size_t j, size_t m, size_t n,
+                                   size_t k, const T* a, const T* b )
+   {
+      packedMmmKernel<MR,NV,TF>( C, i, j, m, n, k, a, b, alpha );
+   };
+
+   packedMmmBackend<TF,MR,NR>( C, A, B, kernel, epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication based on the runtime dispatched microkernel of the
+//        given instruction set (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param epilogue The epilogue for complete blocks of the target matrix.
+// \return void
+//
+// This function runs the packed dense matrix multiplication with the microkernel of the given
+// instruction set (see RuntimeDispatch.h). Complete blocks of the target matrix are directly
+// updated via the data pointer of \a C, incomplete blocks via a temporary block.
+*/
+template< typename ISA         // Instruction set specific kernels
+        , bool TF              // Transposition flag
+        , typename MT1         // Type of the target dense matrix
+        , typename MT2         // Type of the left-hand side operand
+        , typename MT3         // Type of the right-hand side operand
+        , typename T           // Element type
+        , typename Epilogue >  // Type of the epilogue
+void dispatchPackedMmmKernel( MT1& C, const MT2& A, const MT3& B, T alpha, Epilogue epilogue )
+{
+   constexpr size_t MR( ISA::mmmRows );
+   constexpr size_t NR( ISA::mmmVectors * ISA::width / sizeof(T) );
+
+   T* const data( C.data() );
+   const size_t spacing( C.spacing() );
+
+   const auto kernel = [&C,data,spacing,alpha]( size_t i, size_t j, size_t m, size_t n,
+                                                size_t k, const T* a, const T* b )
+   {
+      if( m == MR && n == NR ) {
+         ISA::template gemm<T>( k, a, b, data+i*spacing+j, spacing, alpha );
+         return;
+      }
+
+      alignas( AlignmentOf_v<T> ) T tmp[MR*NR] = {};
+
+      ISA::template gemm<T>( k, a, b, tmp, NR, T(1) );
+
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c ) {
+            ( TF ? C(j+c,i+r) : C(i+r,j+c) ) += tmp[r*NR+c] * alpha;
+         }
+      }
+   };
+
+   packedMmmBackend<TF,MR,NR>( C, A, B, kernel, epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the microkernel of the packed dense matrix multiplication for target
+//        matrices with data access (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param epilogue The epilogue for complete blocks of the target matrix.
+// \return void
+//
+// In case the runtime dispatch mode is enabled, this function selects the microkernel for the
+// widest instruction set supported by the executing CPU (see getInstructionSet()).
+*/
+template< bool TF              // Transposition flag
+        , typename MT1         // Type of the target dense matrix
+        , typename MT2         // Type of the left-hand side operand
+        , typename MT3         // Type of the right-hand side operand
+        , typename T           // Element type
+        , typename Epilogue >  // Type of the epilogue
+auto selectPackedMmmKernel( MT1& C, const MT2& A, const MT3& B, T alpha, Epilogue epilogue )
+   -> EnableIf_t< UseDispatchedPackedMMMKernel_v<MT1> >
+{
+   switch( getInstructionSet() ) {
+      case avx512f: dispatchPackedMmmKernel<DispatchAVX512F,TF>( C, A, B, alpha, epilogue ); break;
+      case avx2   : dispatchPackedMmmKernel<DispatchAVX2,TF>   ( C, A, B, alpha, epilogue ); break;
+      default     : dispatchPackedMmmKernel<DispatchSSE2,TF>   ( C, A, B, alpha, epilogue ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication kernel for row-major matrices (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements a cache-blocked dense matrix multiplication in the style of the
+// BLIS framework. Blocks of both operands are copied into thread-local, aligned packing buffers
+// and multiplied by a register-blocked microkernel. The block sizes are derived from the cache
+// sizes detected at runtime.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+inline void packedMmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (*C).rows()   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (*C).columns(), "Invalid number of columns detected" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes detected"      );
+
+   using ET = ElementType_t<MT1>;
+
+   const auto epilogue = []( size_t, size_t, size_t, size_t ) {};
+
+   selectPackedMmmKernel<false>( *C, A, B, static_cast<ET>( alpha ), epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication kernel with a fused custom operation for row-major
+//        matrices (\f$ C=op(C+\alpha*A*B) \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param op The custom operation to be applied to each element of the result.
+// \return void
+//
+// This function computes \f$ C+=\alpha*A*B \f$ by means of the packed kernel and applies the
+// custom operation \a op to each block of \a C as soon as the block is complete. In contrast
+// to a separate evaluation of \a op this avoids an additional pass over the target matrix.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST, typename OP >
+inline void packedMmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (*C).rows()   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (*C).columns(), "Invalid number of columns detected" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes detected"      );
+
+   using ET = ElementType_t<MT1>;
+
+   const auto epilogue = [&C,&op]( size_t i, size_t j, size_t m, size_t n )
+   {
+      for( size_t r=i; r<i+m; ++r ) {
+         for( size_t c=j; c<j+n; ++c ) {
+            (*C)(r,c) = op( (*C)(r,c) );
+         }
+      }
+   };
+
+   selectPackedMmmKernel<false>( *C, A, B, static_cast<ET>( alpha ), epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication kernel for column-major matrices
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements a cache-blocked dense matrix multiplication in the style of the
+// BLIS framework for column-major target matrices by computing \f$ C^T+=\alpha*B^T*A^T \f$.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+inline void packedMmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (*C).rows()   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (*C).columns(), "Invalid number of columns detected" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes detected"      );
+
+   using ET = ElementType_t<MT1>;
+
+   const auto epilogue = []( size_t, size_t, size_t, size_t ) {};
+
+   selectPackedMmmKernel<true>( *C, B, A, static_cast<ET>( alpha ), epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix multiplication kernel with a fused custom operation for column-major
+//        matrices (\f$ C=op(C+\alpha*A*B) \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param op The custom operation to be applied to each element of the result.
+// \return void
+//
+// This function computes \f$ C^T+=\alpha*B^T*A^T \f$ by means of the packed kernel and applies
+// the custom operation \a op to each block of \a C as soon as the block is complete.
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST, typename OP >
+inline void packedMmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (*C).rows()   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (*C).columns(), "Invalid number of columns detected" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid matrix sizes detected"      );
+
+   using ET = ElementType_t<MT1>;
+
+   const auto epilogue = [&C,&op]( size_t i, size_t j, size_t m, size_t n )
+   {
+      for( size_t c=j; c<j+n; ++c ) {
+         for( size_t r=i; r<i+m; ++r ) {
+            (*C)(r,c) = op( (*C)(r,c) );
+         }
+      }
+   };
+
+   selectPackedMmmKernel<true>( *C, B, A, static_cast<ET>( alpha ), epilogue );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
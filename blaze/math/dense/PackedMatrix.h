@@ -0,0 +1,1379 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of packed triangular matrices
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/PackedFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConj.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Square matrix in packed triangular storage.
+// \ingroup dense_matrix
+//
+// The PackedMatrix class template represents a square symmetric, Hermitian, lower, or upper
+// matrix that stores only one triangular half of its elements. In contrast to the adaptors
+// SymmetricMatrix, HermitianMatrix, LowerMatrix, and UpperMatrix, which are built on top of a
+// full \f$ N \times N \f$ dense matrix, a PackedMatrix requires only \f$ N(N+1)/2 \f$ elements,
+// i.e. it halves both the memory requirements and the memory bandwidth of all operations. The
+// type of the elements and the structure of the matrix can be specified via the two template
+// parameters:
+
+   \code
+   template< typename Type, PackedFlag PF >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference element type.
+//  - PF  : specifies the structure of the matrix (see PackedFlag): \c packedSymmetric,
+//          \c packedHermitian, \c packedLower, or \c packedUpper.
+//
+// The elements are stored column by column in the packed format of LAPACK. For symmetric,
+// Hermitian, and lower matrices the elements \f$ (j..N-1,j) \f$ of column \a j are stored
+// contiguously, for upper matrices the elements \f$ (0..j,j) \f$. Accesses to the elements of
+// the other half are mapped to the stored half: For symmetric matrices element \f$ (i,j) \f$
+// refers to element \f$ (j,i) \f$, for Hermitian matrices to its complex conjugate, and for
+// lower and upper matrices the elements of the other half are zero and cannot be modified:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > S( 1000UL );
+   // ... Initialization
+
+   PackedMatrix<double,packedSymmetric> A( S );  // Copies the lower part of S
+   A.set( 1UL, 2UL, 3.0 );                       // Sets both element (1,2) and (2,1)
+   const double a21 = A( 2UL, 1UL );             // Results in 3.0
+
+   unpack( A, S );  // Converts the packed matrix back into a symmetric dense matrix
+   \endcode
+
+// All operations on packed matrices read and write the stored half only. The matrix/vector
+// multiplication is performed by a vectorized kernel that traverses every stored column once,
+// the matrix/matrix multiplications expand the packed matrix column panel by column panel into
+// a small dense buffer, and the serialization writes the packed elements only:
+
+   \code
+   PackedMatrix<double,packedSymmetric> A( 1000UL ), C( 1000UL );
+   blaze::DynamicMatrix<double> B( 1000UL, 100UL ), D, E( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization
+
+   mult( y, A, x );  // Computes y = A * x
+   mult( D, A, B );  // Computes D = A * B
+   smmm( C, D, trans( B ), 1.0 );  // Computes the lower part of C = D * B^T
+
+   blaze::Archive<std::ofstream> archive( "A.blaze" );
+   archive << A;  // Serializes the N(N+1)/2 packed elements
+   \endcode
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+class PackedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the vectorized matrix/vector multiplication.
+   static constexpr bool simdEnabled =
+      ( IsVectorizable_v<Type> && HasSIMDAdd_v<Type,Type> && HasSIMDMult_v<Type,Type> &&
+        ( PF != packedHermitian || HasSIMDConj_v<Type> ) );
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix( size_t n = 0UL );
+            inline PackedMatrix( const PackedMatrix& m );
+            inline PackedMatrix( PackedMatrix&& m ) noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline PackedMatrix( const DenseMatrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type        operator()( size_t i, size_t j ) const;
+   inline Type*       data() noexcept;
+   inline const Type* data() const noexcept;
+   inline Type*       data( size_t j ) noexcept;
+   inline const Type* data( size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PackedMatrix& operator=( const PackedMatrix& rhs );
+   inline PackedMatrix& operator=( PackedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO >
+   inline PackedMatrix& operator=( const DenseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows    () const noexcept;
+   inline size_t columns () const noexcept;
+   inline size_t capacity() const noexcept;
+   inline void   set     ( size_t i, size_t j, const Type& value );
+   inline void   reset   ();
+   inline void   resize  ( size_t n, bool preserve=true );
+   inline void   swap    ( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t offset( size_t n, size_t j ) noexcept;
+   static inline size_t index ( size_t n, size_t i, size_t j ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;  //!< The current number of rows and columns of the matrix.
+   Type*  v_;  //!< The packed elements of the stored half of the matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for PackedMatrix.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All stored elements are initialized to the default value of \a Type.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>::PackedMatrix( size_t n )
+   : n_( n )        // The current number of rows and columns of the matrix
+   , v_( nullptr )  // The packed elements of the stored half of the matrix
+{
+   if( n_ > 0UL ) {
+      v_ = allocate<Type>( capacity() );
+      reset();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>::PackedMatrix( const PackedMatrix& m )
+   : PackedMatrix( m.n_ )
+{
+   std::copy( m.v_, m.v_ + capacity(), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PackedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>::PackedMatrix( PackedMatrix&& m ) noexcept
+   : n_( m.n_ )  // The current number of rows and columns of the matrix
+   , v_( m.v_ )  // The packed elements of the stored half of the matrix
+{
+   m.n_ = 0UL;
+   m.v_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense matrix.
+//
+// \param m Dense matrix to be packed.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// This constructor copies the stored half of the given dense matrix into the packed storage.
+// In case the given matrix is not square or does not have the structure of the packed matrix
+// (i.e. is not symmetric, Hermitian, lower, or upper, respectively), a \a std::invalid_argument
+// exception is thrown. In case the structure of the given matrix is guaranteed at compile time
+// (as for instance for a SymmetricMatrix adaptor), only the stored half is accessed.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+inline PackedMatrix<Type,PF>::PackedMatrix( const DenseMatrix<MT,SO>& m )
+   : PackedMatrix( (*m).rows() )
+{
+   if( !isSquare( *m ) ||
+       ( PF == packedSymmetric && !IsSymmetric_v<MT> && !isSymmetric( *m ) ) ||
+       ( PF == packedHermitian && !IsHermitian_v<MT> && !isHermitian( *m ) ) ||
+       ( PF == packedLower     && !IsLower_v<MT>     && !isLower    ( *m ) ) ||
+       ( PF == packedUpper     && !IsUpper_v<MT>     && !isUpper    ( *m ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+   }
+
+   CompositeType_t<MT> tmp( *m );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      Type* v( v_ + offset( n_, j ) );
+      const size_t ibegin( PF == packedUpper ? 0UL : j  );
+      const size_t iend  ( PF == packedUpper ? j+1UL : n_ );
+      for( size_t i=ibegin; i<iend; ++i ) {
+         v[i-ibegin] = tmp(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// Accesses to elements of the non-stored half are mapped to the stored half: For symmetric
+// matrices the function returns element \f$ (j,i) \f$, for Hermitian matrices its complex
+// conjugate, and for lower and upper matrices the default value of \a Type. Note that in
+// contrast to the other dense matrices the function returns the element by value. Elements
+// can be modified via the set() function.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline Type PackedMatrix<Type,PF>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   if( PF == packedUpper ) {
+      return ( i <= j )?( v_[index(n_,i,j)] ):( Type() );
+   }
+   else if( i >= j ) {
+      return v_[index(n_,i,j)];
+   }
+   else if( PF == packedLower ) {
+      return Type();
+   }
+   else if( PF == packedHermitian ) {
+      return conj( v_[index(n_,j,i)] );
+   }
+   else {
+      return v_[index(n_,j,i)];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed storage of the matrix.
+//
+// The packed elements are stored column by column in the packed format of LAPACK (see the
+// PackedMatrix class description).
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline Type* PackedMatrix<Type,PF>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed storage of the matrix.
+//
+// The packed elements are stored column by column in the packed format of LAPACK (see the
+// PackedMatrix class description).
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline const Type* PackedMatrix<Type,PF>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of the given column.
+//
+// \param j The column index.
+// \return Pointer to the first stored element of column \a j.
+//
+// For symmetric, Hermitian, and lower matrices the function returns a pointer to the \f$ N-j \f$
+// contiguous elements \f$ (j..N-1,j) \f$, for upper matrices a pointer to the \f$ j+1 \f$
+// contiguous elements \f$ (0..j,j) \f$.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline Type* PackedMatrix<Type,PF>::data( size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   return v_ + offset( n_, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements of the given column.
+//
+// \param j The column index.
+// \return Pointer to the first stored element of column \a j.
+//
+// For symmetric, Hermitian, and lower matrices the function returns a pointer to the \f$ N-j \f$
+// contiguous elements \f$ (j..N-1,j) \f$, for upper matrices a pointer to the \f$ j+1 \f$
+// contiguous elements \f$ (0..j,j) \f$.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline const Type* PackedMatrix<Type,PF>::data( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   return v_ + offset( n_, j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>& PackedMatrix<Type,PF>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   PackedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PackedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline PackedMatrix<Type,PF>& PackedMatrix<Type,PF>::operator=( PackedMatrix&& rhs ) noexcept
+{
+   PackedMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be packed.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// In case the given matrix is not square or does not have the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown and the packed matrix remains unchanged.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+template< typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+inline PackedMatrix<Type,PF>& PackedMatrix<Type,PF>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   PackedMatrix tmp( *rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline size_t PackedMatrix<Type,PF>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline size_t PackedMatrix<Type,PF>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements \f$ N(N+1)/2 \f$.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline size_t PackedMatrix<Type,PF>::capacity() const noexcept
+{
+   return n_*(n_+1UL)/2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of a single matrix element.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The new value of the element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to packed matrix element.
+//
+// For symmetric and Hermitian matrices the function sets both element \f$ (i,j) \f$ and element
+// \f$ (j,i) \f$. In case a non-default value is assigned to an element of the non-stored half
+// of a lower or upper matrix or a non-real value is assigned to a diagonal element of a Hermitian
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void PackedMatrix<Type,PF>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   if( ( PF == packedLower && i < j ) || ( PF == packedUpper && i > j ) ) {
+      if( !isDefault( value ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to packed matrix element" );
+      }
+   }
+   else if( PF == packedHermitian && i == j && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+   else if( PF == packedUpper || i >= j ) {
+      v_[index(n_,i,j)] = value;
+   }
+   else if( PF == packedHermitian ) {
+      v_[index(n_,j,i)] = conj( value );
+   }
+   else {
+      v_[index(n_,j,i)] = value;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void PackedMatrix<Type,PF>::reset()
+{
+   std::fill( v_, v_ + capacity(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function changes the size of the matrix. During this operation, new dynamic memory is
+// allocated. In case \a preserve is set to \a true, the elements of the leading
+// min(\a n,rows()) by min(\a n,rows()) submatrix are preserved. All new elements are initialized
+// to the default value of \a Type.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void PackedMatrix<Type,PF>::resize( size_t n, bool preserve )
+{
+   if( n == n_ ) return;
+
+   PackedMatrix tmp( n );
+
+   if( preserve ) {
+      const size_t jend( min( n, n_ ) );
+      for( size_t j=0UL; j<jend; ++j ) {
+         const size_t ibegin( PF == packedUpper ? 0UL : j );
+         const size_t iend  ( PF == packedUpper ? j+1UL : jend );
+         for( size_t i=ibegin; i<iend; ++i ) {
+            tmp.v_[index(n,i,j)] = v_[index(n_,i,j)];
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void PackedMatrix<Type,PF>::swap( PackedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_, m.n_ );
+   swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the offset of the first stored element of the given column.
+//
+// \param n The number of rows and columns of the matrix.
+// \param j The column index.
+// \return The offset of the first stored element of column \a j.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline size_t PackedMatrix<Type,PF>::offset( size_t n, size_t j ) noexcept
+{
+   return ( PF == packedUpper )?( j*(j+1UL)/2UL ):( j*(2UL*n-j+1UL)/2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the index of the given stored element within the packed storage.
+//
+// \param n The number of rows and columns of the matrix.
+// \param i The row index of the stored element.
+// \param j The column index of the stored element.
+// \return The index of the element within the packed storage.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline size_t PackedMatrix<Type,PF>::index( size_t n, size_t i, size_t j ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( PF == packedUpper ? i <= j : i >= j, "Invalid packed element" );
+
+   return offset( n, j ) + ( ( PF == packedUpper )?( i ):( i-j ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackedFlag PF >
+inline void reset( PackedMatrix<Type,PF>& m );
+
+template< typename Type, PackedFlag PF >
+inline void swap( PackedMatrix<Type,PF>& a, PackedMatrix<Type,PF>& b ) noexcept;
+
+template< typename Type, PackedFlag PF, typename MT, bool SO >
+void unpack( const PackedMatrix<Type,PF>& A, DenseMatrix<MT,SO>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup dense_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void reset( PackedMatrix<Type,PF>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup dense_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+inline void swap( PackedMatrix<Type,PF>& a, PackedMatrix<Type,PF>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a packed matrix into a dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The packed matrix to be converted.
+// \param B The target dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function resizes the given dense matrix to the size of \a A and copies all elements of
+// \a A. In case \a B is a symmetric or Hermitian adaptor, only the stored half of \a A is
+// assigned, all other adaptors check the assigned values as usual. In case \a B cannot be
+// resized to the size of \a A, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF     // Structure of the matrix
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+void unpack( const PackedMatrix<Type,PF>& A, DenseMatrix<MT,SO>& B )
+{
+   const size_t N( A.rows() );
+
+   resize( *B, N, N, false );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      const size_t ibegin( ( IsSymmetric_v<MT> || IsHermitian_v<MT> )?( j ):( 0UL ) );
+      for( size_t i=ibegin; i<N; ++i ) {
+         (*B)(i,j) = A(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given packed matrix and writes it to the archive.
+// \ingroup dense_matrix
+//
+// \param archive The archive to be written.
+// \param mat The packed matrix to be serialized.
+// \return void
+// \exception std::runtime_error Packed matrix could not be serialized.
+//
+// This function serializes the packed elements of the given matrix, i.e. only the stored half
+// of \a mat is written. The archive starts with a header consisting of the version of the
+// format, the structure of the matrix, the element type, the element size, the number of rows
+// and columns, and the number of packed elements.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type     // Data type of the elements
+        , PackedFlag PF >   // Structure of the matrix
+void serialize( Archive& archive, const PackedMatrix<Type,PF>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   archive << uint8_t ( 1U );
+   archive << uint8_t ( PF );
+   archive << uint8_t ( TypeValueMapping<Type>::value );
+   archive << uint8_t ( sizeof( Type ) );
+   archive << uint64_t( mat.rows() );
+   archive << uint64_t( mat.capacity() );
+
+   archive.write( mat.data(), mat.capacity() );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Packed matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a packed matrix from the given archive.
+// \ingroup dense_matrix
+//
+// \param archive The archive to be read from.
+// \param mat The packed matrix to be deserialized.
+// \return void
+// \exception std::runtime_error Packed matrix could not be deserialized.
+//
+// This function deserializes a packed matrix that has been serialized via the serialize()
+// function. In case the header of the archive does not match the given packed matrix type,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type     // Data type of the elements
+        , PackedFlag PF >   // Structure of the matrix
+void deserialize( Archive& archive, PackedMatrix<Type,PF>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   if( !archive ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Faulty archive detected" );
+   }
+
+   uint8_t  version( 0U ), flag( 0U ), elementType( 0U ), elementSize( 0U );
+   uint64_t n( 0UL ), number( 0UL );
+
+   if( !( archive >> version >> flag >> elementType >> elementSize >> n >> number ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( flag != uint8_t( PF ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+   else if( elementType != TypeValueMapping<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+   else if( number != n*(n+1UL)/2UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   mat.resize( n, false );
+   archive.read( mat.data(), mat.capacity() );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Packed matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a packed matrix and a vector (\f$ y+=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the contiguous result vector.
+// \param A The packed matrix.
+// \param x Pointer to the first element of the contiguous right-hand side vector.
+// \return void
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+auto packedMv( Type* y, const PackedMatrix<Type,PF>& A, const Type* x )
+   -> DisableIf_t< PackedMatrix<Type,PF>::simdEnabled >
+{
+   const size_t N( A.rows() );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const Type* a( A.data(j) );
+
+      if( PF == packedUpper ) {
+         for( size_t i=0UL; i<=j; ++i ) {
+            y[i] += a[i] * x[j];
+         }
+      }
+      else if( PF == packedLower ) {
+         for( size_t i=j; i<N; ++i ) {
+            y[i] += a[i-j] * x[j];
+         }
+      }
+      else {
+         Type tmp( a[0] * x[j] );
+         for( size_t i=j+1UL; i<N; ++i ) {
+            y[i] += a[i-j] * x[j];
+            tmp  += ( PF == packedHermitian ? conj( a[i-j] ) : a[i-j] ) * x[i];
+         }
+         y[j] += tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a packed matrix and a vector
+//        (\f$ y+=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y Pointer to the first element of the contiguous result vector.
+// \param A The packed matrix.
+// \param x Pointer to the first element of the contiguous right-hand side vector.
+// \return void
+//
+// This kernel traverses every stored column of \a A exactly once. For symmetric and Hermitian
+// matrices every column contributes both to the lower part of \a y (as column of \a A) and to
+// a single element of \a y (as row of \a A).
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF >  // Structure of the matrix
+auto packedMv( Type* y, const PackedMatrix<Type,PF>& A, const Type* x )
+   -> EnableIf_t< PackedMatrix<Type,PF>::simdEnabled >
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t N( A.rows() );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const Type* a( A.data(j) );
+      const SIMDType x1( set( x[j] ) );
+
+      if( PF == packedUpper || PF == packedLower )
+      {
+         Type* py( PF == packedUpper ? y : y+j );
+         const size_t iend( PF == packedUpper ? j+1UL : N-j );
+         const size_t ipos( prevMultiple( iend, SIMDSIZE ) );
+
+         size_t i( 0UL );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            const SIMDType y1( loadu( py+i ) + loadu( a+i ) * x1 );
+            storeu( py+i, y1 );
+         }
+         for( ; i<iend; ++i ) {
+            py[i] += a[i] * x[j];
+         }
+      }
+      else
+      {
+         Type* py( y+j );
+         const Type* px( x+j );
+         const size_t iend( N-j );
+         const size_t ipos( 1UL + prevMultiple( iend-1UL, SIMDSIZE ) );
+
+         Type tmp( a[0] * x[j] );
+         SIMDType xmm1;
+         size_t i( 1UL );
+
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            const SIMDType a1( loadu( a+i ) );
+            const SIMDType y1( loadu( py+i ) + a1 * x1 );
+            storeu( py+i, y1 );
+            xmm1 += ( PF == packedHermitian ? conj( a1 ) : a1 ) * loadu( px+i );
+         }
+         for( ; i<iend; ++i ) {
+            py[i] += a[i] * x[j];
+            tmp   += ( PF == packedHermitian ? conj( a[i] ) : a[i] ) * px[i];
+         }
+
+         y[j] += tmp + sum( xmm1 );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a packed matrix and a dense vector (\f$ y=A*x \f$).
+// \ingroup dense_matrix
+//
+// \param y The resulting dense vector.
+// \param A The packed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the packed matrix \a A and the dense vector \a x by
+// means of a single pass over the stored half of \a A. The vector \a y is resized to the size
+// of \a A (in case it is resizable) and may alias \a x.
+*/
+template< typename VT1      // Type of the resulting vector
+        , typename Type     // Data type of the elements
+        , PackedFlag PF     // Structure of the matrix
+        , typename VT2 >    // Type of the right-hand side vector
+void mult( DenseVector<VT1,false>& y, const PackedMatrix<Type,PF>& A,
+           const DenseVector<VT2,false>& x )
+{
+   if( A.columns() != (*x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const DynamicVector<Type,false> tmpx( *x );
+   DynamicVector<Type,false> tmpy( A.rows(), Type() );
+
+   packedMv( tmpy.data(), A, tmpx.data() );
+
+   (*y) = tmpy;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a packed matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The resulting dense matrix.
+// \param A The packed matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the packed matrix \a A and the dense matrix \a B. For
+// that purpose \a A is expanded column panel by column panel into a small dense buffer and every
+// panel is multiplied by the according rows of \a B by means of the regular dense matrix
+// multiplication kernels. For lower and upper matrices only the non-zero rows of the panels
+// are multiplied. The matrix \a C is resized to the according size (in case it is resizable)
+// and may alias \a B.
+*/
+template< typename MT1      // Type of the resulting matrix
+        , bool SO1          // Storage order of the resulting matrix
+        , typename Type     // Data type of the elements
+        , PackedFlag PF     // Structure of the matrix
+        , typename MT2      // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+void mult( DenseMatrix<MT1,SO1>& C, const PackedMatrix<Type,PF>& A, const DenseMatrix<MT2,SO2>& B )
+{
+   constexpr size_t block( 64UL );
+
+   if( A.columns() != (*B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT2> b( *B );
+
+   const size_t N( A.rows() );
+   const size_t K( b.columns() );
+
+   DynamicMatrix<ElementType_t<MT1>,SO1> tmp( N, K, ElementType_t<MT1>() );
+   DynamicMatrix<Type,columnMajor> D( N, block );
+
+   for( size_t jj=0UL; jj<N; jj+=block )
+   {
+      const size_t jblock( min( block, N-jj ) );
+      const size_t ibegin( PF == packedLower ? jj : 0UL );
+      const size_t iend  ( PF == packedUpper ? jj+jblock : N );
+
+      if( PF == packedSymmetric || PF == packedHermitian ) {
+         for( size_t i=0UL; i<jj; ++i ) {
+            const Type* a( A.data(i) + jj-i );
+            for( size_t j=0UL; j<jblock; ++j ) {
+               D(i,j) = ( PF == packedHermitian ? conj( a[j] ) : a[j] );
+            }
+         }
+      }
+
+      for( size_t j=jj; j<jj+jblock; ++j )
+      {
+         const Type* a( A.data(j) );
+
+         if( PF == packedUpper ) {
+            for( size_t i=0UL; i<=j; ++i ) {
+               D(i,j-jj) = a[i];
+            }
+            for( size_t i=j+1UL; i<iend; ++i ) {
+               D(i,j-jj) = Type();
+            }
+         }
+         else {
+            for( size_t i=jj; i<j; ++i ) {
+               D(i,j-jj) = ( PF == packedLower )?( Type() ):( A(i,j) );
+            }
+            for( size_t i=j; i<N; ++i ) {
+               D(i,j-jj) = a[i-j];
+            }
+         }
+      }
+
+      submatrix( tmp, ibegin, 0UL, iend-ibegin, K ) +=
+         submatrix( D, ibegin, 0UL, iend-ibegin, jblock ) * submatrix( b, jj, 0UL, jblock, K );
+   }
+
+   (*C) = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRUCTURED MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a dense matrix/dense matrix multiplication into the stored half of
+//        a packed matrix (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target packed matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the stored half of \f$ C=\alpha*A*B+\beta*C \f$ column panel by column
+// panel. Every panel is computed by means of the regular dense matrix multiplication kernels,
+// restricted to the rows that are part of the stored half of the panel.
+*/
+template< typename Type     // Data type of the elements
+        , PackedFlag PF     // Structure of the matrix
+        , typename MT2      // Type of the left-hand side matrix operand
+        , typename MT3      // Type of the right-hand side matrix operand
+        , typename ST >     // Type of the scalar factors
+void packedTargetMmm( PackedMatrix<Type,PF>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT3 );
+
+   constexpr size_t block( 64UL );
+
+   const size_t N( C.rows() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( A.rows() == N   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.rows() == K   , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == N, "Invalid number of columns detected" );
+
+   DynamicMatrix<Type,columnMajor> T;
+
+   for( size_t jj=0UL; jj<N; jj+=block )
+   {
+      const size_t jblock( min( block, N-jj ) );
+      const size_t ibegin( PF == packedUpper ? 0UL : jj );
+      const size_t iend  ( PF == packedUpper ? jj+jblock : N );
+
+      T = alpha * ( submatrix( A, ibegin, 0UL, iend-ibegin, K ) *
+                    submatrix( B, 0UL, jj, K, jblock ) );
+
+      for( size_t j=jj; j<jj+jblock; ++j )
+      {
+         Type* c( C.data(j) );
+         const size_t i0( PF == packedUpper ? 0UL : j );
+         const size_t i1( PF == packedUpper ? j+1UL : N );
+
+         for( size_t i=i0; i<i1; ++i ) {
+            if( isDefault( beta ) )
+               c[i-i0] = T(i-ibegin,j-jj);
+            else
+               c[i-i0] = beta * c[i-i0] + T(i-ibegin,j-jj);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a lower dense matrix/dense matrix multiplication into a packed
+//        lower matrix (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target packed lower matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the lower part of \f$ C=\alpha*A*B+\beta*C \f$. Only the stored half
+// of \a C is read and written.
+*/
+template< typename Type   // Data type of the elements
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar factors
+void lmmm( PackedMatrix<Type,packedLower>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   packedTargetMmm( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for an upper dense matrix/dense matrix multiplication into a packed
+//        upper matrix (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target packed upper matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the upper part of \f$ C=\alpha*A*B+\beta*C \f$. Only the stored half
+// of \a C is read and written.
+*/
+template< typename Type   // Data type of the elements
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar factors
+void ummm( PackedMatrix<Type,packedUpper>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   packedTargetMmm( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a symmetric dense matrix/dense matrix multiplication into a packed
+//        symmetric matrix (\f$ C=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target packed symmetric matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function computes the lower part of the symmetric product \f$ C=\alpha*A*B \f$ (as for
+// instance \f$ A*A^T \f$). It is the responsibility of the caller to guarantee that the result
+// is symmetric.
+*/
+template< typename Type   // Data type of the elements
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar factor
+void smmm( PackedMatrix<Type,packedSymmetric>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   packedTargetMmm( C, A, B, alpha, ST(0) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a Hermitian dense matrix/dense matrix multiplication into a packed
+//        Hermitian matrix (\f$ C=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target packed Hermitian matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function computes the lower part of the Hermitian product \f$ C=\alpha*A*B \f$ (as for
+// instance \f$ A*A^H \f$). It is the responsibility of the caller to guarantee that the result
+// is Hermitian.
+*/
+template< typename Type   // Data type of the elements
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar factor
+void hmmm( PackedMatrix<Type,packedHermitian>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   packedTargetMmm( C, A, B, alpha, ST(0) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
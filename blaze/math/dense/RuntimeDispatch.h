@@ -0,0 +1,727 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/RuntimeDispatch.h
+//  \brief Header file for the runtime dispatched SIMD kernels
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_RUNTIMEDISPATCH_H_
+#define _BLAZE_MATH_DENSE_RUNTIMEDISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/InstructionSet.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCH SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the runtime dispatched SIMD kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the runtime dispatch mode is enabled (see
+// the BLAZE_USE_RUNTIME_DISPATCH switch) and the given type is a single or double precision
+// floating point type. Otherwise it evaluates to \a false.
+*/
+template< typename T >
+constexpr bool IsDispatchable_v =
+   ( BLAZE_RUNTIME_DISPATCH_MODE &&
+     ( IsSame_v< RemoveCV_t<T>, float > || IsSame_v< RemoveCV_t<T>, double > ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the runtime dispatched vector kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the given dense vector type provides
+// contiguous access to its single or double precision elements and the runtime dispatch mode
+// is enabled. Otherwise it evaluates to \a false.
+*/
+template< typename VT >
+constexpr bool IsDispatchableVector_v =
+   ( IsDispatchable_v< ElementType_t<VT> > && IsContiguous_v<VT> && HasConstDataAccess_v<VT> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//=================================================================================================
+//
+//  GENERIC SIMD KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD vector type of the runtime dispatched kernels.
+// \ingroup dense_matrix
+//
+// This type trait provides a SIMD vector of \a N bytes based on the vector extensions of the
+// GNU and Clang compilers. In contrast to the SIMD types of Blaze the instruction set of the
+// resulting operations is not fixed at compile time, but determined by the target of the
+// function the operations are instantiated in. Loads and stores of the vector are unaligned.
+// Note that the vector must only be passed by reference to functions that are not compiled for
+// the according instruction set, since otherwise the calling convention would be affected.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of bytes
+struct DispatchSIMD
+{
+   typedef T Type __attribute__(( vector_size( N ), aligned( sizeof(T) ), __may_alias__ ));
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a generic SIMD vector.
+// \ingroup dense_matrix
+*/
+template< size_t N, typename T >
+BLAZE_ALWAYS_INLINE const typename DispatchSIMD<T,N>::Type& dload( const T* address ) noexcept
+{
+   return *reinterpret_cast< const typename DispatchSIMD<T,N>::Type* >( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a generic SIMD vector.
+// \ingroup dense_matrix
+*/
+template< size_t N, typename T >
+BLAZE_ALWAYS_INLINE void dstore( T* address, const typename DispatchSIMD<T,N>::Type& value ) noexcept
+{
+   *reinterpret_cast< typename DispatchSIMD<T,N>::Type* >( address ) = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the sum of all elements of a generic SIMD vector.
+// \ingroup dense_matrix
+*/
+template< size_t N, typename T >
+BLAZE_ALWAYS_INLINE T dsum( const typename DispatchSIMD<T,N>::Type& value ) noexcept
+{
+   T sum{};
+   for( size_t k=0UL; k<N/sizeof(T); ++k ) {
+      sum += value[k];
+   }
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD kernel for the inner product of two dense arrays.
+// \ingroup dense_matrix
+//
+// \param x The first array.
+// \param y The second array.
+// \param n The number of elements.
+// \return The inner product \f$ \sum_i x_i y_i \f$.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of bytes of a SIMD vector
+BLAZE_ALWAYS_INLINE T dispatchedDot( const T* x, const T* y, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+
+   typename DispatchSIMD<T,N>::Type xmm1{}, xmm2{}, xmm3{}, xmm4{};
+   size_t i( 0UL );
+
+   for( ; i+SIMDSIZE*4UL<=n; i+=SIMDSIZE*4UL ) {
+      xmm1 += dload<N>( x+i              ) * dload<N>( y+i              );
+      xmm2 += dload<N>( x+i+SIMDSIZE     ) * dload<N>( y+i+SIMDSIZE     );
+      xmm3 += dload<N>( x+i+SIMDSIZE*2UL ) * dload<N>( y+i+SIMDSIZE*2UL );
+      xmm4 += dload<N>( x+i+SIMDSIZE*3UL ) * dload<N>( y+i+SIMDSIZE*3UL );
+   }
+   for( ; i+SIMDSIZE<=n; i+=SIMDSIZE ) {
+      xmm1 += dload<N>( x+i ) * dload<N>( y+i );
+   }
+
+   T sum( dsum<N,T>( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<n; ++i ) {
+      sum += x[i] * y[i];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD kernel for the summation of a dense array.
+// \ingroup dense_matrix
+//
+// \param x The array.
+// \param n The number of elements.
+// \return The sum \f$ \sum_i x_i \f$.
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of bytes of a SIMD vector
+BLAZE_ALWAYS_INLINE T dispatchedSum( const T* x, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+
+   typename DispatchSIMD<T,N>::Type xmm1{}, xmm2{}, xmm3{}, xmm4{};
+   size_t i( 0UL );
+
+   for( ; i+SIMDSIZE*4UL<=n; i+=SIMDSIZE*4UL ) {
+      xmm1 += dload<N>( x+i              );
+      xmm2 += dload<N>( x+i+SIMDSIZE     );
+      xmm3 += dload<N>( x+i+SIMDSIZE*2UL );
+      xmm4 += dload<N>( x+i+SIMDSIZE*3UL );
+   }
+   for( ; i+SIMDSIZE<=n; i+=SIMDSIZE ) {
+      xmm1 += dload<N>( x+i );
+   }
+
+   T sum( dsum<N,T>( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<n; ++i ) {
+      sum += x[i];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD kernel for elementwise assignment operations (\f$ y_i=y_i \circ x_i \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array.
+// \param x The source array.
+// \param n The number of elements.
+// \return void
+//
+// The elementwise operation is selected via \a OP, which is either \c '+', \c '-', or \c '*'.
+// The operation is deliberately not passed as functor, since the functor would return the SIMD
+// vectors by value (see DispatchSIMD).
+*/
+template< typename T  // Element type
+        , size_t N    // Number of bytes of a SIMD vector
+        , char OP >   // The elementwise operation
+BLAZE_ALWAYS_INLINE void dispatchedMap( T* y, const T* x, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+
+   size_t i( 0UL );
+
+   for( ; i+SIMDSIZE<=n; i+=SIMDSIZE ) {
+      const auto a( dload<N>( y+i ) );
+      const auto b( dload<N>( x+i ) );
+      dstore<N>( y+i, ( OP == '+' )?( a + b ):( ( OP == '-' )?( a - b ):( a * b ) ) );
+   }
+   for( ; i<n; ++i ) {
+      y[i] = ( OP == '+' )?( y[i] + x[i] ):( ( OP == '-' )?( y[i] - x[i] ):( y[i] * x[i] ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD kernel for the multiplication of a row-major dense matrix and a dense
+//        vector (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The spacing between two rows of the matrix.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor.
+// \return void
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of bytes of a SIMD vector
+BLAZE_ALWAYS_INLINE void dispatchedGemvRowMajor( size_t m, size_t n, const T* A, size_t lda,
+                                                 const T* x, T* y, T alpha ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+
+   const size_t jpos( n - n % SIMDSIZE );
+
+   size_t i( 0UL );
+
+   for( ; i+4UL<=m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      typename DispatchSIMD<T,N>::Type xmm1{}, xmm2{}, xmm3{}, xmm4{};
+
+      for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+         const auto x1( dload<N>( x+j ) );
+         xmm1 += dload<N>( a1+j ) * x1;
+         xmm2 += dload<N>( a2+j ) * x1;
+         xmm3 += dload<N>( a3+j ) * x1;
+         xmm4 += dload<N>( a4+j ) * x1;
+      }
+
+      T sum1( dsum<N,T>( xmm1 ) );
+      T sum2( dsum<N,T>( xmm2 ) );
+      T sum3( dsum<N,T>( xmm3 ) );
+      T sum4( dsum<N,T>( xmm4 ) );
+
+      for( size_t j=jpos; j<n; ++j ) {
+         sum1 += a1[j] * x[j];
+         sum2 += a2[j] * x[j];
+         sum3 += a3[j] * x[j];
+         sum4 += a4[j] * x[j];
+      }
+
+      y[i    ] += alpha * sum1;
+      y[i+1UL] += alpha * sum2;
+      y[i+2UL] += alpha * sum3;
+      y[i+3UL] += alpha * sum4;
+   }
+
+   for( ; i<m; ++i ) {
+      y[i] += alpha * dispatchedDot<T,N>( A + i*lda, x, n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD kernel for the multiplication of a column-major dense matrix and a dense
+//        vector (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The spacing between two columns of the matrix.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor.
+// \return void
+*/
+template< typename T  // Element type
+        , size_t N >  // Number of bytes of a SIMD vector
+BLAZE_ALWAYS_INLINE void dispatchedGemvColumnMajor( size_t m, size_t n, const T* A, size_t lda,
+                                                    const T* x, T* y, T alpha ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+
+   const size_t ipos( m - m % SIMDSIZE );
+
+   size_t j( 0UL );
+
+   for( ; j+4UL<=n; j+=4UL )
+   {
+      const T* a1( A + j*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      const T x1( alpha * x[j    ] );
+      const T x2( alpha * x[j+1UL] );
+      const T x3( alpha * x[j+2UL] );
+      const T x4( alpha * x[j+3UL] );
+
+      for( size_t i=0UL; i<ipos; i+=SIMDSIZE ) {
+         dstore<N>( y+i, dload<N>( y+i ) + dload<N>( a1+i ) * x1 + dload<N>( a2+i ) * x2
+                                         + dload<N>( a3+i ) * x3 + dload<N>( a4+i ) * x4 );
+      }
+      for( size_t i=ipos; i<m; ++i ) {
+         y[i] += a1[i] * x1 + a2[i] * x2 + a3[i] * x3 + a4[i] * x4;
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+      const T x1( alpha * x[j] );
+
+      for( size_t i=0UL; i<ipos; i+=SIMDSIZE ) {
+         dstore<N>( y+i, dload<N>( y+i ) + dload<N>( a1+i ) * x1 );
+      }
+      for( size_t i=ipos; i<m; ++i ) {
+         y[i] += a1[i] * x1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD microkernel of the packed dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param k The number of columns of the packed left-hand side panel.
+// \param a Pointer to the packed \f$ MR \times k \f$ left-hand side panel.
+// \param b Pointer to the packed \f$ k \times NR \f$ right-hand side panel.
+// \param c Pointer to the first element of the \f$ MR \times NR \f$ row-major target block.
+// \param ldc The spacing between two rows of the target block.
+// \param alpha The scaling factor.
+// \return void
+//
+// The panels are expected in the format of the packing functions of the packed dense matrix
+// multiplication (see packLeftOperand() and packRightOperand()).
+*/
+template< typename T   // Element type
+        , size_t N     // Number of bytes of a SIMD vector
+        , size_t MR    // Number of rows of the register block
+        , size_t NV >  // Number of SIMD vectors per row of the register block
+BLAZE_ALWAYS_INLINE void dispatchedGemmKernel( size_t k, const T* a, const T* b,
+                                               T* c, size_t ldc, T alpha ) noexcept
+{
+   constexpr size_t SIMDSIZE( N / sizeof(T) );
+   constexpr size_t NR( NV*SIMDSIZE );
+
+   typename DispatchSIMD<T,N>::Type xmm[MR][NV] = {};
+
+   for( size_t l=0UL; l<k; ++l, a+=MR, b+=NR ) {
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t v=0UL; v<NV; ++v ) {
+            xmm[r][v] += a[r] * dload<N>( b+v*SIMDSIZE );
+         }
+      }
+   }
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         dstore<N>( c+r*ldc+v*SIMDSIZE, dload<N>( c+r*ldc+v*SIMDSIZE ) + xmm[r][v] * alpha );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET SPECIFIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Instantiation of the generic SIMD kernels for the given instruction set.
+// \ingroup dense_matrix
+//
+// \param NAME The name of the resulting class.
+// \param TARGET The target attribute string of the instruction set.
+// \param WIDTH The number of bytes of a SIMD register.
+// \param ROWS The number of rows of the register block of the matrix multiplication.
+// \param VECTORS The number of SIMD vectors per row of the register block.
+//
+// This macro defines a class with one static member function template per generic SIMD kernel.
+// All member functions are compiled for the given target instruction set, independent of the
+// instruction set selected at compile time. Thus the functions must only be called in case the
+// executing CPU supports the instruction set (see getInstructionSet()).
+*/
+#define BLAZE_DEFINE_DISPATCH_KERNELS( NAME, TARGET, WIDTH, ROWS, VECTORS ) \
+struct NAME \
+{ \
+   static constexpr size_t width      = WIDTH; \
+   static constexpr size_t mmmRows    = ROWS; \
+   static constexpr size_t mmmVectors = VECTORS; \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static T dot( const T* x, const T* y, size_t n ) noexcept { \
+      return dispatchedDot<T,WIDTH>( x, y, n ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static T sum( const T* x, size_t n ) noexcept { \
+      return dispatchedSum<T,WIDTH>( x, n ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void add( T* y, const T* x, size_t n ) noexcept { \
+      dispatchedMap<T,WIDTH,'+'>( y, x, n ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void sub( T* y, const T* x, size_t n ) noexcept { \
+      dispatchedMap<T,WIDTH,'-'>( y, x, n ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void mult( T* y, const T* x, size_t n ) noexcept { \
+      dispatchedMap<T,WIDTH,'*'>( y, x, n ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void gemvRowMajor( size_t m, size_t n, const T* A, size_t lda, \
+                             const T* x, T* y, T alpha ) noexcept { \
+      dispatchedGemvRowMajor<T,WIDTH>( m, n, A, lda, x, y, alpha ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void gemvColumnMajor( size_t m, size_t n, const T* A, size_t lda, \
+                                const T* x, T* y, T alpha ) noexcept { \
+      dispatchedGemvColumnMajor<T,WIDTH>( m, n, A, lda, x, y, alpha ); \
+   } \
+ \
+   template< typename T > __attribute__(( target( TARGET ) )) \
+   static void gemm( size_t k, const T* a, const T* b, T* c, size_t ldc, T alpha ) noexcept { \
+      dispatchedGemmKernel<T,WIDTH,ROWS,VECTORS>( k, a, b, c, ldc, alpha ); \
+   } \
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_DEFINE_DISPATCH_KERNELS( DispatchSSE2   , "sse2"    , 16UL, 6UL, 2UL );
+BLAZE_DEFINE_DISPATCH_KERNELS( DispatchAVX2   , "avx2,fma", 32UL, 6UL, 2UL );
+BLAZE_DEFINE_DISPATCH_KERNELS( DispatchAVX512F, "avx512f" , 64UL, 8UL, 3UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of the runtime dispatched SIMD kernels for a specific element type.
+// \ingroup dense_matrix
+*/
+template< typename T >  // Element type
+struct DispatchKernels
+{
+   T    ( *dot )( const T*, const T*, size_t );  //!< Inner product of two arrays.
+   T    ( *sum )( const T*, size_t );            //!< Summation of an array.
+   void ( *add )( T*, const T*, size_t );        //!< Elementwise addition assignment.
+   void ( *sub )( T*, const T*, size_t );        //!< Elementwise subtraction assignment.
+   void ( *mult )( T*, const T*, size_t );       //!< Elementwise multiplication assignment.
+
+   //! Row-major dense matrix/dense vector multiplication.
+   void ( *gemvRowMajor )( size_t, size_t, const T*, size_t, const T*, T*, T );
+
+   //! Column-major dense matrix/dense vector multiplication.
+   void ( *gemvColumnMajor )( size_t, size_t, const T*, size_t, const T*, T*, T );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the table of the SIMD kernels of the given instruction set.
+// \ingroup dense_matrix
+*/
+template< typename ISA  // Instruction set specific kernels
+        , typename T >  // Element type
+DispatchKernels<T> createDispatchKernels()
+{
+   return DispatchKernels<T>{ &ISA::template dot<T>
+                            , &ISA::template sum<T>
+                            , &ISA::template add<T>
+                            , &ISA::template sub<T>
+                            , &ISA::template mult<T>
+                            , &ISA::template gemvRowMajor<T>
+                            , &ISA::template gemvColumnMajor<T> };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the runtime dispatched SIMD kernels for the given element type.
+// \ingroup dense_matrix
+//
+// \return The table of the selected SIMD kernels.
+//
+// The kernels are selected once on the first call of the function based on the instruction set
+// returned by getInstructionSet().
+*/
+template< typename T >  // Element type
+const DispatchKernels<T>& getDispatchKernels()
+{
+   static const DispatchKernels<T> kernels( []() -> DispatchKernels<T>
+   {
+      switch( getInstructionSet() ) {
+         case avx512f: return createDispatchKernels<DispatchAVX512F,T>();
+         case avx2   : return createDispatchKernels<DispatchAVX2,T>();
+         default     : return createDispatchKernels<DispatchSSE2,T>();
+      }
+   }() );
+
+   return kernels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCHED OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor.
+// \return void
+//
+// All operands are required to provide contiguous data access (see IsContiguous) and to have
+// the same single or double precision element type.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename MT   // Type of the dense matrix operand
+        , typename VT2  // Type of the dense vector operand
+        , typename ST > // Type of the scaling factor
+void dispatchGemv( VT1& y, const MT& A, const VT2& x, ST alpha )
+{
+   using ET = ElementType_t<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == y.size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == x.size(), "Invalid vector size" );
+
+   const DispatchKernels<ET>& kernels( getDispatchKernels<ET>() );
+
+   ( IsRowMajorMatrix_v<MT> ? kernels.gemvRowMajor : kernels.gemvColumnMajor )
+      ( A.rows(), A.columns(), A.data(), A.spacing(), x.data(), y.data(), static_cast<ET>( alpha ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched inner product of two contiguous dense vectors.
+// \ingroup dense_matrix
+//
+// \param x The left-hand side dense vector.
+// \param y The right-hand side dense vector.
+// \return The inner product of the two vectors.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+RemoveCV_t< ElementType_t<VT1> > dispatchDot( const VT1& x, const VT2& y )
+{
+   using ET = RemoveCV_t< ElementType_t<VT1> >;
+
+   BLAZE_INTERNAL_ASSERT( x.size() == y.size(), "Invalid vector sizes" );
+
+   return getDispatchKernels<ET>().dot( x.data(), y.data(), x.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched summation of a contiguous dense vector.
+// \ingroup dense_matrix
+//
+// \param x The dense vector.
+// \return The sum of all elements of the vector.
+*/
+template< typename VT >  // Type of the dense vector
+RemoveCV_t< ElementType_t<VT> > dispatchSum( const VT& x )
+{
+   using ET = RemoveCV_t< ElementType_t<VT> >;
+
+   return getDispatchKernels<ET>().sum( x.data(), x.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,273 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Strassen.h
+//  \brief Header file for the Strassen-Winograd dense matrix multiplication
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STRASSEN_H_
+#define _BLAZE_MATH_DENSE_STRASSEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCRATCH ARENA
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current recursion level of the Strassen-Winograd multiplication.
+// \ingroup dense_matrix
+//
+// \return Reference to the thread-local recursion level.
+*/
+inline size_t& strassenLevel() noexcept
+{
+   static thread_local size_t level( 0UL );
+   return level;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread-local scratch buffer of the given level of the Strassen-Winograd
+//        recursion.
+// \ingroup dense_matrix
+//
+// \param level The level of the recursion.
+// \param size The required number of elements.
+// \return Pointer to the first element of the aligned buffer.
+//
+// Every thread owns one scratch buffer per element type and level of the recursion. The buffers
+// only grow and are reused by all subsequent multiplications of the thread, which avoids the
+// allocation of temporary memory in every step of the recursion.
+*/
+template< typename T >  // Element type
+T* getStrassenBuffer( size_t level, size_t size )
+{
+   static thread_local std::vector< std::unique_ptr<T[],Deallocate> > buffers;
+   static thread_local std::vector<size_t> capacities;
+
+   if( level >= buffers.size() ) {
+      buffers.resize( level+1UL );
+      capacities.resize( level+1UL, 0UL );
+   }
+
+   if( size > capacities[level] ) {
+      buffers[level].reset();
+      buffers[level].reset( allocate<T>( size ) );
+      capacities[level] = size;
+   }
+
+   return buffers[level].get();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRASSEN-WINOGRAD DENSE MATRIX MULTIPLICATION KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief One level of the Strassen-Winograd dense matrix/dense matrix multiplication
+//        (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return void
+//
+// This function splits the even-sized leading parts of \a A, \a B, and \a C into 2x2 blocks
+// and computes the product by means of the seven half-size products of the Winograd variant of
+// Strassen's algorithm. The products and sums are scheduled as proposed by Boyer, Dumas, Pernet,
+// and Zhou ("Memory efficient scheduling of Strassen-Winograd's matrix multiplication
+// algorithm", ISSAC 2009), which uses the blocks of \a C and only two quarter-size temporaries
+// \a X and \a Y. Both temporaries are taken from a thread-local scratch arena with one buffer
+// per level of the recursion. The remaining row, column, and inner dimension of odd-sized
+// matrices are added via thin classical products (dynamic peeling).
+//
+// All products and sums are evaluated via the regular dense matrix assignment. Therefore the
+// seven sub-products are recursively evaluated via this function as long as their smallest
+// dimension is equal or higher than the STRASSEN_THRESHOLD, else by the classical kernels.
+// Both the sub-products and the sums are parallelized by the active SMP backend.
+//
+// \a C must be a non-expression, non-adaptor dense matrix, which does not alias \a A or \a B.
+// The element types of all three matrices must be identical and BLAS compatible. Since the
+// sub-products and sums are SMP assignments, the function must not be called from within a
+// parallel section.
+*/
+template< typename MT1, bool SO1    // Type of the left-hand side target matrix
+        , typename MT2, bool SO2    // Type of the left-hand side matrix operand
+        , typename MT3, bool SO3 >  // Type of the right-hand side matrix operand
+void strassen( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A, const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE    ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT1> );
+
+   using ET = ElementType_t<MT1>;
+   using TT = CustomMatrix<ET,aligned,unpadded,rowMajor>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t m( (*A).rows() );
+   const size_t k( (*A).columns() );
+   const size_t n( (*B).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (*B).rows()    == k, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (*C).rows()    == m, "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( (*C).columns() == n, "Invalid number of columns detected" );
+
+   const size_t m2( m / 2UL );
+   const size_t k2( k / 2UL );
+   const size_t n2( n / 2UL );
+
+   BLAZE_INTERNAL_ASSERT( m2 > 0UL && k2 > 0UL && n2 > 0UL, "Invalid matrix sizes detected" );
+
+   const size_t xspacing( nextMultiple( max( k2, n2 ), SIMDSIZE ) );
+   const size_t yspacing( nextMultiple( n2, SIMDSIZE ) );
+
+   size_t& level( strassenLevel() );
+   ET* const buffer( getStrassenBuffer<ET>( level, m2*xspacing + k2*yspacing ) );
+
+   TT XS( buffer, m2, k2, xspacing );
+   TT XP( buffer, m2, n2, xspacing );
+   TT Y ( buffer + m2*xspacing, k2, n2, yspacing );
+
+   auto A11( submatrix<unaligned>( *A, 0UL, 0UL, m2, k2, unchecked ) );
+   auto A12( submatrix<unaligned>( *A, 0UL, k2 , m2, k2, unchecked ) );
+   auto A21( submatrix<unaligned>( *A, m2 , 0UL, m2, k2, unchecked ) );
+   auto A22( submatrix<unaligned>( *A, m2 , k2 , m2, k2, unchecked ) );
+
+   auto B11( submatrix<unaligned>( *B, 0UL, 0UL, k2, n2, unchecked ) );
+   auto B12( submatrix<unaligned>( *B, 0UL, n2 , k2, n2, unchecked ) );
+   auto B21( submatrix<unaligned>( *B, k2 , 0UL, k2, n2, unchecked ) );
+   auto B22( submatrix<unaligned>( *B, k2 , n2 , k2, n2, unchecked ) );
+
+   auto C11( submatrix<unaligned>( *C, 0UL, 0UL, m2, n2, unchecked ) );
+   auto C12( submatrix<unaligned>( *C, 0UL, n2 , m2, n2, unchecked ) );
+   auto C21( submatrix<unaligned>( *C, m2 , 0UL, m2, n2, unchecked ) );
+   auto C22( submatrix<unaligned>( *C, m2 , n2 , m2, n2, unchecked ) );
+
+   ++level;
+
+   try {
+      XS  = A11 - A21;   // S3
+      Y   = B22 - B12;   // T3
+      C21 = XS * Y;      // P7 = S3 * T3
+      XS  = A21 + A22;   // S1
+      Y   = B12 - B11;   // T1
+      C22 = XS * Y;      // P5 = S1 * T1
+      XS -= A11;         // S2 = S1 - A11
+      Y   = B22 - Y;     // T2 = B22 - T1
+      C12 = XS * Y;      // P6 = S2 * T2
+      XS  = A12 - XS;    // S4 = A12 - S2
+      Y  -= B21;         // T4 = T2 - B21
+      C11 = XS * B22;    // P3 = S4 * B22
+      XP  = A11 * B11;   // P1
+      C12 += XP;         // U2 = P1 + P6
+      C21 += C12;        // U3 = U2 + P7
+      C12 += C22;        // U4 = U2 + P5
+      C22 += C21;        // U7 = U3 + P5
+      C12 += C11;        // U5 = U4 + P3
+      C11 = A22 * Y;     // P4 = A22 * T4
+      C21 -= C11;        // U6 = U3 - P4
+      C11 = A12 * B21;   // P2
+      C11 += XP;         // U1 = P1 + P2
+   }
+   catch( ... ) {
+      --level;
+      throw;
+   }
+
+   --level;
+
+   if( k % 2UL ) {
+      submatrix<unaligned>( *C, 0UL, 0UL, 2UL*m2, 2UL*n2, unchecked ) +=
+         submatrix<unaligned>( *A, 0UL, k-1UL, 2UL*m2, 1UL, unchecked ) *
+         submatrix<unaligned>( *B, k-1UL, 0UL, 1UL, 2UL*n2, unchecked );
+   }
+
+   if( n % 2UL ) {
+      submatrix<unaligned>( *C, 0UL, n-1UL, m, 1UL, unchecked ) =
+         (*A) * submatrix<unaligned>( *B, 0UL, n-1UL, k, 1UL, unchecked );
+   }
+
+   if( m % 2UL ) {
+      submatrix<unaligned>( *C, m-1UL, 0UL, 1UL, 2UL*n2, unchecked ) =
+         submatrix<unaligned>( *A, m-1UL, 0UL, 1UL, k, unchecked ) *
+         submatrix<unaligned>( *B, 0UL, 0UL, k, 2UL*n2, unchecked );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,693 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/VectorBatch.h
+//  \brief Header file for the implementation of a batch of fixed-size dense vectors
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_VECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_VECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/BatchPack.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batch of fixed-size dense vectors.
+// \ingroup dense_vector
+//
+// The VectorBatch class template represents a batch of an arbitrary number of dense vectors
+// with \a N elements each. It is the vector counterpart of the MatrixBatch class template and
+// is used as operand of the batched matrix/vector multiplication and as right-hand side and
+// solution of batched linear systems of equations:
+
+   \code
+   using blaze::MatrixBatch;
+   using blaze::VectorBatch;
+
+   MatrixBatch<double,3UL,3UL> A( 1000000UL );
+   VectorBatch<double,3UL> x( 1000000UL ), y;
+   // ... Initialization
+
+   mult( y, A, x );  // Computes y[k] = A[k] * x[k] for all vectors of the batch
+   \endcode
+
+// In contrast to a std::vector of StaticVector, the elements of the vectors of a batch are
+// interleaved across SIMD lanes (see the MatrixBatch class template for details). Therefore
+// the single elements cannot be accessed via a contiguous array per vector. Instead, the vectors
+// can be accessed element-wise via the function call operator or as a whole via the get() and
+// set() functions:
+
+   \code
+   VectorBatch<double,3UL> x( 100UL );
+
+   x( 5UL, 1UL ) = 2.0;  // Setting element 1 of vector 5
+
+   blaze::StaticVector<double,3UL> v{ 1.0, 2.0, 3.0 };
+   x.set( 7UL, v );  // Setting vector 7
+   v = x.get( 5UL );  // Extracting vector 5
+   \endcode
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+class VectorBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Type of the vector elements.
+   using VectorType  = StaticVector<Type,N,columnVector>;  //!< Type of a single vector of the batch.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the vectorized operations on the batch.
+   static constexpr bool simdEnabled = BatchPack<Type>::vectorizable;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline VectorBatch( size_t n = 0UL );
+            inline VectorBatch( const VectorBatch& b );
+            inline VectorBatch( VectorBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~VectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type&       operator()( size_t k, size_t i ) noexcept;
+   inline const Type& operator()( size_t k, size_t i ) const noexcept;
+   inline Type*       data  () noexcept;
+   inline const Type* data  () const noexcept;
+   inline Type*       data  ( size_t p ) noexcept;
+   inline const Type* data  ( size_t p ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline VectorBatch& operator=( const VectorBatch& rhs );
+   inline VectorBatch& operator=( VectorBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static constexpr size_t dimension() noexcept;
+   static constexpr size_t packSize () noexcept;
+
+   inline size_t     size () const noexcept;
+   inline size_t     packs() const noexcept;
+   inline VectorType get  ( size_t k ) const;
+   inline void       reset();
+   inline void       resize( size_t n, bool preserve=true );
+   inline void       swap( VectorBatch& b ) noexcept;
+
+   template< typename VT, bool TF >
+   inline void set( size_t k, const DenseVector<VT,TF>& v );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t packsFor( size_t n ) noexcept;
+   static inline size_t index( size_t k, size_t i ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;   //!< The current number of vectors of the batch.
+   size_t packs_;  //!< The current number of SIMD packs of the batch.
+   Type*  v_;      //!< The interleaved elements of all vectors of the batch.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors.
+//
+// \param n The number of vectors of the batch.
+//
+// All elements of all vectors are initialized to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>::VectorBatch( size_t n )
+   : size_ ( n )            // The current number of vectors of the batch
+   , packs_( packsFor( n ) )  // The current number of SIMD packs of the batch
+   , v_    ( nullptr )        // The interleaved elements of all vectors of the batch
+{
+   if( packs_ > 0UL ) {
+      v_ = allocate<Type>( packs_*N*packSize() );
+      reset();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for VectorBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>::VectorBatch( const VectorBatch& b )
+   : VectorBatch( b.size_ )
+{
+   std::copy( b.v_, b.v_ + packs_*N*packSize(), v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for VectorBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>::VectorBatch( VectorBatch&& b ) noexcept
+   : size_ ( b.size_  )  // The current number of vectors of the batch
+   , packs_( b.packs_ )  // The current number of SIMD packs of the batch
+   , v_    ( b.v_     )  // The interleaved elements of all vectors of the batch
+{
+   b.size_  = 0UL;
+   b.packs_ = 0UL;
+   b.v_     = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for VectorBatch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>::~VectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the vectors of the batch.
+//
+// \param k Index of the vector of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the element of the vector. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed element.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline Type& VectorBatch<Type,N>::operator()( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i < N    , "Invalid vector access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the vectors of the batch.
+//
+// \param k Index of the vector of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the element of the vector. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed element.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline const Type& VectorBatch<Type,N>::operator()( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i < N    , "Invalid vector access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// The elements of the \a p-th SIMD pack are stored in the range \f$ [p*N*S..(p+1)*N*S) \f$,
+// where \a S is the number of vectors per SIMD pack (see packSize()). Within a SIMD pack the
+// \a i-th element of the \a l-th vector of the pack is stored at the offset \f$ i*S+l \f$.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline Type* VectorBatch<Type,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline const Type* VectorBatch<Type,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the given SIMD pack.
+//
+// \param p Index of the SIMD pack. The index has to be in the range \f$[0..packs-1]\f$.
+// \return Pointer to the first element of the SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline Type* VectorBatch<Type,N>::data( size_t p ) noexcept
+{
+   BLAZE_USER_ASSERT( p < packs_, "Invalid pack access index" );
+   return v_ + p*N*packSize();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of the given SIMD pack.
+//
+// \param p Index of the SIMD pack. The index has to be in the range \f$[0..packs-1]\f$.
+// \return Pointer to the first element of the SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline const Type* VectorBatch<Type,N>::data( size_t p ) const noexcept
+{
+   BLAZE_USER_ASSERT( p < packs_, "Invalid pack access index" );
+   return v_ + p*N*packSize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for VectorBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( const VectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   VectorBatch tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for VectorBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( VectorBatch&& rhs ) noexcept
+{
+   VectorBatch tmp( std::move( rhs ) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements of every vector of the batch.
+//
+// \return The number of elements per vector.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+constexpr size_t VectorBatch<Type,N>::dimension() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of vectors per SIMD pack.
+//
+// \return The number of vectors per SIMD pack.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+constexpr size_t VectorBatch<Type,N>::packSize() noexcept
+{
+   return BatchPack<Type>::size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of vectors of the batch.
+//
+// \return The number of vectors of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline size_t VectorBatch<Type,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of SIMD packs of the batch.
+//
+// \return The number of SIMD packs of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline size_t VectorBatch<Type,N>::packs() const noexcept
+{
+   return packs_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th vector of the batch.
+//
+// \param k Index of the vector of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th vector of the batch.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline typename VectorBatch<Type,N>::VectorType VectorBatch<Type,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+
+   VectorType v;
+   for( size_t i=0UL; i<N; ++i ) {
+      v[i] = v_[index(k,i)];
+   }
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th vector of the batch.
+//
+// \param k Index of the vector of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param v The dense vector to be copied into the batch.
+// \return void
+// \exception std::invalid_argument Invalid vector size.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+template< typename VT    // Type of the dense vector
+        , bool TF >      // Transpose flag of the dense vector
+inline void VectorBatch<Type,N>::set( size_t k, const DenseVector<VT,TF>& v )
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid batch access index" );
+
+   if( (*v).size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size" );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      v_[index(k,i)] = (*v)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline void VectorBatch<Type,N>::reset()
+{
+   std::fill( v_, v_ + packs_*N*packSize(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of vectors of the batch.
+//
+// \param n The new number of vectors of the batch.
+// \param preserve \a true if the old vectors of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function changes the number of vectors of the batch. During this operation, new dynamic
+// memory may be allocated in case the number of SIMD packs changes. In case \a preserve is set
+// to \a true, the first min(\a n,size()) vectors are preserved. All new vectors are initialized
+// to the default value of \a Type.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline void VectorBatch<Type,N>::resize( size_t n, bool preserve )
+{
+   if( n == size_ ) return;
+
+   VectorBatch tmp( n );
+
+   if( preserve ) {
+      const size_t kend( min( n, size_ ) );
+      for( size_t k=0UL; k<kend; ++k ) {
+         for( size_t i=0UL; i<N; ++i ) {
+            tmp.v_[index(k,i)] = v_[index(k,i)];
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline void VectorBatch<Type,N>::swap( VectorBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_ , b.size_  );
+   swap( packs_, b.packs_ );
+   swap( v_    , b.v_     );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of SIMD packs required for the given number of vectors.
+//
+// \param n The number of vectors.
+// \return The number of SIMD packs.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline size_t VectorBatch<Type,N>::packsFor( size_t n ) noexcept
+{
+   return ( n + packSize() - 1UL ) / packSize();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the storage index of the given element.
+//
+// \param k Index of the vector of the batch.
+// \param i Index of the element of the vector.
+// \return The index of the element in the internal storage.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline size_t VectorBatch<Type,N>::index( size_t k, size_t i ) noexcept
+{
+   return ( ( k / packSize() )*N + i )*packSize() + k % packSize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name VectorBatch operators */
+//@{
+template< typename Type, size_t N >
+inline void reset( VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given vector batch.
+// \ingroup dense_vector
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline void reset( VectorBatch<Type,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vector batches.
+// \ingroup dense_vector
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements per vector
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
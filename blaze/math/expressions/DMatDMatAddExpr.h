@@ -662,6 +662,54 @@ class DMatDMatAddExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a mapped dense matrix-dense matrix addition to a dense matrix
+   //        (\f$ C=op(A+B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-dense
+   // matrix addition expression, combined with the custom operation \a op, to a dense matrix
+   // (see the map() function). The custom operation is passed on to the addition assignment of
+   // the operand that is evaluated last (see mapAddAssign()). Thus in an expression of the form
+   // \f$ C=op(A*B+D) \f$ the operation can be fused into the matrix multiplication. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case either of the two operands requires an intermediate evaluation.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO2       // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAssign( DenseMatrix<MT,SO2>& lhs, const DMatDMatAddExpr& rhs, OP op )
+      -> EnableIf_t< UseAssign_v<MT> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !IsOperation_v<MT1> && isSame( *lhs, rhs.lhs_ ) ) {
+         mapAddAssign( *lhs, rhs.rhs_, op );
+      }
+      else if( !IsOperation_v<MT2> && isSame( *lhs, rhs.rhs_ ) ) {
+         mapAddAssign( *lhs, rhs.lhs_, op );
+      }
+      else if( !RequiresEvaluation_v<MT2> ) {
+         assign      ( *lhs, rhs.rhs_ );
+         mapAddAssign( *lhs, rhs.lhs_, op );
+      }
+      else {
+         assign      ( *lhs, rhs.lhs_ );
+         mapAddAssign( *lhs, rhs.rhs_, op );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense matrix addition to a sparse matrix.
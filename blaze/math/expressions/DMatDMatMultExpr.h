@@ -52,6 +52,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/Strassen.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -81,6 +82,7 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
@@ -125,6 +127,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
 
 
 namespace blaze {
@@ -244,6 +247,37 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the Strassen-Winograd multiplication is enabled and the types of all three involved
+       matrices are suited for the Strassen-Winograd kernel, the variable will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseStrassenKernel_v =
+      ( useStrassen &&
+        !SYM && !HERM && !LOW && !UPP &&
+        !IsAdaptor_v<T1> && !IsTriangular_v<T2> && !IsTriangular_v<T3> &&
+        IsBLASCompatible_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is performed by the packed kernel (see mmm()), the variable
+       will be set to 1 and custom elementwise operations are fused into the kernel. Otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3> && UseVectorizedDefaultKernel_v<T1,T2,T3> &&
+        UsePackedMMMKernel_v< T1, T2, T3, ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -544,6 +578,23 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Strassen-Winograd suitability check*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns whether a multiplication of the given size is suited for the Strassen-Winograd
+   //        kernel.
+   //
+   // \param m The number of rows of the left-hand side operand.
+   // \param k The number of columns of the left-hand side operand.
+   // \param n The number of columns of the right-hand side operand.
+   // \return \a true in case all dimensions reach the STRASSEN_THRESHOLD, \a false if not.
+   */
+   static inline bool isStrassenSuited( size_t m, size_t k, size_t n ) noexcept
+   {
+      return ( min( m, k, n ) >= max( STRASSEN_THRESHOLD, 2UL ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices (kernel selection)*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Selection of the kernel for an assignment of a dense matrix-dense matrix
@@ -2115,6 +2166,46 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a mapped dense matrix-dense matrix multiplication to a dense matrix (\f$
+   //        C=op(A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(0), op,
+                                DMATDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a dense matrix-dense matrix multiplication to a dense matrix
@@ -3254,6 +3345,47 @@ class DMatDMatMultExpr
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a mapped dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C=op(C+A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the multiplication
+   // expression to a dense matrix, followed by the application of the custom operation \a op to
+   // each element of the target matrix (see the map() function). In case the multiplication is
+   // performed by the packed kernel, \a op is applied to each block of the target matrix as soon
+   // as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAddAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(1), op,
+                                DMATDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Subtraction assignment of a dense matrix-dense matrix multiplication to a
@@ -4485,6 +4617,53 @@ class DMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Strassen-Winograd-based SMP assignment to dense matrices************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Strassen-Winograd-based SMP assignment of a dense matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the Strassen-Winograd-based SMP assignment of a dense matrix-dense
+   // matrix multiplication expression to a dense matrix. In case all dimensions of the product
+   // reach the STRASSEN_THRESHOLD, one level of the Strassen-Winograd recursion is performed,
+   // whose sub-products and sums are again assigned via SMP assignments. Otherwise the function
+   // relays to the default SMP assignment. Due to the explicit application of the SFINAE
+   // principle this function can only be selected by the compiler in case the Strassen-Winograd
+   // multiplication is enabled and suited for the involved matrix types.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+      -> EnableIf_t< UseStrassenKernel_v<MT,MT1,MT2> &&
+                     !IsEvaluationRequired_v<MT,MT1,MT2> &&
+                     !CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      // The Strassen-Winograd recursion must not be started from within a parallel section,
+      // since its sub-products and sums are SMP assignments themselves. Therefore the recursion
+      // is performed on this level instead of within the assign() function. The conversion of
+      // the target to a general matrix selects the default SMP assignment.
+      if( !isStrassenSuited( rhs.rows(), rhs.lhs_.columns(), rhs.columns() ) ) {
+         smpAssign( static_cast< Matrix<MT,SO>& >( *lhs ), rhs );
+         return;
+      }
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      strassen( *lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-dense matrix multiplication to a sparse matrix
@@ -4907,6 +5086,18 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
         HasSIMDMult_v< ElementType_t<T2>, ElementType_t<T3> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the scaled multiplication is performed by the packed kernel (see mmm()), the
+       variable will be set to 1 and custom elementwise operations are fused into the kernel.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3,T4> && UseVectorizedDefaultKernel_v<T1,T2,T3,T4> &&
+        UsePackedMMMKernel_v<T1,T2,T3,T4> );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Type of the functor for forwarding an expression to another assign kernel.
    /*! In case a temporary matrix needs to be created, this functor is used to forward the
@@ -6761,6 +6952,45 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*!\brief Assignment of a mapped scaled dense matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ C=op(s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the scaled multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(0), op,
+                                DMATDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*!\brief Addition assignment of a scaled dense matrix-dense matrix multiplication to a
    //        dense matrix (\f$ C+=s*A*B \f$).
@@ -7984,6 +8214,46 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*!\brief Addition assignment of a mapped scaled dense matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C=op(C+s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the scaled
+   // multiplication expression to a dense matrix, followed by the application of the custom
+   // operation \a op to each element of the target matrix (see the map() function). In case the
+   // multiplication is performed by the packed kernel, \a op is applied to each block of the
+   // target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAddAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(1), op,
+                                DMATDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*!\brief Subtraction assignment of a scaled dense matrix-dense matrix multiplication to a
    //        dense matrix (\f$ C-=s*A*B \f$).
@@ -52,6 +52,7 @@
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/Scalar.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/dense/RuntimeDispatch.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
@@ -179,6 +180,24 @@ class DMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type and the two involved vector types are suited for a runtime
+       dispatched kernel, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseDispatchKernel_v =
+      ( !UseBlasKernel_v<T1,T2,T3> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsTriangular_v<T2> &&
+        IsDispatchable_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -1133,7 +1152,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeAssignKernel( y, A, x );
    }
@@ -1175,6 +1194,36 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the SIMD
+   // kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      reset( y );
+      dispatchGemv( y, A, x, ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense vector multiplication to a sparse vector
@@ -1941,7 +1990,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeAddAssignKernel( y, A, x );
    }
@@ -1984,6 +2033,35 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched addition assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the SIMD
+   // kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -2725,7 +2803,7 @@ class DMatDVecMultExpr
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2> || UseDispatchKernel_v<VT1,MT1,VT2> >
    {
       selectLargeSubAssignKernel( y, A, x );
    }
@@ -2768,6 +2846,35 @@ class DMatDVecMultExpr
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched subtraction assignment of a dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense matrix-dense vector multiplication by means of the SIMD
+   // kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(-1) );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -3171,6 +3278,23 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
         !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix type, the two involved vector types, and the scalar type are suited
+       for a runtime dispatched kernel, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseDispatchKernel_v =
+      ( !UseBlasKernel_v<T1,T2,T3,T4> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
+        !IsTriangular_v<T2> &&
+        IsDispatchable_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > &&
+        !IsComplex_v<T4> );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! In case the two involved vector types, the matrix type, and the scalar type are suited
@@ -4125,7 +4249,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeAssignKernel( y, A, x, scalar );
    }
@@ -4166,6 +4290,36 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors**********************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched assignment of a scaled dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // SIMD kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      reset( y );
+      dispatchGemv( y, A, x, ET(scalar) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a scaled dense matrix-dense vector multiplication to a sparse vector
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -4932,7 +5086,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeAddAssignKernel( y, A, x, scalar );
    }
@@ -4974,6 +5128,35 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched addition assignment to dense vectors*************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched addition assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // SIMD kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, ET(scalar) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -5716,7 +5899,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename VT2    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<VT1,MT1,VT2,ST2> || UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
    {
       selectLargeSubAssignKernel( y, A, x, scalar );
    }
@@ -5758,6 +5941,35 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**Runtime dispatched subtraction assignment to dense vectors**********************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   /*!\brief Runtime dispatched subtraction assignment of a scaled dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense matrix-dense vector multiplication by means of the
+   // SIMD kernel for the widest instruction set supported by the executing CPU.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
+      -> EnableIf_t< UseDispatchKernel_v<VT1,MT1,VT2,ST2> >
+   {
+      using ET = ElementType_t<VT1>;
+
+      dispatchGemv( y, A, x, -ET(scalar) );
+   }
+#endif
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -49,11 +49,13 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/native/getrf.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/IsStrictlyTriangular.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
@@ -342,7 +344,11 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[n] );
 
+#if BLAZE_LAPACK_MODE
    getrf( n, n, A.data(), lda, ipiv.get(), &info );
+#else
+   nativeGetrf( n, n, A.data(), lda, ipiv.get(), &info );
+#endif
 
    if( info > 0 ) {
       return ET(0);
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -50,19 +52,21 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatExpExpr.h>
+#include <blaze/math/lapack/gesv.h>
 #include <blaze/math/shims/Exp.h>
 #include <blaze/math/shims/Frexp.h>
-#include <blaze/math/shims/Pow.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloat.h>
 
 
 namespace blaze {
@@ -88,12 +92,12 @@ class DMatExpExpr
 {
  private:
    //**Type definitions****************************************************************************
-   using RT = ResultType_t<MT>;   //!< Result type of the dense matrix expression.
-   using ET = ElementType_t<MT>;  //!< Element type of the dense matrix expression.
-   //**********************************************************************************************
+   using RT = ResultType_t<MT>;    //!< Result type of the dense matrix expression.
+   using OT = OppositeType_t<MT>;  //!< Opposite type of the dense matrix expression.
+   using ET = ElementType_t<MT>;   //!< Element type of the dense matrix expression.
 
-   //**********************************************************************************************
-   static constexpr size_t K = 18;  //!< The approximation limit for the exponential computation.
+   //! Column-major workspace type for the Pad&eacute; approximation.
+   using WT = RemoveAdaptor_t< If_t< SO, RT, OT > >;
    //**********************************************************************************************
 
  public:
@@ -196,6 +200,176 @@ class DMatExpExpr
    Operand dm_;  //!< Dense matrix of the exponential expression.
    //**********************************************************************************************
 
+   //**1-norm computation**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the 1-norm (i.e. the maximum absolute column sum) of the given matrix.
+   //
+   // \param A The given column-major workspace matrix.
+   // \return The 1-norm of the given matrix.
+   */
+   static inline auto norm1( const WT& A )
+   {
+      return max( sum<columnwise>( abs( A ) ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Pade approximation**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the exponential of the given dense matrix by means of scaling and squaring.
+   //
+   // \param E The resulting matrix exponential.
+   // \param dm The dense matrix operand.
+   // \return void
+   //
+   // This function implements the scaling and squaring algorithm by Higham (N.J. Higham, "The
+   // Scaling and Squaring Method for the Matrix Exponential Revisited", SIAM J. Matrix Anal.
+   // Appl. 26(4), 2005), with the degree selection refined by the sharper bounds of Al-Mohy and
+   // Higham (2009). The degree \f$ m \in \{3,5,7,9,13\} \f$ (\f$ m \leq 7 \f$ in single
+   // precision) of the diagonal Pad&eacute; approximant \f$ r_m(A) = q_m(A)^{-1} p_m(A) \f$ and
+   // the scaling exponent \f$ s \f$ are chosen based on the 1-norms of the even powers of \f$ A \f$
+   // that are computed for the evaluation of the approximant anyway. The rational step is
+   // performed by a single LU-based solve of \f$ (V-U) E = (V+U) \f$ and all matrix products are
+   // computed into a fixed set of workspace matrices.
+   */
+   template< typename MT2 >  // Type of the dense matrix operand
+   static void exponential( WT& E, const MT2& dm )
+   {
+      using BT = UnderlyingBuiltin_t<ET>;
+
+      constexpr bool single( IsFloat_v<BT> );
+
+      // Maximum scaled 1-norms for the Pad&eacute; approximants of degree 3, 5, 7, 9, and 13
+      constexpr BT theta3 ( single ? 4.258730016922831e-1 : 1.495585217958292e-2 );
+      constexpr BT theta5 ( single ? 1.880152677804762e0  : 2.539398330063230e-1 );
+      constexpr BT theta7 ( single ? 3.925724783138660e0  : 9.504178996162932e-1 );
+      constexpr BT theta9 ( 2.097847961257068e0 );
+      constexpr BT theta13( 5.371920351148152e0 );
+
+      // Coefficients of the Pad&eacute; approximants of degree 3, 5, 7, 9, and 13
+      constexpr double b3[] = { 120.0, 60.0, 12.0, 1.0 };
+      constexpr double b5[] = { 30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0 };
+      constexpr double b7[] = { 17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0 };
+      constexpr double b9[] = { 17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0,
+                                2162160.0, 110880.0, 3960.0, 90.0, 1.0 };
+      constexpr double b13[] = { 64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+                                 1187353796428800.0, 129060195264000.0, 10559470521600.0,
+                                 670442572800.0, 33522128640.0, 1323241920.0, 40840800.0,
+                                 960960.0, 16380.0, 182.0, 1.0 };
+
+      const size_t N( dm.rows() );
+
+      WT A( dm );
+      WT A2( A * A );
+      WT A4, A6, U, V, T;
+
+      // Selection of the degree m and the scaling exponent s
+      size_t m( 13UL );
+      int s( 0 );
+
+      const BT a2( norm1( A2 ) );
+
+      if( std::sqrt( a2 ) <= theta3 ) {
+         m = 3UL;
+      }
+      else
+      {
+         A4 = A2 * A2;
+
+         const BT a4( norm1( A4 ) );
+         const BT d4( std::pow( a4, BT(0.25) ) );
+
+         if( max( d4, std::pow( a4*a2, BT(1)/BT(6) ) ) <= theta5 ) {
+            m = 5UL;
+         }
+         else
+         {
+            A6 = A4 * A2;
+
+            const BT a6( norm1( A6 ) );
+            const BT eta3( max( std::pow( a6, BT(1)/BT(6) ), d4 ) );
+
+            if( eta3 <= theta7 || single ) {
+               m = 7UL;
+               if( eta3 > theta7 ) frexp( eta3 / theta7, &s );
+            }
+            else if( eta3 <= theta9 ) {
+               m = 9UL;
+            }
+            else {
+               const BT eta4( max( d4, std::pow( a4*a6, BT(0.1) ) ) );
+               const BT eta5( min( eta3, eta4 ) );
+               if( eta5 > theta13 ) frexp( eta5 / theta13, &s );
+            }
+         }
+      }
+
+      // Scaling of the matrix and its powers
+      if( s > 0 ) {
+         const BT c( std::ldexp( BT(1), -s ) );
+         A  *= c;
+         A2 *= c*c;
+         A4 *= c*c*c*c;
+         A6 *= c*c*c*c*c*c;
+      }
+
+      // Evaluation of the odd (U) and even (V) parts of the numerator polynomial
+      if( m == 13UL )
+      {
+         T = BT(b13[13])*A6 + BT(b13[11])*A4 + BT(b13[9])*A2;
+         V = A6 * T;
+         V += BT(b13[7])*A6 + BT(b13[5])*A4 + BT(b13[3])*A2;
+         for( size_t i=0UL; i<N; ++i ) {
+            V(i,i) += BT(b13[1]);
+         }
+         U = A * V;
+
+         T = BT(b13[12])*A6 + BT(b13[10])*A4 + BT(b13[8])*A2;
+         V = A6 * T;
+         V += BT(b13[6])*A6 + BT(b13[4])*A4 + BT(b13[2])*A2;
+         for( size_t i=0UL; i<N; ++i ) {
+            V(i,i) += BT(b13[0]);
+         }
+      }
+      else
+      {
+         const double* b( m == 3UL ? b3 : m == 5UL ? b5 : m == 7UL ? b7 : b9 );
+
+         if( m == 9UL ) {
+            U = A4 * A4;
+         }
+
+         const WT* powers[] = { nullptr, &A2, &A4, &A6, &U };
+
+         T = BT(b[m  ]) * (*powers[m/2UL]);
+         V = BT(b[m-1]) * (*powers[m/2UL]);
+         for( size_t j=m/2UL-1UL; j>0UL; --j ) {
+            T += BT(b[2UL*j+1UL]) * (*powers[j]);
+            V += BT(b[2UL*j    ]) * (*powers[j]);
+         }
+         for( size_t i=0UL; i<N; ++i ) {
+            T(i,i) += BT(b[1]);
+            V(i,i) += BT(b[0]);
+         }
+         U = A * T;
+      }
+
+      // Rational step: (V-U) * E = (V+U)
+      E = V + U;
+      V -= U;
+
+      const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+      gesv( V, E, ipiv.get() );
+
+      // Squaring
+      for( int i=0; i<s; ++i ) {
+         T = E * E;
+         swap( E, T );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix exponential expression to a dense matrix.
@@ -228,34 +402,9 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
-         assign( *lhs, B );
+         WT E;
+         exponential( E, rhs.dm_ );
+         assign( *lhs, E );
       }
    }
    /*! \endcond */
@@ -324,34 +473,9 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
-         addAssign( *lhs, B );
+         WT E;
+         exponential( E, rhs.dm_ );
+         addAssign( *lhs, E );
       }
    }
    /*! \endcond */
@@ -393,34 +517,9 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
-         subAssign( *lhs, B );
+         WT E;
+         exponential( E, rhs.dm_ );
+         subAssign( *lhs, E );
       }
    }
    /*! \endcond */
@@ -462,34 +561,9 @@ class DMatExpExpr
       }
       else
       {
-         using BT = UnderlyingBuiltin_t<ET>;
-
-         const BT norm( maxNorm( rhs.dm_ ) );
-
-         int exponent( 0 );
-         frexp( norm, &exponent );
-         exponent = max( 0, exponent );
-
-         ResultType R( rhs.dm_ / pow( 2.0, double(exponent) ) );
-         ResultType A( R );
-         ResultType B( R );
-
-         for( size_t i=0UL; i<N; ++i ) {
-            B(i,i) += BT(1);
-         }
-
-         BT factor( 1 );
-         for( size_t k=2UL; k<K; ++k ) {
-            factor *= BT( k );
-            A *= R;
-            addAssign( B, ( A / factor ) );
-         }
-
-         for( int i=0; i<exponent; ++i ) {
-            B *= B;
-         }
-
-         schurAssign( *lhs, B );
+         WT E;
+         exponential( E, rhs.dm_ );
+         schurAssign( *lhs, E );
       }
    }
    /*! \endcond */
@@ -536,6 +610,10 @@ class DMatExpExpr
 
                   \f[ e^X = \sum\limits_{k=0}^\infty \frac{1}{k!} X^k \f]
 
+// The exponential is computed by means of the scaling and squaring method based on diagonal
+// Pad&eacute; approximants, where the degree of the approximant and the number of squarings are
+// chosen adaptively based on 1-norm estimates of the given matrix.
+//
 // Example:
 
    \code
@@ -614,7 +614,9 @@ class DMatMapExpr
    // expression to a dense matrix. Due to the explicit application of the SFINAE principle,
    // this function can only be selected by the compiler in case the operand requires an
    // intermediate evaluation and the underlying numeric data type of the operand and the
-   // target matrix are identical.
+   // target matrix are identical. The custom operation is passed on to the assignment of the
+   // operand (see mapAssign()), which enables the operand to fuse the operation into its own
+   // evaluation.
    */
    template< typename MT2  // Type of the target dense matrix
            , bool SO2 >    // Storage order or the target dense matrix
@@ -627,8 +629,7 @@ class DMatMapExpr
       BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      assign( *lhs, rhs.dm_ );
-      assign( *lhs, map( *lhs, rhs.op_ ) );
+      mapAssign( *lhs, rhs.dm_, rhs.op_ );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2660,6 +2661,78 @@ inline decltype(auto) real( const DMatMapExpr<MT,Real,SO>& dm )
 
 
 
+//=================================================================================================
+//
+//  GLOBAL MAP ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default assignment of a dense matrix combined with a custom operation to a dense
+//        matrix (\f$ A=op(B) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \param op The custom operation to be applied to each element of the result.
+// \return void
+//
+// This function implements the default assignment of a dense matrix combined with a custom
+// elementwise operation: The dense matrix is assigned first, the custom operation is applied
+// in a separate pass over the target matrix afterwards. Expression types that are able to
+// fuse the custom operation into their evaluation provide a specialized mapAssign() function.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , bool SO2       // Storage order of the right-hand side dense matrix
+        , typename OP >  // Type of the custom operation
+inline void mapAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   assign( *lhs, *rhs );
+   assign( *lhs, map( *lhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default addition assignment of a dense matrix combined with a custom operation to a
+//        dense matrix (\f$ A=op(A+B) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \param op The custom operation to be applied to each element of the result.
+// \return void
+//
+// This function implements the default addition assignment of a dense matrix combined with a
+// custom elementwise operation: The dense matrix is added first, the custom operation is applied
+// in a separate pass over the target matrix afterwards. Expression types that are able to fuse
+// the custom operation into their evaluation provide a specialized mapAddAssign() function.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , bool SO1       // Storage order of the target dense matrix
+        , typename MT2   // Type of the right-hand side dense matrix
+        , bool SO2       // Storage order of the right-hand side dense matrix
+        , typename OP >  // Type of the custom operation
+inline void mapAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   addAssign( *lhs, *rhs );
+   assign( *lhs, map( *lhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL ARITHMETIC OPERATORS
@@ -63,11 +63,13 @@
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
@@ -1990,6 +1992,50 @@ inline RemoveCV_t< ElementType_t<MT> > dmatreduce( const DenseMatrix<MT,true>& d
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the total reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function selects between the serial and the parallel total reduction of the given dense
+// matrix. In case the number of elements of the dense matrix is larger or equal to the SMP dense
+// matrix total reduction threshold, the matrix is partitioned into one block of rows (row-major
+// matrices) or columns (column-major matrices) per thread, the blocks are reduced concurrently
+// by the serial (vectorized) reduction kernels, and the partial results are combined via \a op
+// in a fixed order.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) dmatreduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   using CT = CompositeType_t<MT>;
+   using RT = decltype( dmatreduce( *dm, op ) );
+
+   if( !IsSMPAssignable_v<MT> || (*dm).rows() * (*dm).columns() < SMP_DMATFULLREDUCE_THRESHOLD ) {
+      return dmatreduce( *dm, std::move(op) );
+   }
+
+   CT tmp( *dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == (*dm).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == (*dm).columns(), "Invalid number of columns" );
+
+   const auto kernel = [&tmp,&op]( size_t index, size_t size ) -> RT {
+      return dmatreduce( SO ? submatrix( tmp, 0UL, index, tmp.rows(), size, unchecked )
+                            : submatrix( tmp, index, 0UL, size, tmp.columns(), unchecked ), op );
+   };
+
+   return smpReduce( SO ? tmp.columns() : tmp.rows(), 1UL, kernel, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given dense matrix.
 // \ingroup dense_matrix
@@ -2017,7 +2063,9 @@ inline RemoveCV_t< ElementType_t<MT> > dmatreduce( const DenseMatrix<MT,true>& d
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. In case the
+// reduction is executed in parallel, the partial results of the threads are combined in a fixed
+// order. Thus for a given number of threads the result of the reduction is reproducible.
 */
 template< typename MT    // Type of the dense matrix
         , bool SO        // Storage order
@@ -2026,7 +2074,7 @@ inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dmatreduce( *dm, std::move(op) );
+   return dmatreduce_backend( *dm, std::move(op) );
 }
 //*************************************************************************************************
 
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/blas/gemm.h>
+#include <blaze/math/blas/syrk.h>
 #include <blaze/math/blas/trmm.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
@@ -78,6 +79,7 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
@@ -117,6 +119,7 @@
 #include <blaze/util/typetraits/IsDouble.h>
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
 
 
 namespace blaze {
@@ -204,6 +207,27 @@ class DMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is suited for a BLAS kernel only in the form of a symmetric
+       rank-k update (i.e. one of the operands is the transpose of a contiguous matrix), the
+       variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseSyrkKernel_v =
+      ( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION &&
+        !SYM && !HERM && !LOW && !UPP && !UseBlasKernel_v<T1,T2,T3> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        ( IsContiguous_v<T2> || IsTransposedContiguous_v<T2> ) && HasConstDataAccess_v<T2> &&
+        ( IsContiguous_v<T3> || IsTransposedContiguous_v<T3> ) && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+        IsBLASCompatible_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -222,6 +246,20 @@ class DMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is performed by the packed kernel (see mmm()), the variable
+       will be set to 1 and custom elementwise operations are fused into the kernel. Otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3> && UseVectorizedDefaultKernel_v<T1,T2,T3> &&
+        UsePackedMMMKernel_v< T1, T2, T3, ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -2705,6 +2743,9 @@ class DMatTDMatMultExpr
    // This function implements the vectorized default assignment of a dense matrix-transpose
    // dense matrix multiplication expression to a dense matrix. This kernel is optimized for
    // large matrices.
+   //
+   // In case the product represents a Gram matrix (i.e. \f$ B=A^T \f$), only a single triangle is
+   // computed and mirrored into the other triangle.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2720,6 +2761,8 @@ class DMatTDMatMultExpr
          lmmm( C, A, B, ElementType(1), ElementType(0) );
       else if( UPP )
          ummm( C, A, B, ElementType(1), ElementType(0) );
+      else if( isGramian( A, B ) )
+         smmm( C, A, B, ElementType(1) );
       else
          mmm( C, A, B, ElementType(1), ElementType(0) );
    }
@@ -2744,7 +2787,7 @@ class DMatTDMatMultExpr
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline auto selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
-      -> DisableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
+      -> DisableIf_t< UseBlasKernel_v<MT3,MT4,MT5> || UseSyrkKernel_v<MT3,MT4,MT5> >
    {
       selectLargeAssignKernel( C, A, B );
    }
@@ -2765,6 +2808,9 @@ class DMatTDMatMultExpr
    //
    // This function performs the dense matrix-transpose dense matrix multiplication precision
    // matrices based on the according BLAS functionality.
+   //
+   // In case the product represents a Gram matrix (i.e. \f$ B=A^T \f$), only a single triangle is
+   // computed via a symmetric rank-k update (syrk) and mirrored into the other triangle.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2782,6 +2828,10 @@ class DMatTDMatMultExpr
          assign( C, A );
          trmm( C, B, CblasRight, ( IsLower_v<MT5> )?( CblasLower ):( CblasUpper ), ET(1) );
       }
+      else if( isGramian( A, B ) ) {
+         syrk( C, A, ( IsRowMajorMatrix_v<MT3> )?( CblasLower ):( CblasUpper ), ET(1), ET(0) );
+         symmetrize( C );
+      }
       else {
          gemm( C, A, B, ET(1), ET(0) );
       }
@@ -2790,6 +2840,42 @@ class DMatTDMatMultExpr
 #endif
    //**********************************************************************************************
 
+   //**BLAS-based symmetric rank-k update**********************************************************
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a dense matrix-transpose dense matrix multiplication with a
+   //        transposed operand (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function computes Gram matrices (i.e. \f$ B=A^T \f$) based on the BLAS symmetric rank-k
+   // update (syrk). Only a single triangle is computed and mirrored into the other triangle. All
+   // other products relay to the default implementation for large matrices.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      -> EnableIf_t< UseSyrkKernel_v<MT3,MT4,MT5> >
+   {
+      using ET = ElementType_t<MT3>;
+
+      if( isGramian( A, B ) ) {
+         syrk( C, A, ( IsRowMajorMatrix_v<MT3> )?( CblasLower ):( CblasUpper ), ET(1), ET(0) );
+         symmetrize( C );
+      }
+      else {
+         selectLargeAssignKernel( C, A, B );
+      }
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-transpose dense matrix multiplication to a sparse matrix
@@ -2829,6 +2915,45 @@ class DMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a mapped dense matrix-transpose dense matrix multiplication to a dense
+   //        matrix (\f$ C=op(A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline void mapAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs, OP op )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(0), op,
+                                DMATTDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a dense matrix-transpose dense matrix multiplication to a
@@ -4583,6 +4708,46 @@ class DMatTDMatMultExpr
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a mapped dense matrix-transpose dense matrix multiplication to
+   //        a dense matrix (\f$ C=op(C+A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the multiplication
+   // expression to a dense matrix, followed by the application of the custom operation \a op to
+   // each element of the target matrix (see the map() function). In case the multiplication is
+   // performed by the packed kernel, \a op is applied to each block of the target matrix as soon
+   // as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline void mapAddAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs, OP op )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(1), op,
+                                DMATTDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Subtraction assignment of a dense matrix-transpose dense matrix multiplication to a
@@ -6714,6 +6879,26 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
         !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is suited for a BLAS kernel only in the form of a symmetric
+       rank-k update (i.e. one of the operands is the transpose of a contiguous matrix), the
+       variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseSyrkKernel_v =
+      ( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION &&
+        !SYM && !HERM && !LOW && !UPP && !UseBlasKernel_v<T1,T2,T3,T4> &&
+        IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        ( IsContiguous_v<T2> || IsTransposedContiguous_v<T2> ) && HasConstDataAccess_v<T2> &&
+        ( IsContiguous_v<T3> || IsTransposedContiguous_v<T3> ) && HasConstDataAccess_v<T3> &&
+        !IsDiagonal_v<T2> && !IsDiagonal_v<T3> &&
+        T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+        IsBLASCompatible_v< ElementType_t<T1> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T3> > &&
+        !( IsBuiltin_v< ElementType_t<T1> > && IsComplex_v<T4> ) );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! In case all four involved data types are suited for a vectorized computation of the
@@ -6731,6 +6916,18 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
         HasSIMDMult_v< ElementType_t<T2>, ElementType_t<T3> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the scaled multiplication is performed by the packed kernel (see mmm()), the
+       variable will be set to 1 and custom elementwise operations are fused into the kernel.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3,T4> && UseVectorizedDefaultKernel_v<T1,T2,T3,T4> &&
+        UsePackedMMMKernel_v<T1,T2,T3,T4> );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Type of the functor for forwarding an expression to another assign kernel.
    /*! In case a temporary matrix needs to be created, this functor is used to forward the
@@ -9179,6 +9376,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    // This function implements the vectorized default assignment of a scaled dense matrix-
    // transpose dense matrix multiplication expression to a dense matrix. This kernel is
    // optimized for large matrices.
+   //
+   // In case the product represents a Gram matrix (i.e. \f$ B=A^T \f$), only a single triangle is
+   // computed and mirrored into the other triangle.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -9195,6 +9395,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          lmmm( C, A, B, scalar, ST2(0) );
       else if( UPP )
          ummm( C, A, B, scalar, ST2(0) );
+      else if( isGramian( A, B ) )
+         smmm( C, A, B, scalar );
       else
          mmm( C, A, B, scalar, ST2(0) );
    }
@@ -9219,7 +9421,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
            , typename MT5    // Type of the right-hand side matrix operand
            , typename ST2 >  // Type of the scalar value
    static inline auto selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
-      -> DisableIf_t< UseBlasKernel_v<MT3,MT4,MT5,ST2> >
+      -> DisableIf_t< UseBlasKernel_v<MT3,MT4,MT5,ST2> || UseSyrkKernel_v<MT3,MT4,MT5,ST2> >
    {
       selectLargeAssignKernel( C, A, B, scalar );
    }
@@ -9239,6 +9441,9 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    //
    // This function performs the scaled dense matrix-transpose dense matrix multiplication based
    // on the according BLAS functionality.
+   //
+   // In case the product represents a Gram matrix (i.e. \f$ B=A^T \f$), only a single triangle is
+   // computed via a symmetric rank-k update (syrk) and mirrored into the other triangle.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -9257,6 +9462,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
          assign( C, A );
          trmm( C, B, CblasRight, ( IsLower_v<MT5> )?( CblasLower ):( CblasUpper ), ET(scalar) );
       }
+      else if( isGramian( A, B ) ) {
+         syrk( C, A, ( IsRowMajorMatrix_v<MT3> )?( CblasLower ):( CblasUpper ), ET(scalar), ET(0) );
+         symmetrize( C );
+      }
       else {
          gemm( C, A, B, ET(scalar), ET(0) );
       }
@@ -9264,6 +9473,42 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 #endif
    //**********************************************************************************************
 
+   //**BLAS-based symmetric rank-k update**********************************************************
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
+   /*!\brief BLAS-based assignment of a scaled dense matrix-transpose dense matrix multiplication
+   //        with a transposed operand (\f$ C=s*A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function computes Gram matrices (i.e. \f$ B=A^T \f$) based on the BLAS symmetric rank-k
+   // update (syrk). Only a single triangle is computed and mirrored into the other triangle. All
+   // other products relay to the default implementation for large matrices.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
+      -> EnableIf_t< UseSyrkKernel_v<MT3,MT4,MT5,ST2> >
+   {
+      using ET = ElementType_t<MT3>;
+
+      if( isGramian( A, B ) ) {
+         syrk( C, A, ( IsRowMajorMatrix_v<MT3> )?( CblasLower ):( CblasUpper ), ET(scalar), ET(0) );
+         symmetrize( C );
+      }
+      else {
+         selectLargeAssignKernel( C, A, B, scalar );
+      }
+   }
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*!\brief Assignment of a scaled dense matrix-transpose dense matrix multiplication to a
    //        sparse matrix (\f$ C=s*A*B \f$).
@@ -9301,6 +9546,44 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*!\brief Assignment of a mapped scaled dense matrix-transpose dense matrix multiplication to a
+   //        dense matrix (\f$ C=op(s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the scaled multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline void mapAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(0), op,
+                                DMATTDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*!\brief Addition assignment of a scaled dense matrix-transpose dense matrix multiplication
    //        to a dense matrix (\f$ C+=s*A*B \f$).
@@ -11092,6 +11375,45 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*!\brief Addition assignment of a mapped scaled dense matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C=op(C+s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the scaled
+   // multiplication expression to a dense matrix, followed by the application of the custom
+   // operation \a op to each element of the target matrix (see the map() function). In case the
+   // multiplication is performed by the packed kernel, \a op is applied to each block of the
+   // target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline void mapAddAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(1), op,
+                                DMATTDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*!\brief Subtraction assignment of a scaled dense matrix-transpose dense matrix multiplication
    //        to a dense matrix (\f$ C-=s*A*B \f$).
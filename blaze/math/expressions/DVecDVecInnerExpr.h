@@ -41,21 +41,29 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/RuntimeDispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -93,6 +101,13 @@ struct DVecDVecInnerExprHelper
         HasSIMDAdd_v< ElementType_t<CT1>, ElementType_t<CT1> > &&
         HasSIMDMult_v< ElementType_t<CT1>, ElementType_t<CT1> > );
    //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool dispatch =
+      ( IsDispatchableVector_v<VT1> &&
+        IsDispatchableVector_v<VT2> &&
+        IsSame_v< RemoveCV_t< ElementType_t<VT1> >, RemoveCV_t< ElementType_t<VT2> > > );
+   //**********************************************************************************************
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -123,7 +138,8 @@ struct DVecDVecInnerExprHelper
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
 inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
-   -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+   -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value ||
+                   DVecDVecInnerExprHelper<VT1,VT2>::dispatch
                  , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
    using CT1      = CompositeType_t<VT1>;
@@ -179,7 +195,8 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
 inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
-   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value &&
+                  !DVecDVecInnerExprHelper<VT1,VT2>::dispatch
                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
    using CT1      = CompositeType_t<VT1>;
@@ -234,6 +251,83 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched backend implementation of the scalar product (inner product) of
+//        two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the scalar product of two contiguous dense vectors of single or
+// double precision elements by means of the SIMD kernel for the widest instruction set supported
+// by the executing CPU. Due to the explicit application of the SFINAE principle, this function
+// can only be selected by the compiler in case the runtime dispatch mode is enabled.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::dispatch
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   return dispatchDot( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function selects between the serial and the parallel computation of the scalar product.
+// In case the number of elements of the dense vectors is larger or equal to the SMP dense
+// vector/dense vector inner product threshold, both vectors are partitioned into one contiguous
+// range per thread, the partial scalar products are computed concurrently by the serial
+// (vectorized) kernels, and the partial results are summed up in a fixed order.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto dvecdvecinner_backend( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   if( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ||
+       (*lhs).size() < SMP_DVECDVECINNER_THRESHOLD ) {
+      return dvecdvecinner( *lhs, *rhs );
+   }
+
+   CT1 left ( *lhs );
+   CT2 right( *rhs );
+
+   const auto kernel = [&left,&right]( size_t index, size_t size ) {
+      return dvecdvecinner( subvector( left , index, size, unchecked ),
+                            subvector( right, index, size, unchecked ) );
+   };
+
+   return smpReduce( left.size(), SIMDTrait<MultType>::size, kernel, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
@@ -271,7 +365,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   return dvecdvecinner( *lhs, *rhs );
+   return dvecdvecinner_backend( *lhs, *rhs );
 }
 //*************************************************************************************************
 
@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +64,17 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -302,6 +307,11 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the number of elements of the dense vector is larger or equal to the SMP dense vector
+// norm threshold, the sum of the powers is computed in parallel. For that purpose the vector is
+// partitioned into one contiguous range per thread and the partial sums are added up in a fixed
+// order before the root operation is applied.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -310,7 +320,22 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( *dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   using Vectorized = Bool_t< DVecNormHelper<VT,Abs,Power>::value >;
+
+   if( !IsSMPAssignable_v<VT> || (*dv).size() < SMP_DVECNORM_THRESHOLD ) {
+      return norm_backend( *dv, abs, power, root, Vectorized() );
+   }
+
+   CT tmp( *dv );
+
+   const auto kernel = [&tmp,&abs,&power]( size_t index, size_t size ) {
+      return norm_backend( subvector( tmp, index, size, unchecked ), abs, power, Noop(), Vectorized() );
+   };
+
+   return evaluate( root( smpReduce( tmp.size(), SIMDTrait<ET>::size, kernel, Add() ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/RuntimeDispatch.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
@@ -48,11 +49,15 @@
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -249,7 +254,8 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
-   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, RemoveCV_t< ElementType_t<VT> > >
+   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value && !IsDispatchableVector_v<VT>
+                , RemoveCV_t< ElementType_t<VT> > >
 {
    using CT = CompositeType_t<VT>;
    using ET = RemoveCV_t< ElementType_t<VT> >;
@@ -326,6 +332,32 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 //*************************************************************************************************
 
 
+#if BLAZE_RUNTIME_DISPATCH_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched backend implementation of the summation of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the summation.
+// \return The result of the summation.
+//
+// This function implements the summation of a contiguous dense vector of single or double
+// precision elements by means of the SIMD kernel for the widest instruction set supported by
+// the executing CPU. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case the runtime dispatch mode is enabled.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
+   -> EnableIf_t< IsDispatchableVector_v<VT>, RemoveCV_t< ElementType_t<VT> > >
+{
+   return dispatchSum( *dv );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense vector.
@@ -370,6 +402,48 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function selects between the serial and the parallel reduction of the given dense vector.
+// In case the number of elements of the dense vector is larger or equal to the SMP dense vector
+// reduction threshold, the vector is partitioned into one contiguous range per thread, the
+// ranges are reduced concurrently by the serial (vectorized) reduction kernels, and the partial
+// results are combined via \a op in a fixed order.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) dvecreduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = RemoveCV_t< ElementType_t<VT> >;
+   using RT = decltype( dvecreduce( *dv, op ) );
+
+   if( !IsSMPAssignable_v<VT> || (*dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( *dv, std::move(op) );
+   }
+
+   CT tmp( *dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == (*dv).size(), "Invalid vector size" );
+
+   const auto kernel = [&tmp,&op]( size_t index, size_t size ) -> RT {
+      return dvecreduce( subvector( tmp, index, size, unchecked ), op );
+   };
+
+   return smpReduce( tmp.size(), SIMDTrait<ET>::size, kernel, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given dense vector.
 // \ingroup dense_vector
@@ -397,7 +471,9 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. In case the
+// reduction is executed in parallel, the partial results of the threads are combined in a fixed
+// order. Thus for a given number of threads the result of the reduction is reproducible.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
@@ -406,7 +482,7 @@ inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dvecreduce( *dv, std::move(op) );
+   return dvecreduce_backend( *dv, std::move(op) );
 }
 //*************************************************************************************************
 
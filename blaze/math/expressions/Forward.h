@@ -152,6 +152,8 @@ template< typename > struct EvalExpr;
 template< typename > struct ExpandExpr;
 template< typename > struct Expression;
 template< typename > struct GenExpr;
+template< typename, typename, bool > class KronDMatMultExpr;
+template< typename, typename > class KronDVecMultExpr;
 template< typename > struct KronExpr;
 template< typename > struct MatEvalExpr;
 template< typename > struct MatExpExpr;
@@ -0,0 +1,856 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/KronDMatMultExpr.h
+//  \brief Header file for the Kronecker product/dense matrix multiplication expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_KRONDMATMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_KRONDMATMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatKronExpr.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/KronMult.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatKronExpr.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatInvExpr.h>
+#include <blaze/math/typetraits/IsMatScalarMultExpr.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/system/MacroDisable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRONDMATMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for Kronecker product-dense matrix multiplications.
+// \ingroup dense_matrix_expression
+//
+// The KronDMatMultExpr class represents the compile time expression for multiplications between
+// a (nested) Kronecker product and a dense matrix. The Kronecker product is never formed. Instead
+// every column of the dense matrix is multiplied matrix-free via the identity \f$ (A \otimes B)
+// vec(X) = vec(B X A^T) \f$ (see the kronMult() function).
+*/
+template< typename MT1  // Type of the left-hand side Kronecker product
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order of the result
+class KronDMatMultExpr
+   : public MatMatMultExpr< DenseMatrix< KronDMatMultExpr<MT1,MT2,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_t<MT1>;  //!< Result type of the left-hand side Kronecker product.
+   using RT2 = ResultType_t<MT2>;  //!< Result type of the right-hand side dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense matrix expression.
+   static constexpr bool evaluateRight = ( IsComputation_v<MT2> || RequiresEvaluation_v<MT2> );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this KronDMatMultExpr instance.
+   using This = KronDMatMultExpr<MT1,MT2,SO>;
+
+   //! Base type of this KronDMatMultExpr instance.
+   using BaseType = MatMatMultExpr< DenseMatrix<This,SO> >;
+
+   using ResultType    = MultTrait_t<RT1,RT2>;         //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side Kronecker product.
+   using LeftOperand = If_t< IsExpression_v<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side dense matrix expression.
+   using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the right-hand side dense matrix operand.
+   using RT = If_t< evaluateRight, const RT2, CompositeType_t<MT2> >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KronDMatMultExpr class.
+   //
+   // \param lhs The left-hand side Kronecker product of the multiplication expression.
+   // \param rhs The right-hand side dense matrix operand of the multiplication expression.
+   */
+   inline KronDMatMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side Kronecker product of the multiplication expression
+      , rhs_( rhs )  // Right-hand side dense matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < rhs_.columns(), "Invalid column access index" );
+      return row( lhs_, i, unchecked ) * column( rhs_, j, unchecked );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= rhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side Kronecker product operand.
+   //
+   // \return The left-hand side Kronecker product operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense matrix operand.
+   //
+   // \return The right-hand side dense matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side Kronecker product of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Type of the intermediate matrices for the input and output of the kronMult() kernel.
+   template< bool SO2 >
+   using TmpType = CustomMatrix<ElementType,unaligned,unpadded,SO2>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the given input matrix type provides direct access to a contiguous array of
+       elements of the resulting element type and has the same storage order as the given output
+       matrix type, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   static constexpr bool UseDirectInput_v =
+      ( IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
+        IsSame_v< ElementType_t<T2>, ElementType > &&
+        StorageOrder_v<T1> == StorageOrder_v<T2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the given output matrix type provides mutable access to a contiguous array of
+       elements of the resulting element type, the variable will be set to 1, otherwise it will
+       be 0. */
+   template< typename T1 >
+   static constexpr bool UseDirectOutput_v =
+      ( IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
+        IsSame_v< ElementType_t<T1>, ElementType > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kronecker product multiplication kernel*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Matrix-free assignment of a Kronecker product-dense matrix multiplication
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param K The left-hand side Kronecker product.
+   // \param D The right-hand side dense matrix.
+   // \param parallel \a true in case the multiplication may be executed in parallel.
+   // \return void
+   //
+   // This function passes the arrays of the matrices \a D and \a C to the kronMult() kernel. In
+   // case any of the two matrices is padded, the matrix is first copied into or the result is
+   // computed in an intermediate array without padding.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( MT3& C, const MT1& K, const MT4& D, bool parallel )
+      -> EnableIf_t< UseDirectInput_v<MT3,MT4> && UseDirectOutput_v<MT3> >
+   {
+      constexpr bool SO2( StorageOrder_v<MT3> );
+
+      if( D.spacing() != ( SO2 ? D.rows() : D.columns() ) )
+      {
+         const std::unique_ptr<ElementType[]> buffer( new ElementType[D.rows()*D.columns()] );
+         TmpType<SO2> tmp( buffer.get(), D.rows(), D.columns() );
+         assign( tmp, D );
+         selectAssignKernel( C, K, tmp, parallel );
+      }
+      else if( C.spacing() != ( SO2 ? C.rows() : C.columns() ) )
+      {
+         const std::unique_ptr<ElementType[]> buffer( new ElementType[C.rows()*C.columns()] );
+         TmpType<SO2> tmp( buffer.get(), C.rows(), C.columns() );
+         selectAssignKernel( tmp, K, D, parallel );
+         assign( C, tmp );
+      }
+      else
+      {
+         kronMult<SO2>( K, D.data(), C.data(), D.columns(), parallel );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kronecker product multiplication kernel (staged input)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Matrix-free assignment of a Kronecker product-dense matrix multiplication
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param K The left-hand side Kronecker product.
+   // \param D The right-hand side dense matrix.
+   // \param parallel \a true in case the multiplication may be executed in parallel.
+   // \return void
+   //
+   // This function copies the matrix \a D into a contiguous array of the resulting element type
+   // and of the storage order of \a C before passing it to the kronMult() kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( MT3& C, const MT1& K, const MT4& D, bool parallel )
+      -> EnableIf_t< !UseDirectInput_v<MT3,MT4> && UseDirectOutput_v<MT3> >
+   {
+      const std::unique_ptr<ElementType[]> buffer( new ElementType[D.rows()*D.columns()] );
+      TmpType< StorageOrder_v<MT3> > tmp( buffer.get(), D.rows(), D.columns() );
+      assign( tmp, D );
+      selectAssignKernel( C, K, tmp, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Kronecker product multiplication kernel (staged output)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Matrix-free assignment of a Kronecker product-dense matrix multiplication
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param K The left-hand side Kronecker product.
+   // \param D The right-hand side dense matrix.
+   // \param parallel \a true in case the multiplication may be executed in parallel.
+   // \return void
+   //
+   // This function computes the result into a contiguous array of the resulting element type
+   // before copying it into the target matrix \a C.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( MT3& C, const MT1& K, const MT4& D, bool parallel )
+      -> DisableIf_t< UseDirectOutput_v<MT3> >
+   {
+      const std::unique_ptr<ElementType[]> buffer( new ElementType[C.rows()*C.columns()] );
+      TmpType< StorageOrder_v<MT3> > tmp( buffer.get(), C.rows(), C.columns() );
+      selectAssignKernel( tmp, K, D, parallel );
+      assign( C, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense matrix multiplication to a dense matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (*lhs).rows() == 0UL || (*lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( *lhs );
+         return;
+      }
+
+      RT D( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( D.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( D.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      selectAssignKernel( *lhs, rhs.lhs_, D, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a Kronecker product-dense matrix multiplication to a sparse matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a Kronecker product-dense
+   // matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C+=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      addAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C-=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      subAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a Kronecker product-dense matrix multiplication to a dense
+   //        matrix (\f$ C\circ=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      schurAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense matrix multiplication to a dense matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense matrix multiplication expression to a dense matrix. The small matrix multiplications
+   // of the kronMult() kernel are executed in parallel.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (*lhs).rows() == 0UL || (*lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.lhs_.columns() == 0UL ) {
+         reset( *lhs );
+         return;
+      }
+
+      RT D( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( D.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( D.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+
+      selectAssignKernel( *lhs, rhs.lhs_, D, true );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a Kronecker product-dense matrix multiplication to a sparse matrix
+   //        (\f$ C=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a Kronecker product-
+   // dense matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO2 >   // Storage order of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C+=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpAddAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAddAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpSubAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpSubAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a Kronecker product-dense matrix multiplication to a
+   //        dense matrix (\f$ C\circ=(A \otimes B)*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a Kronecker
+   // product-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO2 >   // Storage order of the target dense matrix
+   friend inline void smpSchurAssign( DenseMatrix<MT,SO2>& lhs, const KronDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = If_t< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( TmpType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT, TmpType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpSchurAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to sparse matrices*********************************************
+   // No special implementation for the SMP Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense matrices*********************************************
+   // No special implementation for the SMP multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse matrices********************************************
+   // No special implementation for the SMP multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_MATMATKRONEXPR_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a Kronecker product and a dense
+//        matrix (\f$ C=(A \otimes B)*D \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side Kronecker product.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// Kronecker product and a dense matrix. Instead of forming the Kronecker product, which
+// contains \f$ m p \times n q \f$ elements for a \f$ m \times n \f$ matrix \f$ A \f$ and a
+// \f$ p \times q \f$ matrix \f$ B \f$, it evaluates every column of the multiplication
+// matrix-free via the identity \f$ (A \otimes B) vec(X) = vec(B X A^T) \f$.
+*/
+template< typename MT1  // Matrix base type of the left-hand side expression
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO       // Storage order of the right-hand side dense matrix
+        , DisableIf_t< IsMatScalarMultExpr_v<MT2> || IsMatInvExpr_v<MT2> >* = nullptr >
+inline decltype(auto)
+   operator*( const MatMatKronExpr<MT1>& lhs, const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using KT = MatrixType_t<MT1>;
+   using RT = MultTrait_t< ResultType_t<KT>, ResultType_t<MT2> >;
+
+   if( (*lhs).columns() != (*rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const KronDMatMultExpr< KT, MT2, StorageOrder_v<RT> >;
+   return ReturnType( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
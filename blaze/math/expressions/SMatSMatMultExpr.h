@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Identity.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -58,6 +59,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -947,6 +950,221 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to row-major sparse matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major sparse
+   //        matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-sparse
+   // matrix multiplication expression to a row-major sparse matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler in
+   // case none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline auto smpAssign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
+      -> DisableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !rhs.canSMPAssign() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (*lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (*lhs).columns()  , "Invalid number of columns" );
+
+      SMatSMatMultExpr::selectSMPAssignKernel( *lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP assignment to row-major sparse matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major
+   //        sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side sparse matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the default SMP assignment kernel for the sparse matrix-sparse
+   // matrix multiplication. Since the rows of a general sparse matrix cannot be filled
+   // concurrently, the multiplication is executed single-threaded.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSMPAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      assign( C, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel SMP assignment to row-major compressed matrices************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel SMP assignment of a sparse matrix-sparse matrix multiplication to a row-major
+   //        compressed matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side compressed matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the parallel SMP assignment kernel for the sparse matrix-sparse
+   // matrix multiplication (Gustavson's algorithm). The work of each row of the resulting matrix
+   // is estimated by the number of multiplications it requires, and the rows are partitioned
+   // among the threads such that every thread performs approximately the same number of
+   // multiplications. In a first (symbolic) pass the exact number of non-zero elements of every
+   // row is computed, which allows to set up the storage layout of the target matrix at once.
+   // In a second (numeric) pass every thread computes its rows by means of a thread-local
+   // accumulator and directly stores them in the target matrix.
+   */
+   template< typename Type   // Data type of the target compressed matrix
+           , typename Tag    // Type tag of the target compressed matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSMPAssignKernel( CompressedMatrix<Type,false,Tag>& C, const MT4& A, const MT5& B )
+   {
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+
+      // Estimating the work of every row of the resulting matrix
+      std::vector<size_t> work( M+1UL, 0UL );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         size_t flops( 1UL );
+         const auto lend( A.end(i) );
+         for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            flops += B.nonZeros( lelem->index() );
+         }
+         work[i+1UL] = work[i] + flops;
+      }
+
+      // Computing the exact number of non-zero elements of every row
+      std::vector<size_t> nonzeros( M, 0UL );
+
+      smpLoop( work, [&A,&B,&nonzeros,M,N]( size_t begin, size_t end )
+      {
+         SmallArray<size_t,128UL> marker( N, M );
+
+         for( size_t i=begin; i<end; ++i )
+         {
+            size_t count( 0UL );
+
+            const auto lend( A.end(i) );
+            for( auto lelem=A.begin(i); lelem!=lend; ++lelem )
+            {
+               const auto rend( B.end( lelem->index() ) );
+               for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  if( marker[relem->index()] != i ) {
+                     marker[relem->index()] = i;
+                     ++count;
+                  }
+               }
+            }
+
+            nonzeros[i] = count;
+         }
+      } );
+
+      C.reset();
+      C.layout( nonzeros );
+
+      // Performing the matrix-matrix multiplication
+      smpLoop( work, [&A,&B,&C,N]( size_t begin, size_t end )
+      {
+         SmallArray<ElementType,128UL> values ( N, ElementType() );
+         SmallArray<bool,128UL>        valid  ( N, false );
+         SmallArray<size_t,128UL>      indices( N, 0UL );
+         size_t minIndex( inf ), maxIndex( 0UL );
+
+         for( size_t i=begin; i<end; ++i )
+         {
+            size_t count( 0UL );
+
+            const auto lend( A.end(i) );
+            for( auto lelem=A.begin(i); lelem!=lend; ++lelem )
+            {
+               const auto rend( B.end( lelem->index() ) );
+               for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  if( !valid[relem->index()] ) {
+                     values[relem->index()] = lelem->value() * relem->value();
+                     valid [relem->index()] = true;
+                     indices[count] = relem->index();
+                     ++count;
+                     if( relem->index() < minIndex ) minIndex = relem->index();
+                     if( relem->index() > maxIndex ) maxIndex = relem->index();
+                  }
+                  else {
+                     values[relem->index()] += lelem->value() * relem->value();
+                  }
+               }
+            }
+
+            BLAZE_INTERNAL_ASSERT( count <= N, "Invalid number of non-zero elements" );
+
+            if( count == 0UL )
+               continue;
+
+            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+            if( ( count + count ) < ( maxIndex - minIndex ) )
+            {
+               std::sort( indices.begin(), indices.begin() + count );
+
+               for( size_t j=0UL; j<count; ++j )
+               {
+                  const size_t index( indices[j] );
+                  if( !isDefault( values[index] ) ) {
+                     C.append( i, index, values[index] );
+                     reset( values[index] );
+                  }
+
+                  reset( valid[index] );
+               }
+            }
+            else {
+               for( size_t j=minIndex; j<=maxIndex; ++j )
+               {
+                  if( !isDefault( values[j] ) ) {
+                     C.append( i, j, values[j] );
+                     reset( values[j] );
+                  }
+
+                  reset( valid[j] );
+               }
+            }
+
+            minIndex = inf;
+            maxIndex = 0UL;
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a sparse matrix-sparse matrix multiplication to a dense
@@ -79,6 +79,7 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsBLASCompatible.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
@@ -123,6 +124,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
 
 
 namespace blaze {
@@ -242,6 +244,20 @@ class TDMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is performed by the packed kernel (see mmm()), the variable
+       will be set to 1 and custom elementwise operations are fused into the kernel. Otherwise
+       it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3> && UseVectorizedDefaultKernel_v<T1,T2,T3> &&
+        UsePackedMMMKernel_v< T1, T2, T3, ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -2119,6 +2135,46 @@ class TDMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a mapped transpose dense matrix-transpose dense matrix multiplication to
+   //        a dense matrix (\f$ C=op(A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(0), op,
+                                TDMATTDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a transpose dense matrix-transpose dense matrix multiplication
@@ -3258,6 +3314,47 @@ class TDMatTDMatMultExpr
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a mapped transpose dense matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C=op(C+A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the multiplication
+   // expression to a dense matrix, followed by the application of the custom operation \a op to
+   // each element of the target matrix (see the map() function). In case the multiplication is
+   // performed by the packed kernel, \a op is applied to each block of the target matrix as soon
+   // as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAddAssign( DenseMatrix<MT,SO>& lhs, const TDMatTDMatMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using ET = ElementType_t<MT>;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT> > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, rhs.lhs_, rhs.rhs_, ET(1), ET(1), op,
+                                TDMATTDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Subtraction assignment of a transpose dense matrix-transpose dense matrix
@@ -4913,6 +5010,18 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
         HasSIMDMult_v< ElementType_t<T3>, ElementType_t<T3> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the scaled multiplication is performed by the packed kernel (see mmm()), the
+       variable will be set to 1 and custom elementwise operations are fused into the kernel.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static constexpr bool UseFusedKernel_v =
+      ( !SYM && !HERM && !LOW && !UPP && !IsAdaptor_v<T1> &&
+        !UseBlasKernel_v<T1,T2,T3,T4> && UseVectorizedDefaultKernel_v<T1,T2,T3,T4> &&
+        UsePackedMMMKernel_v<T1,T2,T3,T4> );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Type of the functor for forwarding an expression to another assign kernel.
    /*! In case a temporary matrix needs to be created, this functor is used to forward the
@@ -6767,6 +6876,45 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    }
    //**********************************************************************************************
 
+   //**Map assignment to dense matrices************************************************************
+   /*!\brief Assignment of a mapped scaled transpose dense matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C=op(s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be assigned.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of the scaled multiplication
+   // expression, combined with the custom operation \a op, to a dense matrix (see the map()
+   // function). In case the multiplication is performed by the packed kernel, \a op is applied to
+   // each block of the target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(0), op,
+                                TDMATTDMATMULT_THRESHOLD ) ) {
+         assign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Addition assignment to dense matrices*******************************************************
    /*!\brief Addition assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication to a dense matrix (\f$ C+=s*A*B \f$).
@@ -7992,6 +8140,46 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Map addition assignment to dense matrices***************************************************
+   /*!\brief Addition assignment of a mapped scaled transpose dense matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C=op(C+s*A*B) \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side scaled multiplication expression to be added.
+   // \param op The custom operation to be applied to each element of the result.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of the scaled
+   // multiplication expression to a dense matrix, followed by the application of the custom
+   // operation \a op to each element of the target matrix (see the map() function). In case the
+   // multiplication is performed by the packed kernel, \a op is applied to each block of the
+   // target matrix as soon as the block is complete.
+   */
+   template< typename MT    // Type of the target dense matrix
+           , bool SO        // Storage order of the target dense matrix
+           , typename OP >  // Type of the custom operation
+   friend inline auto mapAddAssign( DenseMatrix<MT,SO>& lhs, const DMatScalarMultExpr& rhs, OP op )
+      -> DisableIf_t< CanExploitSymmetry_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LeftOperand_t<MMM>  left ( rhs.matrix_.leftOperand()  );
+      RightOperand_t<MMM> right( rhs.matrix_.rightOperand() );
+
+      constexpr bool fused( UseFusedKernel_v< MT, RemoveCVRef_t<LT>, RemoveCVRef_t<RT>, ST > );
+
+      if( !mapmmm<fused,LT,RT>( *lhs, left, right, rhs.scalar_, ST(1), op,
+                                TDMATTDMATMULT_THRESHOLD ) ) {
+         addAssign( *lhs, rhs );
+         assign( *lhs, map( *lhs, op ) );
+      }
+   }
+   //**********************************************************************************************
+
    //**Subtraction assignment to dense matrices****************************************************
    /*!\brief Subtraction assignment of a scaled transpose dense matrix-transpose dense matrix
    //        multiplication to a dense matrix (\f$ C-=s*A*B \f$).
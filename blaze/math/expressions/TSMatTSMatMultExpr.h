@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/Identity.h>
@@ -58,6 +59,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/sparse/Forward.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -951,6 +954,219 @@ class TSMatTSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to column-major sparse matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a transpose sparse matrix-transpose sparse matrix multiplication to
+   //        a column-major sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a transpose sparse
+   // matrix-transpose sparse matrix multiplication expression to a column-major sparse matrix.
+   // Due to the explicit application of the SFINAE principle this function can only be selected
+   // by the compiler in case none of the two matrix operands requires an intermediate evaluation.
+   */
+   template< typename MT >  // Type of the target sparse matrix
+   friend inline auto smpAssign( SparseMatrix<MT,true>& lhs, const TSMatTSMatMultExpr& rhs )
+      -> DisableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (*lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !rhs.canSMPAssign() ) {
+         assign( *lhs, rhs );
+         return;
+      }
+
+      CT1 A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      CT2 B( rhs.rhs_ );  // Evaluation of the right-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (*lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (*lhs).columns()  , "Invalid number of columns" );
+
+      TSMatTSMatMultExpr::selectSMPAssignKernel( *lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SMP assignment to column-major sparse matrices**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default SMP assignment of a transpose sparse matrix-transpose sparse matrix
+   //        multiplication to a column-major sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side sparse matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the default SMP assignment kernel for the transpose sparse matrix-
+   // transpose sparse matrix multiplication. Since the columns of a general sparse matrix cannot
+   // be filled concurrently, the multiplication is executed single-threaded.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSMPAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      assign( C, A * B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel SMP assignment to column-major compressed matrices*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel SMP assignment of a transpose sparse matrix-transpose sparse matrix
+   //        multiplication to a column-major compressed matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side compressed matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the parallel SMP assignment kernel for the transpose sparse matrix-
+   // transpose sparse matrix multiplication (column-wise Gustavson's algorithm). The columns of
+   // the resulting matrix are partitioned among the threads based on the estimated number of
+   // multiplications per column. A symbolic pass computes the exact number of non-zero elements
+   // of every column and sets up the storage layout of the target matrix, a numeric pass computes
+   // the columns by means of thread-local accumulators.
+   */
+   template< typename Type   // Data type of the target compressed matrix
+           , typename Tag    // Type tag of the target compressed matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSMPAssignKernel( CompressedMatrix<Type,true,Tag>& C, const MT4& A, const MT5& B )
+   {
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+
+      // Estimating the work of every column of the resulting matrix
+      std::vector<size_t> work( N+1UL, 0UL );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         size_t flops( 1UL );
+         const auto rend( B.end(j) );
+         for( auto relem=B.begin(j); relem!=rend; ++relem ) {
+            flops += A.nonZeros( relem->index() );
+         }
+         work[j+1UL] = work[j] + flops;
+      }
+
+      // Computing the exact number of non-zero elements of every column
+      std::vector<size_t> nonzeros( N, 0UL );
+
+      smpLoop( work, [&A,&B,&nonzeros,M,N]( size_t begin, size_t end )
+      {
+         SmallArray<size_t,128UL> marker( M, N );
+
+         for( size_t j=begin; j<end; ++j )
+         {
+            size_t count( 0UL );
+
+            const auto rend( B.end(j) );
+            for( auto relem=B.begin(j); relem!=rend; ++relem )
+            {
+               const auto lend( A.end( relem->index() ) );
+               for( auto lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
+               {
+                  if( marker[lelem->index()] != j ) {
+                     marker[lelem->index()] = j;
+                     ++count;
+                  }
+               }
+            }
+
+            nonzeros[j] = count;
+         }
+      } );
+
+      C.reset();
+      C.layout( nonzeros );
+
+      // Performing the matrix-matrix multiplication
+      smpLoop( work, [&A,&B,&C,M]( size_t begin, size_t end )
+      {
+         SmallArray<ElementType,128UL> values ( M, ElementType() );
+         SmallArray<bool,128UL>        valid  ( M, false );
+         SmallArray<size_t,128UL>      indices( M, 0UL );
+         size_t minIndex( inf ), maxIndex( 0UL );
+
+         for( size_t j=begin; j<end; ++j )
+         {
+            size_t count( 0UL );
+
+            const auto rend( B.end(j) );
+            for( auto relem=B.begin(j); relem!=rend; ++relem )
+            {
+               const auto lend( A.end( relem->index() ) );
+               for( auto lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
+               {
+                  if( !valid[lelem->index()] ) {
+                     values[lelem->index()] = lelem->value() * relem->value();
+                     valid [lelem->index()] = true;
+                     indices[count] = lelem->index();
+                     ++count;
+                     if( lelem->index() < minIndex ) minIndex = lelem->index();
+                     if( lelem->index() > maxIndex ) maxIndex = lelem->index();
+                  }
+                  else {
+                     values[lelem->index()] += lelem->value() * relem->value();
+                  }
+               }
+            }
+
+            BLAZE_INTERNAL_ASSERT( count <= M, "Invalid number of non-zero elements" );
+
+            if( count == 0UL )
+               continue;
+
+            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+
+            if( ( count + count ) < ( maxIndex - minIndex ) )
+            {
+               std::sort( indices.begin(), indices.begin() + count );
+
+               for( size_t i=0UL; i<count; ++i )
+               {
+                  const size_t index( indices[i] );
+                  if( !isDefault( values[index] ) ) {
+                     C.append( index, j, values[index] );
+                     reset( values[index] );
+                  }
+
+                  reset( valid[index] );
+               }
+            }
+            else {
+               for( size_t i=minIndex; i<=maxIndex; ++i )
+               {
+                  if( !isDefault( values[i] ) ) {
+                     C.append( i, j, values[i] );
+                     reset( values[i] );
+                  }
+
+                  reset( valid[i] );
+               }
+            }
+
+            minIndex = inf;
+            maxIndex = 0UL;
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to dense matrices***************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a transpose sparse matrix-transpose sparse matrix
@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/gbtrf.h
+//  \brief Header file for the CLAPACK gbtrf wrapper functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_GBTRF_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_GBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void sgbtrf_( blaze::blas_int_t* m, blaze::blas_int_t* n, blaze::blas_int_t* kl,
+              blaze::blas_int_t* ku, float* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, blaze::blas_int_t* info );
+void dgbtrf_( blaze::blas_int_t* m, blaze::blas_int_t* n, blaze::blas_int_t* kl,
+              blaze::blas_int_t* ku, double* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, blaze::blas_int_t* info );
+void cgbtrf_( blaze::blas_int_t* m, blaze::blas_int_t* n, blaze::blas_int_t* kl,
+              blaze::blas_int_t* ku, float* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, blaze::blas_int_t* info );
+void zgbtrf_( blaze::blas_int_t* m, blaze::blas_int_t* n, blaze::blas_int_t* kl,
+              blaze::blas_int_t* ku, double* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, blaze::blas_int_t* info );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND LU DECOMPOSITION FUNCTIONS (GBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band LU decomposition functions (gbtrf) */
+//@{
+void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, float* AB,
+            blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, double* AB,
+            blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<float>* AB,
+            blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+
+void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<double>* AB,
+            blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LU decomposition of the given single precision band matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the LU decomposition of a general \a m-by-\a n single precision band
+// matrix with \a kl subdiagonals and \a ku superdiagonals based on the LAPACK sgbtrf() function,
+// which uses partial pivoting with row interchanges. The matrix is given in the band storage format
+// of LAPACK, i.e. element \f$ (i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$. The first
+// \a kl rows of \a AB are used as workspace for the fill-in of the factorization. On exit, \c U
+// is stored as upper band matrix with \a kl+ku superdiagonals in the first \a kl+ku+1 rows of
+// \a AB, the multipliers of \c L are stored in the remaining \a kl rows.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+//
+// For more information on the sgbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, float* AB,
+                   blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   sgbtrf_( &m, &n, &kl, &ku, AB, &ldab, ipiv, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LU decomposition of the given double precision band matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the LU decomposition of a general \a m-by-\a n double precision band
+// matrix with \a kl subdiagonals and \a ku superdiagonals based on the LAPACK dgbtrf() function,
+// which uses partial pivoting with row interchanges. The matrix is given in the band storage format
+// of LAPACK, i.e. element \f$ (i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$. The first
+// \a kl rows of \a AB are used as workspace for the fill-in of the factorization. On exit, \c U
+// is stored as upper band matrix with \a kl+ku superdiagonals in the first \a kl+ku+1 rows of
+// \a AB, the multipliers of \c L are stored in the remaining \a kl rows.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+//
+// For more information on the dgbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, double* AB,
+                   blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   dgbtrf_( &m, &n, &kl, &ku, AB, &ldab, ipiv, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LU decomposition of the given single precision complex band matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the LU decomposition of a general \a m-by-\a n single precision complex
+// band matrix with \a kl subdiagonals and \a ku superdiagonals based on the LAPACK cgbtrf()
+// function, which uses partial pivoting with row interchanges. The matrix is given in the band
+// storage format of LAPACK, i.e. element \f$ (i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$. The
+// first
+// \a kl rows of \a AB are used as workspace for the fill-in of the factorization. On exit, \c U
+// is stored as upper band matrix with \a kl+ku superdiagonals in the first \a kl+ku+1 rows of
+// \a AB, the multipliers of \c L are stored in the remaining \a kl rows.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+//
+// For more information on the cgbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<float>* AB,
+                   blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex8 ) == sizeof( complex<float> ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cgbtrf_( &m, &n, &kl, &ku, reinterpret_cast<ET*>( AB ), &ldab, ipiv, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LU decomposition of the given double precision complex band matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the LU decomposition of a general \a m-by-\a n double precision complex
+// band matrix with \a kl subdiagonals and \a ku superdiagonals based on the LAPACK zgbtrf()
+// function, which uses partial pivoting with row interchanges. The matrix is given in the band
+// storage format of LAPACK, i.e. element \f$ (i,j) \f$ is stored in \f$ AB(kl+ku+i-j,j) \f$. The
+// first
+// \a kl rows of \a AB are used as workspace for the fill-in of the factorization. On exit, \c U
+// is stored as upper band matrix with \a kl+ku superdiagonals in the first \a kl+ku+1 rows of
+// \a AB, the multipliers of \c L are stored in the remaining \a kl rows.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+//
+// For more information on the zgbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, complex<double>* AB,
+                   blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex16 ) == sizeof( complex<double> ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zgbtrf_( &m, &n, &kl, &ku, reinterpret_cast<ET*>( AB ), &ldab, ipiv, info );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,343 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/gbtrs.h
+//  \brief Header file for the CLAPACK gbtrs wrapper functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_GBTRS_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_GBTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void sgbtrs_( char* trans, blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+              blaze::blas_int_t* nrhs, float* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, float* B, blaze::blas_int_t* ldb,
+              blaze::blas_int_t* info, blaze::fortran_charlen_t ntrans );
+void dgbtrs_( char* trans, blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+              blaze::blas_int_t* nrhs, double* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, double* B, blaze::blas_int_t* ldb,
+              blaze::blas_int_t* info, blaze::fortran_charlen_t ntrans );
+void cgbtrs_( char* trans, blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+              blaze::blas_int_t* nrhs, float* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, float* B, blaze::blas_int_t* ldb,
+              blaze::blas_int_t* info, blaze::fortran_charlen_t ntrans );
+void zgbtrs_( char* trans, blaze::blas_int_t* n, blaze::blas_int_t* kl, blaze::blas_int_t* ku,
+              blaze::blas_int_t* nrhs, double* AB, blaze::blas_int_t* ldab,
+              blaze::blas_int_t* ipiv, double* B, blaze::blas_int_t* ldb,
+              blaze::blas_int_t* info, blaze::fortran_charlen_t ntrans );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND LU-BASED SUBSTITUTION FUNCTIONS (GBTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band LU-based substitution functions (gbtrs) */
+//@{
+void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+            const float* AB, blas_int_t ldab, const blas_int_t* ipiv,
+            float* B, blas_int_t ldb, blas_int_t* info );
+
+void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+            const double* AB, blas_int_t ldab, const blas_int_t* ipiv,
+            double* B, blas_int_t ldb, blas_int_t* info );
+
+void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+            const complex<float>* AB, blas_int_t ldab, const blas_int_t* ipiv,
+            complex<float>* B, blas_int_t ldb, blas_int_t* info );
+
+void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+            const complex<double>* AB, blas_int_t ldab, const blas_int_t* ipiv,
+            complex<double>* B, blas_int_t ldb, blas_int_t* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a general single precision banded
+//        linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param trans \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, and \c C for \f$ A^H*X=B \f$.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the LU factors.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK sgbtrs() function to perform the substitution step to compute
+// the solution to the general banded system of linear equations, where \a A is a \a n-by-\a n
+// band matrix that has already been factorized by the sgbtrf() function and \a X and \a B are
+// column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the sgbtrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+                   const float* AB, blas_int_t ldab, const blas_int_t* ipiv,
+                   float* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   sgbtrs_( &trans, &n, &kl, &ku, &nrhs, const_cast<float*>( AB ),
+            &ldab, const_cast<blas_int_t*>( ipiv ), B, &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a general double precision banded
+//        linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param trans \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, and \c C for \f$ A^H*X=B \f$.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the LU factors.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK dgbtrs() function to perform the substitution step to compute
+// the solution to the general banded system of linear equations, where \a A is a \a n-by-\a n
+// band matrix that has already been factorized by the dgbtrf() function and \a X and \a B are
+// column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the dgbtrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+                   const double* AB, blas_int_t ldab, const blas_int_t* ipiv,
+                   double* B, blas_int_t ldb, blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   dgbtrs_( &trans, &n, &kl, &ku, &nrhs, const_cast<double*>( AB ),
+            &ldab, const_cast<blas_int_t*>( ipiv ), B, &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a general single precision complex
+//        banded linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param trans \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, and \c C for \f$ A^H*X=B \f$.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the LU factors.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK cgbtrs() function to perform the substitution step to compute
+// the solution to the general banded system of linear equations, where \a A is a \a n-by-\a n
+// band matrix that has already been factorized by the cgbtrf() function and \a X and \a B are
+// column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the cgbtrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+                   const complex<float>* AB, blas_int_t ldab, const blas_int_t* ipiv,
+                   complex<float>* B, blas_int_t ldb, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex8 ) == sizeof( complex<float> ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cgbtrs_( &trans, &n, &kl, &ku, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( AB ) ),
+            &ldab, const_cast<blas_int_t*>( ipiv ), reinterpret_cast<ET*>( B ), &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a general double precision complex
+//        banded linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param trans \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, and \c C for \f$ A^H*X=B \f$.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the LU factors.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK zgbtrs() function to perform the substitution step to compute
+// the solution to the general banded system of linear equations, where \a A is a \a n-by-\a n
+// band matrix that has already been factorized by the zgbtrf() function and \a X and \a B are
+// column-major \a n-by-\a nrhs matrices.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the zgbtrs() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void gbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+                   const complex<double>* AB, blas_int_t ldab, const blas_int_t* ipiv,
+                   complex<double>* B, blas_int_t ldb, blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex16 ) == sizeof( complex<double> ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zgbtrs_( &trans, &n, &kl, &ku, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( AB ) ),
+            &ldab, const_cast<blas_int_t*>( ipiv ), reinterpret_cast<ET*>( B ), &ldb, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
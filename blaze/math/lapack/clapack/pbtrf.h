@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/pbtrf.h
+//  \brief Header file for the CLAPACK pbtrf wrapper functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_PBTRF_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_PBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void spbtrf_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, float* AB,
+              blaze::blas_int_t* ldab, blaze::blas_int_t* info,
+              blaze::fortran_charlen_t nuplo );
+void dpbtrf_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, double* AB,
+              blaze::blas_int_t* ldab, blaze::blas_int_t* info,
+              blaze::fortran_charlen_t nuplo );
+void cpbtrf_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, float* AB,
+              blaze::blas_int_t* ldab, blaze::blas_int_t* info,
+              blaze::fortran_charlen_t nuplo );
+void zpbtrf_( char* uplo, blaze::blas_int_t* n, blaze::blas_int_t* kd, double* AB,
+              blaze::blas_int_t* ldab, blaze::blas_int_t* info,
+              blaze::fortran_charlen_t nuplo );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND CHOLESKY DECOMPOSITION FUNCTIONS (PBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band Cholesky decomposition functions (pbtrf) */
+//@{
+void pbtrf( char uplo, blas_int_t n, blas_int_t kd, float* AB, blas_int_t ldab,
+            blas_int_t* info );
+
+void pbtrf( char uplo, blas_int_t n, blas_int_t kd, double* AB, blas_int_t ldab,
+            blas_int_t* info );
+
+void pbtrf( char uplo, blas_int_t n, blas_int_t kd, complex<float>* AB, blas_int_t ldab,
+            blas_int_t* info );
+
+void pbtrf( char uplo, blas_int_t n, blas_int_t kd, complex<double>* AB, blas_int_t ldab,
+            blas_int_t* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given single precision positive
+//        definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a positive definite
+// single precision band matrix based on the LAPACK spbtrf() function. For \a uplo = \c 'L' element
+// \f$ (i,j) \f$ of the lower band is stored in \f$ AB(i-j,j) \f$ and the decomposition has
+// the form \f$ A = L \cdot L^H \f$, for \a uplo = \c 'U' element \f$ (i,j) \f$ of the upper
+// band is stored in \f$ AB(kd+i-j,j) \f$ and the decomposition has the form
+// \f$ A = U^H \cdot U \f$. The resulting factor is stored in place of the given band.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the spbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbtrf( char uplo, blas_int_t n, blas_int_t kd, float* AB, blas_int_t ldab,
+                   blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   spbtrf_( &uplo, &n, &kd, AB, &ldab, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given double precision positive
+//        definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a positive definite
+// double precision band matrix based on the LAPACK dpbtrf() function. For \a uplo = \c 'L' element
+// \f$ (i,j) \f$ of the lower band is stored in \f$ AB(i-j,j) \f$ and the decomposition has
+// the form \f$ A = L \cdot L^H \f$, for \a uplo = \c 'U' element \f$ (i,j) \f$ of the upper
+// band is stored in \f$ AB(kd+i-j,j) \f$ and the decomposition has the form
+// \f$ A = U^H \cdot U \f$. The resulting factor is stored in place of the given band.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the dpbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbtrf( char uplo, blas_int_t n, blas_int_t kd, double* AB, blas_int_t ldab,
+                   blas_int_t* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+#endif
+
+   dpbtrf_( &uplo, &n, &kd, AB, &ldab, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given single precision complex
+//        positive definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a positive definite single precision complex
+// band matrix based on the LAPACK cpbtrf() function. For \a uplo = \c 'L' element
+// \f$ (i,j) \f$ of the lower band is stored in \f$ AB(i-j,j) \f$ and the decomposition has
+// the form \f$ A = L \cdot L^H \f$, for \a uplo = \c 'U' element \f$ (i,j) \f$ of the upper
+// band is stored in \f$ AB(kd+i-j,j) \f$ and the decomposition has the form
+// \f$ A = U^H \cdot U \f$. The resulting factor is stored in place of the given band.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the cpbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbtrf( char uplo, blas_int_t n, blas_int_t kd, complex<float>* AB, blas_int_t ldab,
+                   blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex8 ) == sizeof( complex<float> ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   cpbtrf_( &uplo, &n, &kd, reinterpret_cast<ET*>( AB ), &ldab, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given double precision complex
+//        positive definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param info Return code of the function call.
+// \return void
+//
+// This function performs the Cholesky decomposition of a positive definite double precision complex
+// band matrix based on the LAPACK zpbtrf() function. For \a uplo = \c 'L' element
+// \f$ (i,j) \f$ of the lower band is stored in \f$ AB(i-j,j) \f$ and the decomposition has
+// the form \f$ A = L \cdot L^H \f$, for \a uplo = \c 'U' element \f$ (i,j) \f$ of the upper
+// band is stored in \f$ AB(kd+i-j,j) \f$ and the decomposition has the form
+// \f$ A = U^H \cdot U \f$. The resulting factor is stored in place of the given band.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//   - > 0: If info = i, the leading minor of order i is not positive definite.
+//
+// For more information on the zpbtrf() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void pbtrf( char uplo, blas_int_t n, blas_int_t kd, complex<double>* AB, blas_int_t ldab,
+                   blas_int_t* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( blas_int_t ) );
+   BLAZE_STATIC_ASSERT( sizeof( MKL_Complex16 ) == sizeof( complex<double> ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   zpbtrf_( &uplo, &n, &kd, reinterpret_cast<ET*>( AB ), &ldab, info
+#if !defined(INTEL_MKL_VERSION)
+          , blaze::fortran_charlen_t(1)
+#endif
+          );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gbtrf.h
+//  \brief Header file for the LAPACK band LU decomposition functions (gbtrf)
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GBTRF_H_
+#define _BLAZE_MATH_LAPACK_GBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BandedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/lapack/clapack/gbtrf.h>
+#include <blaze/math/lapack/native/gbtrf.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND LU DECOMPOSITION FUNCTIONS (GBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band LU decomposition functions (gbtrf) */
+//@{
+template< typename Type >
+void gbtrf( BandedMatrix<Type,columnMajor>& A, blas_int_t* ipiv );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LU decomposition of the given general band matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The band matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+// \exception std::invalid_argument Invalid band storage provided.
+//
+// This function performs the LU decomposition of a general \a m-by-\a n band matrix based on
+// the LAPACK \c gbtrf() functions, which use partial pivoting with row interchanges. Note that
+// the function only works for band matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!\n
+//
+// The resulting decomposition has the form
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c L is a lower unitriangular band matrix with \a kl subdiagonals, \c U is an upper
+// triangular band matrix, and \c P is an m-by-m permutation matrix, which represents the pivoting
+// indices for the applied row interchanges. Due to the row interchanges \c U has up to \a kl
+// more superdiagonals than \a A. Therefore the given band matrix has to provide the storage for
+// these additional superdiagonals, i.e. a band matrix with \a kl subdiagonals and \a ku
+// superdiagonals has to be stored with an upper bandwidth of \a kl+ku. Otherwise a
+// \a std::invalid_argument exception is thrown. The content of the additional superdiagonals
+// is ignored:
+
+   \code
+   using blaze::BandedMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::blas_int_t;
+
+   // Storing a tridiagonal matrix with an additional superdiagonal for the fill-in
+   BandedMatrix<double,columnMajor> A( 100UL, 100UL, 1UL, 2UL );
+   DynamicVector<blas_int_t,columnVector> ipiv( 100UL );
+   // ... Initialization
+
+   gbtrf( A, ipiv.data() );
+   \endcode
+
+// On exit, \c U is stored in the upper band and the multipliers of \c L are stored in the lower
+// band of \a A.
+//
+// For more information on the gbtrf() functions (i.e. sgbtrf(), dgbtrf(), cgbtrf(), and zgbtrf())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
+//
+// \note The LU decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for solving a linear system of
+// equations.
+*/
+template< typename Type >  // Data type of the elements
+inline void gbtrf( BandedMatrix<Type,columnMajor>& A, blas_int_t* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.upperBandwidth() < A.lowerBandwidth() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid band storage provided" );
+   }
+
+   blas_int_t m   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.columns() ) );
+   blas_int_t kl  ( numeric_cast<blas_int_t>( A.lowerBandwidth() ) );
+   blas_int_t ku  ( numeric_cast<blas_int_t>( A.upperBandwidth() - A.lowerBandwidth() ) );
+   blas_int_t ldab( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t info( 0 );
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+#if BLAZE_LAPACK_MODE
+   gbtrf( m, n, kl, ku, A.data(), ldab, ipiv, &info );
+#else
+   nativeGbtrf( m, n, kl, ku, A.data(), ldab, ipiv, &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for band LU decomposition" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,6 +50,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/gelqf.h>
 #include <blaze/math/lapack/clapack/geqrf.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -109,9 +111,10 @@ void gelqf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
@@ -123,8 +126,6 @@ inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
    BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
    blas_int_t lda ( numeric_cast<blas_int_t>( (*A).spacing() ) );
@@ -134,6 +135,9 @@ inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
       return;
    }
 
+#if BLAZE_LAPACK_MODE
+   using ET = ElementType_t<MT>;
+
    blas_int_t lwork( ( SO ? m : n ) * lda );
    const std::unique_ptr<ET[]> work( new ET[lwork] );
 
@@ -143,6 +147,14 @@ inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
    else {
       geqrf( m, n, (*A).data(), lda, tau, work.get(), lwork, &info );
    }
+#else
+   if( SO ) {
+      nativeGelqf( m, n, (*A).data(), lda, tau, &info );
+   }
+   else {
+      nativeGeqrf( m, n, (*A).data(), lda, tau, &info );
+   }
+#endif
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for LQ decomposition" );
 }
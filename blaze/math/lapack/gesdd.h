@@ -51,7 +51,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesdd.h>
+#include <blaze/math/lapack/native/gesdd.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
@@ -120,6 +122,7 @@ inline auto gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
    blas_int_t lda ( numeric_cast<blas_int_t>( (*A).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -129,6 +132,10 @@ inline auto gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 
    gesdd( 'N', m, n, (*A).data(), lda, (*s).data(),
           nullptr, 1, nullptr, 1, work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesdd( 'N', m, n, (*A).data(), lda, (*s).data(),
+                static_cast<ET*>( nullptr ), 1, static_cast<ET*>( nullptr ), 1, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -167,13 +174,15 @@ inline auto gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
    BLAZE_INTERNAL_ASSERT( (*s).size() == min( (*A).rows(), (*A).columns() ), "Invalid vector dimension detected" );
 
    using CT = ElementType_t<MT>;
-   using BT = UnderlyingElement_t<CT>;
 
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
    blas_int_t lda ( numeric_cast<blas_int_t>( (*A).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
+   using BT = UnderlyingElement_t<CT>;
+
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -184,6 +193,10 @@ inline auto gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 
    gesdd( 'N', m, n, (*A).data(), lda, (*s).data(),
           nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesdd( 'N', m, n, (*A).data(), lda, (*s).data(),
+                static_cast<CT*>( nullptr ), 1, static_cast<CT*>( nullptr ), 1, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -253,9 +266,10 @@ inline auto gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
@@ -330,6 +344,7 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    blas_int_t ldu ( numeric_cast<blas_int_t>( (*U).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -343,6 +358,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
           ( SO ? (*U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (*U).data() ), ( SO ? 1 : ldu ),
           work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? (*U).data() : static_cast<ET*>( nullptr ) ), ( SO ? ldu : 1 ),
+                ( SO ? static_cast<ET*>( nullptr ) : (*U).data() ), ( SO ? 1 : ldu ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -388,7 +408,6 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    BLAZE_INTERNAL_ASSERT( (*s).size() == min( (*A).rows(), (*A).columns() ), "Invalid vector dimension detected" );
 
    using CT = ElementType_t<MT1>;
-   using BT = UnderlyingElement_t<CT>;
 
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
@@ -396,6 +415,9 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    blas_int_t ldu ( numeric_cast<blas_int_t>( (*U).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
+   using BT = UnderlyingElement_t<CT>;
+
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -414,6 +436,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
           ( SO ? (*U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (*U).data() ), ( SO ? 1 : ldu ),
           work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? (*U).data() : static_cast<CT*>( nullptr ) ), ( SO ? ldu : 1 ),
+                ( SO ? static_cast<CT*>( nullptr ) : (*U).data() ), ( SO ? 1 : ldu ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -510,9 +537,10 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
@@ -607,6 +635,7 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
    blas_int_t ldv ( numeric_cast<blas_int_t>( (*V).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -620,6 +649,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
           ( SO ? nullptr : (*V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (*V).data() : nullptr ), ( SO ? ldv : 1 ),
           work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? static_cast<ET*>( nullptr ) : (*V).data() ), ( SO ? 1 : ldv ),
+                ( SO ? (*V).data() : static_cast<ET*>( nullptr ) ), ( SO ? ldv : 1 ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -665,7 +699,6 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
    BLAZE_INTERNAL_ASSERT( (*s).size() == min( (*A).rows(), (*A).columns() ), "Invalid vector dimension detected" );
 
    using CT = ElementType_t<MT1>;
-   using BT = UnderlyingElement_t<CT>;
 
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
@@ -673,6 +706,9 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
    blas_int_t ldv ( numeric_cast<blas_int_t>( (*V).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
+   using BT = UnderlyingElement_t<CT>;
+
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -691,6 +727,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
           ( SO ? nullptr : (*V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (*V).data() : nullptr ), ( SO ? ldv : 1 ),
           work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? static_cast<CT*>( nullptr ) : (*V).data() ), ( SO ? 1 : ldv ),
+                ( SO ? (*V).data() : static_cast<CT*>( nullptr ) ), ( SO ? ldv : 1 ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -778,9 +819,10 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
@@ -873,8 +915,6 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    BLAZE_INTERNAL_ASSERT( jobz != 'S' || (*V).rows() == min( (*A).rows(), (*A).columns() ), "Invalid matrix dimension detected" );
    BLAZE_INTERNAL_ASSERT( (*s).size() == min( (*A).rows(), (*A).columns() ), "Invalid vector dimension detected" );
 
-   using ET = ElementType_t<MT1>;
-
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
    blas_int_t lda ( numeric_cast<blas_int_t>( (*A).spacing() ) );
@@ -882,6 +922,9 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    blas_int_t ldv ( numeric_cast<blas_int_t>( (*V).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
+   using ET = ElementType_t<MT1>;
+
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -893,6 +936,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
           ( SO ? (*U).data() : (*V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (*V).data() : (*U).data() ), ( SO ? ldv : ldu ),
           work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? (*U).data() : (*V).data() ), ( SO ? ldu : ldv ),
+                ( SO ? (*V).data() : (*U).data() ), ( SO ? ldv : ldu ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -943,9 +991,6 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    BLAZE_INTERNAL_ASSERT( jobz != 'S' || (*V).rows() == min( (*A).rows(), (*A).columns() ), "Invalid matrix dimension detected" );
    BLAZE_INTERNAL_ASSERT( (*s).size() == min( (*A).rows(), (*A).columns() ), "Invalid vector dimension detected" );
 
-   using CT = ElementType_t<MT1>;
-   using BT = UnderlyingElement_t<CT>;
-
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
    blas_int_t lda ( numeric_cast<blas_int_t>( (*A).spacing() ) );
@@ -953,6 +998,10 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    blas_int_t ldv ( numeric_cast<blas_int_t>( (*V).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
+   using CT = ElementType_t<MT1>;
+   using BT = UnderlyingElement_t<CT>;
+
    const blas_int_t minimum( min( m, n ) );
    const blas_int_t maximum( max( m, n ) );
 
@@ -967,6 +1016,11 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
           ( SO ? (*U).data() : (*V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (*V).data() : (*U).data() ), ( SO ? ldv : ldu ),
           work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesdd( jobz, m, n, (*A).data(), lda, (*s).data(),
+                ( SO ? (*U).data() : (*V).data() ), ( SO ? ldu : ldv ),
+                ( SO ? (*V).data() : (*U).data() ), ( SO ? ldv : ldu ), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -1076,9 +1130,10 @@ inline auto gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
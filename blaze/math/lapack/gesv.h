@@ -50,6 +50,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesv.h>
+#include <blaze/math/lapack/native/gesv.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/NumericCast.h>
@@ -122,9 +124,10 @@ void gesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t* ipiv );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -164,7 +167,11 @@ inline void gesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv
       return;
    }
 
+#if BLAZE_LAPACK_MODE
    gesv( n, nrhs, (*A).data(), lda, ipiv, (*b).data(), ldb, &info );
+#else
+   nativeGesv( n, nrhs, (*A).data(), lda, ipiv, (*b).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
@@ -225,9 +232,10 @@ inline void gesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, blas_int_t* ipiv
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -269,7 +277,11 @@ inline void gesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, blas_int_t*
       return;
    }
 
+#if BLAZE_LAPACK_MODE
    gesv( n, nrhs, (*A).data(), lda, ipiv, (*B).data(), ldb, &info );
+#else
+   nativeGesv( n, nrhs, (*A).data(), lda, ipiv, (*B).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
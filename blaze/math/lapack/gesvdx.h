@@ -51,10 +51,12 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesvdx.h>
+#include <blaze/math/lapack/native/gesdd.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
 #include <blaze/math/views/Subvector.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Builtin.h>
@@ -167,6 +169,7 @@ inline auto gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
       sptr = stmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -175,6 +178,10 @@ inline auto gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
 
    gesvdx( 'N', 'N', range, m, n, (*A).data(), lda, vl, vu, il, iu, &ns, sptr,
            nullptr, 1, nullptr, 1, work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesvdx( 'N', 'N', range, m, n, (*A).data(), lda, ET( vl ), ET( vu ), il, iu, &ns, sptr,
+                 static_cast<ET*>( nullptr ), 1, static_cast<ET*>( nullptr ), 1, &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -258,6 +265,7 @@ inline auto gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
       sptr = stmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -267,6 +275,10 @@ inline auto gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
 
    gesvdx( 'N', 'N', range, m, n, (*A).data(), lda, vl, vu, il, iu, &ns, sptr,
            nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesvdx( 'N', 'N', range, m, n, (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &ns, sptr,
+                 static_cast<CT*>( nullptr ), 1, static_cast<CT*>( nullptr ), 1, &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -337,9 +349,10 @@ inline auto gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
@@ -453,9 +466,10 @@ inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT    // Type of the matrix A
         , bool SO        // Storage order of the matrix A
@@ -586,6 +600,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
       uptr = utmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -597,6 +612,14 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
            ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
            ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
            work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
+                 (*A).data(), lda, ET( vl ), ET( vu ), il, iu, &ns, sptr,
+                 ( SO ? uptr : static_cast<ET*>( nullptr ) ),
+                 ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
+                 ( SO ? static_cast<ET*>( nullptr ) : uptr ),
+                 ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -707,6 +730,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
       uptr = utmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -719,6 +743,14 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
            ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
            ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
            work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
+                 (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &ns, sptr,
+                 ( SO ? uptr : static_cast<CT*>( nullptr ) ),
+                 ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
+                 ( SO ? static_cast<CT*>( nullptr ) : uptr ),
+                 ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -812,9 +844,10 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
@@ -945,9 +978,10 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVecto
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1   // Type of the matrix A
         , bool SO        // Storage order of all matrices
@@ -1091,6 +1125,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, Dense
       vptr = vtmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -1102,6 +1137,14 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, Dense
            ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
            ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
            work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
+                 (*A).data(), lda, ET( vl ), ET( vu ), il, iu, &ns, sptr,
+                 ( SO ? static_cast<ET*>( nullptr ) : vptr ),
+                 ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
+                 ( SO ? vptr : static_cast<ET*>( nullptr ) ),
+                 ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1212,6 +1255,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, Dense
       vptr = vtmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -1224,6 +1268,14 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, Dense
            ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
            ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
            work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
+                 (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &ns, sptr,
+                 ( SO ? static_cast<CT*>( nullptr ) : vptr ),
+                 ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
+                 ( SO ? vptr : static_cast<CT*>( nullptr ) ),
+                 ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1317,9 +1369,10 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, Dense
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
@@ -1450,9 +1503,10 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1   // Type of the matrix A
         , bool SO        // Storage order of all matrices
@@ -1606,6 +1660,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
       vptr = vtmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -1616,6 +1671,11 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
            ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
            ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
            work.get(), lwork, iwork.get(), &info );
+#else
+   nativeGesvdx( 'V', 'V', range, m, n, (*A).data(), lda, ET( vl ), ET( vu ), il, iu, &ns, sptr,
+                 ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
+                 ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1748,6 +1808,7 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
       vptr = vtmp.get();
    }
 
+#if BLAZE_LAPACK_MODE
    const blas_int_t minimum( min( m, n ) );
 
    blas_int_t lwork( minimum*( minimum*3 + 20 ) + 2 );
@@ -1759,6 +1820,11 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
            ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
            ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
            work.get(), lwork, rwork.get(), iwork.get(), &info );
+#else
+   nativeGesvdx( 'V', 'V', range, m, n, (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &ns, sptr,
+                 ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
+                 ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ), &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1868,9 +1934,10 @@ inline auto gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, Dens
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1    // Type of the matrix A
         , bool SO         // Storage order of all matrices
@@ -2017,9 +2084,10 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1   // Type of the matrix A
         , bool SO        // Storage order of all matrices
@@ -48,6 +48,8 @@
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getrf.h>
+#include <blaze/math/lapack/native/getrf.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -108,9 +110,10 @@ void getrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
@@ -135,7 +138,11 @@ inline void getrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
       return;
    }
 
+#if BLAZE_LAPACK_MODE
    getrf( m, n, (*A).data(), lda, ipiv, &info );
+#else
+   nativeGetrf( m, n, (*A).data(), lda, ipiv, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for LU decomposition" );
 }
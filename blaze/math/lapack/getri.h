@@ -50,6 +50,8 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getri.h>
+#include <blaze/math/lapack/native/getri.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -99,9 +101,10 @@ void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -116,8 +119,6 @@ inline void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
    BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
    if( !isSquare( *A ) ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
    }
@@ -130,10 +131,16 @@ inline void getri( DenseMatrix<MT,SO>& A, const blas_int_t* ipiv )
       return;
    }
 
+#if BLAZE_LAPACK_MODE
+   using ET = ElementType_t<MT>;
+
    blas_int_t lwork( n*lda );
    const std::unique_ptr<ET[]> work( new ET[lwork] );
 
    getri( n, (*A).data(), lda, ipiv, work.get(), lwork, &info );
+#else
+   nativeGetri( n, (*A).data(), lda, ipiv, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
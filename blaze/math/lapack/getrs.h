@@ -51,6 +51,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/getrs.h>
+#include <blaze/math/lapack/native/getrs.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/NumericCast.h>
@@ -161,9 +163,10 @@ void getrs( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, char trans,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the system matrix
         , bool SO      // Storage order of the system matrix
@@ -205,7 +208,11 @@ inline void getrs( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char tran
       return;
    }
 
+#if BLAZE_LAPACK_MODE
    getrs( trans, n, nrhs, (*A).data(), lda, ipiv, (*b).data(), ldb, &info );
+#else
+   nativeGetrs( trans, n, nrhs, (*A).data(), lda, ipiv, (*b).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
 }
@@ -299,9 +306,10 @@ inline void getrs( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char tran
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1  // Type of the system matrix
         , bool SO1      // Storage order of the system matrix
@@ -345,7 +353,11 @@ inline void getrs( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
       return;
    }
 
+#if BLAZE_LAPACK_MODE
    getrs( trans, n, nrhs, (*A).data(), lda, ipiv, (*B).data(), ldb, &info );
+#else
+   nativeGetrs( trans, n, nrhs, (*A).data(), lda, ipiv, (*B).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
 }
@@ -51,7 +51,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/heevd.h>
+#include <blaze/math/lapack/native/syev.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Complex.h>
 #include <blaze/util/NumericCast.h>
@@ -129,9 +131,10 @@ void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
@@ -152,9 +155,6 @@ inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT> );
    BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_t<VT> );
 
-   using CT = ElementType_t<MT>;
-   using BT = UnderlyingElement_t<CT>;
-
    if( !isSquare( *A ) ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
    }
@@ -177,6 +177,14 @@ inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
       return;
    }
 
+   if( IsRowMajorMatrix_v<MT> ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+#if BLAZE_LAPACK_MODE
+   using CT = ElementType_t<MT>;
+   using BT = UnderlyingElement_t<CT>;
+
    blas_int_t lwork( n*n + 2*n + 2 );
    const std::unique_ptr<CT[]> work( new CT[lwork] );
 
@@ -186,12 +194,11 @@ inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
    blas_int_t liwork( 3 + 5*n );
    const std::unique_ptr<blas_int_t[]> iwork( new blas_int_t[liwork] );
 
-   if( IsRowMajorMatrix_v<MT> ) {
-      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
-   }
-
    heevd( jobz, uplo, n, (*A).data(), lda, (*w).data(),
           work.get(), lwork, rwork.get(), lrwork, iwork.get(), liwork, &info );
+#else
+   nativeSyev( jobz, uplo, n, (*A).data(), lda, (*w).data(), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
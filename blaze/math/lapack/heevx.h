@@ -51,7 +51,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/heevx.h>
+#include <blaze/math/lapack/native/syev.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Builtin.h>
 #include <blaze/util/constraints/Complex.h>
@@ -136,6 +138,7 @@ inline size_t heevx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
    blas_int_t m   ( 0 );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    blas_int_t lwork( 12*n + 2 );
    const std::unique_ptr<CT[]>  work ( new CT[lwork] );
    const std::unique_ptr<BT[]>  rwork( new BT[7*n] );
@@ -144,6 +147,10 @@ inline size_t heevx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
 
    heevx( 'N', range, uplo, n, (*A).data(), lda, vl, vu, il, iu, BT(0), &m, (*w).data(),
           nullptr, 1, work.get(), lwork, rwork.get(), iwork.get(), ifail.get(), &info );
+#else
+   nativeSyevx( 'N', range, uplo, n, (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &m,
+                (*w).data(), static_cast<CT*>( nullptr ), 1, &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( m ) );
 
@@ -212,9 +219,10 @@ inline size_t heevx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
@@ -341,9 +349,10 @@ inline size_t heevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT    // Type of the matrix A
         , bool SO        // Storage order of the matrix A
@@ -461,14 +470,19 @@ inline size_t heevx_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
    blas_int_t ldz ( numeric_cast<blas_int_t>( (*Z).spacing() ) );
    blas_int_t info( 0 );
 
+#if BLAZE_LAPACK_MODE
    blas_int_t lwork( 12*n + 2 );
    const std::unique_ptr<CT[]>  work ( new CT[lwork] );
    const std::unique_ptr<BT[]>  rwork( new BT[7*n] );
    const std::unique_ptr<blas_int_t[]> iwork( new blas_int_t[5*n] );
    const std::unique_ptr<blas_int_t[]> ifail( new blas_int_t[n] );
 
-   heevx( 'N', range, uplo, n, (*A).data(), lda, vl, vu, il, iu, BT(0), &m, (*w).data(),
+   heevx( 'V', range, uplo, n, (*A).data(), lda, vl, vu, il, iu, BT(0), &m, (*w).data(),
           (*Z).data(), ldz, work.get(), lwork, rwork.get(), iwork.get(), ifail.get(), &info );
+#else
+   nativeSyevx( 'V', range, uplo, n, (*A).data(), lda, BT( vl ), BT( vu ), il, iu, &m,
+                (*w).data(), (*Z).data(), ldz, &info );
+#endif
 
    const size_t num( numeric_cast<size_t>( m ) );
 
@@ -544,9 +558,10 @@ inline size_t heevx_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1  // Type of the matrix A
         , bool SO1      // Storage order of the matrix A
@@ -694,9 +709,10 @@ inline size_t heevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT1   // Type of the matrix A
         , bool SO1       // Storage order of the matrix A
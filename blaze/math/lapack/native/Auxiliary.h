@@ -0,0 +1,305 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/Auxiliary.h
+//  \brief Auxiliary functionality for the native LAPACK implementations
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_AUXILIARY_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_AUXILIARY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatTDMatMultExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/DVecDVecInnerExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecScalarMultExpr.h>
+#include <blaze/math/expressions/TDMatDMatMultExpr.h>
+#include <blaze/math/expressions/TDMatTDMatMultExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LAPACK AUXILIARY TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-major view on a block of a matrix handled by the native LAPACK kernels.
+// \ingroup lapack
+//
+// All native LAPACK kernels operate on blocks of column-major matrices that are represented by
+// distinct CustomMatrix views. Since the views don't alias each other from the perspective of
+// the expression templates, products between blocks of the same matrix (as for instance the
+// trailing update of a right-looking factorization) are directly handled by the (SMP parallel)
+// dense matrix multiplication kernels without evaluation into a temporary matrix.
+*/
+template< typename T >  // Element type of the matrix
+using NativeMatrix = CustomMatrix<T,unaligned,unpadded,columnMajor>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief View on a part of a column of a matrix handled by the native LAPACK kernels.
+// \ingroup lapack
+*/
+template< typename T >  // Element type of the vector
+using NativeVector = CustomVector<T,unaligned,unpadded,columnVector>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LAPACK AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a view on the given block of a column-major matrix.
+// \ingroup lapack
+//
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param i The index of the first row of the block.
+// \param j The index of the first column of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \return View on the specified block.
+*/
+template< typename T >  // Element type of the matrix
+inline NativeMatrix<T>
+   nativeBlock( T* A, blas_int_t lda, blas_int_t i, blas_int_t j, blas_int_t m, blas_int_t n )
+{
+   return NativeMatrix<T>( A + i + j*lda, m, n, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a view on a part of a column of the given column-major matrix.
+// \ingroup lapack
+//
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param i The index of the first row of the column part.
+// \param j The index of the column.
+// \param m The number of elements of the column part.
+// \return View on the specified part of the column.
+*/
+template< typename T >  // Element type of the matrix
+inline NativeVector<T>
+   nativeColumn( T* A, blas_int_t lda, blas_int_t i, blas_int_t j, blas_int_t m )
+{
+   return NativeVector<T>( A + i + j*lda, m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the conjugate transpose of the given real-valued dense matrix.
+// \ingroup lapack
+//
+// \param dm The given dense matrix.
+// \return The transpose of the given matrix.
+//
+// In contrast to ctrans() this function avoids the evaluation of the (pointless) conjugation
+// of real-valued matrices, which would otherwise result in a temporary matrix within products.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline auto nativeCtrans( const DenseMatrix<MT,SO>& dm )
+   -> DisableIf_t< IsComplex_v< ElementType_t<MT> >, decltype( trans( *dm ) ) >
+{
+   return trans( *dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the conjugate transpose of the given complex dense matrix.
+// \ingroup lapack
+//
+// \param dm The given dense matrix.
+// \return The conjugate transpose of the given matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline auto nativeCtrans( const DenseMatrix<MT,SO>& dm )
+   -> EnableIf_t< IsComplex_v< ElementType_t<MT> >, decltype( ctrans( *dm ) ) >
+{
+   return ctrans( *dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ x^H y \f$ of two real-valued dense vectors.
+// \ingroup lapack
+//
+// \param x The left-hand side dense vector.
+// \param y The right-hand side dense vector.
+// \return The inner product of the two vectors.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline auto nativeDotc( const DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& y )
+   -> DisableIf_t< IsComplex_v< ElementType_t<VT1> >, ElementType_t<VT1> >
+{
+   return dot( *x, *y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ x^H y \f$ of two complex dense vectors.
+// \ingroup lapack
+//
+// \param x The left-hand side dense vector.
+// \param y The right-hand side dense vector.
+// \return The inner product of the two vectors.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline auto nativeDotc( const DenseVector<VT1,TF>& x, const DenseVector<VT2,TF>& y )
+   -> EnableIf_t< IsComplex_v< ElementType_t<VT1> >, ElementType_t<VT1> >
+{
+   return dot( conj( *x ), *y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the transpose operation of a native LAPACK kernel to a single element.
+// \ingroup lapack
+//
+// \param value The given element.
+// \param conjugate \a true in case the element is to be conjugated, \a false if not.
+// \return The (conjugated) element.
+*/
+template< typename T >  // Element type
+inline T nativeOp( const T& value, bool conjugate )
+{
+   return ( conjugate ? conj( value ) : value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Performs a series of row interchanges on the given column-major matrix.
+// \ingroup lapack
+//
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix.
+// \param k1 The index of the first pivot index to be applied.
+// \param k2 The index one past the last pivot index to be applied.
+// \param ipiv The 1-based pivot indices in the LAPACK format.
+// \param forward \a true to apply the interchanges in forward order, \a false for reverse order.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c laswp() function. For every index
+// \a i in the range \f$[k1..k2)\f$ the rows \a i and \a ipiv[i]-1 are swapped. The interchanges
+// are applied column by column in order to traverse the memory contiguously.
+*/
+template< typename T >  // Element type of the matrix
+void nativeLaswp( blas_int_t n, T* A, blas_int_t lda, blas_int_t k1, blas_int_t k2,
+                  const blas_int_t* ipiv, bool forward )
+{
+   using std::swap;
+
+   for( blas_int_t j=0; j<n; ++j )
+   {
+      T* a( A + j*lda );
+
+      if( forward ) {
+         for( blas_int_t i=k1; i<k2; ++i ) {
+            if( ipiv[i]-1 != i )
+               swap( a[i], a[ipiv[i]-1] );
+         }
+      }
+      else {
+         for( blas_int_t i=k2-1; i>=k1; --i ) {
+            if( ipiv[i]-1 != i )
+               swap( a[i], a[ipiv[i]-1] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
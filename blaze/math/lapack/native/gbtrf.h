@@ -0,0 +1,164 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/gbtrf.h
+//  \brief Header file for the native band LU decomposition (gbtrf)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GBTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BAND LU DECOMPOSITION FUNCTIONS (GBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native LU decomposition of the given general band matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the band matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the 1-based pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gbtrf() function and produces the
+// identical result format. It performs the unblocked LU decomposition with partial pivoting of
+// the \c gbtf2() function: Since every column of the band is stored contiguously, the scaling of
+// the pivot column and the rank-1 updates of the at most \a kl+ku columns right of the pivot are
+// vectorized, whereas the row interchanges are restricted to the band.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+*/
+template< typename T >  // Element type
+void nativeGbtrf( blas_int_t m, blas_int_t n, blas_int_t kl, blas_int_t ku, T* AB,
+                  blas_int_t ldab, blas_int_t* ipiv, blas_int_t* info )
+{
+   using std::abs;
+   using std::swap;
+
+   *info = 0;
+
+   const blas_int_t kv( ku+kl );
+   const blas_int_t mn( min( m, n ) );
+
+   // Zeroing the fill-in elements of the first columns
+   for( blas_int_t j=ku+1; j<min( kv, n ); ++j ) {
+      for( blas_int_t i=kv-j; i<kl; ++i ) {
+         AB[i+j*ldab] = T();
+      }
+   }
+
+   blas_int_t ju( 0 );
+
+   for( blas_int_t j=0; j<mn; ++j )
+   {
+      // Zeroing the fill-in elements of column j+kv
+      if( j+kv < n ) {
+         for( blas_int_t i=0; i<kl; ++i ) {
+            AB[i+(j+kv)*ldab] = T();
+         }
+      }
+
+      const blas_int_t km( min( kl, m-j-1 ) );
+      T* a( AB + kv + j*ldab );
+
+      blas_int_t p( 0 );
+      auto pmax( abs( a[0] ) );
+      for( blas_int_t i=1; i<=km; ++i ) {
+         if( abs( a[i] ) > pmax ) {
+            pmax = abs( a[i] );
+            p = i;
+         }
+      }
+
+      ipiv[j] = j+p+1;
+
+      if( a[p] != T() )
+      {
+         ju = max( ju, min( j+ku+p, n-1 ) );
+
+         // Row j+p of the band is stored with a stride of ldab-1 elements
+         if( p != 0 ) {
+            for( blas_int_t k=0; k<=ju-j; ++k ) {
+               swap( a[p+k*(ldab-1)], a[k*(ldab-1)] );
+            }
+         }
+
+         if( km > 0 )
+         {
+            nativeColumn( AB, ldab, kv+1, j, km ) *= T(1) / a[0];
+
+            const auto l( nativeColumn( AB, ldab, kv+1, j, km ) );
+            for( blas_int_t k=1; k<=ju-j; ++k ) {
+               const T ujk( a[k*(ldab-1)] );
+               if( ujk != T() ) {
+                  nativeColumn( AB, ldab, kv+1-k, j+k, km ) -= ujk * l;
+               }
+            }
+         }
+      }
+      else if( *info == 0 ) {
+         *info = j+1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
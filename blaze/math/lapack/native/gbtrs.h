@@ -0,0 +1,160 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/gbtrs.h
+//  \brief Header file for the native band LU-based substitution (gbtrs)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GBTRS_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GBTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BAND LU-BASED SUBSTITUTION FUNCTIONS (GBTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native substitution step for solving a general banded linear system of equations.
+// \ingroup lapack_substitution
+//
+// \param trans \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, \c 'C' for \f$ A^H*X=B \f$.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kl The number of subdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param ku The number of superdiagonals within the band of the matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the LU factors.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= 2*kl+ku+1.
+// \param ipiv Auxiliary array for the 1-based pivot indices; size >= \a n.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gbtrs() function. Based on the band
+// LU decomposition computed by nativeGbtrf() it solves the system of equations by means of the
+// row interchanges and the unit lower band factor \c L with \a kl subdiagonals and by means of
+// a substitution with the upper band factor \c U with \a kl+ku superdiagonals. The complexity
+// of the substitution is \f$ O(n \cdot (2 \cdot kl+ku) \cdot nrhs) \f$.
+*/
+template< typename T >  // Element type
+void nativeGbtrs( char trans, blas_int_t n, blas_int_t kl, blas_int_t ku, blas_int_t nrhs,
+                  const T* AB, blas_int_t ldab, const blas_int_t* ipiv,
+                  T* B, blas_int_t ldb, blas_int_t* info )
+{
+   using std::swap;
+
+   *info = 0;
+
+   if( n == 0 || nrhs == 0 ) {
+      return;
+   }
+
+   const blas_int_t kv( ku+kl );
+
+   const auto op = [trans]( const T& value ) {
+      return ( trans == 'C' )?( conj( value ) ):( value );
+   };
+
+   for( blas_int_t k=0; k<nrhs; ++k )
+   {
+      T* b( B + k*ldb );
+
+      if( trans == 'N' )
+      {
+         // Solving L*y = P*b
+         for( blas_int_t j=0; j+1<n && kl>0; ++j ) {
+            const blas_int_t lm( min( kl, n-j-1 ) );
+            if( ipiv[j]-1 != j )
+               swap( b[j], b[ipiv[j]-1] );
+            const T* l( AB + kv+1 + j*ldab );
+            for( blas_int_t i=0; i<lm; ++i ) {
+               b[j+1+i] -= l[i] * b[j];
+            }
+         }
+
+         // Solving U*x = y
+         for( blas_int_t j=n-1; j>=0; --j ) {
+            const T* u( AB + ( kv-j + j*ldab ) );
+            b[j] /= u[j];
+            for( blas_int_t i=max( blas_int_t(0), j-kv ); i<j; ++i ) {
+               b[i] -= u[i] * b[j];
+            }
+         }
+      }
+      else
+      {
+         // Solving U^T*y = b or U^H*y = b
+         for( blas_int_t j=0; j<n; ++j ) {
+            const T* u( AB + ( kv-j + j*ldab ) );
+            T tmp( b[j] );
+            for( blas_int_t i=max( blas_int_t(0), j-kv ); i<j; ++i ) {
+               tmp -= op( u[i] ) * b[i];
+            }
+            b[j] = tmp / op( u[j] );
+         }
+
+         // Solving L^T*x = y or L^H*x = y
+         for( blas_int_t j=n-2; j>=0 && kl>0; --j ) {
+            const blas_int_t lm( min( kl, n-j-1 ) );
+            const T* l( AB + kv+1 + j*ldab );
+            T tmp( b[j] );
+            for( blas_int_t i=0; i<lm; ++i ) {
+               tmp -= op( l[i] ) * b[j+1+i];
+            }
+            b[j] = tmp;
+            if( ipiv[j]-1 != j )
+               swap( b[j], b[ipiv[j]-1] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
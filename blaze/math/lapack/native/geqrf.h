@@ -0,0 +1,418 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/geqrf.h
+//  \brief Header file for the native QR and LQ decompositions (geqrf/gelqf)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GEQRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE HOUSEHOLDER AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generates an elementary reflector.
+// \ingroup lapack_decomposition
+//
+// \param n The order of the elementary reflector \f$[0..\infty)\f$.
+// \param alpha On entry the value alpha, on exit the value beta.
+// \param x Pointer to the first of the \a n-1 elements of the vector \a x.
+// \param tau The resulting value tau.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c larfg() function. It generates the
+// elementary reflector \f$ H = I - tau \cdot v \cdot v^H \f$ such that \f$ H^H (alpha,x)^T =
+// (beta,0)^T \f$, where \a beta is real and \c v(0) = 1. On exit \a x is overwritten with the
+// remaining elements of \a v.
+*/
+template< typename T >  // Element type
+void nativeLarfg( blas_int_t n, T& alpha, T* x, T& tau )
+{
+   using std::abs;
+   using std::copysign;
+   using std::hypot;
+   using std::sqrt;
+
+   using RT = UnderlyingBuiltin_t<T>;
+
+   if( n <= 0 ) {
+      tau = T();
+      return;
+   }
+
+   RT scale( 0 );
+   RT ssq  ( 1 );
+
+   for( blas_int_t i=0; i<n-1; ++i ) {
+      const RT absxi( abs( x[i] ) );
+      if( absxi > RT(0) ) {
+         if( scale < absxi ) {
+            ssq   = RT(1) + ssq * ( scale/absxi ) * ( scale/absxi );
+            scale = absxi;
+         }
+         else {
+            ssq += ( absxi/scale ) * ( absxi/scale );
+         }
+      }
+   }
+
+   const RT xnorm( scale * sqrt( ssq ) );
+   const RT alphr( real( alpha ) );
+   const RT alphi( imag( alpha ) );
+
+   if( xnorm == RT(0) && alphi == RT(0) ) {
+      tau = T();
+      return;
+   }
+
+   const RT beta( -copysign( hypot( hypot( alphr, alphi ), xnorm ), alphr ) );
+
+   tau = ( T( beta ) - alpha ) / T( beta );
+
+   const T factor( T(1) / ( alpha - T( beta ) ) );
+   for( blas_int_t i=0; i<n-1; ++i ) {
+      x[i] *= factor;
+   }
+
+   alpha = T( beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the Householder vectors of a QR decomposition into an explicit matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the Householder vectors \f$[0..\infty)\f$.
+// \param k The number of Householder vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major QR decomposed matrix.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param V Pointer to the first element of the resulting column-major m-by-k matrix.
+// \param ldv The total number of elements between two columns of matrix \a V.
+// \return void
+//
+// This function copies the Householder vectors stored below the diagonal of \a A into the unit
+// lower trapezoidal matrix \a V, which can be directly used within dense matrix products.
+*/
+template< typename T >  // Element type
+void nativeCopyReflectors( blas_int_t m, blas_int_t k, const T* A, blas_int_t lda,
+                           T* V, blas_int_t ldv )
+{
+   for( blas_int_t j=0; j<k; ++j ) {
+      for( blas_int_t i=0; i<m; ++i ) {
+         V[i+j*ldv] = ( i < j ? T() : ( i == j ? T(1) : A[i+j*lda] ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forms the triangular factor of a block reflector.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the Householder vectors \f$[0..\infty)\f$.
+// \param k The number of Householder vectors \f$[0..\infty)\f$.
+// \param V Pointer to the first element of the explicit column-major m-by-k matrix \a V.
+// \param ldv The total number of elements between two columns of matrix \a V.
+// \param tau Pointer to the \a k scalar factors of the elementary reflectors.
+// \param Tm Pointer to the first element of the resulting column-major k-by-k matrix \a T.
+// \param ldt The total number of elements between two columns of matrix \a T.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c larft() function for a forward,
+// columnwise stored block reflector. It forms the upper triangular matrix \a T such that
+// \f$ H(0) H(1) . . . H(k-1) = I - V T V^H \f$. The inner products \f$ V^H V \f$ are computed
+// by a single dense matrix multiplication. The strictly lower part of \a T is set to zero.
+*/
+template< typename T >  // Element type
+void nativeLarft( blas_int_t m, blas_int_t k, const T* V, blas_int_t ldv, const T* tau,
+                  T* Tm, blas_int_t ldt )
+{
+   const auto Vb( nativeBlock( V, ldv, 0, 0, m, k ) );
+   auto Tb( nativeBlock( Tm, ldt, 0, 0, k, k ) );
+
+   Tb = nativeCtrans( Vb ) * Vb;
+
+   for( blas_int_t i=0; i<k; ++i )
+   {
+      for( blas_int_t r=0; r<i; ++r ) {
+         T tmp{};
+         for( blas_int_t c=r; c<i; ++c ) {
+            tmp += Tm[r+c*ldt] * Tm[c+i*ldt];
+         }
+         Tm[r+i*ldt] = -tau[i] * tmp;
+      }
+
+      Tm[i+i*ldt] = tau[i];
+
+      for( blas_int_t r=i+1; r<k; ++r ) {
+         Tm[r+i*ldt] = T();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a block reflector or its conjugate transpose to a general matrix from the left.
+// \ingroup lapack_decomposition
+//
+// \param trans \c 'N' to apply \f$ H = I - V T V^H \f$, \c 'C' to apply \f$ H^H \f$.
+// \param m The number of rows of matrix \a C \f$[0..\infty)\f$.
+// \param n The number of columns of matrix \a C \f$[0..\infty)\f$.
+// \param k The number of Householder vectors \f$[0..\infty)\f$.
+// \param V Pointer to the first element of the explicit column-major m-by-k matrix \a V.
+// \param ldv The total number of elements between two columns of matrix \a V.
+// \param Tm Pointer to the first element of the column-major k-by-k matrix \a T.
+// \param ldt The total number of elements between two columns of matrix \a T.
+// \param C Pointer to the first element of the column-major m-by-n matrix \a C.
+// \param ldc The total number of elements between two columns of matrix \a C.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c larfb() function for a forward,
+// columnwise stored block reflector applied from the left. All three steps are computed via
+// the (SMP parallel) dense matrix multiplication of Blaze.
+*/
+template< typename T >  // Element type
+void nativeLarfb( char trans, blas_int_t m, blas_int_t n, blas_int_t k, const T* V, blas_int_t ldv,
+                  const T* Tm, blas_int_t ldt, T* C, blas_int_t ldc )
+{
+   if( m == 0 || n == 0 || k == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<T[]> work( new T[k*n] );
+
+   const auto Vb( nativeBlock( V, ldv, 0, 0, m, k ) );
+   const auto Tb( nativeBlock( Tm, ldt, 0, 0, k, k ) );
+   auto Cb( nativeBlock( C, ldc, 0, 0, m, n ) );
+   auto Wb( nativeBlock( work.get(), k, 0, 0, k, n ) );
+
+   Wb = nativeCtrans( Vb ) * Cb;
+
+   if( trans == 'N' )
+      Wb = Tb * Wb;
+   else
+      Wb = nativeCtrans( Tb ) * Wb;
+
+   Cb -= Vb * Wb;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE QR DECOMPOSITION FUNCTIONS (GEQRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked QR decomposition of the given column-major panel.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the panel \f$[0..\infty)\f$.
+// \param n The number of columns of the panel \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major panel.
+// \param lda The total number of elements between two columns of the panel.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c geqr2() function. The application
+// of the elementary reflectors to the remaining columns of the panel is vectorized.
+*/
+template< typename T >  // Element type
+void nativeGeqr2( blas_int_t m, blas_int_t n, T* A, blas_int_t lda, T* tau )
+{
+   const blas_int_t k( min( m, n ) );
+
+   for( blas_int_t i=0; i<k; ++i )
+   {
+      nativeLarfg( m-i, A[i+i*lda], A+(i+1)+i*lda, tau[i] );
+
+      if( i+1 < n && tau[i] != T() )
+      {
+         const T aii( A[i+i*lda] );
+         A[i+i*lda] = T(1);
+
+         const auto v( nativeColumn( A, lda, i, i, m-i ) );
+         const T ctau( conj( tau[i] ) );
+
+         for( blas_int_t j=i+1; j<n; ++j ) {
+            auto c( nativeColumn( A, lda, i, j, m-i ) );
+            c -= ( ctau * nativeDotc( v, c ) ) * v;
+         }
+
+         A[i+i*lda] = aii;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked QR decomposition of the given dense general column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c geqrf() function and produces the
+// identical result format. Every panel of \c LAPACK_BLOCK_SIZE columns is decomposed via
+// nativeGeqr2(), the triangular factor of the according block reflector is formed via
+// nativeLarft(), and the block reflector is applied to the trailing columns via nativeLarfb().
+*/
+template< typename T >  // Element type
+void nativeGeqrf( blas_int_t m, blas_int_t n, T* A, blas_int_t lda, T* tau, blas_int_t* info )
+{
+   *info = 0;
+
+   const blas_int_t k ( min( m, n ) );
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+
+   if( k <= nb ) {
+      nativeGeqr2( m, n, A, lda, tau );
+      return;
+   }
+
+   const std::unique_ptr<T[]> work( new T[m*nb + nb*nb] );
+   T* V ( work.get() );
+   T* Tm( work.get() + m*nb );
+
+   for( blas_int_t i=0; i<k; i+=nb )
+   {
+      const blas_int_t ib( min( nb, k-i ) );
+
+      nativeGeqr2( m-i, ib, A+i+i*lda, lda, tau+i );
+
+      if( i+ib < n ) {
+         nativeCopyReflectors( m-i, ib, A+i+i*lda, lda, V, m );
+         nativeLarft( m-i, ib, V, m, tau+i, Tm, nb );
+         nativeLarfb( 'C', m-i, n-i-ib, ib, V, m, Tm, nb, A+i+(i+ib)*lda, lda );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE LQ DECOMPOSITION FUNCTIONS (GELQF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native LQ decomposition of the given dense general column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gelqf() function and produces the
+// identical result format. Since the LQ decomposition of \a A corresponds to the QR decomposition
+// of \f$ A^H \f$, the decomposition is computed via nativeGeqrf() on the conjugate transpose of
+// \a A. This is for instance used for the QR decomposition of row-major matrices.
+*/
+template< typename T >  // Element type
+void nativeGelqf( blas_int_t m, blas_int_t n, T* A, blas_int_t lda, T* tau, blas_int_t* info )
+{
+   *info = 0;
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<T[]> work( new T[n*m] );
+
+   auto Ab( nativeBlock( A, lda, 0, 0, m, n ) );
+   auto Wb( nativeBlock( work.get(), n, 0, 0, n, m ) );
+
+   Wb = nativeCtrans( Ab );
+   nativeGeqrf( n, m, work.get(), n, tau, info );
+   Ab = nativeCtrans( Wb );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,502 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/gesdd.h
+//  \brief Header file for the native singular value decomposition (gesdd/gesvdx)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GESDD_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GESDD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/lapack/native/ormqr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE ONE-SIDED JACOBI SINGULAR VALUE FUNCTIONS (GESVJ)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native singular value decomposition of a dense column-major matrix with at least as many
+//        rows as columns.
+// \ingroup lapack_singular_value
+//
+// \param m The number of rows of the given matrix \f$[n..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..m]\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param s Pointer to the first element of the vector for the \a n singular values.
+// \param U Pointer to the first element of the column-major m-by-ucols matrix \a U (or \c nullptr).
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param ucols The number of left singular vectors to be computed \f$[n..m]\f$.
+// \param VT Pointer to the first element of the column-major n-by-n matrix \f$ V^H \f$.
+// \param ldvt The total number of elements between two columns of the matrix \f$ V^H \f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gesvj() function. In case \a m is
+// larger than \a n the matrix is first reduced to the triangular factor \a R of its (blocked) QR
+// decomposition. Afterwards the cyclic one-sided Jacobi method orthogonalizes the columns of the
+// n-by-n matrix by means of plane rotations, which are applied via vectorized dense vector
+// operations. The singular values are given by the norms of the resulting columns and are
+// returned in descending order. In case \a U is not \c nullptr, the left singular vectors are
+// given by the normalized columns, which are transformed back via nativeOrmqr(), and the right
+// singular vectors are given by the accumulated rotations. Left singular vectors belonging to
+// zero singular values are completed to an orthonormal basis.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: The Jacobi iteration failed to converge.
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeGesvj( blas_int_t m, blas_int_t n, T* A, blas_int_t lda, RT* s,
+                  T* U, blas_int_t ldu, blas_int_t ucols, T* VT, blas_int_t ldvt,
+                  blas_int_t* info )
+{
+   using std::abs;
+   using std::hypot;
+   using std::sqrt;
+   using std::swap;
+
+   *info = 0;
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const bool vectors( U != nullptr );
+   const bool qr( m > n );
+
+   const RT eps  ( std::numeric_limits<RT>::epsilon() );
+   const RT sfmin( std::numeric_limits<RT>::min() / eps );
+   const RT tol  ( eps * sqrt( RT( n ) ) );
+
+   const std::unique_ptr<T[]>  work ( new T[2*n*n + n] );
+   const std::unique_ptr<T[]>  Q    ( new T[qr ? m*n + n : 1] );
+   const std::unique_ptr<RT[]> norms( new RT[n] );
+   const std::unique_ptr<blas_int_t[]> perm( new blas_int_t[n] );
+
+   T* W  ( work.get() );
+   T* V  ( work.get() + n*n );
+   T* tmp( work.get() + 2*n*n );
+   T* tau( qr ? Q.get() + m*n : nullptr );
+
+   const auto Ab( nativeBlock( A, lda, 0, 0, m, n ) );
+   auto Wb( nativeBlock( W, n, 0, 0, n, n ) );
+   auto Vb( nativeBlock( V, n, 0, 0, n, n ) );
+   auto tv( nativeColumn( tmp, n, 0, 0, n ) );
+
+   if( qr ) {
+      auto Qb( nativeBlock( Q.get(), m, 0, 0, m, n ) );
+      Qb = Ab;
+      nativeGeqrf( m, n, Q.get(), m, tau, info );
+      for( blas_int_t j=0; j<n; ++j ) {
+         for( blas_int_t i=0; i<n; ++i ) {
+            W[i+j*n] = ( i <= j ? Q[i+j*m] : T() );
+         }
+      }
+   }
+   else {
+      Wb = Ab;
+   }
+
+   if( vectors ) {
+      reset( Vb );
+      for( blas_int_t i=0; i<n; ++i ) {
+         V[i+i*n] = T(1);
+      }
+   }
+
+   bool converged( n == 1 );
+
+   for( blas_int_t sweep=0; !converged && sweep<60; ++sweep )
+   {
+      converged = true;
+
+      for( blas_int_t j=0; j<n; ++j ) {
+         const auto wj( nativeColumn( W, n, 0, j, n ) );
+         norms[j] = real( nativeDotc( wj, wj ) );
+      }
+
+      for( blas_int_t p=0; p<n-1; ++p )
+      {
+         auto wp( nativeColumn( W, n, 0, p, n ) );
+
+         for( blas_int_t q=p+1; q<n; ++q )
+         {
+            const RT alpha( norms[p] );
+            const RT beta ( norms[q] );
+
+            if( alpha <= RT(0) || beta <= RT(0) ) continue;
+
+            auto wq( nativeColumn( W, n, 0, q, n ) );
+
+            const T  gamma( nativeDotc( wp, wq ) );
+            const RT absg ( abs( gamma ) );
+
+            if( absg <= tol * sqrt( alpha ) * sqrt( beta ) ) continue;
+
+            converged = false;
+
+            const RT zeta( ( beta - alpha ) / ( RT(2) * absg ) );
+            const RT sign( zeta >= RT(0) ? RT(1) : RT(-1) );
+            const RT t( sign / ( abs( zeta ) + hypot( RT(1), zeta ) ) );
+            const RT c( RT(1) / sqrt( RT(1) + t*t ) );
+            const T  g( gamma / absg );
+            const T  sg ( ( c*t ) * g );
+            const T  sgc( ( c*t ) * conj( g ) );
+
+            tv = wp;
+            wp = c*wp - sgc*wq;
+            wq = sg*tv + c*wq;
+
+            if( vectors ) {
+               auto vp( nativeColumn( V, n, 0, p, n ) );
+               auto vq( nativeColumn( V, n, 0, q, n ) );
+               tv = vp;
+               vp = c*vp - sgc*vq;
+               vq = sg*tv + c*vq;
+            }
+
+            norms[p] = alpha - t*absg;
+            norms[q] = beta  + t*absg;
+         }
+      }
+   }
+
+   if( !converged ) {
+      *info = 1;
+      return;
+   }
+
+   for( blas_int_t j=0; j<n; ++j ) {
+      const auto wj( nativeColumn( W, n, 0, j, n ) );
+      norms[j] = sqrt( real( nativeDotc( wj, wj ) ) );
+      perm[j] = j;
+   }
+
+   for( blas_int_t i=0; i<n-1; ++i ) {
+      blas_int_t k( i );
+      for( blas_int_t j=i+1; j<n; ++j ) {
+         if( norms[perm[j]] > norms[perm[k]] ) k = j;
+      }
+      swap( perm[i], perm[k] );
+      s[i] = norms[perm[i]];
+   }
+   s[n-1] = norms[perm[n-1]];
+
+   if( !vectors ) {
+      return;
+   }
+
+   // Computing the right singular vectors
+   for( blas_int_t k=0; k<n; ++k ) {
+      for( blas_int_t i=0; i<n; ++i ) {
+         VT[k+i*ldvt] = conj( V[i+perm[k]*n] );
+      }
+   }
+
+   // Computing the left singular vectors of the n-by-n matrix (in place of V)
+   for( blas_int_t k=0; k<n; ++k )
+   {
+      auto uk( nativeColumn( V, n, 0, k, n ) );
+
+      if( s[k] > sfmin ) {
+         uk = ( RT(1) / s[k] ) * nativeColumn( W, n, 0, perm[k], n );
+         continue;
+      }
+
+      for( blas_int_t i=0; i<n; ++i )
+      {
+         reset( uk );
+         uk[i] = T(1);
+
+         for( blas_int_t pass=0; pass<2; ++pass ) {
+            for( blas_int_t l=0; l<k; ++l ) {
+               const auto ul( nativeColumn( V, n, 0, l, n ) );
+               uk -= nativeDotc( ul, uk ) * ul;
+            }
+         }
+
+         const RT unorm( sqrt( real( nativeDotc( uk, uk ) ) ) );
+
+         if( unorm > RT(0.5) ) {
+            uk *= RT(1) / unorm;
+            break;
+         }
+      }
+   }
+
+   if( !qr ) {
+      nativeBlock( U, ldu, 0, 0, n, n ) = Vb;
+      return;
+   }
+
+   auto Ub( nativeBlock( U, ldu, 0, 0, m, ucols ) );
+
+   reset( Ub );
+   nativeBlock( U, ldu, 0, 0, n, n ) = Vb;
+   for( blas_int_t i=n; i<ucols; ++i ) {
+      U[i+i*ldu] = T(1);
+   }
+
+   nativeOrmqr( 'N', m, ucols, n, Q.get(), m, tau, U, ldu );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE SINGULAR VALUE FUNCTIONS (GESDD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native singular value decomposition of a dense general column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobz Specifies the computation of the singular vectors (\c 'A', \c 'S', \c 'O', \c 'N').
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major matrix for the left singular vectors.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major matrix for the right singular vectors.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gesdd() function and supports the
+// same settings of the \a jobz argument. Instead of a divide-and-conquer strategy it uses the
+// QR preconditioned one-sided Jacobi method (see nativeGesvj()). In case \a m is smaller than
+// \a n the decomposition of \f$ A^H \f$ is computed. The content of \a A is destroyed, unless
+// it is overwritten with singular vectors (\a jobz == \c 'O').
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: The decomposition failed to converge.
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeGesdd( char jobz, blas_int_t m, blas_int_t n, T* A, blas_int_t lda, RT* s,
+                  T* U, blas_int_t ldu, T* VT, blas_int_t ldvt, blas_int_t* info )
+{
+   *info = 0;
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   const blas_int_t mn( min( m, n ) );
+
+   if( jobz == 'O' )
+   {
+      const std::unique_ptr<T[]> work( new T[m*n] );
+      const auto Wb( nativeBlock( work.get(), m, 0, 0, m, n ) );
+      auto Ab( nativeBlock( A, lda, 0, 0, m, n ) );
+
+      if( m >= n ) {
+         nativeGesdd( 'S', m, n, A, lda, s, work.get(), m, VT, ldvt, info );
+      }
+      else {
+         nativeGesdd( 'S', m, n, A, lda, s, U, ldu, work.get(), m, info );
+      }
+
+      Ab = Wb;
+      return;
+   }
+
+   const bool vectors( jobz != 'N' );
+
+   if( m >= n ) {
+      nativeGesvj( m, n, A, lda, s, ( vectors ? U : nullptr ), ldu,
+                   ( jobz == 'A' ? m : n ), VT, ldvt, info );
+      return;
+   }
+
+   const blas_int_t ucols( jobz == 'A' ? n : m );
+   const std::unique_ptr<T[]> work( new T[n*m + n*ucols + m*m] );
+   T* AH ( work.get() );
+   T* UH ( work.get() + n*m );
+   T* VTH( work.get() + n*m + n*ucols );
+
+   nativeBlock( AH, n, 0, 0, n, m ) = nativeCtrans( nativeBlock( A, lda, 0, 0, m, n ) );
+   nativeGesvj( n, m, AH, n, s, ( vectors ? UH : nullptr ), n, ucols, VTH, mn, info );
+
+   if( vectors && *info == 0 ) {
+      nativeBlock( U, ldu, 0, 0, m, m ) = nativeCtrans( nativeBlock( VTH, m, 0, 0, m, m ) );
+      nativeBlock( VT, ldvt, 0, 0, ucols, n ) =
+         nativeCtrans( nativeBlock( UH, n, 0, 0, n, ucols ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE SELECTED SINGULAR VALUE FUNCTIONS (GESVDX)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of selected singular values and vectors of a dense general
+//        column-major matrix.
+// \ingroup lapack_singular_value
+//
+// \param jobu \c 'V' to compute the left singular vectors, \c 'N' to skip them.
+// \param jobv \c 'V' to compute the right singular vectors, \c 'N' to skip them.
+// \param range \c 'A' to compute all singular values, \c 'V' to compute all singular values in
+//              the half-open interval \f$(vl..vu]\f$, or \c 'I' to compute the singular values
+//              with the indices in the range \f$[il..iu]\f$ (descending order).
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for singular values (\a vl < \a vu).
+// \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
+// \param il The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param iu The index of the smallest singular value to be returned (\a il <= \a iu < min(m,n)).
+// \param ns The total number of singular values found.
+// \param s Pointer to the first element of the vector for the singular values.
+// \param U Pointer to the first element of the column-major m-by-ns matrix \a U.
+// \param ldu The total number of elements between two columns of the matrix \a U.
+// \param VT Pointer to the first element of the column-major ns-by-n matrix \a VT.
+// \param ldvt The total number of elements between two columns of the matrix \a VT.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c gesvdx() function. It computes the
+// thin singular value decomposition via nativeGesdd() and returns the selected singular values
+// and vectors.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: The decomposition failed to converge.
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeGesvdx( char jobu, char jobv, char range, blas_int_t m, blas_int_t n,
+                   T* A, blas_int_t lda, RT vl, RT vu, blas_int_t il, blas_int_t iu,
+                   blas_int_t* ns, RT* s, T* U, blas_int_t ldu, T* VT, blas_int_t ldvt,
+                   blas_int_t* info )
+{
+   *ns   = 0;
+   *info = 0;
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   const blas_int_t mn( min( m, n ) );
+   const bool vectors( jobu == 'V' || jobv == 'V' );
+
+   const std::unique_ptr<RT[]> sv( new RT[mn] );
+   const std::unique_ptr<T[]>  work( new T[vectors ? m*mn + mn*n : 1] );
+   T* Ut ( work.get() );
+   T* VTt( work.get() + m*mn );
+
+   nativeGesdd( ( vectors ? 'S' : 'N' ), m, n, A, lda, sv.get(), Ut, m, VTt, mn, info );
+
+   if( *info > 0 ) {
+      return;
+   }
+
+   blas_int_t lo( 0 );
+   blas_int_t hi( mn );
+
+   if( range == 'I' ) {
+      lo = il;
+      hi = iu + 1;
+   }
+   else if( range == 'V' ) {
+      while( lo < mn && sv[lo] > vu ) ++lo;
+      hi = lo;
+      while( hi < mn && sv[hi] > vl ) ++hi;
+   }
+
+   *ns = hi - lo;
+
+   for( blas_int_t i=lo; i<hi; ++i ) {
+      s[i-lo] = sv[i];
+   }
+
+   if( jobu == 'V' && *ns > 0 ) {
+      const auto Utb( nativeBlock( Ut, m, 0, lo, m, *ns ) );
+      auto Ub( nativeBlock( U, ldu, 0, 0, m, *ns ) );
+      Ub = Utb;
+   }
+
+   if( jobv == 'V' && *ns > 0 ) {
+      const auto VTtb( nativeBlock( VTt, mn, lo, 0, *ns, n ) );
+      auto VTb( nativeBlock( VT, ldvt, 0, 0, *ns, n ) );
+      VTb = VTtb;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,212 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getrf.h
+//  \brief Header file for the native LU decomposition (getrf)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION FUNCTIONS (GETRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition of the given column-major panel.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the panel \f$[0..\infty)\f$.
+// \param n The number of columns of the panel \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major panel.
+// \param lda The total number of elements between two columns of the panel.
+// \param ipiv Auxiliary array for the 1-based pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c getf2() function. It performs the
+// LU decomposition of the given panel by means of partial pivoting with row interchanges, where
+// the row interchanges are restricted to the \a n columns of the panel. The scaling of the
+// pivot column and the rank-1 updates of the remaining columns are vectorized.
+*/
+template< typename T >  // Element type
+void nativeGetf2( blas_int_t m, blas_int_t n, T* A, blas_int_t lda,
+                  blas_int_t* ipiv, blas_int_t* info )
+{
+   using std::abs;
+   using std::swap;
+
+   *info = 0;
+
+   const blas_int_t mn( min( m, n ) );
+
+   for( blas_int_t j=0; j<mn; ++j )
+   {
+      T* a( A + j*lda );
+
+      blas_int_t p( j );
+      auto pmax( abs( a[j] ) );
+      for( blas_int_t i=j+1; i<m; ++i ) {
+         if( abs( a[i] ) > pmax ) {
+            pmax = abs( a[i] );
+            p = i;
+         }
+      }
+
+      ipiv[j] = p+1;
+
+      if( a[p] != T() )
+      {
+         if( p != j ) {
+            for( blas_int_t k=0; k<n; ++k ) {
+               swap( A[j+k*lda], A[p+k*lda] );
+            }
+         }
+
+         if( j+1 < m ) {
+            nativeColumn( A, lda, j+1, j, m-j-1 ) *= T(1) / a[j];
+         }
+      }
+      else if( *info == 0 ) {
+         *info = j+1;
+      }
+
+      if( j+1 < m ) {
+         const auto l( nativeColumn( A, lda, j+1, j, m-j-1 ) );
+         for( blas_int_t k=j+1; k<n; ++k ) {
+            const T ujk( A[j+k*lda] );
+            if( ujk != T() ) {
+               nativeColumn( A, lda, j+1, k, m-j-1 ) -= ujk * l;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked LU decomposition of the given dense general column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c getrf() function and produces the
+// identical result format. It performs a right-looking LU decomposition with partial pivoting:
+// every panel of \c LAPACK_BLOCK_SIZE columns is factorized by nativeGetf2(), the row
+// interchanges are applied to the remaining columns, the block row of \c U is computed via
+// nativeTrsm(), and the trailing submatrix is updated via the (SMP parallel) dense matrix
+// multiplication of Blaze.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - > 0: If info = i, the decomposition has been completed, but the factor U(i,i) is singular.
+*/
+template< typename T >  // Element type
+void nativeGetrf( blas_int_t m, blas_int_t n, T* A, blas_int_t lda,
+                  blas_int_t* ipiv, blas_int_t* info )
+{
+   *info = 0;
+
+   const blas_int_t mn( min( m, n ) );
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+
+   if( mn <= nb ) {
+      nativeGetf2( m, n, A, lda, ipiv, info );
+      return;
+   }
+
+   for( blas_int_t j=0; j<mn; j+=nb )
+   {
+      const blas_int_t jb( min( nb, mn-j ) );
+      const blas_int_t mr( m-j-jb );
+      const blas_int_t nr( n-j-jb );
+
+      blas_int_t iinfo( 0 );
+      nativeGetf2( m-j, jb, A+j+j*lda, lda, ipiv+j, &iinfo );
+
+      if( *info == 0 && iinfo > 0 ) {
+         *info = iinfo + j;
+      }
+
+      for( blas_int_t i=j; i<j+jb; ++i ) {
+         ipiv[i] += j;
+      }
+
+      nativeLaswp( j, A, lda, j, j+jb, ipiv, true );
+
+      if( nr > 0 )
+      {
+         nativeLaswp( nr, A+(j+jb)*lda, lda, j, j+jb, ipiv, true );
+         nativeTrsm( 'L', 'N', 'U', jb, nr, A+j+j*lda, lda, A+j+(j+jb)*lda, lda );
+
+         if( mr > 0 ) {
+            auto A22( nativeBlock( A, lda, j+jb, j+jb, mr, nr ) );
+            A22 -= nativeBlock( A, lda, j+jb, j, mr, jb ) * nativeBlock( A, lda, j, j+jb, jb, nr );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,128 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getri.h
+//  \brief Header file for the native LU-based matrix inversion (getri)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU-BASED INVERSION FUNCTIONS (GETRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native inversion of the given LU decomposed dense general column-major matrix.
+// \ingroup lapack_inversion
+//
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the LU decomposed column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c getri() function. Based on the LU
+// decomposition \f$ A = P \cdot L \cdot U \f$ computed by nativeGetrf() it computes the inverse
+// \f$ A^{-1} = U^{-1} \cdot L^{-1} \cdot P^T \f$. The inverse of \c L is computed block column
+// by block column in order to exploit its lower triangular structure, the multiplication with
+// the inverse of \c U is performed via a blocked triangular substitution, and the permutation
+// is applied via column interchanges in reverse order.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The inversion finished successfully.
+//   - > 0: If info = i, the inversion could not be computed since U(i,i) is exactly zero.
+*/
+template< typename T >  // Element type
+void nativeGetri( blas_int_t n, T* A, blas_int_t lda, const blas_int_t* ipiv, blas_int_t* info )
+{
+   *info = 0;
+
+   for( blas_int_t i=0; i<n; ++i ) {
+      if( A[i+i*lda] == T() ) {
+         *info = i+1;
+         return;
+      }
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[n*n] );
+
+   auto W( nativeBlock( work.get(), n, 0, 0, n, n ) );
+   reset( W );
+   for( blas_int_t i=0; i<n; ++i ) {
+      W(i,i) = T(1);
+   }
+
+   for( blas_int_t j=0; j<n; j+=nb ) {
+      const blas_int_t jb( min( nb, n-j ) );
+      nativeTrsm( 'L', 'N', 'U', n-j, jb, A+j+j*lda, lda, work.get()+j+j*n, n );
+   }
+
+   nativeTrsm( 'U', 'N', 'N', n, n, A, lda, work.get(), n );
+
+   nativeBlock( A, lda, 0, 0, n, n ) = W;
+
+   for( blas_int_t j=n-1; j>=0; --j ) {
+      const blas_int_t p( ipiv[j]-1 );
+      if( p != j ) {
+         std::swap_ranges( A+j*lda, A+j*lda+n, A+p*lda );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/orgqr.h
+//  \brief Header file for the native reconstruction of Q (orgqr/ungqr/orglq/unglq)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_ORGQR_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_ORGQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE Q MATRIX RECONSTRUCTION FUNCTIONS (ORGQR/UNGQR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native reconstruction of the matrix Q from a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..m]\f$.
+// \param k The number of elementary reflectors, whose product defines the matrix \f$[0..n]\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= \a k.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c orgqr() and \c ungqr() functions.
+// It generates the first \a n columns of the matrix \f$ Q = H(0) H(1) . . . H(k-1) \f$ from the
+// elementary reflectors computed by nativeGeqrf(). The block reflectors are applied in reverse
+// order via nativeLarfb() to a temporary identity matrix, which is finally copied into \a A.
+*/
+template< typename T >  // Element type
+void nativeOrgqr( blas_int_t m, blas_int_t n, blas_int_t k, T* A, blas_int_t lda,
+                  const T* tau, blas_int_t* info )
+{
+   *info = 0;
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[m*n + m*nb + nb*nb] );
+   T* Q ( work.get() );
+   T* V ( work.get() + m*n );
+   T* Tm( work.get() + m*n + m*nb );
+
+   auto Qb( nativeBlock( Q, m, 0, 0, m, n ) );
+   reset( Qb );
+   for( blas_int_t i=0; i<min( m, n ); ++i ) {
+      Qb(i,i) = T(1);
+   }
+
+   if( k > 0 )
+   {
+      for( blas_int_t i=( (k-1)/nb )*nb; i>=0; i-=nb )
+      {
+         const blas_int_t ib( min( nb, k-i ) );
+
+         nativeCopyReflectors( m-i, ib, A+i+i*lda, lda, V, m );
+         nativeLarft( m-i, ib, V, m, tau+i, Tm, nb );
+         nativeLarfb( 'N', m-i, n-i, ib, V, m, Tm, nb, Q+i+i*m, m );
+      }
+   }
+
+   nativeBlock( A, lda, 0, 0, m, n ) = Qb;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE Q MATRIX RECONSTRUCTION FUNCTIONS (ORGLQ/UNGLQ)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native reconstruction of the matrix Q from an LQ decomposition.
+// \ingroup lapack_decomposition
+//
+// \param m The number of rows of the given matrix \f$[0..n]\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param k The number of elementary reflectors, whose product defines the matrix \f$[0..m]\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= \a k.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c orglq() and \c unglq() functions.
+// It generates the first \a m rows of the matrix Q from the elementary reflectors computed by
+// nativeGelqf(). In analogy to nativeGelqf() the matrix is generated via nativeOrgqr() on the
+// conjugate transpose of \a A.
+*/
+template< typename T >  // Element type
+void nativeOrglq( blas_int_t m, blas_int_t n, blas_int_t k, T* A, blas_int_t lda,
+                  const T* tau, blas_int_t* info )
+{
+   *info = 0;
+
+   if( m == 0 || n == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<T[]> work( new T[n*m] );
+
+   auto Ab( nativeBlock( A, lda, 0, 0, m, n ) );
+   auto Wb( nativeBlock( work.get(), n, 0, 0, n, m ) );
+
+   Wb = nativeCtrans( Ab );
+   nativeOrgqr( n, m, k, work.get(), n, tau, info );
+   Ab = nativeCtrans( Wb );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
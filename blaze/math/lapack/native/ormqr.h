@@ -0,0 +1,111 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/ormqr.h
+//  \brief Header file for the native multiplication with Q (ormqr/unmqr)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_ORMQR_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_ORMQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE Q MATRIX MULTIPLICATION FUNCTIONS (ORMQR/UNMQR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native multiplication of a general matrix with the matrix Q from a QR decomposition.
+// \ingroup lapack_decomposition
+//
+// \param trans \c 'N' to compute \f$ Q*C \f$, \c 'C' to compute \f$ Q^H*C \f$.
+// \param m The number of rows of matrix \a C \f$[0..\infty)\f$.
+// \param n The number of columns of matrix \a C \f$[0..\infty)\f$.
+// \param k The number of elementary reflectors, whose product defines the matrix \f$[0..m]\f$.
+// \param A Pointer to the first element of the column-major matrix containing the reflectors.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= \a k.
+// \param C Pointer to the first element of the column-major m-by-n matrix \a C.
+// \param ldc The total number of elements between two columns of matrix \a C.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c ormqr() and \c unmqr() functions
+// for the multiplication from the left. The matrix \f$ Q = H(0) H(1) . . . H(k-1) \f$ is given
+// by the elementary reflectors computed by nativeGeqrf(). The reflectors are applied blockwise
+// via nativeLarfb(), i.e. all operations are performed by dense matrix multiplications.
+*/
+template< typename T >  // Element type
+void nativeOrmqr( char trans, blas_int_t m, blas_int_t n, blas_int_t k, const T* A,
+                  blas_int_t lda, const T* tau, T* C, blas_int_t ldc )
+{
+   if( m == 0 || n == 0 || k == 0 ) {
+      return;
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[m*nb + nb*nb] );
+   T* V ( work.get() );
+   T* Tm( work.get() + m*nb );
+
+   const blas_int_t first( trans == 'N' ? ( (k-1)/nb )*nb : 0 );
+   const blas_int_t step ( trans == 'N' ? -nb : nb );
+
+   for( blas_int_t i=first; i>=0 && i<k; i+=step )
+   {
+      const blas_int_t ib( min( nb, k-i ) );
+
+      nativeCopyReflectors( m-i, ib, A+i+i*lda, lda, V, m );
+      nativeLarft( m-i, ib, V, m, tau+i, Tm, nb );
+      nativeLarfb( trans, m-i, n, ib, V, m, Tm, nb, C+i, ldc );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,162 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/pbtrf.h
+//  \brief Header file for the native band Cholesky decomposition (pbtrf)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_PBTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_PBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BAND CHOLESKY DECOMPOSITION FUNCTIONS (PBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native Cholesky decomposition of the given positive definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c pbtrf() function and produces the
+// identical result format. It performs the unblocked Cholesky decomposition of the \c pbtf2()
+// function, which restricts every rank-1 update to the \a kd-by-\a kd triangle right of the
+// current diagonal element. In case of \a uplo = \c 'L' the columns of the factor \c L are
+// stored contiguously and the scaling is vectorized.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - > 0: If info = i, the decomposition could not be completed since the leading minor of
+//          order i is not positive definite.
+*/
+template< typename T >  // Element type
+void nativePbtrf( char uplo, blas_int_t n, blas_int_t kd, T* AB, blas_int_t ldab,
+                  blas_int_t* info )
+{
+   using std::sqrt;
+
+   using RT = UnderlyingBuiltin_t<T>;
+
+   *info = 0;
+
+   for( blas_int_t j=0; j<n; ++j )
+   {
+      const blas_int_t kn( min( kd, n-j-1 ) );
+
+      if( uplo == 'L' )
+      {
+         T* a( AB + j*ldab );
+         RT ajj( real( a[0] ) );
+
+         if( !( ajj > RT(0) ) ) {
+            a[0] = ajj;
+            *info = j+1;
+            return;
+         }
+
+         ajj = sqrt( ajj );
+         a[0] = ajj;
+
+         if( kn > 0 ) {
+            nativeColumn( AB, ldab, 1, j, kn ) *= T( RT(1) / ajj );
+         }
+
+         // Updating the trailing kn-by-kn triangle: A(j+r,j+c) -= L(j+r,j) * conj( L(j+c,j) )
+         for( blas_int_t c=1; c<=kn; ++c ) {
+            const T lc( conj( a[c] ) );
+            T* t( AB + (j+c)*ldab - c );
+            for( blas_int_t r=c; r<=kn; ++r ) {
+               t[r] -= a[r] * lc;
+            }
+         }
+      }
+      else
+      {
+         // Row j of the upper band is stored with a stride of ldab-1 elements
+         T* a( AB + kd + j*ldab );
+         RT ajj( real( a[0] ) );
+
+         if( !( ajj > RT(0) ) ) {
+            a[0] = ajj;
+            *info = j+1;
+            return;
+         }
+
+         ajj = sqrt( ajj );
+         a[0] = ajj;
+
+         for( blas_int_t c=1; c<=kn; ++c ) {
+            a[c*(ldab-1)] /= ajj;
+         }
+
+         // Updating the trailing kn-by-kn triangle: A(j+r,j+c) -= conj( U(j,j+r) ) * U(j,j+c)
+         for( blas_int_t c=1; c<=kn; ++c ) {
+            const T uc( a[c*(ldab-1)] );
+            T* t( AB + kd + (j+c)*ldab - c );
+            for( blas_int_t r=1; r<=c; ++r ) {
+               t[r] -= conj( a[r*(ldab-1)] ) * uc;
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,145 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/pbtrs.h
+//  \brief Header file for the native band LLH-based substitution (pbtrs)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_PBTRS_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_PBTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE BAND LLH-BASED SUBSTITUTION FUNCTIONS (PBTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native substitution step for solving a positive definite banded linear system of
+//        equations.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the band matrix \f$[0..\infty)\f$.
+// \param kd The number of sub- or superdiagonals of the band matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param AB Pointer to the first element of the band storage of the Cholesky factor.
+// \param ldab The total number of elements between two columns of \a AB; ldab >= kd+1.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c pbtrs() function. Based on the band
+// Cholesky decomposition computed by nativePbtrf() it solves the system of equations by means
+// of a forward and a backward substitution with the band factor, which both touch only the
+// \a kd off-diagonals of every column.
+*/
+template< typename T >  // Element type
+void nativePbtrs( char uplo, blas_int_t n, blas_int_t kd, blas_int_t nrhs, const T* AB,
+                  blas_int_t ldab, T* B, blas_int_t ldb, blas_int_t* info )
+{
+   *info = 0;
+
+   if( n == 0 || nrhs == 0 ) {
+      return;
+   }
+
+   for( blas_int_t k=0; k<nrhs; ++k )
+   {
+      T* b( B + k*ldb );
+
+      if( uplo == 'L' )
+      {
+         // Solving L*y = b
+         for( blas_int_t j=0; j<n; ++j ) {
+            const blas_int_t kn( min( kd, n-j-1 ) );
+            const T* l( AB + j*ldab - j );
+            b[j] /= l[j];
+            for( blas_int_t i=j+1; i<=j+kn; ++i ) {
+               b[i] -= l[i] * b[j];
+            }
+         }
+
+         // Solving L^H*x = y
+         for( blas_int_t j=n-1; j>=0; --j ) {
+            const blas_int_t kn( min( kd, n-j-1 ) );
+            const T* l( AB + j*ldab - j );
+            T tmp( b[j] );
+            for( blas_int_t i=j+1; i<=j+kn; ++i ) {
+               tmp -= conj( l[i] ) * b[i];
+            }
+            b[j] = tmp / l[j];
+         }
+      }
+      else
+      {
+         // Solving U^H*y = b
+         for( blas_int_t j=0; j<n; ++j ) {
+            const T* u( AB + ( kd-j + j*ldab ) );
+            T tmp( b[j] );
+            for( blas_int_t i=max( blas_int_t(0), j-kd ); i<j; ++i ) {
+               tmp -= conj( u[i] ) * b[i];
+            }
+            b[j] = tmp / u[j];
+         }
+
+         // Solving U*x = y
+         for( blas_int_t j=n-1; j>=0; --j ) {
+            const T* u( AB + ( kd-j + j*ldab ) );
+            b[j] /= u[j];
+            for( blas_int_t i=max( blas_int_t(0), j-kd ); i<j; ++i ) {
+               b[i] -= u[i] * b[j];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,285 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrf.h
+//  \brief Header file for the native Cholesky decomposition (potrf)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY DECOMPOSITION FUNCTIONS (POTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of the given positive definite column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c potf2() function. It is used for the
+// diagonal blocks within the blocked nativePotrf() function.
+*/
+template< typename T >  // Element type
+void nativePotf2( char uplo, blas_int_t n, T* A, blas_int_t lda, blas_int_t* info )
+{
+   using std::sqrt;
+
+   using RT = UnderlyingBuiltin_t<T>;
+
+   *info = 0;
+
+   for( blas_int_t j=0; j<n; ++j )
+   {
+      T* ajj( A + j + j*lda );
+      RT djj( real( *ajj ) );
+
+      if( uplo == 'L' ) {
+         for( blas_int_t k=0; k<j; ++k ) {
+            djj -= real( conj( A[j+k*lda] ) * A[j+k*lda] );
+         }
+      }
+      else {
+         for( blas_int_t k=0; k<j; ++k ) {
+            djj -= real( conj( A[k+j*lda] ) * A[k+j*lda] );
+         }
+      }
+
+      if( !( djj > RT(0) ) ) {
+         *ajj = djj;
+         *info = j+1;
+         return;
+      }
+
+      djj = sqrt( djj );
+      *ajj = djj;
+
+      if( uplo == 'L' ) {
+         for( blas_int_t i=j+1; i<n; ++i ) {
+            T tmp( A[i+j*lda] );
+            for( blas_int_t k=0; k<j; ++k ) {
+               tmp -= A[i+k*lda] * conj( A[j+k*lda] );
+            }
+            A[i+j*lda] = tmp / djj;
+         }
+      }
+      else {
+         for( blas_int_t i=j+1; i<n; ++i ) {
+            T tmp( A[j+i*lda] );
+            for( blas_int_t k=0; k<j; ++k ) {
+               tmp -= conj( A[k+j*lda] ) * A[k+i*lda];
+            }
+            A[j+i*lda] = tmp / djj;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native Hermitian rank-k update of a triangular part of the given column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to update the lower part of \a C, \c 'U' to update the upper part.
+// \param n The number of rows/columns of matrix \a C \f$[0..\infty)\f$.
+// \param k The rank of the update \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the n-by-k (\c 'L') or k-by-n (\c 'U') matrix \a A.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param C Pointer to the first element of the column-major n-by-n matrix \a C.
+// \param ldc The total number of elements between two columns of matrix \a C.
+// \return void
+//
+// This function computes \f$ C = C - A A^H \f$ (\c 'L') or \f$ C = C - A^H A \f$ (\c 'U') on
+// the specified triangular part of \a C. The update is performed block column by block column
+// via the (SMP parallel) dense matrix multiplication of Blaze, which avoids the computation of
+// the opposite triangular part. Only the specified triangular part of \a C is modified.
+*/
+template< typename T >  // Element type
+void nativeHerk( char uplo, blas_int_t n, blas_int_t k, const T* A, blas_int_t lda,
+                 T* C, blas_int_t ldc )
+{
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[nb*nb] );
+
+   for( blas_int_t j=0; j<n; j+=nb )
+   {
+      const blas_int_t jb( min( nb, n-j ) );
+      auto D( nativeBlock( work.get(), jb, 0, 0, jb, jb ) );
+
+      if( uplo == 'L' )
+      {
+         const auto Aj( nativeBlock( A, lda, j, 0, jb, k ) );
+         D = Aj * nativeCtrans( Aj );
+
+         for( blas_int_t jj=0; jj<jb; ++jj ) {
+            for( blas_int_t ii=jj; ii<jb; ++ii ) {
+               C[(j+ii)+(j+jj)*ldc] -= D(ii,jj);
+            }
+         }
+
+         if( j+jb < n ) {
+            auto Cb( nativeBlock( C, ldc, j+jb, j, n-j-jb, jb ) );
+            Cb -= nativeBlock( A, lda, j+jb, 0, n-j-jb, k ) * nativeCtrans( Aj );
+         }
+      }
+      else
+      {
+         const auto Aj( nativeBlock( A, lda, 0, j, k, jb ) );
+         D = nativeCtrans( Aj ) * Aj;
+
+         for( blas_int_t jj=0; jj<jb; ++jj ) {
+            for( blas_int_t ii=0; ii<=jj; ++ii ) {
+               C[(j+ii)+(j+jj)*ldc] -= D(ii,jj);
+            }
+         }
+
+         if( j > 0 ) {
+            auto Cb( nativeBlock( C, ldc, 0, j, j, jb ) );
+            Cb -= nativeCtrans( nativeBlock( A, lda, 0, 0, k, j ) ) * Aj;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked Cholesky decomposition of the given positive definite column-major matrix.
+// \ingroup lapack_decomposition
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c potrf() function and produces the
+// identical result format. It performs a right-looking Cholesky decomposition: every diagonal
+// block of size \c LAPACK_BLOCK_SIZE is decomposed by nativePotf2(), the according block column
+// (\c 'L') or block row (\c 'U') is computed via a triangular substitution, and the trailing
+// triangular part is updated via nativeHerk(). Only the specified triangular part of \a A is
+// referenced and modified.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The decomposition finished successfully.
+//   - > 0: If info = i, the decomposition could not be completed since the leading minor of
+//          order i is not positive definite.
+*/
+template< typename T >  // Element type
+void nativePotrf( char uplo, blas_int_t n, T* A, blas_int_t lda, blas_int_t* info )
+{
+   *info = 0;
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+
+   if( n <= nb ) {
+      nativePotf2( uplo, n, A, lda, info );
+      return;
+   }
+
+   for( blas_int_t j=0; j<n; j+=nb )
+   {
+      const blas_int_t jb( min( nb, n-j ) );
+      const blas_int_t nr( n-j-jb );
+
+      T* A11( A+j+j*lda );
+
+      nativePotf2( uplo, jb, A11, lda, info );
+
+      if( *info > 0 ) {
+         *info += j;
+         return;
+      }
+
+      if( nr == 0 ) continue;
+
+      if( uplo == 'L' )
+      {
+         // Computing L21 = A21 * L11^{-H} column by column
+         for( blas_int_t c=0; c<jb; ++c ) {
+            auto x( nativeColumn( A, lda, j+jb, j+c, nr ) );
+            for( blas_int_t k=0; k<c; ++k ) {
+               x -= conj( A11[c+k*lda] ) * nativeColumn( A, lda, j+jb, j+k, nr );
+            }
+            x *= T(1) / A11[c+c*lda];
+         }
+
+         nativeHerk( 'L', nr, jb, A+(j+jb)+j*lda, lda, A+(j+jb)+(j+jb)*lda, lda );
+      }
+      else
+      {
+         nativeTrsm( 'U', 'C', 'N', jb, nr, A11, lda, A+j+(j+jb)*lda, lda );
+         nativeHerk( 'U', nr, jb, A+j+(j+jb)*lda, lda, A+(j+jb)+(j+jb)*lda, lda );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,141 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potri.h
+//  \brief Header file for the native Cholesky-based matrix inversion (potri)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY-BASED INVERSION FUNCTIONS (POTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native inversion of the given Cholesky decomposed positive definite column-major matrix.
+// \ingroup lapack_inversion
+//
+// \param uplo \c 'L' in case of a lower Cholesky factor, \c 'U' in case of an upper factor.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c potri() function. Based on the
+// Cholesky decomposition computed by nativePotrf() it inverts the triangular factor via
+// nativeTrtri() and forms the specified triangular part of \f$ L^{-H} L^{-1} \f$ (\c 'L') or
+// \f$ U^{-1} U^{-H} \f$ (\c 'U') block column by block column via the (SMP parallel) dense
+// matrix multiplication of Blaze.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The inversion finished successfully.
+//   - > 0: If info = i, the element (i,i) of the factor is exactly zero.
+*/
+template< typename T >  // Element type
+void nativePotri( char uplo, blas_int_t n, T* A, blas_int_t lda, blas_int_t* info )
+{
+   nativeTrtri( uplo, 'N', n, A, lda, info );
+
+   if( *info > 0 ) {
+      return;
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[n*n + n*nb] );
+   T* X( work.get() );
+   T* R( work.get() + n*n );
+
+   auto W( nativeBlock( X, n, 0, 0, n, n ) );
+   reset( W );
+
+   for( blas_int_t j=0; j<n; ++j ) {
+      if( uplo == 'L' ) {
+         for( blas_int_t i=j; i<n; ++i )
+            X[i+j*n] = A[i+j*lda];
+      }
+      else {
+         for( blas_int_t i=0; i<=j; ++i )
+            X[i+j*n] = A[i+j*lda];
+      }
+   }
+
+   for( blas_int_t j=0; j<n; j+=nb )
+   {
+      const blas_int_t jb( min( nb, n-j ) );
+
+      if( uplo == 'L' ) {
+         auto Rb( nativeBlock( R, n-j, 0, 0, n-j, jb ) );
+         const auto Xj( nativeBlock( X, n, j, j, n-j, n-j ) );
+         Rb = nativeCtrans( Xj ) * nativeBlock( X, n, j, j, n-j, jb );
+         for( blas_int_t jj=0; jj<jb; ++jj ) {
+            for( blas_int_t ii=jj; ii<n-j; ++ii )
+               A[(j+ii)+(j+jj)*lda] = Rb(ii,jj);
+         }
+      }
+      else {
+         auto Rb( nativeBlock( R, j+jb, 0, 0, j+jb, jb ) );
+         const auto Xj( nativeBlock( X, n, j, j, jb, n-j ) );
+         Rb = nativeBlock( X, n, 0, j, j+jb, n-j ) * nativeCtrans( Xj );
+         for( blas_int_t jj=0; jj<jb; ++jj ) {
+            for( blas_int_t ii=0; ii<=j+jj; ++ii )
+               A[ii+(j+jj)*lda] = Rb(ii,jj);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
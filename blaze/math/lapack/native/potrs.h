@@ -0,0 +1,100 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrs.h
+//  \brief Header file for the native Cholesky-based substitution (potrs)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRS_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/trsm.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY-BASED SUBSTITUTION FUNCTIONS (POTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native substitution step for solving a positive definite linear system of equations.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' in case of a lower Cholesky factor, \c 'U' in case of an upper factor.
+// \param n The number of rows/columns of the column-major system matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the Cholesky decomposed column-major system matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c potrs() function. Based on the
+// Cholesky decomposition computed by nativePotrf() it solves the system of equations by means
+// of two blocked triangular substitutions.
+*/
+template< typename T >  // Element type
+void nativePotrs( char uplo, blas_int_t n, blas_int_t nrhs, const T* A, blas_int_t lda,
+                  T* B, blas_int_t ldb, blas_int_t* info )
+{
+   *info = 0;
+
+   if( n == 0 || nrhs == 0 ) {
+      return;
+   }
+
+   if( uplo == 'L' ) {
+      nativeTrsm( 'L', 'N', 'N', n, nrhs, A, lda, B, ldb );
+      nativeTrsm( 'L', 'C', 'N', n, nrhs, A, lda, B, ldb );
+   }
+   else {
+      nativeTrsm( 'U', 'C', 'N', n, nrhs, A, lda, B, ldb );
+      nativeTrsm( 'U', 'N', 'N', n, nrhs, A, lda, B, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
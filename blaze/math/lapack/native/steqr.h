@@ -0,0 +1,388 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/steqr.h
+//  \brief Header file for the native tridiagonal eigenvalue solvers (steqr/stein)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_STEQR_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_STEQR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/expressions/DVecDVecInnerExpr.h>
+#include <blaze/math/expressions/DVecScalarMultExpr.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/util/algorithms/Max.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIDIAGONAL EIGENVALUE FUNCTIONS (STEQR)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a plane rotation to two columns of a real column-major matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param n The number of rows of the matrix \f$[0..\infty)\f$.
+// \param x Pointer to the first element of the first column.
+// \param y Pointer to the first element of the second column.
+// \param c The cosine of the rotation.
+// \param s The sine of the rotation.
+// \param work Auxiliary array; size >= \a n.
+// \return void
+//
+// This function computes \f$ x = c*x - s*y \f$ and \f$ y = s*x + c*y \f$ by means of the
+// vectorized dense vector operations of Blaze.
+*/
+template< typename RT >  // Real element type
+void nativeRot( blas_int_t n, RT* x, RT* y, RT c, RT s, RT* work )
+{
+   auto xv( nativeColumn( x, n, 0, 0, n ) );
+   auto yv( nativeColumn( y, n, 0, 0, n ) );
+   auto tv( nativeColumn( work, n, 0, 0, n ) );
+
+   tv = yv;
+   yv = s*xv + c*tv;
+   xv = c*xv - s*tv;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of all eigenvalues and eigenvectors of a real symmetric tridiagonal
+//        matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param compz \c 'N' for eigenvalues only, \c 'I' to compute the eigenvectors of \a T.
+// \param n The number of rows/columns of the tridiagonal matrix \f$[0..\infty)\f$.
+// \param d On entry the \a n diagonal elements, on exit the eigenvalues in ascending order.
+// \param e On entry the \a n-1 off-diagonal elements, on exit destroyed; size >= \a n.
+// \param Z Pointer to the first element of the column-major n-by-n matrix of eigenvectors.
+// \param ldz The total number of elements between two columns of matrix \a Z.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c steqr() and \c sterf() functions.
+// It computes the eigenvalues of the tridiagonal matrix by means of the implicit QL method with
+// Wilkinson shifts. In case \a compz is set to \c 'I', the plane rotations are accumulated in
+// \a Z, which results in the orthonormal eigenvectors of \a T. The rotations of the columns are
+// vectorized.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: If info = i, the algorithm failed to find all eigenvalues.
+*/
+template< typename RT >  // Real element type
+void nativeSteqr( char compz, blas_int_t n, RT* d, RT* e, RT* Z, blas_int_t ldz, blas_int_t* info )
+{
+   using std::abs;
+   using std::hypot;
+   using std::swap;
+
+   *info = 0;
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const bool vectors( compz == 'I' );
+   const RT eps( std::numeric_limits<RT>::epsilon() );
+
+   const std::unique_ptr<RT[]> work( new RT[vectors ? n : 1] );
+
+   if( vectors ) {
+      auto Zb( nativeBlock( Z, ldz, 0, 0, n, n ) );
+      reset( Zb );
+      for( blas_int_t i=0; i<n; ++i ) {
+         Z[i+i*ldz] = RT(1);
+      }
+   }
+
+   e[n-1] = RT(0);
+
+   for( blas_int_t l=0; l<n; ++l )
+   {
+      blas_int_t iter( 0 );
+      blas_int_t m;
+
+      do {
+         for( m=l; m<n-1; ++m ) {
+            const RT dd( abs( d[m] ) + abs( d[m+1] ) );
+            if( abs( e[m] ) <= eps*dd ) break;
+         }
+
+         if( m == l ) break;
+
+         if( ++iter > 30 ) {
+            *info = l+1;
+            return;
+         }
+
+         RT g( ( d[l+1] - d[l] ) / ( RT(2) * e[l] ) );
+         RT r( hypot( g, RT(1) ) );
+         g = d[m] - d[l] + e[l] / ( g + ( g >= RT(0) ? r : -r ) );
+
+         RT s( 1 ), c( 1 ), p( 0 );
+         blas_int_t i;
+
+         for( i=m-1; i>=l; --i )
+         {
+            const RT f( s*e[i] );
+            const RT b( c*e[i] );
+
+            e[i+1] = ( r = hypot( f, g ) );
+
+            if( r == RT(0) ) {
+               d[i+1] -= p;
+               e[m] = RT(0);
+               break;
+            }
+
+            s = f / r;
+            c = g / r;
+            g = d[i+1] - p;
+            r = ( d[i] - g )*s + RT(2)*c*b;
+            d[i+1] = g + ( p = s*r );
+            g = c*r - b;
+
+            if( vectors ) {
+               nativeRot( n, Z+i*ldz, Z+(i+1)*ldz, c, s, work.get() );
+            }
+         }
+
+         if( r == RT(0) && i >= l ) continue;
+
+         d[l] -= p;
+         e[l] = g;
+         e[m] = RT(0);
+      }
+      while( m != l );
+   }
+
+   for( blas_int_t i=0; i<n-1; ++i )
+   {
+      blas_int_t k( i );
+      for( blas_int_t j=i+1; j<n; ++j ) {
+         if( d[j] < d[k] ) k = j;
+      }
+
+      if( k != i ) {
+         swap( d[i], d[k] );
+         if( vectors ) {
+            for( blas_int_t r=0; r<n; ++r )
+               swap( Z[r+i*ldz], Z[r+k*ldz] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE TRIDIAGONAL INVERSE ITERATION FUNCTIONS (STEIN)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of selected eigenvectors of a real symmetric tridiagonal matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param n The number of rows/columns of the tridiagonal matrix \f$[0..\infty)\f$.
+// \param d Pointer to the first element of the array of the \a n diagonal elements.
+// \param e Pointer to the first element of the array of the \a n-1 off-diagonal elements.
+// \param m The number of eigenvectors to be computed \f$[0..n]\f$.
+// \param w Pointer to the first element of the array of the \a m eigenvalues (ascending order).
+// \param Z Pointer to the first element of the column-major n-by-m matrix of eigenvectors.
+// \param ldz The total number of elements between two columns of matrix \a Z.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c stein() function. It computes the
+// eigenvectors belonging to the given eigenvalues by means of inverse iteration. Every shifted
+// tridiagonal matrix \f$ T - w(j) I \f$ is factorized once by Gaussian elimination with partial
+// pivoting, which requires \f$ O(n) \f$ operations per iteration. Eigenvectors belonging to
+// close eigenvalues are reorthogonalized against the eigenvectors of the same cluster. Thus the
+// computation of \a m eigenvectors only requires \f$ O(n*m) \f$ operations for well separated
+// eigenvalues.
+*/
+template< typename RT >  // Real element type
+void nativeStein( blas_int_t n, const RT* d, const RT* e, blas_int_t m, const RT* w,
+                  RT* Z, blas_int_t ldz )
+{
+   using std::abs;
+   using std::sqrt;
+   using std::swap;
+
+   if( n == 0 || m == 0 ) {
+      return;
+   }
+
+   const RT eps( std::numeric_limits<RT>::epsilon() );
+
+   RT onenrm( abs( d[0] ) + ( n > 1 ? abs( e[0] ) : RT(0) ) );
+   for( blas_int_t i=1; i<n; ++i ) {
+      onenrm = max( onenrm, abs( d[i] ) + abs( e[i-1] ) + ( i+1 < n ? abs( e[i] ) : RT(0) ) );
+   }
+
+   const RT ortol ( RT(1E-3) * onenrm );
+   const RT pivmin( max( eps*onenrm, std::numeric_limits<RT>::min() ) );
+
+   const std::unique_ptr<RT[]> work( new RT[5*n] );
+   RT* u1( work.get() );
+   RT* u2( work.get() +   n );
+   RT* u3( work.get() + 2*n );
+   RT* lm( work.get() + 3*n );
+   RT* x ( work.get() + 4*n );
+   const std::unique_ptr<bool[]> swp( new bool[n] );
+
+   blas_int_t first( 0 );
+   RT xjm( 0 );
+
+   for( blas_int_t j=0; j<m; ++j )
+   {
+      RT xj( w[j] );
+
+      if( j > 0 ) {
+         if( xj - w[j-1] > ortol ) first = j;
+         const RT pertol( RT(10) * abs( eps*xj ) + pivmin );
+         if( xj - xjm < pertol ) xj = xjm + pertol;
+      }
+      xjm = xj;
+
+      // Factorizing T - xj*I = P*L*U with partial pivoting
+      RT cd( d[0] - xj );
+      RT cs( n > 1 ? e[0] : RT(0) );
+
+      for( blas_int_t i=0; i<n-1; ++i )
+      {
+         const RT ci( e[i] );
+         const RT bi( i+2 < n ? e[i+1] : RT(0) );
+
+         if( abs( cd ) >= abs( ci ) ) {
+            swp[i] = false;
+            if( cd == RT(0) ) cd = pivmin;
+            lm[i] = ci / cd;
+            u1[i] = cd; u2[i] = cs; u3[i] = RT(0);
+            cd = d[i+1] - xj - lm[i]*cs;
+            cs = bi;
+         }
+         else {
+            swp[i] = true;
+            lm[i] = cd / ci;
+            u1[i] = ci; u2[i] = d[i+1] - xj; u3[i] = bi;
+            cd = cs - lm[i]*u2[i];
+            cs = -lm[i]*bi;
+         }
+
+         if( abs( u1[i] ) < pivmin ) {
+            u1[i] = ( u1[i] < RT(0) ? -pivmin : pivmin );
+         }
+      }
+
+      u1[n-1] = ( abs( cd ) < pivmin ? ( cd < RT(0) ? -pivmin : pivmin ) : cd );
+
+      // Initializing the starting vector with pseudo-random values in the range [-1..1]
+      unsigned long seed( 4357UL + 7919UL*static_cast<unsigned long>( j ) );
+      for( blas_int_t i=0; i<n; ++i ) {
+         seed = ( 1103515245UL*seed + 12345UL ) % 2147483648UL;
+         x[i] = RT(2) * static_cast<RT>( seed ) / RT(2147483648.0) - RT(1);
+      }
+
+      auto xv( nativeColumn( x, n, 0, 0, n ) );
+
+      for( blas_int_t iter=0; iter<3; ++iter )
+      {
+         // Solving P*L*U*x = x
+         for( blas_int_t i=0; i<n-1; ++i ) {
+            if( swp[i] ) swap( x[i], x[i+1] );
+            x[i+1] -= lm[i]*x[i];
+         }
+
+         x[n-1] /= u1[n-1];
+         if( n > 1 ) {
+            x[n-2] = ( x[n-2] - u2[n-2]*x[n-1] ) / u1[n-2];
+         }
+         for( blas_int_t i=n-3; i>=0; --i ) {
+            x[i] = ( x[i] - u2[i]*x[i+1] - u3[i]*x[i+2] ) / u1[i];
+         }
+
+         // Reorthogonalizing against the eigenvectors of the same cluster
+         for( blas_int_t k=first; k<j; ++k ) {
+            const auto zk( nativeColumn( Z, ldz, 0, k, n ) );
+            xv -= dot( zk, xv ) * zk;
+         }
+
+         RT xmax( 0 );
+         for( blas_int_t i=0; i<n; ++i ) {
+            xmax = max( xmax, abs( x[i] ) );
+         }
+         xv *= RT(1) / xmax;
+      }
+
+      RT scale( RT(1) / sqrt( dot( xv, xv ) ) );
+
+      blas_int_t jmax( 0 );
+      for( blas_int_t i=1; i<n; ++i ) {
+         if( abs( x[i] ) > abs( x[jmax] ) ) jmax = i;
+      }
+      if( x[jmax] < RT(0) ) scale = -scale;
+
+      nativeColumn( Z, ldz, 0, j, n ) = scale * xv;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,284 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/syev.h
+//  \brief Header file for the native symmetric/Hermitian eigenvalue solvers (syev/heev/syevx/heevx)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_SYEV_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_SYEV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/ormqr.h>
+#include <blaze/math/lapack/native/steqr.h>
+#include <blaze/math/lapack/native/sytrd.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE SYMMETRIC/HERMITIAN EIGENVALUE FUNCTIONS (SYEV/HEEV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mirrors the specified triangular part of a Hermitian column-major matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param uplo \c 'L' to mirror the lower part of the matrix, \c 'U' to mirror the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \return void
+//
+// This function copies the conjugate of the specified triangular part of \a A into the opposite
+// part and resets the imaginary part of the diagonal elements.
+*/
+template< typename T >  // Element type
+void nativeHermitianFill( char uplo, blas_int_t n, T* A, blas_int_t lda )
+{
+   for( blas_int_t j=0; j<n; ++j )
+   {
+      A[j+j*lda] = T( real( A[j+j*lda] ) );
+
+      for( blas_int_t i=j+1; i<n; ++i ) {
+         if( uplo == 'L' )
+            A[j+i*lda] = conj( A[i+j*lda] );
+         else
+            A[i+j*lda] = conj( A[j+i*lda] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the eigenvalues and eigenvectors of a dense symmetric or Hermitian
+//        column-major matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param w Pointer to the first element of the vector for the eigenvalues.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c syev(), \c syevd(), \c heev(), and
+// \c heevd() functions. The matrix is reduced to real tridiagonal form via nativeSytrd(), the
+// eigenvalues (and eigenvectors) of the tridiagonal matrix are computed via nativeSteqr() and
+// in case the eigenvectors are requested they are transformed back by means of the blocked
+// nativeOrmqr() function. On exit \a w contains the eigenvalues in ascending order and, in case
+// \a jobz is set to \c 'V', \a A contains the according orthonormal eigenvectors.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: The algorithm failed to converge.
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeSyev( char jobz, char uplo, blas_int_t n, T* A, blas_int_t lda, RT* w,
+                 blas_int_t* info )
+{
+   *info = 0;
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<RT[]> e  ( new RT[n] );
+   const std::unique_ptr<T[]>  tau( new T[n] );
+
+   nativeHermitianFill( uplo, n, A, lda );
+   nativeSytrd( n, A, lda, w, e.get(), tau.get() );
+
+   if( jobz == 'N' ) {
+      nativeSteqr( 'N', n, w, e.get(), static_cast<RT*>( nullptr ), 1, info );
+      return;
+   }
+
+   const std::unique_ptr<RT[]> Z( new RT[n*n] );
+   const std::unique_ptr<T[]>  C( new T[n*n] );
+
+   nativeSteqr( 'I', n, w, e.get(), Z.get(), n, info );
+
+   if( *info > 0 ) {
+      return;
+   }
+
+   const auto Zb( nativeBlock( Z.get(), n, 0, 0, n, n ) );
+   auto Cb( nativeBlock( C.get(), n, 0, 0, n, n ) );
+
+   Cb = Zb;
+   nativeOrmqr( 'N', n-1, n, n-1, A+1, lda, tau.get(), C.get()+1, n );
+   nativeBlock( A, lda, 0, 0, n, n ) = Cb;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of selected eigenvalues and eigenvectors of a dense symmetric or
+//        Hermitian column-major matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param range \c 'A' to compute all eigenvalues, \c 'V' to compute all eigenvalues in the
+//              half-open interval \f$(vl..vu]\f$, or \c 'I' to compute the eigenvalues with the
+//              indices in the range \f$[il..iu]\f$.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param vl The lower bound of the interval to be searched for eigenvalues (\a vl < \a vu).
+// \param vu The upper bound of the interval to be searched for eigenvalues (\a vl < \a vu).
+// \param il The index of the smallest eigenvalue to be returned (0 <= \a il <= \a iu).
+// \param iu The index of the largest eigenvalue to be returned (0 <= \a il <= \a iu < \a n).
+// \param m The total number of eigenvalues found (0 <= \a m <= \a n).
+// \param w Pointer to the first element of the vector for the eigenvalues.
+// \param Z Pointer to the first element of the column-major matrix for the eigenvectors.
+// \param ldz The total number of elements between two columns of the matrix Z \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c syevx() and \c heevx() functions.
+// After the reduction to tridiagonal form all eigenvalues of the tridiagonal matrix are computed
+// by means of nativeSteqr() without accumulating the rotations, which only requires \f$ O(n^2) \f$
+// operations. The eigenvectors of the \a m selected eigenvalues are computed by inverse iteration
+// (see nativeStein()) and transformed back via nativeOrmqr(). Therefore the computation of only
+// a few eigenpairs (as for instance the \a k largest ones via \a il = \a n-k and \a iu = \a n-1)
+// is considerably cheaper than the computation of the full eigendecomposition.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The computation finished successfully.
+//   - > 0: The algorithm failed to converge.
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeSyevx( char jobz, char range, char uplo, blas_int_t n, T* A, blas_int_t lda,
+                  RT vl, RT vu, blas_int_t il, blas_int_t iu, blas_int_t* m, RT* w,
+                  T* Z, blas_int_t ldz, blas_int_t* info )
+{
+   *m    = 0;
+   *info = 0;
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<RT[]> work( new RT[4*n] );
+   const std::unique_ptr<T[]>  tau ( new T[n] );
+   RT* d ( work.get() );
+   RT* e ( work.get() +   n );
+   RT* wd( work.get() + 2*n );
+   RT* we( work.get() + 3*n );
+
+   nativeHermitianFill( uplo, n, A, lda );
+   nativeSytrd( n, A, lda, d, e, tau.get() );
+
+   for( blas_int_t i=0; i<n; ++i ) {
+      wd[i] = d[i];
+      we[i] = e[i];
+   }
+
+   nativeSteqr( 'N', n, wd, we, static_cast<RT*>( nullptr ), 1, info );
+
+   if( *info > 0 ) {
+      return;
+   }
+
+   blas_int_t lo( 0 );
+   blas_int_t hi( n );
+
+   if( range == 'I' ) {
+      lo = il;
+      hi = iu + 1;
+   }
+   else if( range == 'V' ) {
+      while( lo < n && wd[lo] <= vl ) ++lo;
+      hi = lo;
+      while( hi < n && wd[hi] <= vu ) ++hi;
+   }
+
+   *m = hi - lo;
+
+   for( blas_int_t i=lo; i<hi; ++i ) {
+      w[i-lo] = wd[i];
+   }
+
+   if( jobz != 'V' || *m == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<RT[]> Zr( new RT[n*(*m)] );
+
+   if( *m == n ) {
+      for( blas_int_t i=0; i<n; ++i ) {
+         w[i] = d[i];
+      }
+      nativeSteqr( 'I', n, w, e, Zr.get(), n, info );
+      if( *info > 0 ) return;
+   }
+   else {
+      nativeStein( n, d, e, *m, w, Zr.get(), n );
+   }
+
+   const auto Zrb( nativeBlock( Zr.get(), n, 0, 0, n, *m ) );
+   auto Zb( nativeBlock( Z, ldz, 0, 0, n, *m ) );
+
+   Zb = Zrb;
+   nativeOrmqr( 'N', n-1, *m, n-1, A+1, lda, tau.get(), Z+1, ldz );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
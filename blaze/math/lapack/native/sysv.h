@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/sysv.h
+//  \brief Header file for the native symmetric/Hermitian linear system solvers (sysv/hesv)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_SYSV_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_SYSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/gesv.h>
+#include <blaze/math/shims/Conjugate.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE SYMMETRIC/HERMITIAN LINEAR SYSTEM FUNCTIONS (SYSV/HESV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native solver for a symmetric indefinite linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major system matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major system matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native replacement of the LAPACK \c sysv() function. Since there is no
+// native Bunch-Kaufman decomposition, the specified triangular part of \a A is mirrored into
+// the opposite part and the system is solved via nativeGesv(). Therefore on exit \a A and
+// \a ipiv contain the LU decomposition instead of the Bunch-Kaufman decomposition.
+*/
+template< typename T >  // Element type
+void nativeSysv( char uplo, blas_int_t n, blas_int_t nrhs, T* A, blas_int_t lda,
+                 blas_int_t* ipiv, T* B, blas_int_t ldb, blas_int_t* info )
+{
+   for( blas_int_t j=0; j<n; ++j ) {
+      for( blas_int_t i=j+1; i<n; ++i ) {
+         if( uplo == 'L' )
+            A[j+i*lda] = A[i+j*lda];
+         else
+            A[i+j*lda] = A[j+i*lda];
+      }
+   }
+
+   nativeGesv( n, nrhs, A, lda, ipiv, B, ldb, info );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native solver for a Hermitian indefinite linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major system matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major system matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native replacement of the LAPACK \c hesv() function. In analogy to
+// nativeSysv() the specified triangular part of \a A is mirrored (and conjugated) into the
+// opposite part and the system is solved via nativeGesv().
+*/
+template< typename T >  // Element type
+void nativeHesv( char uplo, blas_int_t n, blas_int_t nrhs, T* A, blas_int_t lda,
+                 blas_int_t* ipiv, T* B, blas_int_t ldb, blas_int_t* info )
+{
+   for( blas_int_t j=0; j<n; ++j ) {
+      for( blas_int_t i=j+1; i<n; ++i ) {
+         if( uplo == 'L' )
+            A[j+i*lda] = conj( A[i+j*lda] );
+         else
+            A[i+j*lda] = conj( A[j+i*lda] );
+      }
+   }
+
+   nativeGesv( n, nrhs, A, lda, ipiv, B, ldb, info );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,129 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/sytrd.h
+//  \brief Header file for the native tridiagonal reduction (sytrd/hetrd)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_SYTRD_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_SYTRD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/expressions/DMatDMatAddExpr.h>
+#include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/expressions/TDMatDVecMultExpr.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/geqrf.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIDIAGONAL REDUCTION FUNCTIONS (SYTRD/HETRD)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native reduction of a dense Hermitian column-major matrix to real tridiagonal form.
+// \ingroup lapack_eigenvalue
+//
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param d Pointer to the first element of the array for the \a n diagonal elements.
+// \param e Pointer to the first element of the array for the \a n-1 off-diagonal elements.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= \a n-1.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c sytrd() and \c hetrd() functions
+// for the lower part of the matrix. It reduces the given symmetric or Hermitian matrix to the
+// real symmetric tridiagonal form \f$ T = Q^H A Q \f$, where \f$ Q = H(0) H(1) . . . H(n-2) \f$
+// is the product of elementary reflectors. In contrast to LAPACK both triangular parts of \a A
+// are expected to be set and both are updated, which enables the use of the vectorized (and
+// SMP parallel) dense matrix/vector multiplication and outer product for the symmetric rank-2
+// updates. On exit the elementary reflector \f$ H(i) \f$ is stored in the elements below the
+// subdiagonal of the \a i-th column of \a A in the format of nativeGeqrf().
+*/
+template< typename T    // Element type
+        , typename RT >  // Real element type
+void nativeSytrd( blas_int_t n, T* A, blas_int_t lda, RT* d, RT* e, T* tau )
+{
+   if( n == 0 ) {
+      return;
+   }
+
+   const std::unique_ptr<T[]> work( new T[n] );
+
+   for( blas_int_t j=0; j<n-1; ++j )
+   {
+      const blas_int_t nr( n-j-1 );
+
+      nativeLarfg( nr, A[(j+1)+j*lda], A+(j+2)+j*lda, tau[j] );
+
+      d[j] = real( A[j+j*lda] );
+      e[j] = real( A[(j+1)+j*lda] );
+
+      if( tau[j] != T() )
+      {
+         A[(j+1)+j*lda] = T(1);
+
+         const auto v  ( nativeColumn( A, lda, j+1, j, nr ) );
+         auto       w  ( nativeColumn( work.get(), n, 0, 0, nr ) );
+         auto       A22( nativeBlock( A, lda, j+1, j+1, nr, nr ) );
+
+         w = tau[j] * ( A22 * v );
+         w += ( T(-0.5) * tau[j] * nativeDotc( w, v ) ) * v;
+         A22 -= v * ctrans( w ) + w * ctrans( v );
+
+         A[(j+1)+j*lda] = e[j];
+      }
+   }
+
+   d[n-1] = real( A[(n-1)+(n-1)*lda] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
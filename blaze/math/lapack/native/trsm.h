@@ -0,0 +1,231 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trsm.h
+//  \brief Header file for the native triangular system solver (trsm)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRSM_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRSM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR SYSTEM SOLVER FUNCTIONS (TRSM)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked kernel for the solution of a triangular system with multiple right-hand sides.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' in case of a lower triangular matrix, \c 'U' in case of an upper matrix.
+// \param transA \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, \c 'C' for \f$ A^H*X=B \f$.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param m The number of rows of the right-hand side matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the right-hand side matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major triangular matrix.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B.
+// \return void
+//
+// This function solves the triangular system \f$ op(A)*X=B \f$ column by column. It is used
+// for the diagonal blocks within the blocked nativeTrsm() function.
+*/
+template< typename T >  // Element type
+void nativeTrsmKernel( char uplo, char transA, char diag, blas_int_t m, blas_int_t n,
+                       const T* A, blas_int_t lda, T* B, blas_int_t ldb )
+{
+   const bool unit ( diag == 'U' );
+   const bool lower( uplo == 'L' );
+   const bool cplx ( transA == 'C' );
+
+   for( blas_int_t j=0; j<n; ++j )
+   {
+      T* b( B + j*ldb );
+
+      if( transA == 'N' && lower ) {
+         for( blas_int_t k=0; k<m; ++k ) {
+            if( !unit ) b[k] /= A[k+k*lda];
+            const T bk( b[k] );
+            const T* a( A + k*lda );
+            for( blas_int_t i=k+1; i<m; ++i ) {
+               b[i] -= bk * a[i];
+            }
+         }
+      }
+      else if( transA == 'N' ) {
+         for( blas_int_t k=m-1; k>=0; --k ) {
+            if( !unit ) b[k] /= A[k+k*lda];
+            const T bk( b[k] );
+            const T* a( A + k*lda );
+            for( blas_int_t i=0; i<k; ++i ) {
+               b[i] -= bk * a[i];
+            }
+         }
+      }
+      else if( !lower ) {
+         for( blas_int_t i=0; i<m; ++i ) {
+            const T* a( A + i*lda );
+            T tmp( b[i] );
+            for( blas_int_t k=0; k<i; ++k ) {
+               tmp -= nativeOp( a[k], cplx ) * b[k];
+            }
+            b[i] = ( unit ? tmp : tmp / nativeOp( a[i], cplx ) );
+         }
+      }
+      else {
+         for( blas_int_t i=m-1; i>=0; --i ) {
+            const T* a( A + i*lda );
+            T tmp( b[i] );
+            for( blas_int_t k=i+1; k<m; ++k ) {
+               tmp -= nativeOp( a[k], cplx ) * b[k];
+            }
+            b[i] = ( unit ? tmp : tmp / nativeOp( a[i], cplx ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native blocked solution of a triangular system with multiple right-hand sides.
+// \ingroup lapack_substitution
+//
+// \param uplo \c 'L' in case of a lower triangular matrix, \c 'U' in case of an upper matrix.
+// \param transA \c 'N' for \f$ A*X=B \f$, \c 'T' for \f$ A^T*X=B \f$, \c 'C' for \f$ A^H*X=B \f$.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param m The number of rows of the right-hand side matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the right-hand side matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major triangular matrix.
+// \param lda The total number of elements between two columns of matrix \a A.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B.
+// \return void
+//
+// This function is the native counterpart of the BLAS \c trsm() function for triangular matrices
+// on the left-hand side. The solution \a X overwrites the right-hand side matrix \a B. Only the
+// triangular part of \a A specified by \a uplo is referenced. The diagonal blocks of size
+// \c LAPACK_BLOCK_SIZE are solved by means of nativeTrsmKernel(), the remaining right-hand side
+// rows are updated via the (SMP parallel) dense matrix multiplication of Blaze.
+*/
+template< typename T >  // Element type
+void nativeTrsm( char uplo, char transA, char diag, blas_int_t m, blas_int_t n,
+                 const T* A, blas_int_t lda, T* B, blas_int_t ldb )
+{
+   if( !IsComplex_v<T> && transA == 'C' ) {
+      transA = 'T';
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+
+   if( m <= nb || n == 0 ) {
+      nativeTrsmKernel( uplo, transA, diag, m, n, A, lda, B, ldb );
+      return;
+   }
+
+   const bool forward( ( uplo == 'L' ) == ( transA == 'N' ) );
+
+   if( forward )
+   {
+      for( blas_int_t k=0; k<m; k+=nb )
+      {
+         const blas_int_t kb( min( nb, m-k ) );
+         const blas_int_t mr( m-k-kb );
+
+         nativeTrsmKernel( uplo, transA, diag, kb, n, A+k+k*lda, lda, B+k, ldb );
+
+         if( mr == 0 ) continue;
+
+         const auto Bk( nativeBlock( B, ldb, k, 0, kb, n ) );
+         auto Br( nativeBlock( B, ldb, k+kb, 0, mr, n ) );
+
+         if( transA == 'N' ) {
+            Br -= nativeBlock( A, lda, k+kb, k, mr, kb ) * Bk;
+         }
+         else if( transA == 'T' ) {
+            Br -= trans( nativeBlock( A, lda, k, k+kb, kb, mr ) ) * Bk;
+         }
+         else {
+            Br -= nativeCtrans( nativeBlock( A, lda, k, k+kb, kb, mr ) ) * Bk;
+         }
+      }
+   }
+   else
+   {
+      for( blas_int_t k=( (m-1)/nb )*nb; k>=0; k-=nb )
+      {
+         const blas_int_t kb( min( nb, m-k ) );
+
+         nativeTrsmKernel( uplo, transA, diag, kb, n, A+k+k*lda, lda, B+k, ldb );
+
+         if( k == 0 ) continue;
+
+         const auto Bk( nativeBlock( B, ldb, k, 0, kb, n ) );
+         auto Bt( nativeBlock( B, ldb, 0, 0, k, n ) );
+
+         if( transA == 'N' ) {
+            Bt -= nativeBlock( A, lda, 0, k, k, kb ) * Bk;
+         }
+         else if( transA == 'T' ) {
+            Bt -= trans( nativeBlock( A, lda, k, 0, kb, k ) ) * Bk;
+         }
+         else {
+            Bt -= nativeCtrans( nativeBlock( A, lda, k, 0, kb, k ) ) * Bk;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,135 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trtri.h
+//  \brief Header file for the native triangular matrix inversion (trtri)
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/lapack/native/Auxiliary.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR INVERSION FUNCTIONS (TRTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native inversion of the given dense triangular column-major matrix.
+// \ingroup lapack_inversion
+//
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native counterpart of the LAPACK \c trtri() function. The inverse is
+// computed block column by block column via blocked triangular substitutions, which exploit
+// the triangular structure of the inverse. Only the triangular part of \a A specified by
+// \a uplo is referenced and modified; in case of a unitriangular matrix the diagonal elements
+// are neither referenced nor modified.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The inversion finished successfully.
+//   - > 0: If info = i, the element A(i,i) is exactly zero and the matrix is singular.
+*/
+template< typename T >  // Element type
+void nativeTrtri( char uplo, char diag, blas_int_t n, T* A, blas_int_t lda, blas_int_t* info )
+{
+   *info = 0;
+
+   if( diag == 'N' ) {
+      for( blas_int_t i=0; i<n; ++i ) {
+         if( A[i+i*lda] == T() ) {
+            *info = i+1;
+            return;
+         }
+      }
+   }
+
+   const blas_int_t nb( LAPACK_BLOCK_SIZE );
+   const std::unique_ptr<T[]> work( new T[n*n] );
+   T* X( work.get() );
+
+   auto W( nativeBlock( X, n, 0, 0, n, n ) );
+   reset( W );
+   for( blas_int_t i=0; i<n; ++i ) {
+      W(i,i) = T(1);
+   }
+
+   for( blas_int_t j=0; j<n; j+=nb ) {
+      const blas_int_t jb( min( nb, n-j ) );
+      if( uplo == 'L' )
+         nativeTrsm( 'L', 'N', diag, n-j, jb, A+j+j*lda, lda, X+j+j*n, n );
+      else
+         nativeTrsm( 'U', 'N', diag, j+jb, jb, A, lda, X+j*n, n );
+   }
+
+   const blas_int_t offset( diag == 'U' ? 1 : 0 );
+
+   for( blas_int_t j=0; j<n; ++j ) {
+      if( uplo == 'L' ) {
+         for( blas_int_t i=j+offset; i<n; ++i )
+            A[i+j*lda] = X[i+j*n];
+      }
+      else {
+         for( blas_int_t i=0; i<=j-offset; ++i )
+            A[i+j*lda] = X[i+j*n];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,161 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pbtrf.h
+//  \brief Header file for the LAPACK band Cholesky decomposition functions (pbtrf)
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PBTRF_H_
+#define _BLAZE_MATH_LAPACK_PBTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BandedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/lapack/clapack/pbtrf.h>
+#include <blaze/math/lapack/native/pbtrf.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND LLH (CHOLESKY) DECOMPOSITION FUNCTIONS (PBTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band LLH (Cholesky) decomposition functions (pbtrf) */
+//@{
+template< typename Type >
+void pbtrf( BandedMatrix<Type,columnMajor>& A, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the Cholesky decomposition of the given positive definite band matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The band matrix to be decomposed.
+// \param uplo \c 'L' to use the lower band of the matrix, \c 'U' to use the upper band.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition of a symmetric or Hermitian positive definite
+// band matrix based on the LAPACK pbtrf() functions. In case \a uplo is \c 'L', the diagonal and
+// the \a kl subdiagonals are used, in case \a uplo is \c 'U', the diagonal and the \a ku
+// superdiagonals are used. The other half of the band is not referenced. Note that the function
+// only works for band matrices with \c float, \c double, \c complex<float>, or \c complex<double>
+// element type. The attempt to call the function with matrices of any other element type results
+// in a compile time error!\n
+//
+// The decomposition has the form
+
+                      \f[ A = U^{H} U \texttt{ (if uplo = 'U'), or }
+                          A = L L^{H} \texttt{ (if uplo = 'L'), } \f]
+
+// where \c U is an upper triangular band matrix and \c L is a lower triangular band matrix with
+// the same bandwidth as the referenced half of \a A, i.e. the decomposition does not require any
+// additional storage. The resulting factor is stored in place of the referenced half of \a A.
+// The Cholesky decomposition fails if ...
+//
+//  - ... the given system matrix \a A is not a square matrix;
+//  - ... the given system matrix \a A is not a positive definite matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U'.
+//
+// In all failure cases an exception is thrown.
+//
+// For more information on the pbtrf() functions (i.e. spbtrf(), dpbtrf(), cpbtrf(), and zpbtrf())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename Type >  // Data type of the elements
+inline void pbtrf( BandedMatrix<Type,columnMajor>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kd  ( numeric_cast<blas_int_t>( uplo == 'L' ? A.lowerBandwidth()
+                                                          : A.upperBandwidth() ) );
+   blas_int_t ldab( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   // The lower band starts at the diagonal, which is located in row ku of the band storage
+   Type* ab( uplo == 'L' ? A.data() + A.upperBandwidth() : A.data() );
+
+#if BLAZE_LAPACK_MODE
+   pbtrf( uplo, n, kd, ab, ldab, &info );
+#else
+   nativePbtrf( uplo, n, kd, ab, ldab, &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for Cholesky decomposition" );
+
+   if( info > 0 ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
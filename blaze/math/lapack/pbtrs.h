@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/pbtrs.h
+//  \brief Header file for the LAPACK band LLH-based substitution functions (pbtrs)
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_PBTRS_H_
+#define _BLAZE_MATH_LAPACK_PBTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/BandedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/pbtrs.h>
+#include <blaze/math/lapack/native/pbtrs.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/NumericCast.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK BAND LLH-BASED SUBSTITUTION FUNCTIONS (PBTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK band LLH-based substitution functions (pbtrs) */
+//@{
+template< typename Type, typename VT, bool TF >
+void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseVector<VT,TF>& b, char uplo );
+
+template< typename Type, typename MT, bool SO >
+void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseMatrix<MT,SO>& B, char uplo );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite banded linear
+//        system of equations (\f$ A*x=b \f$).
+// \ingroup lapack_substitution
+//
+// \param A The Cholesky decomposed band matrix.
+// \param b The right-hand side vector.
+// \param uplo \c 'L' to use the lower band of the matrix, \c 'U' to use the upper band.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+//
+// This function uses the LAPACK pbtrs() functions to perform the substitution step to compute
+// the solution to the positive definite banded system of linear equations \f$ A*x=b \f$. In
+// this context the band matrix \a A is a \a n-by-\a n matrix that has already been factorized
+// by the pbtrf() functions with the same \a uplo argument and \a x and \a b are n-dimensional
+// vectors. Note that the function only works for band matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// If the function exits successfully, the vector \a b contains the solution of the linear system
+// of equations. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the sizes of the given matrix and vector do not match.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// Example:
+
+   \code
+   using blaze::BandedMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   BandedMatrix<double,columnMajor> A( 100UL, 100UL, 2UL, 0UL );  // The lower band of A
+   DynamicVector<double,columnVector> b( 100UL );                 // The right-hand side vector b
+   // ... Initialization
+
+   BandedMatrix<double,columnMajor>   D( A );  // Temporary matrix to be decomposed
+   DynamicVector<double,columnVector> x( b );  // Temporary vector for the solution
+
+   pbtrf( D, 'L' );
+   pbtrs( D, x, 'L' );
+   \endcode
+
+// For more information on the pbtrs() functions (i.e. spbtrs(), dpbtrs(), cpbtrs(), and zpbtrs()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
+*/
+template< typename Type  // Data type of the elements
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+inline void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseVector<VT,TF>& b, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (*b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kd  ( numeric_cast<blas_int_t>( uplo == 'L' ? A.lowerBandwidth()
+                                                          : A.upperBandwidth() ) );
+   blas_int_t nrhs( 1 );
+   blas_int_t ldab( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (*b).size() ) );
+   blas_int_t info( 0 );
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const Type* ab( uplo == 'L' ? A.data() + A.upperBandwidth() : A.data() );
+
+#if BLAZE_LAPACK_MODE
+   pbtrs( uplo, n, kd, nrhs, ab, ldab, (*b).data(), ldb, &info );
+#else
+   nativePbtrs( uplo, n, kd, nrhs, ab, ldab, (*b).data(), ldb, &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the substitution step of solving a positive definite banded linear
+//        system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_substitution
+//
+// \param A The Cholesky decomposed band matrix.
+// \param B The matrix of right-hand sides.
+// \param uplo \c 'L' to use the lower band of the matrix, \c 'U' to use the upper band.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+//
+// This function uses the LAPACK pbtrs() functions to perform the substitution step to compute
+// the solution to the positive definite banded system of linear equations:
+//
+//  - \f$ A*X  =B   \f$ if \a B is column-major
+//  - \f$ A*X^T=B^T \f$ if \a B is row-major
+//
+// In this context the band matrix \a A is a \a n-by-\a n matrix that has already been factorized
+// by the pbtrf() functions with the same \a uplo argument and \a X and \a B are either row-major
+// \a m-by-\a n matrices or column-major \a n-by-\a m matrices. Note that the function only works
+// for band matrices and general, non-adapted dense matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// If the function exits successfully, the matrix \a B contains the solutions of the linear
+// system of equations. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the given \a uplo argument is neither \c 'L' nor \c 'U';
+//  - ... the sizes of the two given matrices do not match.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// For more information on the pbtrs() functions (i.e. spbtrs(), dpbtrs(), cpbtrs(), and zpbtrs()),
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
+*/
+template< typename Type  // Data type of the elements
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline void pbtrs( const BandedMatrix<Type,columnMajor>& A, DenseMatrix<MT,SO>& B, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   blas_int_t n   ( numeric_cast<blas_int_t>( A.rows() ) );
+   blas_int_t kd  ( numeric_cast<blas_int_t>( uplo == 'L' ? A.lowerBandwidth()
+                                                          : A.upperBandwidth() ) );
+   blas_int_t mrhs( numeric_cast<blas_int_t>( SO ? (*B).rows() : (*B).columns() ) );
+   blas_int_t nrhs( numeric_cast<blas_int_t>( SO ? (*B).columns() : (*B).rows() ) );
+   blas_int_t ldab( numeric_cast<blas_int_t>( A.spacing() ) );
+   blas_int_t ldb ( numeric_cast<blas_int_t>( (*B).spacing() ) );
+   blas_int_t info( 0 );
+
+   if( n != mrhs ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0 ) {
+      return;
+   }
+
+   const Type* ab( uplo == 'L' ? A.data() + A.upperBandwidth() : A.data() );
+
+#if BLAZE_LAPACK_MODE
+   pbtrs( uplo, n, kd, nrhs, ab, ldab, (*B).data(), ldb, &info );
+#else
+   nativePbtrs( uplo, n, kd, nrhs, ab, ldab, (*B).data(), ldb, &info );
+#endif
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
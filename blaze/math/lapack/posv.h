@@ -50,7 +50,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/posv.h>
+#include <blaze/math/lapack/native/posv.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/NumericCast.h>
@@ -127,9 +129,10 @@ void posv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, char uplo );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -177,7 +180,11 @@ inline void posv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo )
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
+#if BLAZE_LAPACK_MODE
    posv( uplo, n, nrhs, (*A).data(), lda, (*b).data(), ldb, &info );
+#else
+   nativePosv( uplo, n, nrhs, (*A).data(), lda, (*b).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
@@ -242,9 +249,10 @@ inline void posv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -294,7 +302,11 @@ inline void posv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, char uplo )
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
+#if BLAZE_LAPACK_MODE
    posv( uplo, n, nrhs, (*A).data(), lda, (*B).data(), ldb, &info );
+#else
+   nativePosv( uplo, n, nrhs, (*A).data(), lda, (*B).data(), ldb, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
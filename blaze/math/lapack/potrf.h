@@ -49,7 +49,9 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/potrf.h>
+#include <blaze/math/lapack/native/potrf.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -106,9 +108,10 @@ void potrf( DenseMatrix<MT,SO>& A, char uplo );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a A may already have been modified.
@@ -143,7 +146,11 @@ inline void potrf( DenseMatrix<MT,SO>& A, char uplo )
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
+#if BLAZE_LAPACK_MODE
    potrf( uplo, n, (*A).data(), lda, &info );
+#else
+   nativePotrf( uplo, n, (*A).data(), lda, &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for Cholesky decomposition" );
 
@@ -51,7 +51,9 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/syevd.h>
+#include <blaze/math/lapack/native/syev.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Builtin.h>
 #include <blaze/util/NumericCast.h>
@@ -129,9 +131,10 @@ void syevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT  // Type of the matrix A
         , bool SO      // Storage order of the matrix A
@@ -152,8 +155,6 @@ inline void syevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT> );
    BLAZE_CONSTRAINT_MUST_BE_BUILTIN_TYPE( ElementType_t<VT> );
 
-   using ET = ElementType_t<MT>;
-
    if( !isSquare( *A ) ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
    }
@@ -176,18 +177,24 @@ inline void syevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
       return;
    }
 
+   if( IsRowMajorMatrix_v<MT> ) {
+      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
+   }
+
+#if BLAZE_LAPACK_MODE
+   using ET = ElementType_t<MT>;
+
    blas_int_t lwork( 2*n*n + 6*n + 3 );
    const std::unique_ptr<ET[]> work( new ET[lwork] );
 
    blas_int_t liwork( 3 + 5*n );
    const std::unique_ptr<blas_int_t[]> iwork( new blas_int_t[liwork] );
 
-   if( IsRowMajorMatrix_v<MT> ) {
-      ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
-   }
-
    syevd( jobz, uplo, n, (*A).data(), lda, (*w).data(),
           work.get(), lwork, iwork.get(), liwork, &info );
+#else
+   nativeSyev( jobz, uplo, n, (*A).data(), lda, (*w).data(), &info );
+#endif
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
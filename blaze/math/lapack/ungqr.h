@@ -50,6 +50,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/unglq.h>
 #include <blaze/math/lapack/clapack/ungqr.h>
+#include <blaze/math/lapack/native/orgqr.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Complex.h>
 #include <blaze/util/NumericCast.h>
@@ -112,9 +114,10 @@ void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau );
 //
 //        http://www.netlib.org/lapack/explore-html/
 //
-// \note This function can only be used if a fitting LAPACK library, which supports this function,
-// is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// \note In case the LAPACK mode is enabled (see the \c BLAZE_LAPACK_MODE switch), this function
+// can only be used if a fitting LAPACK library, which supports this function, is available and
+// linked to the executable. Otherwise a call to this function will result in a linker error.
+// In case the LAPACK mode is disabled, the native implementation of Blaze is used instead.
 */
 template< typename MT, bool SO >
 inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
@@ -126,8 +129,6 @@ inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
    BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_t<MT> );
 
-   using ET = ElementType_t<MT>;
-
    blas_int_t m   ( numeric_cast<blas_int_t>( SO ? (*A).rows() : (*A).columns() ) );
    blas_int_t n   ( numeric_cast<blas_int_t>( SO ? (*A).columns() : (*A).rows() ) );
    blas_int_t k   ( min( m, n ) );
@@ -138,6 +139,9 @@ inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
       return;
    }
 
+#if BLAZE_LAPACK_MODE
+   using ET = ElementType_t<MT>;
+
    blas_int_t lwork( k*lda );
    const std::unique_ptr<ET[]> work( new ET[lwork] );
 
@@ -147,6 +151,14 @@ inline void ungqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
    else {
       unglq( k, n, k, (*A).data(), lda, tau, work.get(), lwork, &info );
    }
+#else
+   if( SO ) {
+      nativeOrgqr( m, k, k, (*A).data(), lda, tau, &info );
+   }
+   else {
+      nativeOrglq( k, n, k, (*A).data(), lda, tau, &info );
+   }
+#endif
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q reconstruction" );
 }
@@ -0,0 +1,647 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Async.h
+//  \brief Header file for the asynchronous evaluation of expressions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_SMP_ASYNC_H_
+#define _BLAZE_MATH_SMP_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadLimit.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_HPX_PARALLEL_MODE
+#  include <hpx/include/run_as.hpp>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCSCHEDULER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduler for the asynchronous evaluation of expressions.
+// \ingroup smp
+//
+// The AsyncScheduler class starts the asynchronous operations of the asyncAssign() and async()
+// functions and tracks the dependencies between them. Every asynchronous operation is executed
+// by a separate thread of execution, which in turn uses the active shared memory parallelization
+// for the actual evaluation. An asynchronous operation is started only after
+//
+//  - the previous asynchronous operation of the same application thread and
+//  - all pending asynchronous operations of any application thread on the same target operand
+//
+// have been completed. Therefore the asynchronous operations of a single application thread are
+// executed in program order, whereas they overlap with all other work of the application thread.
+// The thread limit and serial sections of the calling thread are forwarded to the thread that
+// evaluates the operation. In case the flags of the serial and parallel sections are shared by
+// all threads (see the \c BLAZE_THREAD_LOCAL_SECTION_MODE switch), the asynchronous operations
+// must not overlap with any parallel operation of the application threads.
+*/
+class AsyncScheduler
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using Future = std::shared_future<void>;  //!< Handle for the completion of an operation.
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename R, typename Task >
+   static std::shared_future<R> launch( const void* target, Task task );
+
+   template< typename R, typename Task >
+   static std::shared_future<R> start( std::vector<Future> dependencies, Task task );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Pending asynchronous operation on a target operand. */
+   struct Pending {
+      const void* target_;  //!< The address of the target operand.
+      Future      future_;  //!< The completion handle of the operation.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline std::mutex&           mutex();
+   static inline std::vector<Pending>& pending();
+   static inline Future&               previous();
+
+   static inline Future completion( const Future& future );
+
+   template< typename R >
+   static Future completion( const std::shared_future<R>& future );
+
+   template< typename Task >
+   static decltype(auto) execute( Task& task, size_t limit, bool serial );
+
+   template< typename Task >
+   static decltype(auto) run( Task& task );
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts the asynchronous execution of the given task.
+//
+// \param target The address of the target operand (\a nullptr in case of no target operand).
+// \param task The task to be executed asynchronously.
+// \return Handle for the result of the task.
+*/
+template< typename R       // Result type of the task
+        , typename Task >  // Type of the task
+std::shared_future<R> AsyncScheduler::launch( const void* target, Task task )
+{
+   std::lock_guard<std::mutex> lock( mutex() );
+
+   std::vector<Future> dependencies;
+
+   if( previous().valid() ) {
+      dependencies.push_back( previous() );
+   }
+
+   std::vector<Pending>& operations( pending() );
+
+   operations.erase( std::remove_if( operations.begin(), operations.end(),
+                                     []( const Pending& op ) {
+                                        return op.future_.wait_for( std::chrono::seconds( 0 ) ) ==
+                                               std::future_status::ready;
+                                     } ),
+                     operations.end() );
+
+   if( target != nullptr ) {
+      for( const Pending& op : operations ) {
+         if( op.target_ == target )
+            dependencies.push_back( op.future_ );
+      }
+   }
+
+   std::shared_future<R> future( start<R>( std::move( dependencies ), std::move( task ) ) );
+
+   previous() = completion( future );
+
+   if( target != nullptr ) {
+      operations.push_back( Pending{ target, previous() } );
+   }
+
+   return future;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Starts the asynchronous execution of the given task after the given dependencies.
+//
+// \param dependencies The operations to be completed before the execution of the task.
+// \param task The task to be executed asynchronously.
+// \return Handle for the result of the task.
+//
+// In contrast to the launch() function, this function does not track any dependencies on its own.
+// The task is executed with the thread limit and serial section of the calling thread.
+*/
+template< typename R       // Result type of the task
+        , typename Task >  // Type of the task
+std::shared_future<R> AsyncScheduler::start( std::vector<Future> dependencies, Task task )
+{
+   const size_t limit ( getThreadLimit() );
+   const bool   serial( isSerialSectionActive() || isParallelSectionActive() );
+
+   return std::async( std::launch::async, [dependencies, task, limit, serial]() mutable -> R
+   {
+      for( const Future& dependency : dependencies ) {
+         dependency.wait();
+      }
+      dependencies.clear();
+
+      return execute( task, limit, serial );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the mutex protecting the pending asynchronous operations.
+//
+// \return Reference to the synchronization mutex.
+*/
+inline std::mutex& AsyncScheduler::mutex()
+{
+   static std::mutex mtx;
+   return mtx;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the pending asynchronous operations on target operands.
+//
+// \return Reference to the list of pending operations.
+*/
+inline std::vector<AsyncScheduler::Pending>& AsyncScheduler::pending()
+{
+   static std::vector<Pending> operations;
+   return operations;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the last asynchronous operation started by the calling thread.
+//
+// \return Reference to the completion handle of the last operation of the calling thread.
+*/
+inline AsyncScheduler::Future& AsyncScheduler::previous()
+{
+   static thread_local Future future;
+   return future;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the completion handle of an operation without result.
+//
+// \param future The handle of the operation.
+// \return The completion handle of the operation.
+*/
+inline AsyncScheduler::Future AsyncScheduler::completion( const Future& future )
+{
+   return future;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the completion handle of an operation with result.
+//
+// \param future The handle for the result of the operation.
+// \return The completion handle of the operation.
+*/
+template< typename R >  // Result type of the operation
+AsyncScheduler::Future AsyncScheduler::completion( const std::shared_future<R>& future )
+{
+   return std::async( std::launch::deferred, [future]() { future.wait(); } ).share();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given task with the thread limit and serial section of the caller.
+//
+// \param task The task to be executed.
+// \param limit The thread limit of the calling thread (0 if unlimited).
+// \param serial \a true in case the task has to be executed serially, \a false if not.
+// \return The result of the task.
+*/
+template< typename Task >  // Type of the task
+decltype(auto) AsyncScheduler::execute( Task& task, size_t limit, bool serial )
+{
+   if( limit != 0UL ) {
+      ThreadLimit scope( limit );
+      if( serial ) {
+         BLAZE_SERIAL_SECTION {
+            return run( task );
+         }
+      }
+      return run( task );
+   }
+
+   if( serial ) {
+      BLAZE_SERIAL_SECTION {
+         return run( task );
+      }
+   }
+   return run( task );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runs the given task on the active shared memory parallelization.
+//
+// \param task The task to be executed.
+// \return The result of the task.
+//
+// In case the HPX-based parallelization is active, the task is executed as HPX thread.
+*/
+template< typename Task >  // Type of the task
+decltype(auto) AsyncScheduler::run( Task& task )
+{
+#if BLAZE_HPX_PARALLEL_MODE
+   return hpx::threads::run_as_hpx_thread( task );
+#else
+   return task();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS TASKS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Asynchronous assignment of an expression to a target operand.
+// \ingroup smp
+//
+// Views on the target operand and expressions are stored by value, all other operands are stored
+// by reference.
+*/
+template< typename T1    // Type of the target operand
+        , typename T2 >  // Type of the right-hand side operand
+struct AsyncAssignment
+{
+   //**Type definitions****************************************************************************
+   using Target  = If_t< IsView_v<T1>, T1, T1& >;              //!< Storage of the target.
+   using Operand = If_t< IsExpression_v<T2>, const T2, const T2& >;  //!< Storage of the operand.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment.
+   //
+   // \return void
+   */
+   void operator()() {
+      lhs_ = rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Target  lhs_;  //!< The target operand.
+   Operand rhs_;  //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Asynchronous evaluation of an expression.
+// \ingroup smp
+//
+// Expressions are stored by value, all other operands are stored by reference.
+*/
+template< typename T >  // Type of the operand
+struct AsyncEvaluation
+{
+   //**Type definitions****************************************************************************
+   using Operand = If_t< IsExpression_v<T>, const T, const T& >;  //!< Storage of the operand.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the evaluation.
+   //
+   // \return The result of the evaluation.
+   */
+   ResultType_t<T> operator()() {
+      return ResultType_t<T>( operand_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Operand operand_;  //!< The operand to be evaluated.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+std::shared_future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+auto asyncAssign( Matrix<MT1,SO1>&& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsView_v<MT1>, std::shared_future<void> >;
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+std::shared_future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+auto asyncAssign( Vector<VT1,TF1>&& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsView_v<VT1>, std::shared_future<void> >;
+
+template< typename MT, bool SO >
+std::shared_future< ResultType_t<MT> > async( const Matrix<MT,SO>& expr );
+
+template< typename VT, bool TF >
+std::shared_future< ResultType_t<VT> > async( const Vector<VT,TF>& expr );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side matrix (typically a matrix
+// expression) to the given target matrix and immediately returns. The assignment is performed
+// exactly as the synchronous assignment \c lhs \c = \c rhs, i.e. by means of the active shared
+// memory parallelization. The returned handle can be used to wait for the completion of the
+// assignment. Any exception thrown during the assignment is rethrown by its \c get() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   std::shared_future<void> done = blaze::asyncAssign( C, A * B );
+
+   // ... Work that does not involve C
+
+   done.get();  // Waiting for the completion of the assignment
+   \endcode
+
+// The assignment is started after all previous asynchronous operations of the calling thread and
+// all pending asynchronous assignments to the same matrix have been completed. Since the
+// right-hand side expression is created synchronously, its size checks are performed before the
+// function is called. Note that all operands of the right-hand side expression must not be
+// destroyed and that neither the target nor any operand of the right-hand side expression must
+// be modified or accessed synchronously before the assignment has been completed! Also note that
+// in combination with the OpenMP and HPX parallelization the flags of parallel sections are
+// shared by all threads. In this case the calling thread must not perform any other assignment
+// of a vector or matrix expression before all asynchronous operations have been completed, since
+// two concurrent parallel sections would be detected as nested parallel sections.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+std::shared_future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   return AsyncScheduler::launch<void>( &unview( *lhs ), AsyncAssignment<MT1,MT2>{ *lhs, *rhs } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a temporary matrix view.
+// \ingroup smp
+//
+// \param lhs The target temporary view on a matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return Handle for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side matrix to the given temporary
+// view (e.g. a submatrix). The view is copied and the dependencies of the assignment are tracked
+// on the viewed matrix.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+auto asyncAssign( Matrix<MT1,SO1>&& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsView_v<MT1>, std::shared_future<void> >
+{
+   return asyncAssign( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side vector (typically a vector
+// expression) to the given target vector and immediately returns. For more details see the
+// asyncAssign() function for matrices.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+std::shared_future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   return AsyncScheduler::launch<void>( &unview( *lhs ), AsyncAssignment<VT1,VT2>{ *lhs, *rhs } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a temporary vector view.
+// \ingroup smp
+//
+// \param lhs The target temporary view on a vector or matrix.
+// \param rhs The right-hand side vector to be assigned.
+// \return Handle for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side vector to the given temporary
+// view (e.g. a subvector or row). The view is copied and the dependencies of the assignment are
+// tracked on the viewed operand.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+auto asyncAssign( Vector<VT1,TF1>&& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsView_v<VT1>, std::shared_future<void> >
+{
+   return asyncAssign( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given matrix expression.
+// \ingroup smp
+//
+// \param expr The matrix expression to be evaluated.
+// \return Handle for the resulting matrix.
+//
+// This function starts the evaluation of the given matrix expression into a new matrix of the
+// result type of the expression and immediately returns:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+
+   auto result = blaze::async( A * B );
+
+   // ... Work that does not involve A or B
+
+   blaze::DynamicMatrix<double> C( result.get() );
+   \endcode
+
+// The evaluation is started after all previous asynchronous operations of the calling thread
+// have been completed. Note that the operands of the expression must not be destroyed or
+// modified before the evaluation has been completed! For the restrictions in combination with
+// the OpenMP and HPX parallelization see the asyncAssign() function for matrices.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+std::shared_future< ResultType_t<MT> > async( const Matrix<MT,SO>& expr )
+{
+   return AsyncScheduler::launch< ResultType_t<MT> >( nullptr, AsyncEvaluation<MT>{ *expr } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given vector expression.
+// \ingroup smp
+//
+// \param expr The vector expression to be evaluated.
+// \return Handle for the resulting vector.
+//
+// This function starts the evaluation of the given vector expression into a new vector of the
+// result type of the expression and immediately returns. For more details see the async()
+// function for matrices.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+std::shared_future< ResultType_t<VT> > async( const Vector<VT,TF>& expr )
+{
+   return AsyncScheduler::launch< ResultType_t<VT> >( nullptr, AsyncEvaluation<VT>{ *expr } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,477 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/CompressedAssign.h
+//  \brief Header file for the SMP assignment to compressed matrices and vectors
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_COMPRESSEDASSIGN_H_
+#define _BLAZE_MATH_SMP_COMPRESSEDASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given row of a matrix for the SMP assignment to a row-major compressed matrix.
+// \ingroup smp
+//
+// \param A The given matrix.
+// \param k The index of the row.
+// \return View on the row of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline decltype(auto) compressedSlice( const Matrix<MT,SO>& A, size_t k, FalseType )
+{
+   return row( *A, k, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given column of a matrix for the SMP assignment to a column-major compressed
+//        matrix.
+// \ingroup smp
+//
+// \param A The given matrix.
+// \param k The index of the column.
+// \return View on the column of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline decltype(auto) compressedSlice( const Matrix<MT,SO>& A, size_t k, TrueType )
+{
+   return column( *A, k, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the non-zero elements of a dense vector for the SMP assignment to a compressed
+//        matrix or vector.
+// \ingroup smp
+//
+// \param v The dense vector to be assigned.
+// \param tmp The temporary compressed vector (not used).
+// \return The number of non-default elements of the vector.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename TT >  // Type of the temporary compressed vector
+inline auto compressedNonZeros( const DenseVector<VT,TF>& v, TT& tmp )
+   -> DisableIf_t< IsComputation_v<VT>, size_t >
+{
+   MAYBE_UNUSED( tmp );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<(*v).size(); ++i ) {
+      const ElementType_t<TT> value( (*v)[i] );
+      if( !isDefault<strict>( value ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the non-zero elements of a sparse vector for the SMP assignment to a compressed
+//        matrix or vector.
+// \ingroup smp
+//
+// \param v The sparse vector to be assigned.
+// \param tmp The temporary compressed vector (not used).
+// \return The number of non-zero elements of the vector.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag of the sparse vector
+        , typename TT >  // Type of the temporary compressed vector
+inline auto compressedNonZeros( const SparseVector<VT,TF>& v, TT& tmp )
+   -> DisableIf_t< IsComputation_v<VT>, size_t >
+{
+   MAYBE_UNUSED( tmp );
+
+   return (*v).nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the non-zero elements of a vector computation for the SMP assignment to a
+//        compressed matrix or vector.
+// \ingroup smp
+//
+// \param v The vector computation to be assigned.
+// \param tmp The temporary compressed vector for the evaluation of the computation.
+// \return The number of non-zero elements of the vector.
+*/
+template< typename VT    // Type of the vector
+        , bool TF        // Transpose flag of the vector
+        , typename TT >  // Type of the temporary compressed vector
+inline auto compressedNonZeros( const Vector<VT,TF>& v, TT& tmp )
+   -> EnableIf_t< IsComputation_v<VT>, size_t >
+{
+   tmp = *v;
+   return tmp.nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Passes the non-zero elements of a dense vector to the given append function.
+// \ingroup smp
+//
+// \param v The dense vector to be assigned.
+// \param tmp The temporary compressed vector (not used).
+// \param append The function appending a single element to the target.
+// \return void
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag of the dense vector
+        , typename TT      // Type of the temporary compressed vector
+        , typename OP >    // Type of the append function
+inline auto compressedAppend( const DenseVector<VT,TF>& v, TT& tmp, OP append )
+   -> DisableIf_t< IsComputation_v<VT> >
+{
+   MAYBE_UNUSED( tmp );
+
+   for( size_t i=0UL; i<(*v).size(); ++i ) {
+      const ElementType_t<TT> value( (*v)[i] );
+      if( !isDefault<strict>( value ) )
+         append( i, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Passes the non-zero elements of a sparse vector to the given append function.
+// \ingroup smp
+//
+// \param v The sparse vector to be assigned.
+// \param tmp The temporary compressed vector (not used).
+// \param append The function appending a single element to the target.
+// \return void
+*/
+template< typename VT      // Type of the sparse vector
+        , bool TF          // Transpose flag of the sparse vector
+        , typename TT      // Type of the temporary compressed vector
+        , typename OP >    // Type of the append function
+inline auto compressedAppend( const SparseVector<VT,TF>& v, TT& tmp, OP append )
+   -> DisableIf_t< IsComputation_v<VT> >
+{
+   MAYBE_UNUSED( tmp );
+
+   const auto end( (*v).end() );
+   for( auto element=(*v).begin(); element!=end; ++element ) {
+      append( element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Passes the non-zero elements of a vector computation to the given append function.
+// \ingroup smp
+//
+// \param v The vector computation to be assigned.
+// \param tmp The temporary compressed vector for the evaluation of the computation.
+// \param append The function appending a single element to the target.
+// \return void
+*/
+template< typename VT      // Type of the vector
+        , bool TF          // Transpose flag of the vector
+        , typename TT      // Type of the temporary compressed vector
+        , typename OP >    // Type of the append function
+inline auto compressedAppend( const Vector<VT,TF>& v, TT& tmp, OP append )
+   -> EnableIf_t< IsComputation_v<VT> >
+{
+   tmp = *v;
+
+   const auto end( tmp.end() );
+   for( auto element=tmp.begin(); element!=end; ++element ) {
+      append( element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP assignment of a matrix to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param elements The number of elements of the right-hand side matrix to be processed.
+// \return void
+//
+// This function implements the SMP assignment of a matrix to a compressed matrix, which is
+// shared by all parallelization backends. The assignment is performed in two concurrent passes
+// over the rows (or columns) of the right-hand side matrix: The first pass counts the non-zero
+// elements of every row (or column), based on which the storage layout of the target matrix is
+// set up at once. The second pass appends the elements directly into the reserved rows (or
+// columns) of the target matrix. Rows (or columns) of computations are evaluated into a single
+// thread-local compressed vector in both passes. In case the number of elements to be processed
+// is below the SMP compressed matrix assignment threshold, in case the right-hand side is a
+// sparse matrix with a different storage order, or in case the function is called inside a
+// serial section or inside another parallel operation, the assignment is executed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename Tag   // Type tag of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void compressedAssign( CompressedMatrix<Type,SO1,Tag>& lhs, const Matrix<MT2,SO2>& rhs, size_t elements )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( Type );
+
+   using TmpType = CompressedVector<Type,!SO1,Tag>;
+
+   const size_t major( SO1 ? (*rhs).columns() : (*rhs).rows() );
+
+   if( major == 0UL || elements < SMP_SMATASSIGN_THRESHOLD ||
+       ( IsSparseMatrix_v<MT2> && SO1 != SO2 ) ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      assign( lhs, *rhs );
+      return;
+   }
+
+   std::vector<size_t> work( major+1UL );
+   std::vector<size_t> nonzeros( major );
+
+   for( size_t k=0UL; k<=major; ++k ) {
+      work[k] = k;
+   }
+
+   smpLoop( work, [&nonzeros,&rhs]( size_t begin, size_t end )
+   {
+      TmpType tmp;
+
+      for( size_t k=begin; k<end; ++k ) {
+         nonzeros[k] = compressedNonZeros( compressedSlice( *rhs, k, BoolConstant<SO1>() ), tmp );
+      }
+   } );
+
+   lhs.reset();
+   lhs.layout( nonzeros );
+
+   for( size_t k=0UL; k<major; ++k ) {
+      work[k+1UL] = work[k] + nonzeros[k] + 1UL;
+   }
+
+   smpLoop( work, [&lhs,&rhs]( size_t begin, size_t end )
+   {
+      TmpType tmp;
+
+      for( size_t k=begin; k<end; ++k ) {
+         compressedAppend( compressedSlice( *rhs, k, BoolConstant<SO1>() ), tmp,
+                           [&lhs,k]( size_t index, const Type& value )
+         {
+            if( SO1 )
+               lhs.append( index, k, value );
+            else
+               lhs.append( k, index, value );
+         } );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP assignment of a vector to a compressed vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param elements The number of elements of the right-hand side vector to be processed.
+// \return void
+//
+// This function implements the SMP assignment of a vector to a compressed vector, which is
+// shared by all parallelization backends. The right-hand side vector is split into one block
+// per thread and the assignment is performed in two concurrent passes over these blocks: The
+// first pass counts the non-zero elements of every block, based on which the storage of the
+// target vector is set up at once. The second pass stores the elements of every block directly
+// into its reserved range of the target vector. In case the number of elements to be processed
+// is below the SMP compressed vector assignment threshold or in case the function is called
+// inside a serial section or inside another parallel operation, the assignment is executed
+// single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed vector
+        , bool TF        // Transpose flag of the vectors
+        , typename Tag   // Type tag of the left-hand side compressed vector
+        , typename VT2 > // Type of the right-hand side vector
+void compressedAssign( CompressedVector<Type,TF,Tag>& lhs, const Vector<VT2,TF>& rhs, size_t elements )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( Type );
+
+   using TmpType = CompressedVector<Type,TF,Tag>;
+
+   const size_t n( (*rhs).size() );
+   const size_t blocks( min( n, getNumThreads() ) );
+
+   if( blocks <= 1UL || elements < SMP_SVECASSIGN_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      assign( lhs, *rhs );
+      return;
+   }
+
+   const BlockPartition partition( createBlockPartition( n, blocks, 1UL ) );
+
+   std::vector<size_t> work( blocks+1UL );
+   std::vector<size_t> offsets( blocks+1UL );
+
+   for( size_t b=0UL; b<=blocks; ++b ) {
+      work[b] = b;
+   }
+
+   smpLoop( work, [&offsets,&rhs,&partition]( size_t begin, size_t end )
+   {
+      TmpType tmp;
+
+      for( size_t b=begin; b<end; ++b ) {
+         const size_t index( partition.begin(b) );
+         const size_t size ( partition.end(b) - index );
+         offsets[b+1UL] = compressedNonZeros( subvector( *rhs, index, size, unchecked ), tmp );
+      }
+   } );
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      offsets[b+1UL] += offsets[b];
+   }
+
+   lhs.reset();
+   lhs.layout( offsets[blocks] );
+
+   smpLoop( work, [&lhs,&offsets,&rhs,&partition]( size_t begin, size_t end )
+   {
+      TmpType tmp;
+
+      for( size_t b=begin; b<end; ++b )
+      {
+         const size_t index( partition.begin(b) );
+         const size_t size ( partition.end(b) - index );
+         size_t pos( offsets[b] );
+
+         compressedAppend( subvector( *rhs, index, size, unchecked ), tmp,
+                           [&lhs,&pos,index]( size_t i, const Type& value )
+         {
+            lhs.place( pos++, index+i, value );
+         } );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
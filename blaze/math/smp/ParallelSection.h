@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -97,10 +98,19 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+#if BLAZE_THREAD_LOCAL_SECTION_MODE
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the currently
+                                           executed code is inside a parallel section), the flag
+                                           is set to \a true, otherwise it is \a false. Since the
+                                           flag is thread-specific, parallel sections of different
+                                           threads do not affect each other. */
+#else
    static bool active_;  //!< Activity flag for the parallel section.
                          /*!< In case a parallel section is active (i.e. the currently executed
                               code is inside a parallel section), the flag is set to \a true,
                               otherwise it is \a false. */
+#endif
    //@}
    //**********************************************************************************************
 
@@ -123,8 +133,13 @@ class ParallelSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_THREAD_LOCAL_SECTION_MODE
+template< typename T >
+thread_local bool ParallelSection<T>::active_ = false;
+#else
 template< typename T >
 bool ParallelSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
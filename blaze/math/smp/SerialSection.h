@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +90,19 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+#if BLAZE_THREAD_LOCAL_SECTION_MODE
+   static thread_local bool active_;  //!< Activity flag for the serial section.
+                                      /*!< In case a serial section is active (i.e. the currently
+                                           executed code is inside a serial section), the flag
+                                           is set to \a true, otherwise it is \a false. Since the
+                                           flag is thread-specific, serial sections of different
+                                           threads do not affect each other. */
+#else
    static bool active_;  //!< Activity flag for the serial section.
                          /*!< In case a serial section is active (i.e. the currently executed
                               code is inside a serial section), the flag is set to \a true,
                               otherwise it is \a false. */
+#endif
    //@}
    //**********************************************************************************************
 
@@ -115,8 +125,13 @@ class SerialSection
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_THREAD_LOCAL_SECTION_MODE
+template< typename T >
+thread_local bool SerialSection<T>::active_ = false;
+#else
 template< typename T >
 bool SerialSection<T>::active_ = false;
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
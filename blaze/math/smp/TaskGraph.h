@@ -0,0 +1,648 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TaskGraph.h
+//  \brief Header file for the TaskGraph class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_SMP_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/Async.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred evaluation of a batch of assignments.
+// \ingroup smp
+//
+// The TaskGraph class collects a batch of assignments and evaluates them together. Whereas a
+// sequence of statements is evaluated one statement at a time, with every statement using all
+// available threads and ending with a barrier, the statements of a TaskGraph are only ordered
+// by their actual dependencies:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x1, x2, w, y1, y2, z;
+   // ... Resizing and initialization
+
+   blaze::TaskGraph graph;
+   graph.assign( y1, A * x1 );
+   graph.assign( y2, B * x2 );
+   graph.assign( z, trans( A ) * w );
+   graph.addAssign( y1, A * y2 );  // Depends on the first and second statement
+
+   graph.run();
+   \endcode
+
+// On adding a statement, its dependencies on all previously added statements are determined by
+// means of the alias detection of the involved expressions (read-after-write, write-after-read,
+// and write-after-write dependencies on the target operands). During the execution via run(),
+// every statement is evaluated as soon as all its predecessors are completed. Independent
+// statements are evaluated concurrently by the active shared memory parallelization, i.e. the
+// tasks of all independent statements share the threads without any barrier in between. In case
+// the shared memory parallelization is deactivated, only a single thread is available, or run()
+// is called within a serial section, all statements are evaluated serially in the order they
+// have been added. The same applies in combination with the OpenMP and HPX parallelization, which
+// share the flags of parallel sections between all threads and therefore cannot evaluate several
+// statements concurrently. Still, every single statement is evaluated in parallel.
+//
+// A TaskGraph only stores references to its target and right-hand side operands, which therefore
+// must not be destroyed before the last call to run(). Expressions and views are stored by value.
+// Since the right-hand side expressions are created when the statements are added, their size
+// checks are performed at this point. A TaskGraph can be executed repeatedly, for instance once
+// per iteration of an iterative solver.
+*/
+class TaskGraph
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()    const noexcept;
+   inline bool   isEmpty() const noexcept;
+   inline size_t predecessors( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Statement functions*************************************************************************
+   /*!\name Statement functions */
+   //@{
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   auto assign( Matrix<MT1,SO1>&& lhs, const Matrix<MT2,SO2>& rhs ) -> EnableIf_t< IsView_v<MT1> >;
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   auto assign( Vector<VT1,TF1>&& lhs, const Vector<VT2,TF2>& rhs ) -> EnableIf_t< IsView_v<VT1> >;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void addAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void subAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Execution functions*************************************************************************
+   /*!\name Execution functions */
+   //@{
+   inline void run();
+   inline void clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Placeholder for a type-erased target operand in the alias detection.
+   //
+   // The alias detection of all vectors, matrices, views, and expressions only compares the
+   // address of the given alias with the address of the (unviewed) operands. Therefore the
+   // address of a type-erased target operand is passed as pointer to an AliasProbe, which is
+   // never dereferenced.
+   */
+   struct AliasProbe : public Matrix<AliasProbe,false> {};
+
+   //! Assignment operation.
+   struct Assign {
+      template< typename T1, typename T2 >
+      static void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+   };
+
+   //! Addition assignment operation.
+   struct AddAssign {
+      template< typename T1, typename T2 >
+      static void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+   };
+
+   //! Subtraction assignment operation.
+   struct SubAssign {
+      template< typename T1, typename T2 >
+      static void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+   };
+
+   //! Base class for all statements of a task graph.
+   struct Node {
+      explicit Node( const void* target ) : target_( target ), predecessors_() {}
+      virtual ~Node() = default;
+
+      virtual void execute() = 0;
+      virtual bool reads( const AliasProbe* operand ) const = 0;
+
+      const void*         target_;        //!< The address of the (unviewed) target operand.
+      std::vector<size_t> predecessors_;  //!< The indices of all predecessor statements.
+   };
+
+   //! Statement of a task graph.
+   template< typename OP, typename T1, typename T2 >
+   struct Statement : public Node {
+      using Target  = If_t< IsView_v<T1>, T1, T1& >;                    //!< Storage of the target.
+      using Operand = If_t< IsExpression_v<T2>, const T2, const T2& >;  //!< Storage of the operand.
+
+      Statement( T1& lhs, const T2& rhs ) : Node( &unview( lhs ) ), lhs_( lhs ), rhs_( rhs ) {}
+
+      void execute() override { OP::apply( lhs_, rhs_ ); }
+      bool reads( const AliasProbe* operand ) const override { return rhs_.isAliased( operand ); }
+
+      Target  lhs_;  //!< The target operand.
+      Operand rhs_;  //!< The right-hand side operand.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename T1, typename T2 >
+   void add( T1& lhs, const T2& rhs );
+
+   inline void runSerial();
+
+   static inline const AliasProbe* probe( const void* address ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector< std::unique_ptr<Node> > nodes_;  //!< The statements of the task graph.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for TaskGraph.
+*/
+inline TaskGraph::TaskGraph()
+   : nodes_()  // The statements of the task graph
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of statements of the task graph.
+//
+// \return The number of statements.
+*/
+inline size_t TaskGraph::size() const noexcept
+{
+   return nodes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task graph contains no statements.
+//
+// \return \a true in case the task graph is empty, \a false if not.
+*/
+inline bool TaskGraph::isEmpty() const noexcept
+{
+   return nodes_.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of direct predecessors of the specified statement.
+//
+// \param index The index of the statement in the order of addition.
+// \return The number of statements that have to be completed before the specified statement.
+// \exception std::invalid_argument Invalid statement index.
+*/
+inline size_t TaskGraph::predecessors( size_t index ) const
+{
+   if( index >= nodes_.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid statement index" );
+   }
+
+   return nodes_[index]->predecessors_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds the assignment of a matrix to a matrix to the task graph.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void TaskGraph::assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   add<Assign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the assignment of a matrix to a temporary matrix view to the task graph.
+//
+// \param lhs The target temporary view on a matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+auto TaskGraph::assign( Matrix<MT1,SO1>&& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsView_v<MT1> >
+{
+   add<Assign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the assignment of a vector to a vector to the task graph.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void TaskGraph::assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   add<Assign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the assignment of a vector to a temporary vector view to the task graph.
+//
+// \param lhs The target temporary view on a vector or matrix.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+auto TaskGraph::assign( Vector<VT1,TF1>&& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsView_v<VT1> >
+{
+   add<Assign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the addition assignment of a matrix to a matrix to the task graph.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void TaskGraph::addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   add<AddAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the addition assignment of a vector to a vector to the task graph.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void TaskGraph::addAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   add<AddAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the subtraction assignment of a matrix to a matrix to the task graph.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void TaskGraph::subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   add<SubAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds the subtraction assignment of a vector to a vector to the task graph.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void TaskGraph::subAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   add<SubAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates all statements of the task graph.
+//
+// \return void
+//
+// This function evaluates all statements of the task graph and returns as soon as all statements
+// have been completed. In case the evaluation of a statement throws an exception, all dependent
+// statements are skipped and the first exception (in the order of addition) is rethrown after
+// all other statements have been completed.
+*/
+inline void TaskGraph::run()
+{
+   if( nodes_.size() < 2UL || getNumThreads() < 2UL || !BLAZE_THREAD_LOCAL_SECTION_MODE ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      runSerial();
+      return;
+   }
+
+   std::vector< std::shared_future<void> > futures;
+   futures.reserve( nodes_.size() );
+
+   for( const std::unique_ptr<Node>& node : nodes_ )
+   {
+      std::vector< std::shared_future<void> > dependencies;
+      dependencies.reserve( node->predecessors_.size() );
+
+      for( size_t index : node->predecessors_ ) {
+         dependencies.push_back( futures[index] );
+      }
+
+      Node* const statement( node.get() );
+
+      futures.push_back( AsyncScheduler::start<void>( {}, [statement, dependencies]()
+      {
+         for( const std::shared_future<void>& dependency : dependencies ) {
+            dependency.get();
+         }
+         statement->execute();
+      } ) );
+   }
+
+   for( const std::shared_future<void>& future : futures ) {
+      future.wait();
+   }
+
+   for( const std::shared_future<void>& future : futures ) {
+      future.get();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all statements from the task graph.
+//
+// \return void
+*/
+inline void TaskGraph::clear()
+{
+   nodes_.clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adds a statement to the task graph and determines its dependencies.
+//
+// \param lhs The target operand.
+// \param rhs The right-hand side operand.
+// \return void
+//
+// The new statement depends on every previously added statement that writes to the same target
+// operand, that writes to an operand of the new right-hand side expression, or that reads the
+// new target operand.
+*/
+template< typename OP    // Type of the assignment operation
+        , typename T1    // Type of the target operand
+        , typename T2 >  // Type of the right-hand side operand
+void TaskGraph::add( T1& lhs, const T2& rhs )
+{
+   std::unique_ptr<Node> node( new Statement<OP,T1,T2>( lhs, rhs ) );
+
+   for( size_t i=0UL; i<nodes_.size(); ++i )
+   {
+      const Node& previous( *nodes_[i] );
+
+      if( previous.target_ == node->target_ ||
+          rhs.isAliased( probe( previous.target_ ) ) ||
+          previous.reads( probe( node->target_ ) ) ) {
+         node->predecessors_.push_back( i );
+      }
+   }
+
+   nodes_.push_back( std::move( node ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates all statements of the task graph serially in the order of addition.
+//
+// \return void
+//
+// In case the evaluation of a statement throws an exception, all dependent statements are skipped
+// and the first exception is rethrown after all other statements have been completed.
+*/
+inline void TaskGraph::runSerial()
+{
+   std::vector<bool> failed( nodes_.size(), false );
+   std::exception_ptr error;
+
+   for( size_t i=0UL; i<nodes_.size(); ++i )
+   {
+      const std::vector<size_t>& predecessors( nodes_[i]->predecessors_ );
+
+      if( std::any_of( predecessors.begin(), predecessors.end(),
+                       [&failed]( size_t index ) { return failed[index]; } ) ) {
+         failed[i] = true;
+         continue;
+      }
+
+      try {
+         nodes_[i]->execute();
+      }
+      catch( ... ) {
+         failed[i] = true;
+         if( !error ) error = std::current_exception();
+      }
+   }
+
+   if( error ) {
+      std::rethrow_exception( error );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the address of a type-erased target operand for the alias detection.
+//
+// \param address The address of the target operand.
+// \return Pointer to an alias probe with the given address.
+*/
+inline const TaskGraph::AliasProbe* TaskGraph::probe( const void* address ) noexcept
+{
+   return static_cast<const AliasProbe*>( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadLimit.h
+//  \brief Header file for the thread limit implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADLIMIT_H_
+#define _BLAZE_MATH_SMP_THREADLIMIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope to limit the number of threads used for the operations of the calling thread.
+// \ingroup smp
+//
+// The ThreadLimit class limits the number of threads used for all operations executed by the
+// calling thread within the lifetime of a ThreadLimit object. In contrast to the setNumThreads()
+// function, the total number of threads as well as the operations of all other threads are not
+// affected. This for instance enables several application threads to evaluate expressions
+// concurrently, each of them with a fixed share of the available threads:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   {
+      blaze::ThreadLimit limit( 2UL );
+
+      C = A * B;  // Executed with at most two threads
+   }
+
+   C = A * B;  // Executed with all available threads
+   \endcode
+
+// ThreadLimit objects can be nested. A nested ThreadLimit can only lower, but never raise the
+// number of threads of an enclosing ThreadLimit. Upon destruction the previous limit is restored.
+// In case the shared memory parallelization is deactivated, a ThreadLimit has no effect.
+*/
+class ThreadLimit
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ThreadLimit( size_t number );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadLimit();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t limit() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t previous_;  //!< The previous thread limit of the calling thread.
+   size_t limit_;     //!< The active thread limit of the calling thread.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadLimit class.
+//
+// \param number The maximum number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+inline ThreadLimit::ThreadLimit( size_t number )
+   : previous_( getThreadLimit() )  // The previous thread limit of the calling thread
+   , limit_   ( number )            // The active thread limit of the calling thread
+{
+   if( number == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( previous_ != 0UL ) {
+      limit_ = min( previous_, number );
+   }
+
+   setThreadLimit( limit_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the ThreadLimit class.
+//
+// The destructor restores the previous thread limit of the calling thread.
+*/
+inline ThreadLimit::~ThreadLimit()
+{
+   setThreadLimit( previous_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the active thread limit.
+//
+// \return The maximum number of threads for the operations of the calling thread.
+*/
+inline size_t ThreadLimit::limit() const noexcept
+{
+   return limit_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,12 +40,22 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstdint>
 #include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/shims/Round.h>
 #include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/Types.h>
 
 
@@ -114,6 +124,308 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a work-balanced 1D partitioning of an index range.
+// \ingroup smp
+//
+// \param partitions The maximum number of partitions.
+// \param work The accumulated work of the index range.
+// \return The boundaries of the partitions.
+//
+// This function splits the index range \f$ [0..N) \f$ into at most \a partitions contiguous
+// partitions of approximately equal work. The given vector \a work has to contain \f$ N+1 \f$
+// non-decreasing values, where \a work[i] represents the accumulated work of the first \a i
+// indices (i.e. \a work[0] is 0 and \a work[N] is the total work). The function returns the
+// \f$ P+1 \f$ boundaries of the resulting \f$ P \f$ non-empty partitions, where the \a p-th
+// partition covers the index range \f$ [bounds[p]..bounds[p+1]) \f$.
+*/
+inline std::vector<size_t> createWorkPartitions( size_t partitions, const std::vector<size_t>& work )
+{
+   BLAZE_INTERNAL_ASSERT( partitions > 0UL, "Invalid number of partitions detected" );
+   BLAZE_INTERNAL_ASSERT( !work.empty()   , "Invalid work vector detected"          );
+
+   const size_t N( work.size() - 1UL );
+   const size_t total( work[N] );
+
+   std::vector<size_t> bounds;
+   bounds.reserve( partitions + 1UL );
+   bounds.push_back( 0UL );
+
+   for( size_t p=1UL; p<partitions; ++p )
+   {
+      const size_t target( ( total / partitions ) * p + ( ( total % partitions ) * p ) / partitions );
+      const auto pos( std::lower_bound( work.begin() + bounds.back(), work.end() - 1L, target ) );
+      const size_t index( static_cast<size_t>( pos - work.begin() ) );
+
+      if( index > bounds.back() && index < N ) {
+         bounds.push_back( index );
+      }
+   }
+
+   bounds.push_back( N );
+
+   return bounds;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK PARTITIONING FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of an index range into contiguous blocks.
+// \ingroup smp
+//
+// The BlockPartition class represents the partitioning of the index range \f$ [0..size) \f$ into
+// \a blocks contiguous blocks. Except for the first block, the \a i-th block starts at the index
+// \f$ offset + i \cdot step \f$, which allows to align all block boundaries to cache lines. The
+// first block always starts at index 0 and the last block always ends at index \a size. Blocks
+// beyond the end of the index range are empty.
+*/
+struct BlockPartition
+{
+   //**********************************************************************************************
+   /*!\brief Returns the first index of the given block.
+   //
+   // \param block The index of the block.
+   // \return The first index of the block.
+   */
+   inline size_t begin( size_t block ) const noexcept {
+      return ( block == 0UL )?( 0UL ):( min( size, offset + block*step ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the index one past the last index of the given block.
+   //
+   // \param block The index of the block.
+   // \return The index one past the last index of the block.
+   */
+   inline size_t end( size_t block ) const noexcept {
+      return ( block+1UL >= blocks )?( size ):( begin( block+1UL ) );
+   }
+   //**********************************************************************************************
+
+   size_t size;    //!< The size of the partitioned index range.
+   size_t blocks;  //!< The number of blocks.
+   size_t step;    //!< The distance between two consecutive block boundaries.
+   size_t offset;  //!< The offset of the block boundaries.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D partitioning of a matrix into blocks.
+// \ingroup smp
+*/
+struct MatrixPartition
+{
+   BlockPartition rows;     //!< The partitioning of the rows of the matrix.
+   BlockPartition columns;  //!< The partitioning of the columns of the matrix.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 1D partitioning of an index range.
+// \ingroup smp
+//
+// \param size The size of the index range.
+// \param blocks The number of blocks.
+// \param granularity The granularity of the block boundaries.
+// \param offset The offset of the block boundaries \f$ [0..granularity) \f$.
+// \return The partitioning of the index range.
+//
+// This function splits the index range \f$ [0..size) \f$ into \a blocks blocks of approximately
+// equal size. All block boundaries (except for 0 and \a size) are placed at \f$ offset + k \cdot
+// granularity \f$.
+*/
+inline BlockPartition createBlockPartition( size_t size, size_t blocks, size_t granularity, size_t offset = 0UL )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL        , "Invalid number of blocks detected" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL   , "Invalid granularity detected"      );
+   BLAZE_INTERNAL_ASSERT( offset < granularity, "Invalid offset detected"           );
+
+   const size_t addon     ( ( ( size % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( size / blocks + addon );
+   const size_t rest      ( equalShare % granularity );
+   const size_t step      ( ( rest )?( equalShare - rest + granularity ):( equalShare ) );
+
+   return BlockPartition{ size, blocks, step, offset };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements from the given address to the next cache line boundary.
+// \ingroup smp
+//
+// \param ptr The address of the first element.
+// \param granularity The required granularity of the offset.
+// \return The number of elements to the next cache line boundary.
+//
+// In case the next cache line boundary is not a multiple of \a granularity elements away from
+// the given address, the function returns 0.
+*/
+template< typename Type >  // Type of the elements
+size_t cacheLineOffset( const Type* ptr, size_t granularity ) noexcept
+{
+   const size_t address( static_cast<size_t>( reinterpret_cast<std::uintptr_t>( ptr ) ) );
+   const size_t bytes  ( ( cacheLineSize - address % cacheLineSize ) % cacheLineSize );
+   const size_t offset ( bytes / sizeof(Type) );
+
+   if( bytes % sizeof(Type) != 0UL || offset % granularity != 0UL )
+      return 0UL;
+
+   return offset;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a cache line aligned 2D partitioning of a dense matrix.
+// \ingroup smp
+//
+// \param partitions The total number of partitions.
+// \param lhs The target dense matrix of the parallel operation.
+// \param rhs The right-hand side matrix of the parallel operation.
+// \param simdEnabled \a true in case the operation is vectorized, \a false if not.
+// \return The partitioning of the target matrix.
+//
+// This function creates a 2D partitioning of the target matrix \a lhs of a parallel operation,
+// which is shared by all parallelization backends. Based on the 2D mapping of the partitions
+// (see createThreadMapping()), the rows and columns of the matrix are split into blocks such
+// that the block boundaries are aligned to cache lines. Within a single row of a row-major
+// matrix (column of a column-major matrix) the boundaries are aligned relative to the address
+// of the matrix. Across rows (columns) the boundaries are aligned with respect to the spacing
+// of the matrix, i.e. are placed at rows (columns) that start at a cache line boundary. In
+// vectorized operations all boundaries additionally are multiples of the SIMD width.
+//
+// In case the \c BLAZE_USE_PADDING_AWARE_PARTITIONING switch is active and the spacing of the
+// matrix is not a multiple of the cache line size, the matrix is only split along its rows
+// (row-major) or columns (column-major), which avoids split cache lines entirely.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+MatrixPartition createMatrixPartition( size_t partitions, const DenseMatrix<MT1,SO1>& lhs,
+                                       const Matrix<MT2,SO2>& rhs, bool simdEnabled )
+{
+   using ET = ElementType_t<MT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool alignable( cacheLineSize % sizeof(ET) == 0UL );
+
+   const ThreadMapping threads( createThreadMapping( partitions, *rhs ) );
+
+   size_t majorBlocks( SO1 ? threads.second : threads.first  );
+   size_t minorBlocks( SO1 ? threads.first  : threads.second );
+
+   const size_t simdGranularity( simdEnabled ? SIMDSIZE : 1UL );
+   size_t majorGranularity( simdGranularity ), majorOffset( 0UL );
+   size_t minorGranularity( simdGranularity ), minorOffset( 0UL );
+
+   const size_t stride( (*lhs).spacing() * sizeof(ET) );
+
+   if( alignable )
+   {
+      const ET* const ptr( (*lhs).data() );
+
+      minorGranularity = max( simdGranularity, cacheLineSize / sizeof(ET) );
+      minorOffset = cacheLineOffset( ptr, simdGranularity );
+
+      const size_t phase( stride % cacheLineSize );
+
+      if( phase != 0UL )
+      {
+         const size_t period( cacheLineSize / ( phase & ( ~phase + 1UL ) ) );
+         const size_t address( static_cast<size_t>( reinterpret_cast<std::uintptr_t>( ptr ) ) );
+
+         majorGranularity = max( simdGranularity, period );
+
+         for( size_t i=0UL; i<period; i+=simdGranularity ) {
+            if( ( address + i*stride ) % cacheLineSize == 0UL ) {
+               majorOffset = i;
+               break;
+            }
+         }
+      }
+   }
+
+#if BLAZE_USE_PADDING_AWARE_PARTITIONING
+   if( !alignable || stride % cacheLineSize != 0UL ) {
+      majorBlocks *= minorBlocks;
+      minorBlocks  = 1UL;
+   }
+#endif
+
+   const BlockPartition major( createBlockPartition( SO1 ? (*lhs).columns() : (*lhs).rows(),
+                                                     majorBlocks, majorGranularity, majorOffset ) );
+   const BlockPartition minor( createBlockPartition( SO1 ? (*lhs).rows() : (*lhs).columns(),
+                                                     minorBlocks, minorGranularity, minorOffset ) );
+
+   return SO1 ? MatrixPartition{ minor, major } : MatrixPartition{ major, minor };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a cache line aligned 1D partitioning of a dense vector.
+// \ingroup smp
+//
+// \param partitions The total number of partitions.
+// \param lhs The target dense vector of the parallel operation.
+// \param simdEnabled \a true in case the operation is vectorized, \a false if not.
+// \return The partitioning of the target vector.
+//
+// This function creates a 1D partitioning of the target vector \a lhs of a parallel operation,
+// which is shared by all parallelization backends. The block boundaries are aligned to cache
+// lines relative to the address of the vector and in vectorized operations additionally are
+// multiples of the SIMD width.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , bool TF >    // Transpose flag of the left-hand side dense vector
+BlockPartition createVectorPartition( size_t partitions, const DenseVector<VT,TF>& lhs, bool simdEnabled )
+{
+   using ET = ElementType_t<VT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool alignable( cacheLineSize % sizeof(ET) == 0UL );
+
+   const size_t simdGranularity( simdEnabled ? SIMDSIZE : 1UL );
+
+   if( !alignable ) {
+      return createBlockPartition( (*lhs).size(), partitions, simdGranularity );
+   }
+
+   const size_t granularity( max( simdGranularity, cacheLineSize / sizeof(ET) ) );
+   const size_t offset( cacheLineOffset( (*lhs).data(), simdGranularity ) );
+
+   return createBlockPartition( (*lhs).size(), partitions, granularity, offset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
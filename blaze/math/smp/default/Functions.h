@@ -130,6 +130,41 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread limit of the calling thread.
+// \ingroup smp
+//
+// \return The maximum number of threads for the operations of the calling thread (0 if unlimited).
+//
+// Note that in case no parallelization is active the function will always return 0.
+*/
+BLAZE_ALWAYS_INLINE size_t getThreadLimit()
+{
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for the operations of the calling thread.
+// \ingroup smp
+//
+// \param number The maximum number of threads for the operations of the calling thread.
+// \return void
+//
+// Note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadLimit( size_t number )
+{
+   MAYBE_UNUSED( number );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
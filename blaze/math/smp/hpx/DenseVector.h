@@ -45,8 +45,8 @@
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
-#include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
@@ -54,7 +54,6 @@
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -108,25 +107,21 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP o
    using ET2 = ElementType_t<VT2>;
 
    constexpr bool simdEnabled( VT1::simdEnabled && VT2::simdEnabled && IsSIMDCombinable_v<ET1,ET2> );
-   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<VT1> >::size );
 
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const size_t threads      ( getNumThreads() );
-   const size_t addon        ( ( ( (*lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (*lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t threads( getNumThreads() );
+   const BlockPartition partition( createVectorPartition( threads, *lhs, simdEnabled ) );
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( partition.begin( i ) );
 
       if( index >= (*lhs).size() )
          return;
 
-      const size_t size( min( sizePerThread, (*lhs).size() - index ) );
+      const size_t size( partition.end( i ) - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( *lhs, index, size, unchecked ) );
@@ -188,18 +183,17 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP
 
    BLAZE_FUNCTION_TRACE;
 
-   const size_t threads      ( getNumThreads() );
-   const size_t addon        ( ( ( (*lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (*lhs).size() / threads + addon );
+   const size_t threads( getNumThreads() );
+   const BlockPartition partition( createVectorPartition( threads, *lhs, false ) );
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( partition.begin( i ) );
 
-      if( index < (*lhs).size() )
+      if( index >= (*lhs).size() )
          return;
 
-      const size_t size( min( sizePerThread, (*lhs).size() - index ) );
+      const size_t size( partition.end( i ) - index );
       auto       target( subvector<unaligned>( *lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
       op( target, source );
@@ -50,6 +50,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -62,6 +63,22 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the thread limit of the calling thread.
+// \ingroup smp
+//
+// \return Reference to the thread limit of the calling thread (0 if unlimited).
+*/
+BLAZE_ALWAYS_INLINE size_t& threadLimit()
+{
+   static thread_local size_t limit( 0UL );
+   return limit;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the number of threads used for HPX parallel operations.
@@ -71,11 +88,50 @@ namespace blaze {
 //
 // Via this function the number of threads used for HPX parallel operations can be queried. The
 // function generally reflects the number of threads as set by the \c --hpx::threads environment
-// variable.
+// variable. In case the calling thread has limited the number of threads (see the setThreadLimit()
+// function), the function returns the given limit.
 */
 BLAZE_ALWAYS_INLINE size_t getNumThreads()
 {
-   return 4 * hpx::get_os_thread_count();
+   const size_t threads( 4 * hpx::get_os_thread_count() );
+   const size_t limit( threadLimit() );
+
+   return ( limit == 0UL ? threads : min( threads, limit ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread limit of the calling thread.
+// \ingroup smp
+//
+// \return The maximum number of threads for the operations of the calling thread (0 if unlimited).
+*/
+BLAZE_ALWAYS_INLINE size_t getThreadLimit()
+{
+   return threadLimit();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for the operations of the calling thread.
+// \ingroup smp
+//
+// \param number The maximum number of threads for the operations of the calling thread.
+// \return void
+//
+// This function limits the number of tasks an HPX parallel operation of the calling thread is
+// split into and with that the number of concurrently working HPX threads. The operations of
+// all other threads are not affected. The value 0 removes the limit.
+*/
+BLAZE_ALWAYS_INLINE void setThreadLimit( size_t number )
+{
+   threadLimit() = number;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/hpx/Reduction.h
+//  \brief Header file for the HPX-based SMP reduction implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_HPX_REDUCTION_H_
+#define _BLAZE_MATH_SMP_HPX_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  HPX-BASED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the HPX-based SMP reduction.
+// \ingroup smp
+//
+// \param n The total number of elements to be reduced.
+// \param alignment The alignment of the partition boundaries.
+// \param kernel The serial reduction kernel.
+// \param op The reduction operation for the combination of the partial results.
+// \return The result of the reduction.
+//
+// This function is the backend implementation of the HPX-based SMP reduction. It
+// partitions the index range \f$ [0..n) \f$ into contiguous partitions, whose boundaries are
+// multiples of the given \a alignment. For every partition the serial \a kernel is called with
+// the index of the first element and the size of the partition (\a kernel(index,size)) and
+// computes the according partial result. Every partial result is stored in its own slot and all
+// partial results are finally combined by the calling thread via \a op in the order of the
+// partitions. Therefore the result of the reduction does not depend on the scheduling of the
+// HPX threads, but only on the number of partitions. In case the function is called inside a
+// serial section, the kernel is called for the entire index range.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Kernel  // Type of the serial reduction kernel
+        , typename OP >    // Type of the reduction operation
+auto smpReduce( size_t n, size_t alignment, Kernel kernel, OP op )
+   -> RemoveCVRef_t< decltype( kernel( size_t(), size_t() ) ) >
+{
+#if HPX_VERSION_FULL < 0x010800
+   using hpx::for_loop;
+   using hpx::execution::par;
+#else
+   using hpx::experimental::for_loop;
+   using hpx::execution::par;
+#endif
+
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL, "Invalid partition alignment detected" );
+
+   using RT = RemoveCVRef_t< decltype( kernel( size_t(), size_t() ) ) >;
+
+   if( n == 0UL || isSerialSectionActive() )
+      return kernel( 0UL, n );
+
+   const size_t threads      ( getNumThreads() );
+   const size_t addon        ( ( ( n % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( n / threads + addon );
+   const size_t rest         ( equalShare % alignment );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
+   const size_t partitions   ( ( n - 1UL ) / sizePerThread + 1UL );
+
+   if( partitions == 1UL )
+      return kernel( 0UL, n );
+
+   std::unique_ptr<RT[]> results( new RT[partitions] );
+
+   for_loop( par, size_t(0), partitions, [&](int i)
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, n - index ) );
+
+      results[i] = kernel( index, size );
+   } );
+
+   RT result( std::move( results[0UL] ) );
+
+   for( size_t i=1UL; i<partitions; ++i ) {
+      result = op( result, results[i] );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_HPX_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,7 +46,6 @@
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
@@ -56,7 +55,6 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -104,35 +102,27 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    using ET2 = ElementType_t<MT2>;
 
    constexpr bool simdEnabled( MT1::simdEnabled && MT2::simdEnabled && IsSIMDCombinable_v<ET1,ET2> );
-   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT1> >::size );
 
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
    const int threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, *rhs ) );
-
-   const size_t addon1     ( ( ( (*rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (*rhs).rows() / threadmap.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (*rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (*rhs).columns() / threadmap.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const MatrixPartition partition( createMatrixPartition( threads, *lhs, *rhs, simdEnabled ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0; i<threads; ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i1( i / partition.columns.blocks );
+      const size_t i2( i % partition.columns.blocks );
+
+      const size_t row   ( partition.rows.begin( i1 ) );
+      const size_t column( partition.columns.begin( i2 ) );
 
       if( row >= (*rhs).rows() || column >= (*rhs).columns() )
          continue;
 
-      const size_t m( min( rowsPerThread, (*rhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
+      const size_t m( partition.rows.end( i1 )    - row    );
+      const size_t n( partition.columns.end( i2 ) - column );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( submatrix<aligned>( *lhs, row, column, m, n ) );
@@ -189,25 +179,22 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
    const size_t threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, *rhs ) );
-
-   const size_t addon1       ( ( ( (*rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (*rhs).rows() / threadmap.first + addon1 );
-
-   const size_t addon2       ( ( ( (*rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (*rhs).columns() / threadmap.second + addon2 );
+   const MatrixPartition partition( createMatrixPartition( threads, *lhs, *rhs, false ) );
 
 #pragma omp for schedule(dynamic,1) nowait
    for( size_t i=0; i<threads; ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t i1( i / partition.columns.blocks );
+      const size_t i2( i % partition.columns.blocks );
+
+      const size_t row   ( partition.rows.begin( i1 ) );
+      const size_t column( partition.columns.begin( i2 ) );
 
       if( row >= (*rhs).rows() || column >= (*rhs).columns() )
          continue;
 
-      const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (*lhs).columns() - column ) );
+      const size_t m( partition.rows.end( i1 )    - row    );
+      const size_t n( partition.columns.end( i2 ) - column );
 
       auto       target( submatrix<unaligned>( *lhs, row, column, m, n ) );
       const auto source( submatrix<unaligned>( *rhs, row, column, m, n ) );
@@ -100,6 +100,46 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread limit of the calling thread.
+// \ingroup smp
+//
+// \return The maximum number of threads for the operations of the calling thread (0 if unlimited).
+//
+// This function returns the number of threads used for the OpenMP parallel regions started by
+// the calling thread. Note that this number is specific to the calling thread.
+*/
+BLAZE_ALWAYS_INLINE size_t getThreadLimit()
+{
+   return omp_get_max_threads();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for the operations of the calling thread.
+// \ingroup smp
+//
+// \param number The maximum number of threads for the operations of the calling thread.
+// \return void
+//
+// This function limits the number of threads used for the OpenMP parallel regions started by the
+// calling thread. Since the number of threads of OpenMP is a thread-specific setting, the parallel
+// regions of all other threads are not affected. The value 0 is ignored.
+*/
+BLAZE_ALWAYS_INLINE void setThreadLimit( size_t number )
+{
+   if( number > 0UL ) {
+      omp_set_num_threads( static_cast<int>( number ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -44,7 +44,6 @@
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
@@ -55,7 +54,6 @@
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -103,39 +101,28 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    using ET2 = ElementType_t<MT2>;
 
    constexpr bool simdEnabled( MT1::simdEnabled && MT2::simdEnabled && IsSIMDCombinable_v<ET1,ET2> );
-   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT1> >::size );
 
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), *rhs ) );
+   const MatrixPartition partition( createMatrixPartition( TheThreadBackend::partitions(), *lhs, *rhs, simdEnabled ) );
 
-   const size_t addon1     ( ( ( (*rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (*rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (*rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (*rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i<partition.rows.blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.rows.begin( i ) );
 
       if( row >= (*lhs).rows() )
          continue;
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j<partition.columns.blocks; ++j )
       {
-         const size_t column( j*colsPerThread );
+         const size_t column( partition.columns.begin( j ) );
 
          if( column >= (*rhs).columns() )
             continue;
 
-         const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
+         const size_t m( partition.rows.end( i )    - row    );
+         const size_t n( partition.columns.end( j ) - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto       target( submatrix<aligned>( *lhs, row, column, m, n, unchecked ) );
@@ -195,30 +182,24 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), *rhs ) );
-
-   const size_t addon1       ( ( ( (*rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (*rhs).rows() / threads.first + addon1 );
+   const MatrixPartition partition( createMatrixPartition( TheThreadBackend::partitions(), *lhs, *rhs, false ) );
 
-   const size_t addon2       ( ( ( (*rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (*rhs).columns() / threads.second + addon2 );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i<partition.rows.blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.rows.begin( i ) );
 
       if( row >= (*lhs).rows() )
          continue;
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j<partition.columns.blocks; ++j )
       {
-         const size_t column( j*colsPerThread );
+         const size_t column( partition.columns.begin( j ) );
 
          if( column >= (*lhs).columns() )
             continue;
 
-         const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (*lhs).columns() - column ) );
+         const size_t m( partition.rows.end( i )    - row    );
+         const size_t n( partition.columns.end( j ) - column );
 
          auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
@@ -646,6 +627,111 @@ inline auto smpMultAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
 
 
 
+//=================================================================================================
+//
+//  PARALLEL CONSTRUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based construction of the elements of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix with uninitialized elements.
+// \param value The initial value of all elements.
+// \return void
+//
+// This function constructs all elements of the given dense matrix with uninitialized elements,
+// including all padding elements, in parallel. The matrix is partitioned exactly as in an SMP
+// assignment of a matrix of the same type (including the choice of the SIMD granularity) and the
+// blocks are scheduled in the same order. Therefore in NUMA mode every block is initialized (and
+// its memory pages are first touched) by the same thread that processes the block in all
+// subsequent SMP assignments. All padding elements are default constructed. The matrix has to
+// provide direct access to its elements via the \c data() and \c spacing() functions and its
+// element type must be nothrow constructible.\n
+// This function must \b NOT be called explicitly! It is used internally for the construction
+// of dense matrices. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void smpConstruct( DenseMatrix<MT,SO>& lhs, const ElementType_t<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   MT& A( *lhs );
+
+   const size_t M( SO ? A.columns() : A.rows()    );
+   const size_t N( SO ? A.rows()    : A.columns() );
+   const size_t spacing( A.spacing() );
+
+   auto construct = [&A,&value,N,spacing]( size_t rowBegin, size_t rowEnd,
+                                          size_t colBegin, size_t colEnd )
+   {
+      const size_t end( ( colEnd == N )?( spacing ):( colEnd ) );
+
+      for( size_t i=rowBegin; i<rowEnd; ++i ) {
+         ET* const ptr( A.data(i) );
+         for( size_t j=colBegin; j<end; ++j ) {
+            if( j < N ) ::new( ptr+j ) ET( value );
+            else ::new( ptr+j ) ET();
+         }
+      }
+   };
+
+   if( isSerialSectionActive() || isParallelSectionActive() || M == 0UL || N == 0UL ) {
+      construct( 0UL, M, 0UL, N );
+      return;
+   }
+
+   constexpr bool simdEnabled( MT::simdEnabled && IsSIMDCombinable_v<ET,ET> );
+
+   const MatrixPartition partition( createMatrixPartition( TheThreadBackend::partitions(), A, A, simdEnabled ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<partition.rows.blocks; ++i )
+      {
+         const size_t row( partition.rows.begin( i ) );
+
+         if( row >= A.rows() )
+            continue;
+
+         for( size_t j=0UL; j<partition.columns.blocks; ++j )
+         {
+            const size_t column( partition.columns.begin( j ) );
+
+            if( column >= A.columns() )
+               continue;
+
+            const size_t rowEnd( partition.rows.end( i ) );
+            const size_t colEnd( partition.columns.end( j ) );
+
+            if( SO ) {
+               TheThreadBackend::schedule( [&construct,row,rowEnd,column,colEnd]() {
+                  construct( column, colEnd, row, rowEnd );
+               } );
+            }
+            else {
+               TheThreadBackend::schedule( [&construct,row,rowEnd,column,colEnd]() {
+                  construct( row, rowEnd, column, colEnd );
+               } );
+            }
+         }
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -44,9 +44,9 @@
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
-#include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
@@ -54,7 +54,6 @@
 #include <blaze/math/views/Subvector.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/SMP.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -103,25 +102,21 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    using ET2 = ElementType_t<VT2>;
 
    constexpr bool simdEnabled( VT1::simdEnabled && VT2::simdEnabled && IsSIMDCombinable_v<ET1,ET2> );
-   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<VT1> >::size );
 
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (*lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (*lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t threads( TheThreadBackend::partitions() );
+   const BlockPartition partition( createVectorPartition( threads, *lhs, simdEnabled ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( partition.begin( i ) );
 
       if( index >= (*lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (*lhs).size() - index ) );
+      const size_t size( partition.end( i ) - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( *lhs, index, size, unchecked ) );
@@ -180,18 +175,17 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (*lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (*lhs).size() / threads + addon );
+   const size_t threads( TheThreadBackend::partitions() );
+   const BlockPartition partition( createVectorPartition( threads, *lhs, false ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( partition.begin( i ) );
 
       if( index >= (*lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (*lhs).size() - index ) );
+      const size_t size( partition.end( i ) - index );
       auto       target( subvector<unaligned>( *lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
       TheThreadBackend::schedule( target, source, op );
@@ -656,6 +650,90 @@ inline auto smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
 
 
 
+//=================================================================================================
+//
+//  PARALLEL CONSTRUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based construction of the elements of a dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector with uninitialized elements.
+// \param value The initial value of all elements.
+// \return void
+//
+// This function constructs all elements of the given dense vector with uninitialized elements,
+// including all padding elements, in parallel. The vector is partitioned exactly as in an SMP
+// assignment of a vector of the same type (including the choice of the SIMD granularity) and the
+// parts are scheduled in the same order. Therefore in NUMA mode every part is initialized (and
+// its memory pages are first touched) by the same thread that processes the part in all
+// subsequent SMP assignments. All padding elements are default constructed. The vector has to
+// provide direct access to its elements via the \c data() and \c spacing() functions and its
+// element type must be nothrow constructible.\n
+// This function must \b NOT be called explicitly! It is used internally for the construction
+// of dense vectors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void smpConstruct( DenseVector<VT,TF>& lhs, const ElementType_t<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<VT>;
+
+   ET* const ptr( (*lhs).data() );
+   const size_t N( (*lhs).size() );
+   const size_t spacing( (*lhs).spacing() );
+
+   auto construct = [ptr,&value,N,spacing]( size_t begin, size_t end )
+   {
+      if( end == N ) end = spacing;
+
+      for( size_t i=begin; i<end; ++i ) {
+         if( i < N ) ::new( ptr+i ) ET( value );
+         else ::new( ptr+i ) ET();
+      }
+   };
+
+   if( isSerialSectionActive() || isParallelSectionActive() || N == 0UL ) {
+      construct( 0UL, N );
+      return;
+   }
+
+   constexpr bool simdEnabled( VT::simdEnabled && IsSIMDCombinable_v<ET,ET> );
+
+   const size_t threads( TheThreadBackend::partitions() );
+   const BlockPartition partition( createVectorPartition( threads, *lhs, simdEnabled ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<threads; ++i )
+      {
+         const size_t index( partition.begin( i ) );
+
+         if( index >= N )
+            continue;
+
+         const size_t end( partition.end( i ) );
+
+         TheThreadBackend::schedule( [&construct,index,end]() {
+            construct( index, end );
+         } );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -98,6 +98,45 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread limit of the calling thread.
+// \ingroup smp
+//
+// \return The maximum number of threads for the operations of the calling thread (0 if unlimited).
+//
+// This function returns the thread limit of the calling thread as set by the setThreadLimit()
+// function. The thread limit does not affect the total number of threads of the thread backend.
+*/
+BLAZE_ALWAYS_INLINE size_t getThreadLimit()
+{
+   return TheThreadBackend::limit();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for the operations of the calling thread.
+// \ingroup smp
+//
+// \param number The maximum number of threads for the operations of the calling thread.
+// \return void
+//
+// This function limits the number of threads used for all subsequent operations of the calling
+// thread. In contrast to the setNumThreads() function the total number of threads remains
+// unchanged and the operations of all other threads are not affected. The value 0 removes the
+// limit.
+*/
+BLAZE_ALWAYS_INLINE void setThreadLimit( size_t number )
+{
+   TheThreadBackend::setLimit( number );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -0,0 +1,147 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Loop.h
+//  \brief Header file for the C++11/Boost thread-based SMP loop implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_LOOP_H_
+#define _BLAZE_MATH_SMP_THREADS_LOOP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD-BASED LOOP KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP loop.
+// \ingroup smp
+//
+// \param work The accumulated work of the index range.
+// \param kernel The serial loop kernel.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP loop. The vector
+// \a work has to contain \f$ N+1 \f$ non-decreasing values, where \a work[i] represents the
+// accumulated work of the first \a i indices of the index range \f$ [0..N) \f$. The function
+// splits the index range into contiguous partitions of approximately equal work (see the
+// createWorkPartitions() function) and concurrently calls the serial \a kernel for every
+// partition with the first and one-past-the-last index of the partition (\a kernel(begin,end)).
+// Therefore the kernel has to be safe for the concurrent execution on disjoint index ranges.
+// In case the function is called inside a serial section or inside another parallel
+// operation, the kernel is called for the entire index range.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Kernel >  // Type of the serial loop kernel
+void smpLoop( const std::vector<size_t>& work, Kernel kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( !work.empty(), "Invalid work vector detected" );
+
+   const size_t N( work.size() - 1UL );
+
+   if( N == 0UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      kernel( 0UL, N );
+      return;
+   }
+
+   const std::vector<size_t> bounds( createWorkPartitions( TheThreadBackend::partitions(), work ) );
+   const size_t partitions( bounds.size() - 1UL );
+
+   if( partitions == 1UL ) {
+      kernel( 0UL, N );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<partitions; ++i )
+      {
+         const size_t begin( bounds[i]     );
+         const size_t end  ( bounds[i+1UL] );
+
+         TheThreadBackend::schedule( [&kernel,begin,end]()
+         {
+            kernel( begin, end );
+         } );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
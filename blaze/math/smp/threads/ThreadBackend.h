@@ -51,13 +51,19 @@
 #endif
 
 #include <cstdlib>
+#include <utility>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/ParallelSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingPool.h>
 
 
 namespace blaze {
@@ -75,7 +81,19 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. In case the work-stealing
+// mode is active (see the \c BLAZE_USE_WORK_STEALING switch), the tasks are executed by means
+// of a WorkStealingPool, else by means of a ThreadPool.\n
+// The thread backend can be used concurrently by several application threads. All tasks
+// scheduled by a particular application thread belong to a thread-specific task group, i.e.
+// the wait() function only blocks until the tasks of the calling thread have been completed.
+// Additionally, every application thread can limit the number of threads used for its own
+// operations (see the setLimit() function) without affecting any other thread.\n
+// In case the NUMA mode is active (see the \c BLAZE_USE_NUMA switch), the threads of the pool
+// are bound to logical CPUs and the n-th task scheduled by an application thread between two
+// calls to wait() is always assigned to the same thread of the pool. Since all SMP assignments
+// schedule their tasks in a deterministic order, the same part of an operand is processed by
+// the same thread in every SMP assignment, including the parallel first-touch initialization.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -89,9 +107,12 @@ class ThreadBackend
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size      ();
+   static inline size_t partitions();
+   static inline size_t limit     ();
+   static inline void   setLimit  ( size_t n );
+   static inline void   resize    ( size_t n, bool block=false );
+   static inline void   wait      ();
    //@}
    //**********************************************************************************************
 
@@ -100,10 +121,23 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+#if BLAZE_WORK_STEALING_MODE
+   using Pool = WorkStealingPool<TT,MT,LT,CT>;  //!< Type of the thread pool.
+#else
+   using Pool = ThreadPool<TT,MT,LT,CT>;        //!< Type of the thread pool.
+#endif
+
+   using TaskGroup = typename Pool::TaskGroup;  //!< Type of a group of tasks.
+   //**********************************************************************************************
+
    //**Private class Assigner**********************************************************************
    /*!\brief Auxiliary functor for the threaded execution of a plain assignment.
    */
@@ -132,7 +166,9 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
-         op_( target_, source_ );
+         BLAZE_PARALLEL_SECTION {
+            op_( target_, source_ );
+         }
       }
       //*******************************************************************************************
 
@@ -153,18 +189,35 @@ class ThreadBackend
    /*!\name Initialization functions */
    //@{
    static inline size_t initPool();
+   static inline size_t initSpin();
+   static inline std::vector<size_t> initAffinity();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified
+                                  via the environment variable \c BLAZE_NUM_THREADS.
+                                  However, it can be explicitly resized to arbitrary
+                                  numbers of threads. The spin budget of the threads is
+                                  initialized via the environment variable
+                                  \c BLAZE_SPIN_COUNT or \c BLAZE_THREAD_SPIN_COUNT. */
+
+   static thread_local TaskGroup group_;  //!< The task group of the calling thread.
+                                          /*!< All tasks scheduled by a thread are part of
+                                               this thread-specific task group. */
+
+   static thread_local size_t limit_;  //!< The thread limit of the calling thread.
+                                       /*!< The value 0 represents an unlimited number of
+                                            threads. */
+
+#if BLAZE_NUMA_MODE
+   static thread_local size_t next_;  //!< The index of the next task of the calling thread.
+                                      /*!< In NUMA mode the n-th task is scheduled on the
+                                           n-th thread of the pool. */
+#endif
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +236,22 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+#if BLAZE_NUMA_MODE
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initSpin(), initAffinity() );
+#else
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), initSpin() );
+#endif
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local typename ThreadBackend<TT,MT,LT,CT>::TaskGroup ThreadBackend<TT,MT,LT,CT>::group_( initSpin() );
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local size_t ThreadBackend<TT,MT,LT,CT>::limit_( 0UL );
+
+#if BLAZE_NUMA_MODE
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local size_t ThreadBackend<TT,MT,LT,CT>::next_( 0UL );
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -214,6 +282,78 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of partitions an SMP assignment is split into.
+//
+// \return The number of partitions of an SMP assignment.
+//
+// This function returns the number of tasks a single SMP assignment should be split into. By
+// default, every thread of the backend system is assigned exactly one task. In case the
+// work-stealing mode is active, every thread is assigned \c BLAZE_WORK_STEALING_TASKS_PER_THREAD
+// tasks in order to enable idle threads to take over the work of slower threads. In case the
+// calling thread has limited the number of threads (see the setLimit() function), the number of
+// threads is reduced accordingly.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::partitions()
+{
+   const size_t threads( limit_ == 0UL ? threadpool_.size() : min( threadpool_.size(), limit_ ) );
+
+#if BLAZE_WORK_STEALING_MODE
+   return threads * max( 1UL, BLAZE_WORK_STEALING_TASKS_PER_THREAD );
+#else
+   return threads;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread limit of the calling thread.
+//
+// \return The maximum number of threads for the operations of the calling thread (0 if unlimited).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::limit()
+{
+   return limit_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Limits the number of threads used for the operations of the calling thread.
+//
+// \param n The maximum number of threads for the operations of the calling thread (0 if unlimited).
+// \return void
+//
+// This function limits the number of threads used for all subsequent operations of the calling
+// thread. In contrast to the resize() function the total number of threads of the thread backend
+// system remains unchanged and the operations of all other threads are not affected.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setLimit( size_t n )
+{
+   limit_ = n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Changes the total number of threads managed by the thread backend system.
@@ -244,11 +384,12 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Waiting for all scheduled tasks to be completed.
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks scheduled by the calling thread have been completed.
+// Tasks scheduled by other threads are not waited for.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -256,7 +397,11 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   group_.wait();
+
+#if BLAZE_NUMA_MODE
+   next_ = 0UL;
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -291,7 +436,47 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+
+#if BLAZE_NUMA_MODE
+   threadpool_.scheduleOn( next_++, group_, Assigner<Target,Source,OP>( target, source, op ) );
+#else
+   threadpool_.schedule( group_, Assigner<Target,Source,OP>( target, source, op ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. It is used for all parallel
+// operations that cannot be expressed in terms of a (compound) assignment, as for instance the
+// parallel reduction of a dense vector. Analogous to an assignment the given function/functor is
+// executed within a parallel section.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   auto task = [func]() mutable {
+      BLAZE_PARALLEL_SECTION {
+         func();
+      }
+   };
+
+#if BLAZE_NUMA_MODE
+   threadpool_.scheduleOn( next_++, group_, std::move( task ) );
+#else
+   threadpool_.schedule( group_, std::move( task ) );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -338,6 +523,80 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial spin budget of the threads of the thread pool.
+//
+// \return The initial number of spin iterations.
+//
+// This function determines the number of spin iterations of idle and waiting threads before
+// they are parked. In case the \c BLAZE_SPIN_COUNT environment variable is defined, the function
+// returns the specified number of iterations. Otherwise it returns \c BLAZE_THREAD_SPIN_COUNT.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::initSpin()
+{
+   const char* env = std::getenv( "BLAZE_SPIN_COUNT" );
+
+   if( env == nullptr )
+      return BLAZE_THREAD_SPIN_COUNT;
+   else return max( 0, atoi( env ) );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the logical CPUs for the threads of the thread pool in NUMA mode.
+//
+// \return The logical CPUs in the order of the threads.
+//
+// This function determines the logical CPUs the threads of the thread pool are bound to in NUMA
+// mode. In case the \c BLAZE_CPU_AFFINITY environment variable contains a valid list of CPUs
+// (e.g. "0-7,16-23"), the function returns the specified CPUs. Otherwise it returns all logical
+// CPUs in ascending order.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   std::vector<size_t> cpus( threadpool::parseCpuList( std::getenv( "BLAZE_CPU_AFFINITY" ) ) );
+
+   if( cpus.empty() ) {
+      const size_t n( max( 1U, TT::hardware_concurrency() ) );
+      for( size_t i=0UL; i<n; ++i ) {
+         cpus.push_back( i );
+      }
+   }
+
+   return cpus;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
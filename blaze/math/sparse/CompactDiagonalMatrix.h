@@ -0,0 +1,1874 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactDiagonalMatrix.h
+//  \brief Implementation of a diagonal matrix that only stores its diagonal elements
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/Scalar.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDMatSchurExpr.h>
+#include <blaze/math/expressions/DVecDVecMultExpr.h>
+#include <blaze/math/expressions/DVecExpandExpr.h>
+#include <blaze/math/expressions/DVecSVecMultExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/DeclDiagTrait.h>
+#include <blaze/math/traits/DeclHermTrait.h>
+#include <blaze/math/traits/DeclLowTrait.h>
+#include <blaze/math/traits/DeclSymTrait.h>
+#include <blaze/math/traits/DeclUppTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_diagonal_matrix CompactDiagonalMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of an \f$ N \times N \f$ diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalMatrix class template is the representation of an arbitrary sized diagonal
+// matrix that only stores its \f$ N \f$ diagonal elements. In contrast to a DiagonalMatrix
+// adaptor, which restricts the elements of an underlying \f$ N \times N \f$ dense or sparse
+// matrix, CompactDiagonalMatrix holds the diagonal in a single contiguous dense vector. The type
+// of the elements, the storage order, and the group tag of the matrix can be specified via the
+// three template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag >
+   class CompactDiagonalMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactDiagonalMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer scalar element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// CompactDiagonalMatrix is a sparse matrix with exactly one (possibly zero) stored element per
+// row/column. The diagonal elements can be accessed via the set() function or as a dense column
+// vector via the values() function. Any attempt to set an off-diagonal element results in a
+// \a std::invalid_argument exception:
+
+   \code
+   using blaze::rowMajor;
+
+   // Creating a row-major 4x4 diagonal matrix with zero diagonal
+   CompactDiagonalMatrix<double,rowMajor> D( 4UL );
+
+   D.set( 1, 1, 2.0 );          // Setting the diagonal element (1,1)
+   D.set( 1, 2, 2.0 );          // Throws a std::invalid_argument exception
+   D.values() = { 1, 2, 3, 4 };  // Setting all diagonal elements at once
+   double d = D(2,1);           // Access to the element (2,1)
+   \endcode
+
+// Since CompactDiagonalMatrix is both a lower and an upper matrix (i.e. \c IsDiagonal_v evaluates
+// to \a true), it takes part in all diagonal matrix optimizations of the library. Additionally,
+// the multiplication with dense and sparse vectors is evaluated as elementwise scaling with the
+// stored diagonal, and the multiplication with a column-major dense matrix from the left and a
+// row-major dense matrix from the right is evaluated as a vectorized Schur product with the
+// expanded diagonal:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+
+   CompactDiagonalMatrix<double> D( 1000UL );
+   DynamicMatrix<double,columnMajor> A( 1000UL, 200UL ), B;
+   DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of D, A, and x
+
+   y = D * x;  // O(N) SIMD scaling of the vector x
+   B = D * A;  // Row scaling of A via a vectorized Schur product
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+class CompactDiagonalMatrix
+   : public Expression< SparseMatrix< CompactDiagonalMatrix<Type,SO,Tag>, SO > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this CompactDiagonalMatrix instance.
+   using This = CompactDiagonalMatrix<Type,SO,Tag>;
+
+   //! Base type of this CompactDiagonalMatrix instance.
+   using BaseType = Expression< SparseMatrix<This,SO> >;
+
+   //!< Result type for expression template evaluations.
+   using ResultType = This;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CompactDiagonalMatrix<Type,!SO,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompactDiagonalMatrix<Type,!SO,Tag>;
+
+   using ElementType    = Type;         //!< Type of the diagonal matrix elements.
+   using TagType        = Tag;          //!< Tag type of this CompactDiagonalMatrix instance.
+   using ReturnType     = const Type;   //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;  //!< Data type for composite expression templates.
+   using Reference      = const Type;   //!< Reference to a diagonal matrix element.
+   using ConstReference = const Type;   //!< Reference to a constant diagonal matrix element.
+
+   //! Type of the dense vector holding the diagonal elements.
+   using DiagonalType = DynamicVector<Type,columnVector,AlignedAllocator<Type>,Tag>;
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactDiagonalMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      //! The type of the other CompactDiagonalMatrix.
+      using Other = CompactDiagonalMatrix<NewType,SO,Tag>;
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompactDiagonalMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      //! The type of the other CompactDiagonalMatrix.
+      using Other = CompactDiagonalMatrix<Type,SO,Tag>;
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the diagonal matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the diagonal matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      constexpr ConstIterator() noexcept
+         : value_()  // Pointer to the current diagonal matrix element
+         , index_()  // Index to the current diagonal matrix element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the initial matrix element.
+      // \param index Index to the initial matrix element.
+      */
+      constexpr ConstIterator( const Type* value, size_t index ) noexcept
+         : value_( value )  // Pointer to the current diagonal matrix element
+         , index_( index )  // Index to the current diagonal matrix element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      constexpr ConstIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      constexpr ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++value_;
+         ++index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      constexpr const Element operator*() const noexcept {
+         return Element( *value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      constexpr const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      constexpr const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      constexpr size_t index() const noexcept {
+         return index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      constexpr bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      constexpr bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      constexpr DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the current diagonal matrix element.
+      size_t      index_;  //!< Index to the current diagonal matrix element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline CompactDiagonalMatrix();
+   explicit inline CompactDiagonalMatrix( size_t n );
+   explicit inline CompactDiagonalMatrix( size_t n, const Type& init );
+
+   template< typename VT >
+   explicit inline CompactDiagonalMatrix( const DenseVector<VT,columnVector>& v );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix( const Matrix<MT,SO2>& m );
+
+   CompactDiagonalMatrix( const CompactDiagonalMatrix& ) = default;
+   CompactDiagonalMatrix( CompactDiagonalMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~CompactDiagonalMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference      operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference      at( size_t i, size_t j ) const;
+   inline DiagonalType&       values() noexcept;
+   inline const DiagonalType& values() const noexcept;
+   inline ConstIterator       begin ( size_t i ) const noexcept;
+   inline ConstIterator       cbegin( size_t i ) const noexcept;
+   inline ConstIterator       end   ( size_t i ) const noexcept;
+   inline ConstIterator       cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator=( const Matrix<MT,SO2>& rhs ) &;
+
+   CompactDiagonalMatrix& operator=( const CompactDiagonalMatrix& ) & = default;
+   CompactDiagonalMatrix& operator=( CompactDiagonalMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( CompactDiagonalMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompactDiagonalMatrix& transpose() noexcept;
+   inline CompactDiagonalMatrix& ctranspose();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DiagonalType v_;  //!< The diagonal elements of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_SCALAR_TYPE       ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactDiagonalMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline CompactDiagonalMatrix<Type,SO,Tag>::CompactDiagonalMatrix()
+   : v_()  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All diagonal elements of the matrix are initialized to zero.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline CompactDiagonalMatrix<Type,SO,Tag>::CompactDiagonalMatrix( size_t n )
+   : v_( n, Type() )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix of size \f$ N \times N \f$ with initialized diagonal.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the diagonal elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline CompactDiagonalMatrix<Type,SO,Tag>::CompactDiagonalMatrix( size_t n, const Type& init )
+   : v_( n, init )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix with the given diagonal.
+//
+// \param v The dense column vector holding the diagonal elements.
+//
+// The matrix is sized according to the size \f$ N \f$ of the given vector and its diagonal is
+// initialized as a copy of the vector.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+template< typename VT >   // Type of the dense vector
+inline CompactDiagonalMatrix<Type,SO,Tag>::CompactDiagonalMatrix(
+   const DenseVector<VT,columnVector>& v )
+   : v_( *v )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Diagonal matrix to be copied.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// The matrix is sized according to the given \f$ N \times N \f$ matrix and its diagonal is
+// initialized as a copy of the diagonal of this matrix. In case the given matrix is not a
+// diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+template< typename MT     // Type of the foreign diagonal matrix
+        , bool SO2 >      // Storage order of the foreign diagonal matrix
+inline CompactDiagonalMatrix<Type,SO,Tag>::CompactDiagonalMatrix( const Matrix<MT,SO2>& m )
+   : v_()  // The diagonal elements of the matrix
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   CompositeType_t<MT> A( *m );
+
+   if( !IsDiagonal_v<MT> && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of diagonal matrix" );
+   }
+
+   const size_t n( A.rows() );
+
+   v_.resize( n, false );
+   for( size_t i=0UL; i<n; ++i ) {
+      v_[i] = A(i,i);
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the diagonal matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstReference
+   CompactDiagonalMatrix<Type,SO,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i == j )
+      return v_[i];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstReference
+   CompactDiagonalMatrix<Type,SO,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the diagonal elements of the matrix.
+//
+// \return Reference to the dense column vector holding the diagonal elements.
+//
+// The returned vector can be used to read and write all diagonal elements at once. Resizing the
+// vector resizes the matrix accordingly.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO,Tag>::values() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the diagonal elements of the matrix.
+//
+// \return Reference to the dense column vector holding the diagonal elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline const typename CompactDiagonalMatrix<Type,SO,Tag>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO,Tag>::values() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( v_.data()+i, i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( v_.data()+i, i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( v_.data()+i+1UL, i+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( v_.data()+i+1UL, i+1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Diagonal matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and its diagonal is
+// initialized as a copy of the diagonal of this matrix. In case the given matrix is not a
+// diagonal matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO,Tag>&
+   CompactDiagonalMatrix<Type,SO,Tag>::operator=( const Matrix<MT,SO2>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   CompositeType_t<MT> A( *rhs );
+
+   if( !IsDiagonal_v<MT> && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   const size_t n( A.rows() );
+
+   if( (*rhs).canAlias( this ) ) {
+      DiagonalType tmp( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         tmp[i] = A(i,i);
+      }
+      v_.swap( tmp );
+   }
+   else {
+      v_.resize( n, false );
+      for( size_t i=0UL; i<n; ++i ) {
+         v_[i] = A(i,i);
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the diagonal matrix.
+//
+// \return The number of rows of the diagonal matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::rows() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the diagonal matrix.
+//
+// \return The number of columns of the diagonal matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::columns() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the diagonal matrix.
+//
+// \return The capacity of the diagonal matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::capacity() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::capacity( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the diagonal matrix
+//
+// \return The number of non-zero elements in the diagonal matrix.
+//
+// Note that all diagonal elements are stored and therefore count as non-zero elements, even
+// if their value is zero.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::nonZeros() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline size_t CompactDiagonalMatrix<Type,SO,Tag>::nonZeros( size_t i ) const noexcept
+{
+   MAYBE_UNUSED( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all diagonal elements to their default initial value. The size of the
+// matrix is not changed.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void CompactDiagonalMatrix<Type,SO,Tag>::reset()
+{
+   using blaze::reset;
+
+   reset( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be reset.
+// \return void
+//
+// This function resets the diagonal element of the specified row/column to its default
+// initial value.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void CompactDiagonalMatrix<Type,SO,Tag>::reset( size_t i )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   reset( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the diagonal matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the diagonal matrix is 0.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void CompactDiagonalMatrix<Type,SO,Tag>::clear()
+{
+   v_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the diagonal matrix.
+//
+// \param n The new number of rows and columns of the diagonal matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. New diagonal elements are initialized to zero.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void CompactDiagonalMatrix<Type,SO,Tag>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   const size_t oldsize( preserve ? v_.size() : 0UL );
+
+   v_.resize( n, preserve );
+
+   for( size_t i=oldsize; i<n; ++i ) {
+      reset( v_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two diagonal matrices.
+//
+// \param m The diagonal matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void CompactDiagonalMatrix<Type,SO,Tag>::swap( CompactDiagonalMatrix& m ) noexcept
+{
+   v_.swap( m.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the diagonal matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+// \exception std::invalid_argument Invalid access to non-diagonal matrix element.
+//
+// This function sets the value of the diagonal element at position \f$ (i,i) \f$. In case
+// the given indices do not refer to a diagonal element, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::Iterator
+   CompactDiagonalMatrix<Type,SO,Tag>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i != j ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid access to non-diagonal matrix element" );
+   }
+
+   v_[i] = value;
+
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::find( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i == j )
+      return begin( i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j <= i ) || ( SO && i <= j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline typename CompactDiagonalMatrix<Type,SO,Tag>::ConstIterator
+   CompactDiagonalMatrix<Type,SO,Tag>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j < i ) || ( SO && i < j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline CompactDiagonalMatrix<Type,SO,Tag>& CompactDiagonalMatrix<Type,SO,Tag>::transpose() noexcept
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline CompactDiagonalMatrix<Type,SO,Tag>& CompactDiagonalMatrix<Type,SO,Tag>::ctranspose()
+{
+   v_ = conj( v_ );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline bool CompactDiagonalMatrix<Type,SO,Tag>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalMatrix operators */
+//@{
+template< typename Type, bool SO, typename Tag >
+void reset( CompactDiagonalMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+void reset( CompactDiagonalMatrix<Type,SO,Tag>& m, size_t i );
+
+template< typename Type, bool SO, typename Tag >
+void clear( CompactDiagonalMatrix<Type,SO,Tag>& m );
+
+template< RelaxationFlag RF, typename Type, bool SO, typename Tag >
+bool isDefault( const CompactDiagonalMatrix<Type,SO,Tag>& m );
+
+template< typename Type, bool SO, typename Tag >
+bool isIntact( const CompactDiagonalMatrix<Type,SO,Tag>& m ) noexcept;
+
+template< typename Type, bool SO, typename Tag >
+void swap( CompactDiagonalMatrix<Type,SO,Tag>& a, CompactDiagonalMatrix<Type,SO,Tag>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void reset( CompactDiagonalMatrix<Type,SO,Tag>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void reset( CompactDiagonalMatrix<Type,SO,Tag>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void clear( CompactDiagonalMatrix<Type,SO,Tag>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given diagonal matrix is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the diagonal matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> D;
+   // ... Resizing and initialization
+   if( isDefault( D ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( D ) ) { ... }
+   \endcode
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename Tag >     // Tag type
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO,Tag>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given diagonal matrix are intact.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The diagonal matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the diagonal matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> D;
+   // ... Resizing and initialization
+   if( isIntact( D ) ) { ... }
+   \endcode
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline bool isIntact( const CompactDiagonalMatrix<Type,SO,Tag>& m ) noexcept
+{
+   return isIntact( m.values() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Tag type
+inline void swap( CompactDiagonalMatrix<Type,SO,Tag>& a,
+                  CompactDiagonalMatrix<Type,SO,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a dense
+//        column vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side diagonal matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The elementwise product of the diagonal and the vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is evaluated as the vectorized elementwise product of the stored diagonal
+// and the given dense vector.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , typename VT     // Type of the right-hand side dense vector
+        , EnableIf_t< IsDenseVector_v<VT> && IsColumnVector_v<VT> >* = nullptr >
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<Type,SO,Tag>& mat, const VT& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (*vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return mat.values() * (*vec);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a sparse
+//        column vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side diagonal matrix for the multiplication.
+// \param vec The right-hand side sparse vector for the multiplication.
+// \return The elementwise product of the diagonal and the vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// The multiplication is evaluated as the elementwise product of the stored diagonal and the
+// given sparse vector, i.e. with a complexity linear in the number of non-zero elements of
+// the vector.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , typename VT     // Type of the right-hand side sparse vector
+        , EnableIf_t< IsSparseVector_v<VT> && IsColumnVector_v<VT> >* = nullptr >
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<Type,SO,Tag>& mat, const VT& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (*vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return mat.values() * (*vec);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense row vector and a compact
+//        diagonal matrix (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param vec The left-hand side dense vector for the multiplication.
+// \param mat The right-hand side diagonal matrix for the multiplication.
+// \return The elementwise product of the vector and the diagonal.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+*/
+template< typename VT     // Type of the left-hand side dense vector
+        , typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , EnableIf_t< IsDenseVector_v<VT> && IsRowVector_v<VT> >* = nullptr >
+inline decltype(auto)
+   operator*( const VT& vec, const CompactDiagonalMatrix<Type,SO,Tag>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*vec).size() != mat.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return (*vec) * trans( mat.values() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        column-major dense matrix (\f$ A=D*B \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side diagonal matrix for the multiplication.
+// \param rhs The right-hand side column-major dense matrix for the multiplication.
+// \return The row-scaled dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is evaluated as the vectorized Schur product of the column-wise expanded
+// diagonal and the given dense matrix. Row-major dense matrices are handled by the default
+// sparse matrix/dense matrix multiplication, which scales each row with a single SIMD kernel.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , typename MT     // Type of the right-hand side dense matrix
+        , EnableIf_t< IsDenseMatrix_v<MT> && IsColumnMajorMatrix_v<MT> >* = nullptr >
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<Type,SO,Tag>& lhs, const MT& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.columns() != (*rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return expand( lhs.values(), (*rhs).columns() ) % (*rhs);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a row-major dense matrix and a
+//        compact diagonal matrix (\f$ A=B*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side row-major dense matrix for the multiplication.
+// \param rhs The right-hand side diagonal matrix for the multiplication.
+// \return The column-scaled dense matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The multiplication is evaluated as the vectorized Schur product of the given dense matrix and
+// the row-wise expanded diagonal.
+*/
+template< typename MT     // Type of the left-hand side dense matrix
+        , typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , EnableIf_t< IsDenseMatrix_v<MT> && IsRowMajorMatrix_v<MT> >* = nullptr >
+inline decltype(auto)
+   operator*( const MT& lhs, const CompactDiagonalMatrix<Type,SO,Tag>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (*lhs).columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return (*lhs) % expand( trans( rhs.values() ), (*lhs).rows() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename Tag >
+struct IsSquare< CompactDiagonalMatrix<MT,SO,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename Tag >
+struct IsSymmetric< CompactDiagonalMatrix<MT,SO,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename Tag >
+struct IsHermitian< CompactDiagonalMatrix<MT,SO,Tag> >
+   : public BoolConstant< !IsComplex_v<MT> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename Tag >
+struct IsLower< CompactDiagonalMatrix<MT,SO,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, typename Tag >
+struct IsUpper< CompactDiagonalMatrix<MT,SO,Tag> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLSYMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag >
+struct DeclSymTrait< CompactDiagonalMatrix<T,SO,Tag> >
+{
+   using Type = CompactDiagonalMatrix<T,SO,Tag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLHERMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag >
+struct DeclHermTrait< CompactDiagonalMatrix<T,SO,Tag> >
+{
+   using Type = CompactDiagonalMatrix<T,SO,Tag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLLOWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag >
+struct DeclLowTrait< CompactDiagonalMatrix<T,SO,Tag> >
+{
+   using Type = CompactDiagonalMatrix<T,SO,Tag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLUPPTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag >
+struct DeclUppTrait< CompactDiagonalMatrix<T,SO,Tag> >
+{
+   using Type = CompactDiagonalMatrix<T,SO,Tag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLDIAGTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename Tag >
+struct DeclDiagTrait< CompactDiagonalMatrix<T,SO,Tag> >
+{
+   using Type = CompactDiagonalMatrix<T,SO,Tag>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
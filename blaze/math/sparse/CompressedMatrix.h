@@ -504,6 +504,8 @@ class CompressedMatrix
 
    inline bool canSMPAssign() const noexcept;
 
+   inline void layout( const std::vector<size_t>& nonzeros );
+
    template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
    template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
@@ -784,11 +786,9 @@ template< typename MT     // Type of the foreign dense matrix
 inline CompressedMatrix<Type,SO,Tag>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : CompressedMatrix( (*dm).rows(), (*dm).columns() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *dm );
+   smpAssign( *this, *dm );
 }
 //*************************************************************************************************
 
@@ -806,11 +806,9 @@ template< typename MT     // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,SO,Tag>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (*sm).rows(), (*sm).columns(), (*sm).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *sm );
+   smpAssign( *this, *sm );
 }
 //*************************************************************************************************
 
@@ -1289,8 +1287,6 @@ template< typename MT     // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO,Tag>&
    CompressedMatrix<Type,SO,Tag>::operator=( const DenseMatrix<MT,SO2>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -1299,7 +1295,7 @@ inline CompressedMatrix<Type,SO,Tag>&
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -1324,8 +1320,6 @@ template< typename MT     // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO,Tag>&
    CompressedMatrix<Type,SO,Tag>::operator=( const SparseMatrix<MT,SO2>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ||
@@ -1339,7 +1333,7 @@ inline CompressedMatrix<Type,SO,Tag>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
@@ -2812,6 +2806,47 @@ inline bool CompressedMatrix<Type,SO,Tag>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets up the storage layout of the matrix for a concurrent assignment.
+//
+// \param nonzeros The number of non-zero elements of each row.
+// \return void
+//
+// This function prepares the (empty) matrix for a concurrent assignment. It reserves the total
+// number of non-zero elements and assigns exactly \a nonzeros[i] elements to row \a i. Afterwards
+// the rows can be filled independently of each other via the append() function, i.e. without
+// the need to call finalize(). In case the given number of non-zero elements of a row is not
+// exactly matched by the subsequent append() calls, the matrix is in an invalid state.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag >  // Type tag
+inline void CompressedMatrix<Type,SO,Tag>::layout( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros.size() == m_, "Invalid number of rows" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   if( m_ == 0UL )
+      return;
+
+   size_t total( 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      total += nonzeros[i];
+   }
+
+   reserve( total );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_[i] = begin_[i];
+      begin_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
 //
@@ -3381,6 +3416,8 @@ class CompressedMatrix<Type,true,Tag>
 
    inline bool canSMPAssign() const noexcept;
 
+   inline void layout( const std::vector<size_t>& nonzeros );
+
    template< typename MT, bool SO > inline void assign     ( const DenseMatrix<MT,SO>&     rhs );
    template< typename MT >          inline void assign     ( const SparseMatrix<MT,true>&  rhs );
    template< typename MT >          inline void assign     ( const SparseMatrix<MT,false>& rhs );
@@ -3670,11 +3707,9 @@ template< typename MT     // Type of the foreign dense matrix
 inline CompressedMatrix<Type,true,Tag>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : CompressedMatrix( (*dm).rows(), (*dm).columns() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *dm );
+   smpAssign( *this, *dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3693,11 +3728,9 @@ template< typename MT     // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,true,Tag>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (*sm).rows(), (*sm).columns(), (*sm).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *sm );
+   smpAssign( *this, *sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4167,8 +4200,6 @@ template< typename MT     // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true,Tag>&
    CompressedMatrix<Type,true,Tag>::operator=( const DenseMatrix<MT,SO>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -4177,7 +4208,7 @@ inline CompressedMatrix<Type,true,Tag>&
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -4203,8 +4234,6 @@ template< typename MT     // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true,Tag>&
    CompressedMatrix<Type,true,Tag>::operator=( const SparseMatrix<MT,SO>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ||
@@ -4218,7 +4247,7 @@ inline CompressedMatrix<Type,true,Tag>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
@@ -5699,6 +5728,48 @@ inline bool CompressedMatrix<Type,true,Tag>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets up the storage layout of the matrix for a concurrent assignment.
+//
+// \param nonzeros The number of non-zero elements of each column.
+// \return void
+//
+// This function prepares the (empty) matrix for a concurrent assignment. It reserves the total
+// number of non-zero elements and assigns exactly \a nonzeros[j] elements to column \a j.
+// Afterwards the columns can be filled independently of each other via the append() function, i.e. without
+// the need to call finalize(). In case the given number of non-zero elements of a column is not
+// exactly matched by the subsequent append() calls, the matrix is in an invalid state.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void CompressedMatrix<Type,true,Tag>::layout( const std::vector<size_t>& nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros.size() == n_, "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   if( n_ == 0UL )
+      return;
+
+   size_t total( 0UL );
+   for( size_t j=0UL; j<n_; ++j ) {
+      total += nonzeros[j];
+   }
+
+   reserve( total );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_[j] = begin_[j];
+      begin_[j+1UL] = begin_[j] + nonzeros[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a dense matrix.
@@ -464,6 +464,9 @@ class CompressedVector
 
    inline bool canSMPAssign() const noexcept;
 
+   inline void layout( size_t nonzeros );
+   inline void place ( size_t pos, size_t index, const Type& value );
+
    template< typename VT > inline void assign    ( const DenseVector <VT,TF>& rhs );
    template< typename VT > inline void assign    ( const SparseVector<VT,TF>& rhs );
    template< typename VT > inline void addAssign ( const DenseVector <VT,TF>& rhs );
@@ -675,11 +678,9 @@ template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF,Tag>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (*dv).size() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
-   assign( *this, *dv );
+   smpAssign( *this, *dv );
 }
 //*************************************************************************************************
 
@@ -696,11 +697,9 @@ template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF,Tag>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (*sv).size(), (*sv).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
-   assign( *this, *sv );
+   smpAssign( *this, *sv );
 }
 //*************************************************************************************************
 
@@ -1061,8 +1060,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF,Tag>&
    CompressedVector<Type,TF,Tag>::operator=( const DenseVector<VT,TF>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -1072,7 +1069,7 @@ inline CompressedVector<Type,TF,Tag>&
    else {
       size_ = (*rhs).size();
       end_  = begin_;
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -1096,8 +1093,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF,Tag>&
    CompressedVector<Type,TF,Tag>::operator=( const SparseVector<VT,TF>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
    if( (*rhs).canAlias( this ) || (*rhs).nonZeros() > capacity_ ) {
@@ -1109,7 +1104,7 @@ inline CompressedVector<Type,TF,Tag>&
       end_  = begin_;
 
       if( !IsZero_v<VT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
@@ -2191,6 +2186,61 @@ inline bool CompressedVector<Type,TF,Tag>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets up the storage layout of the vector for a concurrent assignment.
+//
+// \param nonzeros The total number of non-zero elements.
+// \return void
+//
+// This function prepares the (empty) vector for a concurrent assignment. It reserves and claims
+// exactly \a nonzeros elements, which afterwards can be set independently of each other via the
+// place() function. In case not all claimed elements are subsequently set in ascending order of
+// their indices, the vector is in an invalid state.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag >  // Type tag
+inline void CompressedVector<Type,TF,Tag>::layout( size_t nonzeros )
+{
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   reserve( nonzeros );
+   end_ = begin_ + nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets an element of the storage laid out for a concurrent assignment.
+//
+// \param pos The position of the element within the storage \f$[0..nonZeros()-1]\f$.
+// \param index The index of the element \f$[0..N-1]\f$.
+// \param value The value of the element.
+// \return void
+//
+// This function sets the element at position \a pos of the storage that has been set up via
+// the layout() function.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag >  // Type tag
+inline void CompressedVector<Type,TF,Tag>::place( size_t pos, size_t index, const Type& value )
+{
+   BLAZE_INTERNAL_ASSERT( pos < nonZeros(), "Invalid storage position" );
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   begin_[pos].value_ = value;
+   begin_[pos].index_ = index;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a dense vector.
 //
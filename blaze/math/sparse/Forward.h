@@ -53,6 +53,11 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0 >        // Type tag
+class CompactDiagonalMatrix;
+
 template< typename Type                   // Data type of the vector
         , bool TF = defaultTransposeFlag  // Transpose flag
         , typename Tag = Group0 >         // Type tag
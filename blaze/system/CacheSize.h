@@ -59,6 +59,13 @@ constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t cacheLineSize = BLAZE_CACHE_LINE_SIZE;
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 
@@ -75,6 +82,8 @@ constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::cacheLineSize >= 16UL && blaze::cacheLineSize <= 1024UL );
+BLAZE_STATIC_ASSERT( ( blaze::cacheLineSize & ( blaze::cacheLineSize - 1UL ) ) == 0UL );
 
 }
 /*! \endcond */
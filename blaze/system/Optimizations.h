@@ -57,6 +57,7 @@ constexpr bool usePadding               = BLAZE_USE_PADDING;
 constexpr bool useStreaming             = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
 constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
+constexpr bool useStrassen              = BLAZE_USE_STRASSEN;
 /*! \endcond */
 //*************************************************************************************************
 
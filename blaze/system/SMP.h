@@ -153,4 +153,80 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  WORK-STEALING MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing scheduler.
+// \ingroup system
+//
+// This compilation switch enables/disables the work-stealing scheduler of the C++11 and Boost
+// thread-based parallelization. The work-stealing scheduler is active in case either the C++11
+// or the Boost thread-based parallelization is active and either the \c BLAZE_USE_WORK_STEALING
+// or the \c BLAZE_USE_NUMA switch is set to 1.
+*/
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && ( BLAZE_USE_WORK_STEALING || BLAZE_USE_NUMA )
+#define BLAZE_WORK_STEALING_MODE 1
+#else
+#define BLAZE_WORK_STEALING_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the NUMA mode of the C++11 and Boost thread-based
+// parallelization. The NUMA mode is active in case either the C++11 or the Boost thread-based
+// parallelization is active and the \c BLAZE_USE_NUMA switch is set to 1.
+*/
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && BLAZE_USE_NUMA
+#define BLAZE_NUMA_MODE 1
+#else
+#define BLAZE_NUMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD-LOCAL SECTION MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for thread-local serial and parallel sections.
+// \ingroup system
+//
+// This compilation switch enables/disables thread-specific activity flags for serial and parallel
+// sections. The flags are thread-specific in case either the C++11 or the Boost thread-based
+// parallelization is active, which enables the concurrent use of the thread backend from several
+// application threads. In combination with the OpenMP and HPX parallelization the flags are
+// shared by all threads, since the tasks of these backends are executed by threads that do not
+// inherit the thread-specific state of the thread that entered the section.
+*/
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && !BLAZE_HPX_PARALLEL_MODE
+#define BLAZE_THREAD_LOCAL_SECTION_MODE 1
+#else
+#define BLAZE_THREAD_LOCAL_SECTION_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -246,20 +246,35 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Strassen-Winograd dense matrix/dense matrix multiplication threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_STRASSEN_THRESHOLD while the Blaze debug mode
+// is active. It specifies the cutoff of the Strassen-Winograd recursion for row-major dense
+// matrix/row-major dense matrix multiplications. In case the smallest dimension of the
+// multiplication is equal or higher than this value, one level of the Strassen-Winograd
+// recursion is applied. Otherwise the classical kernel is used.
+*/
+constexpr size_t STRASSEN_DEBUG_THRESHOLD = 64UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
-constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   );
-constexpr size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   );
-constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+constexpr size_t DMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
+constexpr size_t TDMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
+constexpr size_t TDVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
+constexpr size_t TDVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD );
+constexpr size_t DMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   );
+constexpr size_t DMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  );
+constexpr size_t TDMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  );
+constexpr size_t TDMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD );
+constexpr size_t DMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   );
+constexpr size_t TDMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
+constexpr size_t TSMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
+constexpr size_t TSMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+constexpr size_t STRASSEN_DEFAULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? STRASSEN_DEBUG_THRESHOLD       : BLAZE_STRASSEN_THRESHOLD       );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -967,57 +982,565 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction of a dense vector can be executed in
+// parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the reduction is executed in parallel. If the number of elements is below this
+// threshold the reduction is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector norm threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DVECNORM_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the norm of a dense vector can be computed in parallel.
+// In case the number of elements of the dense vector is larger or equal to this threshold, the
+// norm is computed in parallel. If the number of elements is below this threshold the norm is
+// computed single-threaded.
+*/
+constexpr size_t SMP_DVECNORM_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a dense vector/dense vector inner product can be
+// executed in parallel. In case the number of elements of the dense vectors is larger or equal
+// to this threshold, the inner product is executed in parallel. If the number of elements is
+// below this threshold the inner product is executed single-threaded.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DMATFULLREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction of a dense matrix can be executed in
+// parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the reduction is executed in parallel. If the number of elements is below this
+// threshold the reduction is executed single-threaded.
+*/
+constexpr size_t SMP_DMATFULLREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP compressed matrix assignment threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSIGN_THRESHOLD while the Blaze debug
+// mode is active. It specifies when an assignment to a compressed matrix can be executed in
+// parallel. In case the number of elements to be processed is larger or equal to this threshold,
+// the assignment is executed in parallel. If the number of elements is below this threshold the
+// assignment is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSIGN_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP compressed vector assignment threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_SVECASSIGN_THRESHOLD while the Blaze debug
+// mode is active. It specifies when an assignment to a compressed vector can be executed in
+// parallel. In case the number of elements to be processed is larger or equal to this threshold,
+// the assignment is executed in parallel. If the number of elements is below this threshold the
+// assignment is executed single-threaded.
+*/
+constexpr size_t SMP_SVECASSIGN_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched matrix operation threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_BATCH_THRESHOLD while the Blaze debug mode
+// is active. It specifies when an operation on a MatrixBatch or VectorBatch can be executed in
+// parallel. In case the number of matrices in the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP matrix-free Kronecker product multiplication threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_KRONMULT_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the batch of small matrix multiplications of a matrix-free
+// Kronecker product multiplication can be executed in parallel. In case the number of elements
+// computed by the batch is larger or equal to this threshold, the batch is executed in parallel.
+// If the number of elements is below this threshold the batch is executed single-threaded.
+*/
+constexpr size_t SMP_KRONMULT_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t SMP_DVECASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
+constexpr size_t SMP_DVECSCALARMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
+constexpr size_t SMP_DVECDVECADD_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
+constexpr size_t SMP_DVECDVECSUB_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
+constexpr size_t SMP_DVECDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
+constexpr size_t SMP_DVECDVECDIV_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
+constexpr size_t SMP_DVECDVECOUTER_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
+constexpr size_t SMP_DMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
+constexpr size_t SMP_TDVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
+constexpr size_t SMP_DMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TDMATSVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
+constexpr size_t SMP_TSVECDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATDVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATDVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
+constexpr size_t SMP_TDVECSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATSVECMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
+constexpr size_t SMP_TSMATSVECMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
+constexpr size_t SMP_TSVECSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
+constexpr size_t SMP_DMATASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
+constexpr size_t SMP_DMATSCALARMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
+constexpr size_t SMP_DMATDMATADD_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATADD_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
+constexpr size_t SMP_DMATDMATSUB_DEFAULT_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
+constexpr size_t SMP_DMATTDMATSUB_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
+constexpr size_t SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
+constexpr size_t SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
+constexpr size_t SMP_DMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_DMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
+constexpr size_t SMP_DMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_DMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATDMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
+constexpr size_t SMP_SMATTDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSMATDMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATSMATMULT_DEFAULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
+constexpr size_t SMP_SMATTSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSMATSMATMULT_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
+constexpr size_t SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
+constexpr size_t SMP_DMATREDUCE_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_SMATREDUCE_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECREDUCE_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DVECREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECNORM_DEFAULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? SMP_DVECNORM_DEBUG_THRESHOLD       : BLAZE_SMP_DVECNORM_THRESHOLD       );
+constexpr size_t SMP_DVECDVECINNER_DEFAULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECINNER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECINNER_THRESHOLD  );
+constexpr size_t SMP_DMATFULLREDUCE_DEFAULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATFULLREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATFULLREDUCE_THRESHOLD );
+constexpr size_t SMP_SMATASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_SMATASSIGN_THRESHOLD     );
+constexpr size_t SMP_SVECASSIGN_DEFAULT_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_SVECASSIGN_THRESHOLD     );
+constexpr size_t SMP_BATCH_DEFAULT_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : BLAZE_SMP_BATCH_THRESHOLD          );
+constexpr size_t SMP_KRONMULT_DEFAULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? SMP_KRONMULT_DEBUG_THRESHOLD       : BLAZE_SMP_KRONMULT_THRESHOLD       );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage of the current values of all kernel and SMP thresholds.
+// \ingroup system
+//
+// In contrast to the default thresholds above, the thresholds used for the selection of the
+// computational kernels can be adjusted at runtime (see the setThreshold() function and the
+// \c BLAZE_THRESHOLDS environment variable). The RuntimeThresholds class template holds the
+// current value of each threshold. Note that a threshold must not be changed while a Blaze
+// operation is executed by another thread.
+*/
+template< typename T >
+struct RuntimeThresholds
+{
+   static size_t DMATDVECMULT_THRESHOLD;        //!< Current value of the DMATDVECMULT threshold.
+   static size_t TDMATDVECMULT_THRESHOLD;       //!< Current value of the TDMATDVECMULT threshold.
+   static size_t TDVECDMATMULT_THRESHOLD;       //!< Current value of the TDVECDMATMULT threshold.
+   static size_t TDVECTDMATMULT_THRESHOLD;      //!< Current value of the TDVECTDMATMULT threshold.
+   static size_t DMATDMATMULT_THRESHOLD;        //!< Current value of the DMATDMATMULT threshold.
+   static size_t DMATTDMATMULT_THRESHOLD;       //!< Current value of the DMATTDMATMULT threshold.
+   static size_t TDMATDMATMULT_THRESHOLD;       //!< Current value of the TDMATDMATMULT threshold.
+   static size_t TDMATTDMATMULT_THRESHOLD;      //!< Current value of the TDMATTDMATMULT threshold.
+   static size_t DMATSMATMULT_THRESHOLD;        //!< Current value of the DMATSMATMULT threshold.
+   static size_t TDMATSMATMULT_THRESHOLD;       //!< Current value of the TDMATSMATMULT threshold.
+   static size_t TSMATDMATMULT_THRESHOLD;       //!< Current value of the TSMATDMATMULT threshold.
+   static size_t TSMATTDMATMULT_THRESHOLD;      //!< Current value of the TSMATTDMATMULT threshold.
+   static size_t STRASSEN_THRESHOLD;            //!< Current value of the STRASSEN threshold.
+   static size_t SMP_DVECASSIGN_THRESHOLD;      //!< Current value of the SMP_DVECASSIGN threshold.
+   static size_t SMP_DVECSCALARMULT_THRESHOLD;  //!< Current value of the SMP_DVECSCALARMULT threshold.
+   static size_t SMP_DVECDVECADD_THRESHOLD;     //!< Current value of the SMP_DVECDVECADD threshold.
+   static size_t SMP_DVECDVECSUB_THRESHOLD;     //!< Current value of the SMP_DVECDVECSUB threshold.
+   static size_t SMP_DVECDVECMULT_THRESHOLD;    //!< Current value of the SMP_DVECDVECMULT threshold.
+   static size_t SMP_DVECDVECDIV_THRESHOLD;     //!< Current value of the SMP_DVECDVECDIV threshold.
+   static size_t SMP_DVECDVECOUTER_THRESHOLD;   //!< Current value of the SMP_DVECDVECOUTER threshold.
+   static size_t SMP_DMATDVECMULT_THRESHOLD;    //!< Current value of the SMP_DMATDVECMULT threshold.
+   static size_t SMP_TDMATDVECMULT_THRESHOLD;   //!< Current value of the SMP_TDMATDVECMULT threshold.
+   static size_t SMP_TDVECDMATMULT_THRESHOLD;   //!< Current value of the SMP_TDVECDMATMULT threshold.
+   static size_t SMP_TDVECTDMATMULT_THRESHOLD;  //!< Current value of the SMP_TDVECTDMATMULT threshold.
+   static size_t SMP_DMATSVECMULT_THRESHOLD;    //!< Current value of the SMP_DMATSVECMULT threshold.
+   static size_t SMP_TDMATSVECMULT_THRESHOLD;   //!< Current value of the SMP_TDMATSVECMULT threshold.
+   static size_t SMP_TSVECDMATMULT_THRESHOLD;   //!< Current value of the SMP_TSVECDMATMULT threshold.
+   static size_t SMP_TSVECTDMATMULT_THRESHOLD;  //!< Current value of the SMP_TSVECTDMATMULT threshold.
+   static size_t SMP_SMATDVECMULT_THRESHOLD;    //!< Current value of the SMP_SMATDVECMULT threshold.
+   static size_t SMP_TSMATDVECMULT_THRESHOLD;   //!< Current value of the SMP_TSMATDVECMULT threshold.
+   static size_t SMP_TDVECSMATMULT_THRESHOLD;   //!< Current value of the SMP_TDVECSMATMULT threshold.
+   static size_t SMP_TDVECTSMATMULT_THRESHOLD;  //!< Current value of the SMP_TDVECTSMATMULT threshold.
+   static size_t SMP_SMATSVECMULT_THRESHOLD;    //!< Current value of the SMP_SMATSVECMULT threshold.
+   static size_t SMP_TSMATSVECMULT_THRESHOLD;   //!< Current value of the SMP_TSMATSVECMULT threshold.
+   static size_t SMP_TSVECSMATMULT_THRESHOLD;   //!< Current value of the SMP_TSVECSMATMULT threshold.
+   static size_t SMP_TSVECTSMATMULT_THRESHOLD;  //!< Current value of the SMP_TSVECTSMATMULT threshold.
+   static size_t SMP_DMATASSIGN_THRESHOLD;      //!< Current value of the SMP_DMATASSIGN threshold.
+   static size_t SMP_DMATSCALARMULT_THRESHOLD;  //!< Current value of the SMP_DMATSCALARMULT threshold.
+   static size_t SMP_DMATDMATADD_THRESHOLD;     //!< Current value of the SMP_DMATDMATADD threshold.
+   static size_t SMP_DMATTDMATADD_THRESHOLD;    //!< Current value of the SMP_DMATTDMATADD threshold.
+   static size_t SMP_DMATDMATSUB_THRESHOLD;     //!< Current value of the SMP_DMATDMATSUB threshold.
+   static size_t SMP_DMATTDMATSUB_THRESHOLD;    //!< Current value of the SMP_DMATTDMATSUB threshold.
+   static size_t SMP_DMATDMATSCHUR_THRESHOLD;   //!< Current value of the SMP_DMATDMATSCHUR threshold.
+   static size_t SMP_DMATTDMATSCHUR_THRESHOLD;  //!< Current value of the SMP_DMATTDMATSCHUR threshold.
+   static size_t SMP_DMATDMATMULT_THRESHOLD;    //!< Current value of the SMP_DMATDMATMULT threshold.
+   static size_t SMP_DMATTDMATMULT_THRESHOLD;   //!< Current value of the SMP_DMATTDMATMULT threshold.
+   static size_t SMP_TDMATDMATMULT_THRESHOLD;   //!< Current value of the SMP_TDMATDMATMULT threshold.
+   static size_t SMP_TDMATTDMATMULT_THRESHOLD;  //!< Current value of the SMP_TDMATTDMATMULT threshold.
+   static size_t SMP_DMATSMATMULT_THRESHOLD;    //!< Current value of the SMP_DMATSMATMULT threshold.
+   static size_t SMP_DMATTSMATMULT_THRESHOLD;   //!< Current value of the SMP_DMATTSMATMULT threshold.
+   static size_t SMP_TDMATSMATMULT_THRESHOLD;   //!< Current value of the SMP_TDMATSMATMULT threshold.
+   static size_t SMP_TDMATTSMATMULT_THRESHOLD;  //!< Current value of the SMP_TDMATTSMATMULT threshold.
+   static size_t SMP_SMATDMATMULT_THRESHOLD;    //!< Current value of the SMP_SMATDMATMULT threshold.
+   static size_t SMP_SMATTDMATMULT_THRESHOLD;   //!< Current value of the SMP_SMATTDMATMULT threshold.
+   static size_t SMP_TSMATDMATMULT_THRESHOLD;   //!< Current value of the SMP_TSMATDMATMULT threshold.
+   static size_t SMP_TSMATTDMATMULT_THRESHOLD;  //!< Current value of the SMP_TSMATTDMATMULT threshold.
+   static size_t SMP_SMATSMATMULT_THRESHOLD;    //!< Current value of the SMP_SMATSMATMULT threshold.
+   static size_t SMP_SMATTSMATMULT_THRESHOLD;   //!< Current value of the SMP_SMATTSMATMULT threshold.
+   static size_t SMP_TSMATSMATMULT_THRESHOLD;   //!< Current value of the SMP_TSMATSMATMULT threshold.
+   static size_t SMP_TSMATTSMATMULT_THRESHOLD;  //!< Current value of the SMP_TSMATTSMATMULT threshold.
+   static size_t SMP_DMATREDUCE_THRESHOLD;      //!< Current value of the SMP_DMATREDUCE threshold.
+   static size_t SMP_SMATREDUCE_THRESHOLD;      //!< Current value of the SMP_SMATREDUCE threshold.
+   static size_t SMP_DVECREDUCE_THRESHOLD;      //!< Current value of the SMP_DVECREDUCE threshold.
+   static size_t SMP_DVECNORM_THRESHOLD;        //!< Current value of the SMP_DVECNORM threshold.
+   static size_t SMP_DVECDVECINNER_THRESHOLD;   //!< Current value of the SMP_DVECDVECINNER threshold.
+   static size_t SMP_DMATFULLREDUCE_THRESHOLD;  //!< Current value of the SMP_DMATFULLREDUCE threshold.
+   static size_t SMP_SMATASSIGN_THRESHOLD;      //!< Current value of the SMP_SMATASSIGN threshold.
+   static size_t SMP_SVECASSIGN_THRESHOLD;      //!< Current value of the SMP_SVECASSIGN threshold.
+   static size_t SMP_BATCH_THRESHOLD;           //!< Current value of the SMP_BATCH threshold.
+   static size_t SMP_KRONMULT_THRESHOLD;        //!< Current value of the SMP_KRONMULT threshold.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+size_t RuntimeThresholds<T>::DMATDVECMULT_THRESHOLD = DMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDMATDVECMULT_THRESHOLD = TDMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDVECDMATMULT_THRESHOLD = TDVECDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDVECTDMATMULT_THRESHOLD = TDVECTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::DMATDMATMULT_THRESHOLD = DMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::DMATTDMATMULT_THRESHOLD = DMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDMATDMATMULT_THRESHOLD = TDMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDMATTDMATMULT_THRESHOLD = TDMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::DMATSMATMULT_THRESHOLD = DMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TDMATSMATMULT_THRESHOLD = TDMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TSMATDMATMULT_THRESHOLD = TSMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::TSMATTDMATMULT_THRESHOLD = TSMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::STRASSEN_THRESHOLD = STRASSEN_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECASSIGN_THRESHOLD = SMP_DVECASSIGN_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECSCALARMULT_THRESHOLD = SMP_DVECSCALARMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECADD_THRESHOLD = SMP_DVECDVECADD_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECSUB_THRESHOLD = SMP_DVECDVECSUB_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECMULT_THRESHOLD = SMP_DVECDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECDIV_THRESHOLD = SMP_DVECDVECDIV_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECOUTER_THRESHOLD = SMP_DVECDVECOUTER_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATDVECMULT_THRESHOLD = SMP_DMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATDVECMULT_THRESHOLD = SMP_TDMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDVECDMATMULT_THRESHOLD = SMP_TDVECDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDVECTDMATMULT_THRESHOLD = SMP_TDVECTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATSVECMULT_THRESHOLD = SMP_DMATSVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATSVECMULT_THRESHOLD = SMP_TDMATSVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSVECDMATMULT_THRESHOLD = SMP_TSVECDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSVECTDMATMULT_THRESHOLD = SMP_TSVECTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATDVECMULT_THRESHOLD = SMP_SMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATDVECMULT_THRESHOLD = SMP_TSMATDVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDVECSMATMULT_THRESHOLD = SMP_TDVECSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDVECTSMATMULT_THRESHOLD = SMP_TDVECTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATSVECMULT_THRESHOLD = SMP_SMATSVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATSVECMULT_THRESHOLD = SMP_TSMATSVECMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSVECSMATMULT_THRESHOLD = SMP_TSVECSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSVECTSMATMULT_THRESHOLD = SMP_TSVECTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATASSIGN_THRESHOLD = SMP_DMATASSIGN_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATSCALARMULT_THRESHOLD = SMP_DMATSCALARMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATDMATADD_THRESHOLD = SMP_DMATDMATADD_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATTDMATADD_THRESHOLD = SMP_DMATTDMATADD_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATDMATSUB_THRESHOLD = SMP_DMATDMATSUB_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATTDMATSUB_THRESHOLD = SMP_DMATTDMATSUB_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATDMATSCHUR_THRESHOLD = SMP_DMATDMATSCHUR_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATTDMATSCHUR_THRESHOLD = SMP_DMATTDMATSCHUR_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATDMATMULT_THRESHOLD = SMP_DMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATTDMATMULT_THRESHOLD = SMP_DMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATDMATMULT_THRESHOLD = SMP_TDMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATTDMATMULT_THRESHOLD = SMP_TDMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATSMATMULT_THRESHOLD = SMP_DMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATTSMATMULT_THRESHOLD = SMP_DMATTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATSMATMULT_THRESHOLD = SMP_TDMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TDMATTSMATMULT_THRESHOLD = SMP_TDMATTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATDMATMULT_THRESHOLD = SMP_SMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATTDMATMULT_THRESHOLD = SMP_SMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATDMATMULT_THRESHOLD = SMP_TSMATDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATTDMATMULT_THRESHOLD = SMP_TSMATTDMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATSMATMULT_THRESHOLD = SMP_SMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATTSMATMULT_THRESHOLD = SMP_SMATTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATSMATMULT_THRESHOLD = SMP_TSMATSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_TSMATTSMATMULT_THRESHOLD = SMP_TSMATTSMATMULT_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATREDUCE_THRESHOLD = SMP_DMATREDUCE_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATREDUCE_THRESHOLD = SMP_SMATREDUCE_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECREDUCE_THRESHOLD = SMP_DVECREDUCE_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECNORM_THRESHOLD = SMP_DVECNORM_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DVECDVECINNER_THRESHOLD = SMP_DVECDVECINNER_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_DMATFULLREDUCE_THRESHOLD = SMP_DMATFULLREDUCE_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SMATASSIGN_THRESHOLD = SMP_SMATASSIGN_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_SVECASSIGN_THRESHOLD = SMP_SVECASSIGN_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_BATCH_THRESHOLD = SMP_BATCH_DEFAULT_THRESHOLD;
+
+template< typename T >
+size_t RuntimeThresholds<T>::SMP_KRONMULT_THRESHOLD = SMP_KRONMULT_DEFAULT_THRESHOLD;
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
-constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t& DMATDVECMULT_THRESHOLD       = RuntimeThresholds<int>::DMATDVECMULT_THRESHOLD;
+constexpr size_t& TDMATDVECMULT_THRESHOLD      = RuntimeThresholds<int>::TDMATDVECMULT_THRESHOLD;
+constexpr size_t& TDVECDMATMULT_THRESHOLD      = RuntimeThresholds<int>::TDVECDMATMULT_THRESHOLD;
+constexpr size_t& TDVECTDMATMULT_THRESHOLD     = RuntimeThresholds<int>::TDVECTDMATMULT_THRESHOLD;
+constexpr size_t& DMATDMATMULT_THRESHOLD       = RuntimeThresholds<int>::DMATDMATMULT_THRESHOLD;
+constexpr size_t& DMATTDMATMULT_THRESHOLD      = RuntimeThresholds<int>::DMATTDMATMULT_THRESHOLD;
+constexpr size_t& TDMATDMATMULT_THRESHOLD      = RuntimeThresholds<int>::TDMATDMATMULT_THRESHOLD;
+constexpr size_t& TDMATTDMATMULT_THRESHOLD     = RuntimeThresholds<int>::TDMATTDMATMULT_THRESHOLD;
+constexpr size_t& DMATSMATMULT_THRESHOLD       = RuntimeThresholds<int>::DMATSMATMULT_THRESHOLD;
+constexpr size_t& TDMATSMATMULT_THRESHOLD      = RuntimeThresholds<int>::TDMATSMATMULT_THRESHOLD;
+constexpr size_t& TSMATDMATMULT_THRESHOLD      = RuntimeThresholds<int>::TSMATDMATMULT_THRESHOLD;
+constexpr size_t& TSMATTDMATMULT_THRESHOLD     = RuntimeThresholds<int>::TSMATTDMATMULT_THRESHOLD;
+constexpr size_t& STRASSEN_THRESHOLD           = RuntimeThresholds<int>::STRASSEN_THRESHOLD;
+constexpr size_t& SMP_DVECASSIGN_THRESHOLD     = RuntimeThresholds<int>::SMP_DVECASSIGN_THRESHOLD;
+constexpr size_t& SMP_DVECSCALARMULT_THRESHOLD = RuntimeThresholds<int>::SMP_DVECSCALARMULT_THRESHOLD;
+constexpr size_t& SMP_DVECDVECADD_THRESHOLD    = RuntimeThresholds<int>::SMP_DVECDVECADD_THRESHOLD;
+constexpr size_t& SMP_DVECDVECSUB_THRESHOLD    = RuntimeThresholds<int>::SMP_DVECDVECSUB_THRESHOLD;
+constexpr size_t& SMP_DVECDVECMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_DVECDVECMULT_THRESHOLD;
+constexpr size_t& SMP_DVECDVECDIV_THRESHOLD    = RuntimeThresholds<int>::SMP_DVECDVECDIV_THRESHOLD;
+constexpr size_t& SMP_DVECDVECOUTER_THRESHOLD  = RuntimeThresholds<int>::SMP_DVECDVECOUTER_THRESHOLD;
+constexpr size_t& SMP_DMATDVECMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATDVECMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATDVECMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDMATDVECMULT_THRESHOLD;
+constexpr size_t& SMP_TDVECDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDVECDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDVECTDMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TDVECTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATSVECMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATSVECMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATSVECMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDMATSVECMULT_THRESHOLD;
+constexpr size_t& SMP_TSVECDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSVECDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSVECTDMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TSVECTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATDVECMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_SMATDVECMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATDVECMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSMATDVECMULT_THRESHOLD;
+constexpr size_t& SMP_TDVECSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDVECSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDVECTSMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TDVECTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATSVECMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_SMATSVECMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATSVECMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSMATSVECMULT_THRESHOLD;
+constexpr size_t& SMP_TSVECSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSVECSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSVECTSMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TSVECTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATASSIGN_THRESHOLD     = RuntimeThresholds<int>::SMP_DMATASSIGN_THRESHOLD;
+constexpr size_t& SMP_DMATSCALARMULT_THRESHOLD = RuntimeThresholds<int>::SMP_DMATSCALARMULT_THRESHOLD;
+constexpr size_t& SMP_DMATDMATADD_THRESHOLD    = RuntimeThresholds<int>::SMP_DMATDMATADD_THRESHOLD;
+constexpr size_t& SMP_DMATTDMATADD_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATTDMATADD_THRESHOLD;
+constexpr size_t& SMP_DMATDMATSUB_THRESHOLD    = RuntimeThresholds<int>::SMP_DMATDMATSUB_THRESHOLD;
+constexpr size_t& SMP_DMATTDMATSUB_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATTDMATSUB_THRESHOLD;
+constexpr size_t& SMP_DMATDMATSCHUR_THRESHOLD  = RuntimeThresholds<int>::SMP_DMATDMATSCHUR_THRESHOLD;
+constexpr size_t& SMP_DMATTDMATSCHUR_THRESHOLD = RuntimeThresholds<int>::SMP_DMATTDMATSCHUR_THRESHOLD;
+constexpr size_t& SMP_DMATDMATMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATDMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATTDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_DMATTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDMATDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATTDMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TDMATTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATSMATMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_DMATSMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATTSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_DMATTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TDMATSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TDMATTSMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TDMATTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATDMATMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_SMATDMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATTDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_SMATTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATDMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSMATDMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATTDMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TSMATTDMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATSMATMULT_THRESHOLD   = RuntimeThresholds<int>::SMP_SMATSMATMULT_THRESHOLD;
+constexpr size_t& SMP_SMATTSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_SMATTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATSMATMULT_THRESHOLD  = RuntimeThresholds<int>::SMP_TSMATSMATMULT_THRESHOLD;
+constexpr size_t& SMP_TSMATTSMATMULT_THRESHOLD = RuntimeThresholds<int>::SMP_TSMATTSMATMULT_THRESHOLD;
+constexpr size_t& SMP_DMATREDUCE_THRESHOLD     = RuntimeThresholds<int>::SMP_DMATREDUCE_THRESHOLD;
+constexpr size_t& SMP_SMATREDUCE_THRESHOLD     = RuntimeThresholds<int>::SMP_SMATREDUCE_THRESHOLD;
+constexpr size_t& SMP_DVECREDUCE_THRESHOLD     = RuntimeThresholds<int>::SMP_DVECREDUCE_THRESHOLD;
+constexpr size_t& SMP_DVECNORM_THRESHOLD       = RuntimeThresholds<int>::SMP_DVECNORM_THRESHOLD;
+constexpr size_t& SMP_DVECDVECINNER_THRESHOLD  = RuntimeThresholds<int>::SMP_DVECDVECINNER_THRESHOLD;
+constexpr size_t& SMP_DMATFULLREDUCE_THRESHOLD = RuntimeThresholds<int>::SMP_DMATFULLREDUCE_THRESHOLD;
+constexpr size_t& SMP_SMATASSIGN_THRESHOLD     = RuntimeThresholds<int>::SMP_SMATASSIGN_THRESHOLD;
+constexpr size_t& SMP_SVECASSIGN_THRESHOLD     = RuntimeThresholds<int>::SMP_SVECASSIGN_THRESHOLD;
+constexpr size_t& SMP_BATCH_THRESHOLD          = RuntimeThresholds<int>::SMP_BATCH_THRESHOLD;
+constexpr size_t& SMP_KRONMULT_THRESHOLD       = RuntimeThresholds<int>::SMP_KRONMULT_THRESHOLD;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1036,14 +1559,14 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_DEFAULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_DEFAULT_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_DEFAULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_DEFAULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_DEFAULT_THRESHOLD > 0UL );
 
 }
 /*! \endcond */
@@ -385,6 +385,33 @@
 //*************************************************************************************************
 
 
+//=================================================================================================
+//
+//  RUNTIME DISPATCH CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case it is requested via the BLAZE_USE_RUNTIME_DISPATCH
+// switch and the GNU or Clang compiler is used on an x86-64 platform), the Blaze library
+// selects the instruction set for several performance critical kernels at runtime. In case
+// the runtime dispatch mode is disabled, the instruction set is selected at compile time.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && \
+    ( defined(__GNUC__) || defined(__clang__) ) && defined(__x86_64__) && !defined(__INTEL_COMPILER)
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/CacheInfo.h
+//  \brief Header file for the runtime detection of the cache sizes
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_UTIL_CACHEINFO_H_
+#define _BLAZE_UTIL_CACHEINFO_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+#if defined(__linux__)
+#  include <unistd.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sizes of the data caches of the executing machine.
+// \ingroup util
+//
+// The CacheInfo class represents the sizes (in Byte) of the level 1, level 2, and level 3 data
+// caches as they are seen by a single core. In case the machine does not provide a particular
+// cache level, the according size is 0.
+*/
+struct CacheInfo
+{
+   size_t l1;  //!< The size of the level 1 data cache.
+   size_t l2;  //!< The size of the level 2 cache.
+   size_t l3;  //!< The size of the level 3 cache.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the size of a single cache from the Linux sysfs.
+// \ingroup util
+//
+// \param index The index of the cache of CPU 0.
+// \param level The level of the cache.
+// \return The size of the cache in Byte (0 for instruction caches and unavailable caches).
+*/
+inline size_t readSysfsCacheSize( size_t index, size_t& level )
+{
+#if defined(__linux__)
+   char path[128];
+   char buffer[64];
+
+   const auto readEntry = [&]( const char* entry ) -> bool
+   {
+      std::snprintf( path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%lu/%s",
+                     static_cast<unsigned long>( index ), entry );
+
+      std::FILE* file( std::fopen( path, "r" ) );
+      if( file == nullptr )
+         return false;
+
+      const bool success( std::fgets( buffer, sizeof(buffer), file ) != nullptr );
+      std::fclose( file );
+      return success;
+   };
+
+   if( !readEntry( "type" ) || buffer[0] == 'I' )
+      return 0UL;
+
+   if( !readEntry( "level" ) )
+      return 0UL;
+
+   level = std::strtoul( buffer, nullptr, 10 );
+
+   if( !readEntry( "size" ) )
+      return 0UL;
+
+   char* end( nullptr );
+   size_t size( std::strtoul( buffer, &end, 10 ) );
+
+   switch( std::toupper( static_cast<unsigned char>( *end ) ) ) {
+      case 'K': size *= 1024UL; break;
+      case 'M': size *= 1024UL*1024UL; break;
+      case 'G': size *= 1024UL*1024UL*1024UL; break;
+      default: break;
+   }
+
+   return size;
+#else
+   MAYBE_UNUSED( index );
+   level = 0UL;
+   return 0UL;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detects the sizes of the data caches of the executing machine.
+// \ingroup util
+//
+// \return The detected cache sizes.
+//
+// This function determines the sizes of the level 1, level 2, and level 3 data caches. On Linux
+// systems the sizes are read from the sysfs (\c /sys/devices/system/cpu/cpu0/cache) and, if
+// this is not available, queried via \c sysconf(). Cache levels that cannot be detected fall
+// back to 32 KiB (level 1), 256 KiB (level 2), and \c BLAZE_CACHE_SIZE (level 3), respectively.
+*/
+inline CacheInfo detectCacheInfo()
+{
+   CacheInfo info{ 0UL, 0UL, 0UL };
+
+   for( size_t index=0UL; index<8UL; ++index )
+   {
+      size_t level( 0UL );
+      const size_t size( readSysfsCacheSize( index, level ) );
+
+      if( size == 0UL ) continue;
+
+      if     ( level == 1UL ) info.l1 = size;
+      else if( level == 2UL ) info.l2 = size;
+      else if( level == 3UL ) info.l3 = size;
+   }
+
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+   const auto query = []( int name ) -> size_t {
+      const long size( ::sysconf( name ) );
+      return ( size > 0L )?( static_cast<size_t>( size ) ):( 0UL );
+   };
+
+   if( info.l1 == 0UL ) info.l1 = query( _SC_LEVEL1_DCACHE_SIZE );
+   if( info.l2 == 0UL ) info.l2 = query( _SC_LEVEL2_CACHE_SIZE );
+   if( info.l3 == 0UL ) info.l3 = query( _SC_LEVEL3_CACHE_SIZE );
+#endif
+
+   if( info.l1 == 0UL ) info.l1 = 32768UL;
+   if( info.l2 == 0UL ) info.l2 = 262144UL;
+   if( info.l3 == 0UL ) info.l3 = cacheSize;
+
+   return info;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sizes of the data caches of the executing machine.
+// \ingroup util
+//
+// \return The detected cache sizes.
+//
+// This function returns the cache sizes determined by detectCacheInfo(). The detection is only
+// performed once, on the first call of the function.
+*/
+inline const CacheInfo& getCacheInfo()
+{
+   static const CacheInfo info( detectCacheInfo() );
+   return info;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/InstructionSet.h
+//  \brief Header file for the runtime detection of the SIMD instruction set
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_INSTRUCTIONSET_H_
+#define _BLAZE_UTIL_INSTRUCTIONSET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief SIMD instruction sets supported by the runtime dispatch of the SIMD kernels.
+// \ingroup util
+//
+// The enumeration values are ordered by the width of the SIMD registers, i.e. a larger value
+// represents a wider instruction set. The \a avx2 instruction set additionally implies the
+// support of fused multiply-add (FMA) operations.
+*/
+enum InstructionSet
+{
+   sse2    = 0,  //!< 128-bit SIMD operations (SSE2).
+   avx2    = 1,  //!< 256-bit SIMD operations (AVX2 and FMA).
+   avx512f = 2   //!< 512-bit SIMD operations (AVX-512F).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set selected at compile time.
+// \ingroup util
+//
+// \return The widest instruction set enabled at compile time.
+*/
+constexpr InstructionSet compileTimeInstructionSet() noexcept
+{
+   return ( BLAZE_AVX512F_MODE )
+          ?( avx512f )
+          :( ( BLAZE_AVX2_MODE && BLAZE_FMA_MODE )?( avx2 ):( sse2 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detects the widest instruction set supported by the executing CPU.
+// \ingroup util
+//
+// \return The widest supported instruction set.
+//
+// In case the runtime dispatch mode is enabled (see the BLAZE_USE_RUNTIME_DISPATCH switch), this
+// function queries the executing CPU via the \c cpuid instruction. Note that an instruction set
+// is only reported as supported if the operating system also saves the according SIMD registers.
+// In case the runtime dispatch mode is disabled, the function returns the instruction set
+// selected at compile time.
+*/
+inline InstructionSet detectInstructionSet()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return avx512f;
+   if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return avx2;
+   return sse2;
+#else
+   return compileTimeInstructionSet();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set of the runtime dispatched SIMD kernels.
+// \ingroup util
+//
+// \return The selected instruction set.
+//
+// This function returns the instruction set that is used by all runtime dispatched SIMD kernels.
+// The instruction set is selected on the first call of the function, which is the widest
+// instruction set supported by the executing CPU (see detectInstructionSet()). It is possible
+// to restrict the selection via the \c BLAZE_INSTRUCTION_SET environment variable, which accepts
+// the values \c sse2, \c avx2, and \c avx512f:
+
+   \code
+   BLAZE_INSTRUCTION_SET=avx2 ./program
+   \endcode
+
+// An instruction set that is not supported by the executing CPU is never selected. Invalid
+// values of the environment variable are ignored.
+*/
+inline InstructionSet getInstructionSet()
+{
+   static const InstructionSet isa( []() -> InstructionSet
+   {
+      const InstructionSet detected( detectInstructionSet() );
+
+      const char* env( std::getenv( "BLAZE_INSTRUCTION_SET" ) );
+      InstructionSet requested( detected );
+
+      if( env == nullptr ) return detected;
+      else if( std::strcmp( env, "sse2"    ) == 0 ) requested = sse2;
+      else if( std::strcmp( env, "avx2"    ) == 0 ) requested = avx2;
+      else if( std::strcmp( env, "avx512f" ) == 0 ) requested = avx512f;
+
+      return ( requested < detected )?( requested ):( detected );
+   }() );
+
+   return isa;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
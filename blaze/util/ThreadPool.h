@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -48,7 +49,9 @@
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/CountingBarrier.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
 
@@ -193,6 +196,41 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_spinning Spin-then-park synchronization
+//
+// By default, idle threads of a thread pool immediately go to sleep on a condition variable
+// and the wait() function immediately blocks until all tasks have been completed. For short
+// tasks the cost of putting a thread to sleep and waking it up again may exceed the cost of the
+// actual work. For this reason it is possible to specify a spin budget via the second constructor
+// argument. Both idle threads and threads calling the wait() function first spin for the given
+// number of iterations before they are parked on a condition variable:
+
+   \code
+   // Creating a thread pool with four threads, which spin for 10000 iterations before sleeping
+   StdThreadPool threadpool( 4, 10000UL );
+   \endcode
+
+// Note that the join point of the thread pool is implemented in terms of a lock-free counting
+// barrier (see the threadpool::CountingBarrier class template), i.e. the synchronization mutex
+// is only acquired in case a waiting thread actually has to be parked.
+//
+// \section threadpool_taskgroups Task groups
+//
+// The wait() function of a thread pool blocks until all scheduled tasks have been completed.
+// In case several threads share a single thread pool, this means that every thread also waits
+// for the tasks of all other threads. In order to join only a subset of the scheduled tasks, it
+// is possible to schedule tasks as part of a task group (see the threadpool::TaskGroup class
+// template):
+
+   \code
+   StdThreadPool::TaskGroup group;
+
+   threadpool.schedule( group, function0 );
+   threadpool.schedule( group, Functor2(), 4, 6 );
+
+   group.wait();  // Only waits for the two tasks of the task group
+   \endcode
+
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -323,13 +361,21 @@ class ThreadPool
    using Mutex     = MT;                     //!< Type of the mutex.
    using Lock      = LT;                     //!< Type of a locking object.
    using Condition = CT;                     //!< Condition variable type.
+
+   //! Type of the barrier for the completion of the scheduled tasks.
+   using Barrier = threadpool::CountingBarrier<MT,LT,CT>;
    //**********************************************************************************************
 
  public:
+   //**Type definitions****************************************************************************
+   //! Type of a group of tasks that can be joined independently of all other tasks.
+   using TaskGroup = threadpool::TaskGroup<MT,LT,CT>;
+   //**********************************************************************************************
+
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, size_t spin=0UL );
    //@}
    //**********************************************************************************************
 
@@ -347,6 +393,7 @@ class ThreadPool
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+   inline size_t spin()    const;
    //@}
    //**********************************************************************************************
 
@@ -355,6 +402,9 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void schedule( TaskGroup& group, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -373,22 +423,25 @@ class ThreadPool
    //@{
    void createThread();
    bool executeTask();
+   void clearTasks();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   volatile size_t total_;       //!< Total number of threads in the thread pool.
+   volatile size_t expected_;    //!< Expected number of threads in the thread pool.
+                                  /*!< This number may differ from the total number of threads
+                                       during a resize of the thread pool. */
+   volatile size_t active_;      //!< Number of currently active/busy threads.
+   Threads threads_;             //!< The threads contained in the thread pool.
+   TaskQueue taskqueue_;         //!< Task queue for the scheduled tasks.
+   std::atomic<size_t> queued_;  //!< Number of currently queued tasks.
+   Barrier barrier_;             //!< Counting barrier for the completion of the scheduled tasks.
+   mutable Mutex mutex_;         //!< Synchronization mutex.
+   Condition waitForTask_;       //!< Wait condition for idle threads.
+   Condition waitForThread_;     //!< Wait condition for the thread management.
    //@}
    //**********************************************************************************************
 
@@ -413,6 +466,7 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param spin Number of spin iterations before an idle or waiting thread is parked.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
 // initially idle until a task is scheduled.
@@ -421,12 +475,14 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, size_t spin )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
    , threads_      ()  // The threads contained in the thread pool
    , taskqueue_    ()  // Task queue for the scheduled tasks
+   , queued_  ( 0UL )  // Number of currently queued tasks
+   , barrier_( spin )  // Counting barrier for the completion of the scheduled tasks
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
@@ -459,7 +515,7 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    Lock lock( mutex_ );
 
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   clearTasks();
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -559,6 +615,22 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before an idle or waiting thread is parked.
+//
+// \return The number of spin iterations.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::spin() const
+{
+   return barrier_.spin();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -588,6 +660,41 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
    Lock lock( mutex_ );
    taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++queued_;
+   barrier_.add();
+   waitForTask_.notify_one();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution as part of the given task group.
+//
+// \param group The task group the new task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution as part of the given task
+// group. In contrast to the wait() function of the thread pool, the wait() function of the task
+// group only blocks until the tasks of this particular group have been completed. The given
+// function/functor must be copyable, must be callable with the given type and number of arguments
+// and must return \c void.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::schedule( TaskGroup& group, Callable func, Args&&... args )
+{
+   threadpool::Task task( group.wrap( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   Lock lock( mutex_ );
+   taskqueue_.push( std::move( task ) );
+   ++queued_;
+   barrier_.add();
    waitForTask_.notify_one();
 }
 //*************************************************************************************************
@@ -692,7 +799,9 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. The calling thread first
+// spins for the specified number of iterations and only then is parked until the last task has
+// been completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -700,11 +809,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
-   Lock lock( mutex_ );
-
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
-      waitForThread_.wait( lock );
-   }
+   barrier_.wait();
 }
 //*************************************************************************************************
 
@@ -724,7 +829,7 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+   clearTasks();
 }
 //*************************************************************************************************
 
@@ -773,6 +878,13 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
 {
    threadpool::Task task;
 
+   // Spinning for a new task before going to sleep
+   const size_t spin( barrier_.spin() );
+
+   for( size_t i=0UL; queued_ == 0UL && i<spin; ++i ) {
+      threadpool::cpuRelax();
+   }
+
    // Acquiring a scheduled task
    {
       Lock lock( mutex_ );
@@ -793,15 +905,42 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
 
       BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
       task = taskqueue_.pop();
+      --queued_;
    }
 
    // Executing the task
    task();
 
+   // Signaling the completion of the task
+   barrier_.arrive();
+
    return true;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the task queue.
+//
+// \return void
+//
+// This function removes all currently queued tasks and marks them as completed. It must only be
+// called while the synchronization mutex is locked.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::clearTasks()
+{
+   const size_t removed( taskqueue_.size() );
+
+   taskqueue_.clear();
+   queued_ -= removed;
+   barrier_.arrive( removed );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
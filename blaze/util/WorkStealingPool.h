@@ -0,0 +1,830 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the WorkStealingPool class
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/CountingBarrier.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/threadpool/WorkStealingQueue.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingpool_general General
+//
+// The WorkStealingPool class template represents a thread pool with the same interface as the
+// ThreadPool class template, but with a different scheduling strategy. Whereas the ThreadPool
+// class stores all scheduled tasks in a single task queue, which is protected by a single mutex
+// and condition variable, every worker thread of a WorkStealingPool owns a separate task queue
+// (see the threadpool::WorkStealingQueue class template). Newly scheduled tasks are distributed
+// in a round-robin fashion among the workers. A worker primarily processes the tasks of its own
+// queue; as soon as its own queue runs dry it tries to steal a task from the queue of a randomly
+// selected victim. This has two major advantages on systems with many cores:
+//
+//  - The synchronization cost is distributed over all workers instead of being concentrated
+//    on a single lock, which would otherwise become a bottleneck for large numbers of threads.
+//  - Tasks of slow workers (for instance due to a busy or throttled core) are automatically
+//    taken over by faster workers. In combination with splitting the work into more tasks than
+//    threads, this results in an automatic rebalancing of the workload.
+//
+// \section workstealingpool_definition Class Definition
+//
+// Analogous to the ThreadPool class template, the WorkStealingPool can be configured via four
+// template parameters as either a C++11 thread pool or a Boost thread pool:
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class WorkStealingPool;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can either be \c std::thread,
+//        \c boost::thread, or any other standard conforming thread type.
+//  - MT: specifies the type of the used synchronization mutex. This can for instance be
+//        \c std::mutex, \c boost::mutex, or any other standard conforming mutex type.
+//  - LT: specifies the type of lock used in combination with the given mutex type. This
+//        can be any standard conforming lock type, as for instance \c std::unique_lock,
+//        \c boost::unique_lock.
+//  - CT: specifies the type of the used condition variable. This can for instance be
+//        \c std::condition_variable, \c boost::condition_variable, or any other standard
+//        conforming condition variable type.
+//
+// \section workstealingpool_setup Using the WorkStealingPool class
+//
+// The WorkStealingPool class is used exactly as the ThreadPool class:
+
+   \code
+   using StdWorkStealingPool = blaze::WorkStealingPool< std::thread
+                                                      , std::mutex
+                                                      , std::unique_lock<std::mutex>
+                                                      , std::condition_variable >;
+
+   StdWorkStealingPool pool( 4 );
+
+   pool.schedule( function0 );
+   pool.schedule( Functor2(), 4, 6 );
+
+   pool.wait();
+   \endcode
+
+// Analogous to the ThreadPool class, the second constructor argument specifies the number of
+// spin iterations before an idle thread or a thread calling the wait() function is parked on
+// a condition variable. Note that in contrast to the ThreadPool class, resizing a
+// WorkStealingPool via the resize() function always blocks until all currently scheduled tasks
+// have been completed.
+//
+// \section workstealingpool_affinity Thread affinity
+//
+// Optionally, the worker threads can be bound to a list of logical CPUs, which is passed as
+// third constructor argument. The i-th worker is bound to the \f$ i \bmod k \f$-th of the
+// \a k given CPUs. In combination with the scheduleOn() function, which assigns a task to the
+// queue of a particular worker, this enables to execute related tasks on the same CPU:
+
+   \code
+   StdWorkStealingPool pool( 4, 0, { 0, 2, 4, 6 } );
+   StdWorkStealingPool::TaskGroup group;
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      pool.scheduleOn( i, group, function1, i );  // Preferably executed on CPU 2*(i%4)
+   }
+
+   group.wait();
+   \endcode
+
+// Note that idle workers may still steal tasks from other workers.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingPool
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Mutex     = MT;  //!< Type of the mutex.
+   using Lock      = LT;  //!< Type of a locking object.
+   using Condition = CT;  //!< Condition variable type.
+
+   //! Type of the task queue of a single worker.
+   using TaskQueue = threadpool::WorkStealingQueue<MT,LT>;
+
+   //! Type of the barrier for the completion of the scheduled tasks.
+   using Barrier = threadpool::CountingBarrier<MT,LT,CT>;
+
+   //! Type of the container for the worker threads.
+   using Threads = std::vector< std::unique_ptr<TT> >;
+
+   //! Type of the container for the task queues of the worker threads.
+   using TaskQueues = std::vector< std::unique_ptr<TaskQueue> >;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of a group of tasks that can be joined independently of all other tasks.
+   using TaskGroup = threadpool::TaskGroup<MT,LT,CT>;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n, size_t spin=0UL, std::vector<size_t> cpus={} );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   inline size_t active()  const;
+   inline size_t ready()   const;
+   inline size_t spin()    const;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable, typename... Args >
+   void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void schedule( TaskGroup& group, Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void scheduleOn( size_t index, TaskGroup& group, Callable func, Args&&... args );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   void clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void createThreads( size_t n );
+   void destroyThreads();
+   void run( size_t index );
+   bool acquireTask( size_t index, threadpool::Task& task, size_t& seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> queued_;  //!< Number of tasks currently stored in the task queues.
+   std::atomic<size_t> idle_;    //!< Number of currently idle/sleeping workers.
+   std::atomic<size_t> next_;    //!< Index of the next task queue for round-robin scheduling.
+   bool shutdown_;               //!< Termination flag for all worker threads.
+   Threads threads_;             //!< The worker threads of the thread pool.
+   std::vector<size_t> cpus_;    //!< The logical CPUs of the worker threads (empty if unbound).
+   TaskQueues taskqueues_;       //!< The task queues of the individual worker threads.
+   Barrier barrier_;             //!< Counting barrier for the completion of the scheduled tasks.
+   mutable Mutex mutex_;         //!< Synchronization mutex.
+   Mutex resizeMutex_;           //!< Synchronization mutex for the resize of the thread pool.
+   Condition waitForTask_;       //!< Wait condition for idle threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \param spin Number of spin iterations before an idle or waiting thread is parked.
+// \param cpus The logical CPUs to bind the worker threads to (empty for unbound threads).
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates a work-stealing thread pool with initially \a n new threads. All
+// threads are initially idle until a task is scheduled. In case a list of logical CPUs is
+// given, the i-th worker thread is bound to the \f$ i \bmod k \f$-th of the \a k CPUs.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::WorkStealingPool( size_t n, size_t spin, std::vector<size_t> cpus )
+   : queued_  ( 0UL )    // Number of tasks currently stored in the task queues
+   , idle_    ( 0UL )    // Number of currently idle/sleeping workers
+   , next_    ( 0UL )    // Index of the next task queue for round-robin scheduling
+   , shutdown_( false )  // Termination flag for all worker threads
+   , threads_     ()     // The worker threads of the thread pool
+   , cpus_        ( std::move( cpus ) )  // The logical CPUs of the worker threads
+   , taskqueues_  ()     // The task queues of the individual worker threads
+   , barrier_( spin )    // Counting barrier for the completion of the scheduled tasks
+   , mutex_       ()     // Synchronization mutex
+   , resizeMutex_ ()     // Synchronization mutex for the resize of the thread pool
+   , waitForTask_ ()     // Wait condition for idle threads
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor clears all remaining tasks from the task queues and waits for the currently
+// active threads to complete their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::~WorkStealingPool()
+{
+   Lock lock( resizeMutex_ );
+   clear();
+   destroyThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case task are scheduled, \a false otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isEmpty() const
+{
+   return queued_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the work-stealing thread pool.
+//
+// \return The total number of threads in the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::size() const
+{
+   Lock lock( mutex_ );
+   return threads_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently active/busy threads.
+//
+// \return The number of currently active threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::active() const
+{
+   Lock lock( mutex_ );
+   return threads_.size() - idle_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently ready/inactive threads.
+//
+// \return The number of currently ready threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::ready() const
+{
+   return idle_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before an idle or waiting thread is parked.
+//
+// \return The number of spin iterations.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::spin() const
+{
+   return barrier_.spin();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with the given type and number of arguments and must return
+// \c void. The task is added to the task queue of the next worker in a round-robin fashion. Only
+// in case there are idle workers the shared synchronization mutex is acquired to wake up one
+// of them.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
+{
+   BLAZE_INTERNAL_ASSERT( !taskqueues_.empty(), "Invalid work-stealing pool detected" );
+
+   const size_t index( next_++ % taskqueues_.size() );
+
+   barrier_.add();
+   ++queued_;
+   taskqueues_[index]->push( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   if( idle_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution as part of the given task group.
+//
+// \param group The task group the new task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution as part of the given task
+// group. In contrast to the wait() function of the thread pool, the wait() function of the task
+// group only blocks until the tasks of this particular group have been completed. The given
+// function/functor must be copyable, must be callable with the given type and number of arguments
+// and must return \c void.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::schedule( TaskGroup& group, Callable func, Args&&... args )
+{
+   BLAZE_INTERNAL_ASSERT( !taskqueues_.empty(), "Invalid work-stealing pool detected" );
+
+   threadpool::Task task( group.wrap( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   const size_t index( next_++ % taskqueues_.size() );
+
+   barrier_.add();
+   ++queued_;
+   taskqueues_[index]->push( std::move( task ) );
+
+   if( idle_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution by a particular worker.
+//
+// \param index The index of the worker thread (taken modulo the number of workers).
+// \param group The task group the new task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution as part of the given task
+// group. In contrast to the schedule() functions, which distribute the tasks in a round-robin
+// fashion, the task is added to the task queue of the worker with the given index. Therefore
+// tasks scheduled with the same index are preferably executed by the same worker (and in case
+// of bound workers on the same logical CPU). Note however that idle workers may steal the task.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::scheduleOn( size_t index, TaskGroup& group, Callable func, Args&&... args )
+{
+   BLAZE_INTERNAL_ASSERT( !taskqueues_.empty(), "Invalid work-stealing pool detected" );
+
+   threadpool::Task task( group.wrap( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   barrier_.add();
+   ++queued_;
+   taskqueues_[index % taskqueues_.size()]->push( std::move( task ) );
+
+   if( idle_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the work-stealing thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block Ignored; the function always blocks until the resize is complete.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the thread pool, i.e. changes the total number of threads
+// contained in the pool. Since every worker owns a separate task queue, the function first
+// waits for all currently scheduled tasks to be completed before the worker threads are
+// replaced. For this reason the function must not be called from within a scheduled task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   MAYBE_UNUSED( block );
+
+   // Checking the given number of threads
+#if !(defined _MSC_VER)
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+#endif
+
+   Lock lock( resizeMutex_ );
+
+   if( n == taskqueues_.size() )
+      return;
+
+   wait();
+   destroyThreads();
+   createThreads( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function blocks until all scheduled tasks have been completed. The calling thread first
+// spins for the specified number of iterations and only then is parked until the last task has
+// been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait()
+{
+   barrier_.wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the work-stealing thread pool.
+//
+// \return void
+//
+// This function removes all currently scheduled tasks from the thread pool. The total number
+// of threads remains unchanged and all active threads continue completing their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::clear()
+{
+   for( auto const& taskqueue : taskqueues_ )
+   {
+      const size_t removed( taskqueue->clear() );
+
+      queued_ -= removed;
+      barrier_.arrive( removed );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding new worker threads to the work-stealing thread pool.
+//
+// \param n The number of worker threads to be created.
+// \return void
+//
+// This function must only be called while the thread pool does not contain any threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::createThreads( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.empty()   , "Invalid number of threads detected" );
+   BLAZE_INTERNAL_ASSERT( taskqueues_.empty(), "Invalid number of task queues detected" );
+
+   Lock lock( mutex_ );
+
+   shutdown_ = false;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      taskqueues_.push_back( std::unique_ptr<TaskQueue>( new TaskQueue() ) );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      threads_.push_back( std::unique_ptr<TT>( new TT( [this,i]() { this->run( i ); } ) ) );
+      if( !cpus_.empty() ) {
+         threadpool::pinThread( *threads_.back(), cpus_[i % cpus_.size()] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating and destroying all worker threads of the work-stealing thread pool.
+//
+// \return void
+//
+// This function must only be called after all scheduled tasks have been completed or removed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::destroyThreads()
+{
+   {
+      Lock lock( mutex_ );
+      shutdown_ = true;
+      waitForTask_.notify_all();
+   }
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+
+   Lock lock( mutex_ );
+   threads_.clear();
+   taskqueues_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution loop of a single worker thread.
+//
+// \param index The index of the worker thread.
+// \return void
+//
+// This function is executed by every worker thread. It repeatedly acquires a task, either from
+// the worker's own task queue or by stealing from another worker, and executes it. In case no
+// task is available, the worker spins for the specified number of iterations and afterwards
+// sleeps until a new task is scheduled or the thread pool is shut down.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::run( size_t index )
+{
+   threadpool::Task task;
+   size_t seed( 2UL*index + 1UL );
+
+   const size_t spin( barrier_.spin() );
+
+   while( true )
+   {
+      if( acquireTask( index, task, seed ) ) {
+         task();
+         task = nullptr;
+         barrier_.arrive();
+         continue;
+      }
+
+      for( size_t i=0UL; queued_ == 0UL && i<spin; ++i ) {
+         threadpool::cpuRelax();
+      }
+
+      if( queued_ > 0UL )
+         continue;
+
+      Lock lock( mutex_ );
+
+      ++idle_;
+
+      while( queued_ == 0UL && !shutdown_ ) {
+         waitForTask_.wait( lock );
+      }
+
+      --idle_;
+
+      if( queued_ == 0UL && shutdown_ )
+         return;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a task for the given worker thread.
+//
+// \param index The index of the worker thread.
+// \param task Reference to the task to be set.
+// \param seed The state of the random number generator of the worker thread.
+// \return \a true in case a task was acquired, \a false if no task is available.
+//
+// This function first attempts to acquire the most recently added task of the worker's own
+// task queue. In case the own task queue is empty, the function attempts to steal the oldest
+// task from another worker. The search for a victim starts at a randomly selected worker and
+// visits all other workers in a round-robin fashion.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool WorkStealingPool<TT,MT,LT,CT>::acquireTask( size_t index, threadpool::Task& task, size_t& seed )
+{
+   const size_t n( taskqueues_.size() );
+
+   if( taskqueues_[index]->pop( task ) ) {
+      --queued_;
+      return true;
+   }
+
+   while( queued_ > 0UL )
+   {
+      // Xorshift random number generator for the selection of the first victim
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+
+      const size_t first( seed % n );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         const size_t victim( ( first + i ) % n );
+
+         if( victim != index && taskqueues_[victim]->steal( task ) ) {
+            --queued_;
+            return true;
+         }
+      }
+
+      if( taskqueues_[index]->pop( task ) ) {
+         --queued_;
+         return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
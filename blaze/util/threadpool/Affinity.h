@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Thread affinity utilities for the thread pools
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cctype>
+#include <cstdlib>
+#include <vector>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given thread to the given logical CPU.
+// \ingroup threads
+//
+// \param thread The thread to be bound.
+// \param cpu The index of the logical CPU.
+// \return \a true in case the thread has been bound, \a false if not.
+//
+// This function restricts the execution of the given thread to the given logical CPU. The type
+// of the thread (as for instance \c std::thread or \c boost::thread) has to provide access to
+// the native thread handle via the \c native_handle() member function. The function is only
+// supported on Linux systems; on all other systems and in case the CPU does not exist it has
+// no effect and returns \a false.
+*/
+template< typename Thread >  // Type of the thread
+bool pinThread( Thread& thread, size_t cpu )
+{
+#if defined(__linux__)
+   if( cpu >= CPU_SETSIZE )
+      return false;
+
+   cpu_set_t cpuset;
+   CPU_ZERO( &cpuset );
+   CPU_SET( cpu, &cpuset );
+
+   return pthread_setaffinity_np( thread.native_handle(), sizeof(cpu_set_t), &cpuset ) == 0;
+#else
+   MAYBE_UNUSED( thread, cpu );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a list of logical CPUs.
+// \ingroup threads
+//
+// \param list The comma-separated list of CPUs and CPU ranges (e.g. "0-3,8,10-11").
+// \return The parsed CPUs in the given order (empty in case of an invalid list).
+//
+// This function parses a list of logical CPUs in the format used by the Linux kernel (as for
+// instance in \c /sys/devices/system/cpu/online) and by tools like \c taskset. Every entry of
+// the comma-separated list is either a single CPU or an inclusive range of CPUs. In case the
+// list is malformed, the function returns an empty vector.
+*/
+inline std::vector<size_t> parseCpuList( const char* list )
+{
+   std::vector<size_t> cpus;
+
+   if( list == nullptr )
+      return cpus;
+
+   const char* pos( list );
+
+   while( *pos != '\0' )
+   {
+      if( !std::isdigit( static_cast<unsigned char>( *pos ) ) )
+         return std::vector<size_t>();
+
+      char* end( nullptr );
+      const size_t first( std::strtoul( pos, &end, 10 ) );
+      size_t last( first );
+      pos = end;
+
+      if( *pos == '-' ) {
+         ++pos;
+         if( !std::isdigit( static_cast<unsigned char>( *pos ) ) )
+            return std::vector<size_t>();
+         last = std::strtoul( pos, &end, 10 );
+         pos = end;
+      }
+
+      if( last < first )
+         return std::vector<size_t>();
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+
+      if( *pos == ',' ) {
+         ++pos;
+         if( *pos == '\0' )
+            return std::vector<size_t>();
+      }
+      else if( *pos != '\0' ) {
+         return std::vector<size_t>();
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
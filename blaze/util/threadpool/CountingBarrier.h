@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/CountingBarrier.h
+//  \brief Lock-free counting barrier for the thread pools
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_COUNTINGBARRIER_H_
+#define _BLAZE_UTIL_THREADPOOL_COUNTINGBARRIER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#  include <emmintrin.h>
+#endif
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hint to the processor that the calling thread is in a spin-wait loop.
+// \ingroup threads
+//
+// \return void
+//
+// This function should be called in every iteration of a spin-wait loop. On x86 processors it
+// emits a \c pause instruction, which reduces the power consumption of the spinning core and
+// avoids the memory order violation penalty on leaving the loop. On all other architectures the
+// function has no effect.
+*/
+inline void cpuRelax() noexcept
+{
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free counting barrier for the thread pools.
+// \ingroup threads
+//
+// The CountingBarrier class template represents the join point of a thread pool. It counts the
+// number of scheduled, but not yet completed tasks. Whereas the scheduling (add()) and completion
+// (arrive()) of tasks is lock-free, a thread waiting for the completion of all tasks (wait())
+// first spins for a configurable number of iterations and only in case the tasks are not yet
+// completed parks on a condition variable. Since the synchronization mutex is only acquired in
+// case a thread is actually parked, short parallel operations are joined without any system
+// call. The template parameters specify the type of the synchronization mutex (\a MT), the
+// type of the mutex lock (\a LT), and the type of the condition variable (\a CT).
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class CountingBarrier
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Mutex     = MT;  //!< Type of the mutex.
+   using Lock      = LT;  //!< Type of a locking object.
+   using Condition = CT;  //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline CountingBarrier( size_t spin=0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t count() const;
+   inline size_t spin () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSpin( size_t spin );
+   //@}
+   //**********************************************************************************************
+
+   //**Synchronization functions*******************************************************************
+   /*!\name Synchronization functions */
+   //@{
+   inline void add   ( size_t n=1UL );
+   inline void arrive( size_t n=1UL );
+   inline void wait  () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> count_;           //!< Number of outstanding tasks.
+   mutable std::atomic<size_t> parked_;  //!< Number of currently parked threads.
+   std::atomic<size_t> spin_;            //!< Number of spin iterations before parking.
+   mutable Mutex mutex_;                 //!< Synchronization mutex.
+   mutable Condition condition_;         //!< Wait condition for the parked threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CountingBarrier class.
+//
+// \param spin The number of spin iterations before a waiting thread is parked.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline CountingBarrier<MT,LT,CT>::CountingBarrier( size_t spin )
+   : count_    ( 0UL  )  // Number of outstanding tasks
+   , parked_   ( 0UL  )  // Number of currently parked threads
+   , spin_     ( spin )  // Number of spin iterations before parking
+   , mutex_    ()        // Synchronization mutex
+   , condition_()        // Wait condition for the parked threads
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of outstanding tasks.
+//
+// \return The number of outstanding tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t CountingBarrier<MT,LT,CT>::count() const
+{
+   return count_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before a waiting thread is parked.
+//
+// \return The number of spin iterations.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t CountingBarrier<MT,LT,CT>::spin() const
+{
+   return spin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the number of spin iterations before a waiting thread is parked.
+//
+// \param spin The new number of spin iterations.
+// \return void
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void CountingBarrier<MT,LT,CT>::setSpin( size_t spin )
+{
+   spin_ = spin;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYNCHRONIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registering new outstanding tasks.
+//
+// \param n The number of new outstanding tasks.
+// \return void
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void CountingBarrier<MT,LT,CT>::add( size_t n )
+{
+   count_ += n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marking outstanding tasks as completed.
+//
+// \param n The number of completed tasks.
+// \return void
+//
+// In case the last outstanding task is completed and there are parked threads, all parked
+// threads are woken up. Otherwise the function does not acquire the synchronization mutex.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void CountingBarrier<MT,LT,CT>::arrive( size_t n )
+{
+   if( n == 0UL )
+      return;
+
+   if( ( count_ -= n ) == 0UL && parked_ > 0UL ) {
+      Lock lock( mutex_ );
+      condition_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of all outstanding tasks.
+//
+// \return void
+//
+// This function blocks until all outstanding tasks have been completed. The calling thread first
+// spins for the specified number of iterations. Only in case the tasks have not been completed
+// within this spin budget, the thread is parked on a condition variable.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void CountingBarrier<MT,LT,CT>::wait() const
+{
+   const size_t spin( spin_ );
+
+   for( size_t i=0UL; i<spin; ++i ) {
+      if( count_ == 0UL ) return;
+      cpuRelax();
+   }
+
+   if( count_ == 0UL )
+      return;
+
+   Lock lock( mutex_ );
+
+   ++parked_;
+
+   while( count_ != 0UL ) {
+      condition_.wait( lock );
+   }
+
+   --parked_;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,372 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Task groups for the joining of a subset of the tasks of a thread pool
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/CountingBarrier.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of tasks that can be joined independently of all other tasks of a thread pool.
+// \ingroup threads
+//
+// The TaskGroup class template represents a subset of the tasks scheduled to a thread pool. In
+// contrast to the wait() function of a thread pool, which blocks until all scheduled tasks have
+// been completed, the wait() function of a task group only blocks until the tasks of this
+// particular group have been completed. This enables several threads to share a single thread
+// pool without having to wait for the tasks of each other:
+
+   \code
+   using StdThreadPool = blaze::ThreadPool< std::thread
+                                          , std::mutex
+                                          , std::unique_lock<std::mutex>
+                                          , std::condition_variable >;
+
+   StdThreadPool threadpool( 4 );
+
+   // Executed concurrently by several threads
+   StdThreadPool::TaskGroup group;
+   threadpool.schedule( group, function0 );
+   threadpool.schedule( group, Functor2(), 4, 6 );
+   group.wait();  // Only waits for the two tasks scheduled above
+   \endcode
+
+// A task is considered to be completed as soon as it has been executed or as soon as it has
+// been removed from the thread pool (for instance via the clear() function). The destructor of
+// a task group blocks until all tasks of the group have been completed. The template parameters
+// specify the type of the synchronization mutex (\a MT), the type of the mutex lock (\a LT),
+// and the type of the condition variable (\a CT).
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class TaskGroup
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Barrier = CountingBarrier<MT,LT,CT>;  //!< Type of the barrier for the completion of the tasks.
+   //**********************************************************************************************
+
+   //**Private class Token*************************************************************************
+   /*!\brief Completion token of a single task of the task group.
+   //
+   // The token is shared between all copies of a scheduled task. The task is marked as completed
+   // either explicitly after its execution or, in case the task is never executed, as soon as
+   // the last copy of the task is destroyed.
+   */
+   class Token
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Token class.
+      //
+      // \param barrier The completion barrier of the task group.
+      */
+      explicit inline Token( std::shared_ptr<Barrier> barrier )
+         : barrier_( std::move( barrier ) )  // The completion barrier of the task group
+         , done_   ( false )                 // Completion flag of the task
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor for the Token class.
+      */
+      inline ~Token() {
+         complete();
+      }
+      //*******************************************************************************************
+
+      //**Complete function************************************************************************
+      /*!\brief Marks the task as completed.
+      //
+      // \return void
+      */
+      inline void complete() {
+         if( !done_.exchange( true ) )
+            barrier_->arrive();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      std::shared_ptr<Barrier> barrier_;  //!< The completion barrier of the task group.
+      std::atomic<bool> done_;            //!< Completion flag of the task.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup( size_t spin=0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t count() const;
+   inline size_t spin () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSpin( size_t spin );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Callable >
+   inline Task wrap( Callable func );
+
+   inline void wait() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::shared_ptr<Barrier> barrier_;  //!< Counting barrier for the completion of the tasks.
+                                       /*!< The barrier is shared with the completion tokens of
+                                            all scheduled tasks in order to keep it alive until
+                                            the last task has signaled its completion. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskGroup class.
+//
+// \param spin The number of spin iterations before a waiting thread is parked.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline TaskGroup<MT,LT,CT>::TaskGroup( size_t spin )
+   : barrier_( std::make_shared<Barrier>( spin ) )  // Counting barrier for the completion of the tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the TaskGroup class.
+//
+// The destructor blocks until all tasks of the task group have been completed.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline TaskGroup<MT,LT,CT>::~TaskGroup()
+{
+   barrier_->wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of outstanding tasks of the task group.
+//
+// \return The number of outstanding tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t TaskGroup<MT,LT,CT>::count() const
+{
+   return barrier_->count();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before a waiting thread is parked.
+//
+// \return The number of spin iterations.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t TaskGroup<MT,LT,CT>::spin() const
+{
+   return barrier_->spin();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the number of spin iterations before a waiting thread is parked.
+//
+// \param spin The new number of spin iterations.
+// \return void
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskGroup<MT,LT,CT>::setSpin( size_t spin )
+{
+   barrier_->setSpin( spin );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registers the given function/functor as new task of the task group.
+//
+// \param func The given function/functor.
+// \return The task to be scheduled to the thread pool.
+//
+// This function registers a new outstanding task and returns a task that executes the given
+// function/functor and afterwards signals its completion to the task group. This function is
+// used by the thread pools and should not be called explicitly.
+*/
+template< typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline Task TaskGroup<MT,LT,CT>::wrap( Callable func )
+{
+   std::shared_ptr<Token> token( std::make_shared<Token>( barrier_ ) );
+
+   barrier_->add();
+
+   return [func, token]() mutable {
+      func();
+      token->complete();
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the task group to be completed.
+//
+// \return void
+//
+// This function blocks until all tasks of the task group have been completed. The calling
+// thread first spins for the specified number of iterations and only then is parked until the
+// last task of the group has been completed.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskGroup<MT,LT,CT>::wait() const
+{
+   barrier_->wait();
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
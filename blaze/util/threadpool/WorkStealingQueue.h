@@ -0,0 +1,282 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingQueue.h
+//  \brief Per-thread task queue for the work-stealing thread pool
+//
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <deque>
+#include <utility>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Per-thread task queue for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingQueue class template represents the task container of a single worker of
+// a work-stealing thread pool. In contrast to the TaskQueue class, which is shared between all
+// threads of a thread pool, every worker owns a WorkStealingQueue. The owning worker adds and
+// removes tasks at the back of the queue (LIFO), whereas other workers steal tasks from the front
+// of the queue (FIFO). Since every queue is protected by its own mutex, the synchronization cost
+// is distributed over all workers instead of being concentrated on a single lock. The template
+// parameters specify the type of the synchronization mutex (\a MT) and the type of the mutex
+// lock (\a LT).
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+class WorkStealingQueue
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Tasks = std::deque<Task>;  //!< Double-ended container for tasks.
+   using Mutex = MT;                //!< Type of the mutex.
+   using Lock  = LT;                //!< Type of a locking object.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline WorkStealingQueue();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()    const;
+   inline bool   isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void   push ( Task task );
+   inline bool   pop  ( Task& task );
+   inline bool   steal( Task& task );
+   inline size_t clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Tasks tasks_;          //!< Double-ended container for the contained tasks.
+   mutable Mutex mutex_;  //!< Synchronization mutex.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for WorkStealingQueue.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline WorkStealingQueue<MT,LT>::WorkStealingQueue()
+   : tasks_()  // Double-ended container for the contained tasks
+   , mutex_()  // Synchronization mutex
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the work-stealing queue.
+//
+// \return The current number of contained tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline size_t WorkStealingQueue<MT,LT>::size() const
+{
+   Lock lock( mutex_ );
+   return tasks_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the work-stealing queue has no elements.
+//
+// \return \a true if the queue is empty, \a false if it is not.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkStealingQueue<MT,LT>::isEmpty() const
+{
+   Lock lock( mutex_ );
+   return tasks_.empty();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the back of the work-stealing queue.
+//
+// \param task The task to be added.
+// \return void
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void WorkStealingQueue<MT,LT>::push( Task task )
+{
+   Lock lock( mutex_ );
+   tasks_.push_back( std::move( task ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the back of the work-stealing queue.
+//
+// \param task Reference to the task to be set.
+// \return \a true in case a task was removed, \a false if the queue is empty.
+//
+// This function is used by the owning worker of the queue to acquire the most recently
+// scheduled task.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkStealingQueue<MT,LT>::pop( Task& task )
+{
+   Lock lock( mutex_ );
+
+   if( tasks_.empty() )
+      return false;
+
+   task = std::move( tasks_.back() );
+   tasks_.pop_back();
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the front of the work-stealing queue.
+//
+// \param task Reference to the task to be set.
+// \return \a true in case a task was stolen, \a false if the queue is empty or busy.
+//
+// This function is used by all other workers to steal the oldest task of the queue. In order
+// to avoid a convoy of thieves on a single victim, the function does not block in case the
+// queue is currently locked by another thread but immediately returns \a false.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkStealingQueue<MT,LT>::steal( Task& task )
+{
+   if( !mutex_.try_lock() )
+      return false;
+
+   const bool stolen( !tasks_.empty() );
+
+   if( stolen ) {
+      task = std::move( tasks_.front() );
+      tasks_.pop_front();
+   }
+
+   mutex_.unlock();
+   return stolen;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all tasks from the work-stealing queue.
+//
+// \return The number of removed tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline size_t WorkStealingQueue<MT,LT>::clear()
+{
+   Lock lock( mutex_ );
+   const size_t removed( tasks_.size() );
+   tasks_.clear();
+   return removed;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
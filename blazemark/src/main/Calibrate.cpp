@@ -0,0 +1,436 @@
+//=================================================================================================
+/*!
+//  \file src/main/Calibrate.cpp
+//  \brief Source file for the threshold calibration
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of the benchmark kernel of a single calibration.
+//
+// The kernel is called with the size of the operation (measured in the unit of the according
+// threshold) and the number of steps. It returns the wall clock time for the given number of
+// steps.
+*/
+using Kernel = std::function<double(size_t,size_t)>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Description of the calibration of a single threshold.
+*/
+struct Calibration
+{
+   std::string name;  //!< The name of the calibrated threshold.
+   size_t minSize;    //!< The smallest operation size of the calibration.
+   size_t maxSize;    //!< The largest operation size of the calibration.
+   Kernel kernel;     //!< The benchmark kernel of the calibration.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a benchmark kernel for a dense vector operation.
+//
+// \param op The dense vector operation \f$ c = op(a,b) \f$.
+// \return The benchmark kernel.
+//
+// The size of the operation corresponds to the size of the dense vectors.
+*/
+template< typename OP >
+Kernel vectorKernel( OP op )
+{
+   return [op]( size_t N, size_t steps )
+   {
+      ::blaze::setSeed( ::blazemark::seed );
+
+      ::blaze::DynamicVector<blazemark::element_t> a( N ), b( N ), c( N );
+      ::blaze::timing::WcTimer timer;
+
+      blazemark::blaze::init( a );
+      blazemark::blaze::init( b );
+      c = a;
+
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op( c, a, b );
+      }
+      timer.end();
+
+      if( c.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      return timer.last();
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a benchmark kernel for a dense matrix operation.
+//
+// \param op The dense matrix operation \f$ C = op(A,B) \f$.
+// \return The benchmark kernel.
+//
+// The size of the operation corresponds to the total number of elements of the square result
+// matrix.
+*/
+template< typename OP >
+Kernel matrixKernel( OP op )
+{
+   return [op]( size_t size, size_t steps )
+   {
+      ::blaze::setSeed( ::blazemark::seed );
+
+      const size_t N( static_cast<size_t>( std::sqrt( static_cast<double>( size ) ) + 0.5 ) );
+
+      ::blaze::DynamicMatrix<blazemark::element_t> A( N, N ), B( N, N ), C( N, N );
+      ::blaze::timing::WcTimer timer;
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+      C = A;
+
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op( C, A, B );
+      }
+      timer.end();
+
+      if( C.rows() != N || C.columns() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      return timer.last();
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a benchmark kernel for a dense matrix/dense vector multiplication.
+//
+// \param squared \a true if the size of the operation is given by the number of matrix elements,
+//                \a false if it is given by the size of the result vector.
+// \return The benchmark kernel.
+*/
+Kernel matrixVectorKernel( bool squared )
+{
+   return [squared]( size_t size, size_t steps )
+   {
+      ::blaze::setSeed( ::blazemark::seed );
+
+      const size_t N( squared ? static_cast<size_t>( std::sqrt( static_cast<double>( size ) ) + 0.5 )
+                              : size );
+
+      ::blaze::DynamicMatrix<blazemark::element_t> A( N, N );
+      ::blaze::DynamicVector<blazemark::element_t> a( N ), b( N );
+      ::blaze::timing::WcTimer timer;
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( a );
+
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = A * a;
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      return timer.last();
+   };
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the list of all available calibrations.
+//
+// \return The list of all available calibrations.
+*/
+std::vector<Calibration> calibrations()
+{
+   using VT = ::blaze::DynamicVector<blazemark::element_t>;
+   using MT = ::blaze::DynamicMatrix<blazemark::element_t>;
+
+   return {
+      { "SMP_DVECASSIGN_THRESHOLD"    , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT&   ) { c = a;               } ) },
+      { "SMP_DVECSCALARMULT_THRESHOLD", 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT&   ) { c = a * 2.1;         } ) },
+      { "SMP_DVECDVECADD_THRESHOLD"   , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT& b ) { c = a + b;           } ) },
+      { "SMP_DVECDVECSUB_THRESHOLD"   , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT& b ) { c = a - b;           } ) },
+      { "SMP_DVECDVECMULT_THRESHOLD"  , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT& b ) { c = a * b;           } ) },
+      { "SMP_DVECDVECDIV_THRESHOLD"   , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT& b ) { c = a / b;           } ) },
+      { "SMP_DVECREDUCE_THRESHOLD"    , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT&   ) { c[0] += sum( a );    } ) },
+      { "SMP_DVECNORM_THRESHOLD"      , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT&   ) { c[0] += norm( a );   } ) },
+      { "SMP_DVECDVECINNER_THRESHOLD" , 1024UL, 16777216UL, vectorKernel( []( VT& c, const VT& a, const VT& b ) { c[0] += dot( a, b ); } ) },
+      { "SMP_DMATASSIGN_THRESHOLD"    , 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT&   ) { C = A;               } ) },
+      { "SMP_DMATSCALARMULT_THRESHOLD", 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT&   ) { C = A * 2.1;         } ) },
+      { "SMP_DMATDMATADD_THRESHOLD"   , 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT& B ) { C = A + B;           } ) },
+      { "SMP_DMATDMATSUB_THRESHOLD"   , 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT& B ) { C = A - B;           } ) },
+      { "SMP_DMATDMATSCHUR_THRESHOLD" , 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT& B ) { C = A % B;           } ) },
+      { "SMP_DMATFULLREDUCE_THRESHOLD", 1024UL, 16777216UL, matrixKernel( []( MT& C, const MT& A, const MT&   ) { C(0,0) += sum( A );  } ) },
+      { "SMP_DMATDMATMULT_THRESHOLD"  ,   64UL,  1048576UL, matrixKernel( []( MT& C, const MT& A, const MT& B ) { C = A * B;           } ) },
+      { "SMP_DMATDVECMULT_THRESHOLD"  ,   16UL,     8192UL, matrixVectorKernel( false ) },
+      { "DMATDMATMULT_THRESHOLD"      ,   64UL,  1048576UL, matrixKernel( []( MT& C, const MT& A, const MT& B ) { C = A * B;           } ) },
+      { "DMATDVECMULT_THRESHOLD"      ,  256UL, 16777216UL, matrixVectorKernel( true ) }
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single step of the given kernel.
+//
+// \param kernel The benchmark kernel.
+// \param size The size of the operation.
+// \param target The target runtime of a single measurement.
+// \return The minimum wall clock time for a single step.
+//
+// This function first estimates the number of steps necessary for a runtime of approximately
+// the given target time and afterwards returns the minimum time per step of several repetitions.
+*/
+double measure( const Kernel& kernel, size_t size, double target )
+{
+   size_t steps( 1UL );
+   double wct( kernel( size, steps ) );
+
+   while( wct < target && steps < 1000000000UL ) {
+      steps *= 2UL;
+      wct = kernel( size, steps );
+   }
+
+   double min( wct );
+
+   for( size_t rep=1UL; rep<blazemark::reps; ++rep ) {
+      min = std::min( min, kernel( size, steps ) );
+   }
+
+   return min / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibration of a single threshold.
+//
+// \param calibration The calibration of the threshold.
+// \return The calibrated value of the threshold (0 in case no crossover was found).
+//
+// This function measures the runtime of the operation for geometrically increasing sizes, once
+// with the threshold disabled (i.e. with the kernel selected for small operations) and once
+// with the threshold forced (i.e. with the kernel selected for large operations, as for instance
+// the parallel or the BLAS kernel). The calibrated threshold is the smallest size beyond which
+// the kernel for large operations is consistently faster. In case the kernel for large operations
+// is not faster for the largest size, the function returns 0.
+*/
+size_t calibrate( const Calibration& calibration )
+{
+   const size_t previous( ::blaze::getThreshold( calibration.name ) );
+
+   std::cout << "   " << calibration.name << ":\n"
+             << "     " << std::setw(12) << "Size" << std::setw(14) << "Small [s]" << std::setw(14) << "Large [s]" << "\n";
+
+   size_t crossover( 0UL );
+
+   for( size_t size=calibration.minSize; size<=calibration.maxSize; size*=2UL )
+   {
+      ::blaze::setThreshold( calibration.name, std::numeric_limits<size_t>::max() );
+      const double small( measure( calibration.kernel, size, 0.05 ) );
+
+      ::blaze::setThreshold( calibration.name, 1UL );
+      const double large( measure( calibration.kernel, size, 0.05 ) );
+
+      std::cout << "     " << std::setw(12) << size
+                << std::setw(14) << std::setprecision(4) << small
+                << std::setw(14) << std::setprecision(4) << large << "\n";
+
+      if( large < small ) {
+         if( crossover == 0UL ) crossover = size;
+      }
+      else crossover = 0UL;
+   }
+
+   ::blaze::setThreshold( calibration.name, previous );
+
+   if( crossover == 0UL )
+      std::cout << "     No crossover found, keeping " << previous << "\n\n";
+   else
+      std::cout << "     Calibrated threshold: " << crossover << " (previously " << previous << ")\n\n";
+
+   return crossover;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the threshold calibration.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+//
+// The calibration measures the crossover points of the kernel and SMP thresholds on the current
+// machine and writes the resulting threshold profile to the specified file (default: the file
+// \c blaze.thresholds in the current directory). By default all available thresholds are
+// calibrated, but it is possible to restrict the calibration to a subset of thresholds:
+
+   \code
+   ./calibrate -o machine.thresholds SMP_DVECDVECADD_THRESHOLD SMP_DMATDMATMULT_THRESHOLD
+   \endcode
+
+// The resulting profile can be loaded via the blaze::loadThresholds() function or via the
+// \c BLAZE_THRESHOLDS environment variable. Note that the parallel kernels use the number of
+// threads specified for the Blaze library (e.g. via \c BLAZE_NUM_THREADS or \c OMP_NUM_THREADS).
+*/
+int main( int argc, char** argv )
+{
+   std::cout << "\n Threshold calibration:\n";
+
+   std::string profile( "blaze.thresholds" );
+   std::vector<std::string> names;
+
+   for( int i=1; i<argc; ++i ) {
+      const std::string arg( argv[i] );
+      if( arg == "-o" ) {
+         if( ++i == argc ) {
+            std::cerr << " Invalid use of program 'calibrate'!\n"
+                      << "   Use: ./calibrate [-o <profile>] [<threshold> ...]\n" << std::endl;
+            return EXIT_FAILURE;
+         }
+         profile = argv[i];
+      }
+      else names.push_back( arg );
+   }
+
+   const std::vector<Calibration> all( calibrations() );
+   std::vector<Calibration> selection;
+
+   if( names.empty() ) {
+      selection = all;
+   }
+   else for( const std::string& name : names ) {
+      const auto pos( std::find_if( all.begin(), all.end(), [&name]( const Calibration& c ){ return c.name == name; } ) );
+      if( pos == all.end() ) {
+         std::cerr << "   Unknown or uncalibratable threshold '" << name << "'\n";
+         return EXIT_FAILURE;
+      }
+      selection.push_back( *pos );
+   }
+
+   std::ofstream file( profile.c_str() );
+
+   if( !file ) {
+      std::cerr << "   Unable to write threshold profile '" << profile << "'\n";
+      return EXIT_FAILURE;
+   }
+
+   file << "# Blaze threshold profile\n";
+
+   try {
+      for( const Calibration& calibration : selection ) {
+         const size_t threshold( calibrate( calibration ) );
+         if( threshold > 0UL )
+            file << calibration.name << " = " << threshold << "\n";
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during threshold calibration: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "   Threshold profile written to '" << profile << "'\n\n";
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
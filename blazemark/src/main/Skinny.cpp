@@ -0,0 +1,217 @@
+//=================================================================================================
+/*!
+//  \file src/main/Skinny.cpp
+//  \brief Source file for the skinny matrix benchmark
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/system/Config.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the performance of a dense matrix addition \f$ C = A + B \f$.
+//
+// \param C The target matrix.
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \return The performance in MFlop/s.
+//
+// This function first estimates the number of steps necessary for a runtime of approximately
+// 0.1 seconds and afterwards returns the maximum performance of several repetitions.
+*/
+template< typename MT1, typename MT2 >
+double measure( MT1& C, const MT2& A, const MT2& B )
+{
+   const double flops( static_cast<double>( A.rows() * A.columns() ) );
+
+   ::blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   for( ;; steps*=2UL ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         C = A + B;
+      }
+      timer.end();
+      if( timer.last() > 0.1 || steps >= 1000000000UL ) break;
+   }
+
+   double min( timer.last() );
+
+   for( size_t rep=1UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         C = A + B;
+      }
+      timer.end();
+      min = std::min( min, timer.last() );
+   }
+
+   if( C.rows() != A.rows() || C.columns() != A.columns() )
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+   return ( flops * steps ) / ( min * 1E6 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark of a single skinny matrix shape.
+//
+// \param M The number of rows of the matrices.
+// \param N The number of columns of the matrices.
+// \return void
+//
+// This function compares the performance of the addition of two skinny matrices for a padded
+// target matrix (blaze::DynamicMatrix) and an unpadded target matrix (blaze::CustomMatrix).
+*/
+template< bool SO >  // Storage order of the matrices
+void benchmark( size_t M, size_t N )
+{
+   using Type = float;
+   using PaddedType   = ::blaze::DynamicMatrix<Type,SO>;
+   using UnpaddedType = ::blaze::CustomMatrix<Type,::blaze::aligned,::blaze::unpadded,SO>;
+
+   ::blaze::setSeed( ::blazemark::seed );
+
+   PaddedType A( M, N ), B( M, N ), C( M, N );
+   blazemark::blaze::init( A );
+   blazemark::blaze::init( B );
+
+   std::unique_ptr<Type[],::blaze::Deallocate> memory( ::blaze::allocate<Type>( M*N ) );
+   UnpaddedType D( memory.get(), M, N );
+   D = A;
+
+   std::cout << "   " << std::setw(8) << M << " x " << std::setw(8) << std::left << N << std::right
+             << std::setw(14) << std::setprecision(5) << measure( C, A, B )
+             << std::setw(14) << std::setprecision(5) << measure( D, A, B ) << "\n";
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the skinny matrix benchmark.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+//
+// The skinny matrix benchmark measures the performance of the parallel addition of tall and
+// wide matrices of single precision elements, both for row-major and column-major matrices and
+// both for padded and unpadded target matrices. For these shapes the parts of a parallel
+// assignment are very narrow, which makes the operation sensitive to false sharing between
+// threads. In order to show the effect of the padding-aware partitioning the benchmark can be
+// compiled with and without the \c BLAZE_USE_PADDING_AWARE_PARTITIONING switch:
+
+   \code
+   make skinny CXXFLAGS="... -DBLAZE_USE_PADDING_AWARE_PARTITIONING=1"
+   \endcode
+
+// Note that the number of threads is specified as for all Blaze applications (e.g. via
+// \c BLAZE_NUM_THREADS or \c OMP_NUM_THREADS).
+*/
+int main()
+{
+   std::cout << "\n Skinny matrix addition (C = A + B) [MFlop/s]:\n"
+             << "   Threads: " << ::blaze::getNumThreads() << "\n"
+             << "   Padding-aware partitioning: "
+             << ( BLAZE_USE_PADDING_AWARE_PARTITIONING ? "active" : "inactive" ) << "\n";
+
+   try {
+      std::cout << "\n   Row-major matrices:\n"
+                << "   " << std::setw(19) << std::left << "Size" << std::right
+                << std::setw(14) << "Padded" << std::setw(14) << "Unpadded" << "\n";
+      for( size_t N : { 3UL, 5UL, 7UL, 13UL } ) {
+         benchmark<::blaze::rowMajor>( 100000UL, N );
+      }
+      for( size_t M : { 3UL, 5UL, 7UL, 13UL } ) {
+         benchmark<::blaze::rowMajor>( M, 100000UL );
+      }
+
+      std::cout << "\n   Column-major matrices:\n"
+                << "   " << std::setw(19) << std::left << "Size" << std::right
+                << std::setw(14) << "Padded" << std::setw(14) << "Unpadded" << "\n";
+      for( size_t N : { 3UL, 5UL, 7UL, 13UL } ) {
+         benchmark<::blaze::columnMajor>( 100000UL, N );
+      }
+      for( size_t M : { 3UL, 5UL, 7UL, 13UL } ) {
+         benchmark<::blaze::columnMajor>( M, 100000UL );
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
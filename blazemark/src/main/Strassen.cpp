@@ -0,0 +1,190 @@
+//=================================================================================================
+/*!
+//  \file src/main/Strassen.cpp
+//  \brief Source file for the Strassen-Winograd multiplication benchmark
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/system/Config.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a dense matrix multiplication \f$ C = A * B \f$.
+//
+// \param C The target matrix.
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \return The minimum runtime in seconds.
+//
+// Due to the size of the matrices the multiplication is performed only once per repetition
+// and the minimum runtime of all repetitions is returned.
+*/
+template< typename MT >
+double measure( MT& C, const MT& A, const MT& B )
+{
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      C = A * B;
+      timer.end();
+   }
+
+   if( C.rows() != A.rows() || C.columns() != B.columns() )
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+   return timer.min();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark of a single square matrix size.
+//
+// \param N The number of rows and columns of the matrices.
+// \return void
+//
+// This function compares the runtime of the classical multiplication of two \a N x \a N matrices
+// with the runtime of the Strassen-Winograd multiplication and prints the relative normwise
+// deviation of both results.
+*/
+template< typename Type >  // Element type of the matrices
+void benchmark( size_t N )
+{
+   using MatrixType = ::blaze::DynamicMatrix<Type,::blaze::rowMajor>;
+
+   ::blaze::setSeed( ::blazemark::seed );
+
+   MatrixType A( N, N ), B( N, N ), C1( N, N ), C2( N, N );
+   blazemark::blaze::init( A );
+   blazemark::blaze::init( B );
+
+   const size_t threshold( ::blaze::STRASSEN_THRESHOLD );
+
+   ::blaze::STRASSEN_THRESHOLD = N+1UL;
+   const double classical( measure( C1, A, B ) );
+
+   ::blaze::STRASSEN_THRESHOLD = threshold;
+   const double strassen( measure( C2, A, B ) );
+
+   const double flops( 2.0 * N * N * N );
+   const double error( ::blaze::norm( C1 - C2 ) / ::blaze::norm( C1 ) );
+
+   std::cout << "   " << std::setw(8) << N
+             << std::setw(14) << std::setprecision(5) << flops / ( classical * 1E6 )
+             << std::setw(14) << std::setprecision(5) << flops / ( strassen  * 1E6 )
+             << std::setw(14) << std::setprecision(3) << error << "\n";
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Strassen-Winograd multiplication benchmark.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+//
+// The Strassen-Winograd multiplication benchmark compares the classical multiplication of two
+// large square row-major matrices of double precision elements with the Strassen-Winograd
+// multiplication. The performance of both variants is given in effective MFlop/s (i.e. based
+// on the \f$ 2N^3 \f$ operations of the classical algorithm), the deviation of the results as
+// relative Frobenius norm. The benchmark has to be compiled with the \c BLAZE_USE_STRASSEN
+// switch, the cutoff of the recursion is given by the \c BLAZE_STRASSEN_THRESHOLD:
+
+   \code
+   make strassen CXXFLAGS="... -DBLAZE_USE_STRASSEN=1 -DBLAZE_STRASSEN_THRESHOLD=2048UL"
+   \endcode
+
+// Note that the number of threads is specified as for all Blaze applications (e.g. via
+// \c BLAZE_NUM_THREADS or \c OMP_NUM_THREADS).
+*/
+int main()
+{
+   std::cout << "\n Strassen-Winograd multiplication (C = A * B) [MFlop/s]:\n"
+             << "   Threads: " << ::blaze::getNumThreads() << "\n"
+             << "   Strassen-Winograd multiplication: "
+             << ( BLAZE_USE_STRASSEN ? "active" : "inactive" ) << "\n"
+             << "   Cutoff: " << ::blaze::STRASSEN_THRESHOLD << "\n";
+
+   try {
+      std::cout << "\n   " << std::setw(8) << "Size" << std::setw(14) << "Classical"
+                << std::setw(14) << "Strassen" << std::setw(14) << "Rel. error" << "\n";
+      for( size_t N : { 2048UL, 4096UL, 8192UL, 16384UL } ) {
+         benchmark<double>( N );
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -45,10 +45,13 @@
 #include <string>
 #include <typeinfo>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Thresholds.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blazetest/system/BLAS.h>
 
@@ -93,6 +96,7 @@ class OperationTest
    template< typename Type > void testDotc();
    template< typename Type > void testAxpy();
    template< typename Type > void testTrsm();
+   template< typename Type > void testSyrk();
    //@}
    //**********************************************************************************************
 
@@ -728,6 +732,303 @@ void OperationTest::testTrsm()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the symmetric rank-k update functions (syrk).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the symmetric rank-k update functions and of the evaluation
+// of Gram matrix products (as for instance \f$ A*A^T \f$) for various data types. The reference
+// results are computed via general matrix multiplications of explicitly transposed matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testSyrk()
+{
+#if BLAZE_BLAS_MODE && BLAZETEST_MATHTEST_BLAS_MODE
+
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Symmetric rank-k update tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major symmetric rank-k update (lower part)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 7UL, 5UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,columnMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( A * At );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( 7UL, 7UL, Type(0) );
+      blaze::syrk( C, A, CblasLower, Type(1), Type(0) );
+
+      for( size_t i=0UL; i<7UL; ++i ) {
+         for( size_t j=i+1UL; j<7UL; ++j ) {
+            C(i,j) = C(j,i);
+         }
+      }
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric rank-k update failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major symmetric rank-k update (upper part)";
+
+      blaze::DynamicMatrix<Type,columnMajor> A( 7UL, 5UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,rowMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,columnMajor> ref( A * At );
+
+      blaze::DynamicMatrix<Type,columnMajor> C( 7UL, 7UL, Type(0) );
+      blaze::syrk( C, A, CblasUpper, Type(1), Type(0) );
+
+      for( size_t j=0UL; j<7UL; ++j ) {
+         for( size_t i=j+1UL; i<7UL; ++i ) {
+            C(i,j) = C(j,i);
+         }
+      }
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric rank-k update failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Gram matrix multiplication tests
+   //=====================================================================================
+
+   blaze::setThreshold( "DMATTDMATMULT_THRESHOLD", 1UL );
+   blaze::setThreshold( "TDMATDMATMULT_THRESHOLD", 1UL );
+
+   {
+      test_ = "Row-major Gram matrix multiplication (A*trans(A))";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,columnMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( A * At );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( A * trans( A ) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major scaled Gram matrix multiplication (2*A*trans(A))";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,columnMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( Type(2) * A * At );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( Type(2) * A * trans( A ) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major Gram matrix multiplication (trans(A)*A)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,columnMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,columnMajor> ref( At * A );
+
+      blaze::DynamicMatrix<Type,columnMajor> C( trans( A ) * A );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major Gram matrix multiplication (A*trans(A))";
+
+      blaze::DynamicMatrix<Type,columnMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,rowMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,columnMajor> ref( A * At );
+
+      blaze::DynamicMatrix<Type,columnMajor> C( A * trans( A ) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major scaled Gram matrix multiplication (trans(A)*A*2)";
+
+      blaze::DynamicMatrix<Type,columnMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      const blaze::DynamicMatrix<Type,rowMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( At * A * Type(2) );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( trans( A ) * A * Type(2) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Gram matrix multiplication of a submatrix";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL );
+      randomize( A );
+
+      auto S = submatrix( A, 1UL, 1UL, 7UL, 4UL );
+
+      const blaze::DynamicMatrix<Type,columnMajor> St( trans( S ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( S * St );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( S * trans( S ) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Multiplication with a transposed operand (A*trans(B))";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL ), B( 8UL, 6UL );
+      randomize( A );
+      randomize( B );
+
+      const blaze::DynamicMatrix<Type,columnMajor> Bt( trans( B ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( A * Bt );
+
+      blaze::DynamicMatrix<Type,rowMajor> C( A * trans( B ) );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Multiplication with a transposed operand (trans(A)*B)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 9UL, 6UL ), B( 9UL, 5UL );
+      randomize( A );
+      randomize( B );
+
+      const blaze::DynamicMatrix<Type,columnMajor> At( trans( A ) );
+      const blaze::DynamicMatrix<Type,columnMajor> ref( At * B );
+
+      blaze::DynamicMatrix<Type,columnMajor> C( trans( A ) * B );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Gram matrix multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::resetThresholds();
+
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,654 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kernels/DispatchTest.h
+//  \brief Header file for the runtime dispatch test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_KERNELS_DISPATCHTEST_H_
+#define _BLAZETEST_MATHTEST_KERNELS_DISPATCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/dense/RuntimeDispatch.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/InstructionSet.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime dispatched SIMD kernels.
+//
+// This class represents a test suite for the runtime dispatch of the SIMD kernels (see the
+// \c BLAZE_USE_RUNTIME_DISPATCH switch). It tests the selection of the instruction set, the
+// SIMD kernels of all instruction sets supported by the executing CPU, and the dense vector and
+// matrix operations based on the selected kernels.
+*/
+class DispatchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DispatchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+                             void testInstructionSet();
+   template< typename Type > void testKernels();
+   template< typename Type > void testOperations();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   #if BLAZE_RUNTIME_DISPATCH_MODE
+   template< typename ISA, typename Type >
+   void checkKernels();
+   #endif
+
+   template< typename T >
+   static void initialize( T& c );
+
+   template< typename Type, bool SO >
+   static void initialize( blaze::DynamicMatrix<Type,SO>& A );
+
+   template< typename Type >
+   static Type element( Type value, size_t index );
+
+   template< typename Type, bool TF >
+   static Type element( const blaze::DynamicVector<Type,TF>& v, size_t index );
+
+   template< typename Type >
+   void checkValue( const std::string& label, Type result, Type expected ) const;
+
+   template< typename VT, typename Type, typename OT >
+   void checkVector( const std::string& label, const VT& result,
+                     const std::vector<Type>& ref, Type scale, const OT& offset ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const std::string& label, const MT1& result, const MT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the selection of the instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the instruction set of the runtime dispatched kernels is supported
+// by the executing CPU. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void DispatchTest::testInstructionSet()
+{
+   test_ = "Instruction set selection";
+
+   const blaze::InstructionSet detected( blaze::detectInstructionSet() );
+   const blaze::InstructionSet selected( blaze::getInstructionSet() );
+
+   if( selected > detected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unsupported instruction set selected\n"
+          << " Details:\n"
+          << "   Selected instruction set: " << selected << "\n"
+          << "   Detected instruction set: " << detected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !BLAZE_RUNTIME_DISPATCH_MODE && detected != blaze::compileTimeInstructionSet() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid instruction set detected without runtime dispatch\n"
+          << " Details:\n"
+          << "   Detected instruction set: " << detected << "\n"
+          << "   Compile time instruction set: " << blaze::compileTimeInstructionSet() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SIMD kernels of all supported instruction sets.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime dispatched SIMD kernels of every instruction set
+// supported by the executing CPU, independent of the selected instruction set. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DispatchTest::testKernels()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+   const blaze::InstructionSet detected( blaze::detectInstructionSet() );
+
+   test_ = "SSE2 kernels";
+   checkKernels<blaze::DispatchSSE2,Type>();
+
+   if( detected >= blaze::avx2 ) {
+      test_ = "AVX2 kernels";
+      checkKernels<blaze::DispatchAVX2,Type>();
+   }
+
+   if( detected >= blaze::avx512f ) {
+      test_ = "AVX-512F kernels";
+      checkKernels<blaze::DispatchAVX512F,Type>();
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector and matrix operations based on the runtime dispatched kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all dense vector and matrix operations that use the runtime
+// dispatched SIMD kernels by comparing them to elementwise reference computations. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DispatchTest::testOperations()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Runtime dispatched operations";
+
+   for( size_t n : { 1UL, 7UL, 33UL, 130UL } )
+   {
+      const size_t m( n + 5UL );
+
+      blaze::DynamicMatrix<Type,rowMajor> A( m, n );
+      blaze::DynamicMatrix<Type,columnMajor> B( m, n );
+      blaze::DynamicVector<Type> x( n ), z( m );
+      initialize( A );
+      initialize( x );
+      initialize( z );
+      B = A;
+
+      std::vector<Type> ref( m );
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j )
+            ref[i] += A(i,j) * x[j];
+      }
+
+      blaze::DynamicVector<Type> y( m );
+
+      y = A * x;
+      checkVector( "Row-major matrix/vector multiplication", y, ref, Type(1), Type(0) );
+      y = B * x;
+      checkVector( "Column-major matrix/vector multiplication", y, ref, Type(1), Type(0) );
+
+      y = z;
+      y += A * x;
+      checkVector( "Row-major matrix/vector addition assignment", y, ref, Type(1), z );
+      y = z;
+      y -= B * x;
+      checkVector( "Column-major matrix/vector subtraction assignment", y, ref, Type(-1), z );
+
+      y = ( A * x ) * Type(2);
+      checkVector( "Scaled row-major matrix/vector multiplication", y, ref, Type(2), Type(0) );
+      y = ( B * x ) * Type(2);
+      checkVector( "Scaled column-major matrix/vector multiplication", y, ref, Type(2), Type(0) );
+
+      Type dot{}, sum{};
+      for( size_t i=0UL; i<m; ++i ) {
+         dot += z[i] * y[i];
+         sum += z[i];
+      }
+      checkValue( "Inner product", blaze::dot( z, y ), dot );
+      checkValue( "Summation", blaze::sum( z ), sum );
+
+      std::vector<Type> add( m ), sub( m ), mult( m );
+      for( size_t i=0UL; i<m; ++i ) {
+         add [i] = y[i] + z[i];
+         sub [i] = add[i] - z[i] * Type(3);
+         mult[i] = sub[i] * z[i];
+      }
+
+      y += z;
+      checkVector( "Vector addition assignment", y, add, Type(1), Type(0) );
+      y -= z * Type(3);
+      checkVector( "Vector subtraction assignment", y, sub, Type(1), Type(0) );
+      y *= z;
+      checkVector( "Vector multiplication assignment", y, mult, Type(1), Type(0) );
+   }
+
+   for( size_t n : { 5UL, 31UL, 97UL } )
+   {
+      blaze::DynamicMatrix<Type,rowMajor> A( n, n+3UL ), C;
+      blaze::DynamicMatrix<Type,columnMajor> B( n+3UL, n+1UL ), D;
+      initialize( A );
+      initialize( B );
+
+      blaze::DynamicMatrix<Type,rowMajor> ref( n, n+1UL, Type(0) );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n+1UL; ++j ) {
+            for( size_t k=0UL; k<n+3UL; ++k )
+               ref(i,j) += A(i,k) * B(k,j);
+         }
+      }
+
+      C = A * B;
+      checkMatrix( "Row-major matrix/matrix multiplication", C, ref );
+      D = A * B;
+      checkMatrix( "Column-major matrix/matrix multiplication", D, ref );
+      C = ( A * B ) * Type(2);
+      checkMatrix( "Scaled matrix/matrix multiplication", C, ref * Type(2) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+#if BLAZE_RUNTIME_DISPATCH_MODE
+/*!\brief Checking the SIMD kernels of the given instruction set.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of all SIMD kernels of the given instruction set to
+// elementwise reference computations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename ISA     // Instruction set specific kernels
+        , typename Type >  // Element type
+void DispatchTest::checkKernels()
+{
+   const blaze::DispatchKernels<Type> kernels( blaze::createDispatchKernels<ISA,Type>() );
+
+   for( size_t n : { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 100UL, 1001UL } )
+   {
+      std::vector<Type> x( n+1UL ), y( n+1UL );
+      initialize( x );
+      initialize( y );
+
+      Type dot{}, sum{};
+      std::vector<Type> add( y ), sub( y ), mult( y );
+      for( size_t i=0UL; i<n; ++i ) {
+         dot += x[i+1UL] * y[i];
+         sum += x[i+1UL];
+         add [i] += x[i+1UL];
+         sub [i] -= x[i+1UL];
+         mult[i] *= x[i+1UL];
+      }
+
+      checkValue( "Inner product kernel", kernels.dot( x.data()+1UL, y.data(), n ), dot );
+      checkValue( "Summation kernel", kernels.sum( x.data()+1UL, n ), sum );
+
+      std::vector<Type> result( y );
+      kernels.add( result.data(), x.data()+1UL, n );
+      checkVector( "Addition kernel", result, add, Type(1), Type(0) );
+
+      result = y;
+      kernels.sub( result.data(), x.data()+1UL, n );
+      checkVector( "Subtraction kernel", result, sub, Type(1), Type(0) );
+
+      result = y;
+      kernels.mult( result.data(), x.data()+1UL, n );
+      checkVector( "Multiplication kernel", result, mult, Type(1), Type(0) );
+   }
+
+   for( size_t m : { 1UL, 4UL, 13UL, 70UL } ) {
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } )
+      {
+         const size_t lda( std::max( m, n ) + 3UL );
+
+         std::vector<Type> A( lda*lda ), x( std::max( m, n ) ), y( std::max( m, n ) );
+         initialize( A );
+         initialize( x );
+         initialize( y );
+
+         std::vector<Type> ref1( y ), ref2( y );
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               ref1[i] += Type(2) * A[i*lda+j] * x[j];
+               ref2[i] += Type(2) * A[j*lda+i] * x[j];
+            }
+         }
+
+         std::vector<Type> result( y );
+         kernels.gemvRowMajor( m, n, A.data(), lda, x.data(), result.data(), Type(2) );
+         checkVector( "Row-major matrix/vector multiplication kernel",
+                      result, ref1, Type(1), Type(0) );
+
+         result = y;
+         kernels.gemvColumnMajor( m, n, A.data(), lda, x.data(), result.data(), Type(2) );
+         checkVector( "Column-major matrix/vector multiplication kernel",
+                      result, ref2, Type(1), Type(0) );
+      }
+   }
+
+   constexpr size_t MR ( ISA::mmmRows );
+   constexpr size_t NR ( ISA::mmmVectors * ISA::width / sizeof(Type) );
+   constexpr size_t ldc( NR + 5UL );
+
+   for( size_t k : { 0UL, 1UL, 7UL, 64UL } )
+   {
+      std::vector<Type> a( MR*k ), b( k*NR ), c( MR*ldc );
+      initialize( a );
+      initialize( b );
+      initialize( c );
+
+      std::vector<Type> ref( c );
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t s=0UL; s<NR; ++s ) {
+            for( size_t l=0UL; l<k; ++l )
+               ref[r*ldc+s] += Type(3) * a[l*MR+r] * b[l*NR+s];
+         }
+      }
+
+      ISA::template gemm<Type>( k, a.data(), b.data(), c.data(), ldc, Type(3) );
+      checkVector( "Matrix multiplication microkernel", c, ref, Type(1), Type(0) );
+   }
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given container with small integral values.
+//
+// \param c The container to be initialized.
+// \return void
+//
+// The small integral values guarantee that all results can be computed exactly, independent of
+// the order of the operations.
+*/
+template< typename T >  // Type of the container
+void DispatchTest::initialize( T& c )
+{
+   using Type = std::decay_t< decltype( *c.begin() ) >;
+
+   for( auto it=c.begin(); it!=c.end(); ++it ) {
+      *it = Type( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Element type of the matrix
+        , bool SO >      // Storage order of the matrix
+void DispatchTest::initialize( blaze::DynamicMatrix<Type,SO>& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given scalar offset.
+//
+// \param value The scalar offset.
+// \return The given scalar offset.
+*/
+template< typename Type >  // Type of the offset
+Type DispatchTest::element( Type value, size_t /*index*/ )
+{
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the specified element of the given vector offset.
+//
+// \param v The vector offset.
+// \param index The index of the element.
+// \return The specified element of the vector offset.
+*/
+template< typename Type  // Element type of the vector
+        , bool TF >      // Transpose flag of the vector
+Type DispatchTest::element( const blaze::DynamicVector<Type,TF>& v, size_t index )
+{
+   return v[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a scalar operation.
+//
+// \param label The label of the operation.
+// \param result The result of the operation.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the result
+void DispatchTest::checkValue( const std::string& label, Type result, Type expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a vector operation.
+//
+// \param label The label of the operation.
+// \param result The resulting vector.
+// \param ref The reference vector.
+// \param scale The scaling factor of the reference vector.
+// \param offset The offset of the expected result (scalar or vector).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that every element of the given result is equal to the element of the
+// expected result \f$ offset + scale * ref \f$. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename VT      // Type of the resulting vector
+        , typename Type    // Element type of the reference vector
+        , typename OT >    // Type of the offset
+void DispatchTest::checkVector( const std::string& label, const VT& result,
+                                const std::vector<Type>& ref, Type scale, const OT& offset ) const
+{
+   for( size_t i=0UL; i<ref.size(); ++i )
+   {
+      const Type expected( element( offset, i ) + scale * ref[i] );
+
+      if( result[i] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result of the " << label << "\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size: " << ref.size() << "\n"
+             << "   Index: " << i << "\n"
+             << "   Result: " << result[i] << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a matrix operation.
+//
+// \param label The label of the operation.
+// \param result The resulting matrix.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the resulting matrix
+        , typename MT2 >  // Type of the expected result
+void DispatchTest::checkMatrix( const std::string& label,
+                                const MT1& result, const MT2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatched SIMD kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   DispatchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch test.
+*/
+#define RUN_KERNELS_DISPATCH_TEST \
+   blazetest::mathtest::kernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kernels
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,350 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kernels/FusedMapTest.h
+//  \brief Header file for the fused map kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_KERNELS_FUSEDMAPTEST_H_
+#define _BLAZETEST_MATHTEST_KERNELS_FUSEDMAPTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the mapped dense matrix multiplications.
+//
+// This class represents a test suite for the fusion of custom operations into the dense matrix
+// multiplication (see the map() function). For single and double precision matrices the custom
+// operation is applied by the packed kernel, all other element types are evaluated in two
+// separate passes.
+*/
+class FusedMapTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FusedMapTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   static void initialize( MT& mat );
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void checkMaps( const MT1& A, const MT2& B, const MT3& D ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::DenseMatrix<MT1,SO1>& result,
+                     const blaze::DenseMatrix<MT2,SO2>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mapped dense matrix multiplications for the given element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment and the addition assignment of mapped dense
+// matrix multiplications (e.g. \f$ C=op(A*B) \f$ or \f$ C=op(D+s*A*B) \f$) for all combinations
+// of storage orders and a selection of matrix sizes. The multiplication thresholds are lowered
+// such that the custom operation is fused into the packed kernel for single and double precision
+// elements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void FusedMapTest::testMap()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[] = { 0UL, 3UL, 17UL, 97UL, 211UL };
+
+   for( size_t m : sizes ) {
+      for( size_t k : { 0UL, 29UL, 130UL } ) {
+         for( size_t n : sizes )
+         {
+            blaze::DynamicMatrix<Type,rowMajor> A( m, k );
+            blaze::DynamicMatrix<Type,rowMajor> B( k, n );
+            blaze::DynamicMatrix<Type,rowMajor> D( m, n );
+            initialize( A );
+            initialize( B );
+            initialize( D );
+
+            const blaze::DynamicMatrix<Type,columnMajor> TA( A );
+            const blaze::DynamicMatrix<Type,columnMajor> TB( B );
+
+            test_ = "Row-major/row-major multiplication";
+            checkMaps( A, B, D );
+
+            test_ = "Row-major/column-major multiplication";
+            checkMaps( A, TB, D );
+
+            test_ = "Column-major/row-major multiplication";
+            checkMaps( TA, B, D );
+
+            test_ = "Column-major/column-major multiplication";
+            checkMaps( TA, TB, D );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense matrix with small random integral values.
+//
+// \param mat The matrix to be initialized.
+// \return void
+//
+// This function initializes all elements of the given matrix with random integral values in
+// the range \f$ [-5..5] \f$. Therefore all products of the test are computed exactly.
+*/
+template< typename MT >  // Type of the dense matrix
+void FusedMapTest::initialize( MT& mat )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = blaze::rand<int>( -5, 5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the mapped (addition) assignments of the product of the given matrices.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \param D The initial value of the target matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the mapped assignments of the plain and the scaled product of the two
+// given matrices to row-major and column-major target matrices with the results of a separate
+// multiplication and map() operation. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , typename MT3 >  // Type of the initial target matrix
+void FusedMapTest::checkMaps( const MT1& A, const MT2& B, const MT3& D ) const
+{
+   using Type = blaze::ElementType_t<MT1>;
+
+   const auto op = []( Type x ) { return ( x < Type(0) ) ? Type(0) : x + Type(1); };
+
+   MT3 P( A * B );
+   MT3 ref;
+
+   {
+      MT3 C( D );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> E( D );
+
+      ref = map( P, op );
+      C = map( A * B, op );
+      E = map( A * B, op );
+      checkResult( "Mapped assignment", C, ref );
+      checkResult( "Mapped assignment", E, ref );
+
+      ref = map( P * Type(2), op );
+      C = map( A * B * Type(2), op );
+      E = map( Type(2) * A * B, op );
+      checkResult( "Mapped scaled assignment", C, ref );
+      checkResult( "Mapped scaled assignment", E, ref );
+   }
+
+   {
+      MT3 C( D );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> E( D );
+
+      ref = map( D + P, op );
+      C = map( D + A * B, op );
+      E = map( D + A * B, op );
+      checkResult( "Mapped addition assignment", C, ref );
+      checkResult( "Mapped addition assignment", E, ref );
+
+      ref = map( D + P * Type(3), op );
+      C = map( D + A * B * Type(3), op );
+      E = map( D + Type(3) * A * B, op );
+      checkResult( "Mapped scaled addition assignment", C, ref );
+      checkResult( "Mapped scaled addition assignment", E, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a mapped dense matrix multiplication.
+//
+// \param label The label of the performed operation.
+// \param result The result of the mapped multiplication.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result does not match the expected result, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1  // Type of the resulting matrix
+        , bool SO1      // Storage order of the resulting matrix
+        , typename MT2  // Type of the expected result
+        , bool SO2 >    // Storage order of the expected result
+void FusedMapTest::checkResult( const std::string& label,
+                                const blaze::DenseMatrix<MT1,SO1>& result,
+                                const blaze::DenseMatrix<MT2,SO2>& expected ) const
+{
+   if( (*result) != (*expected) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT1> ).name() << "\n"
+          << "   Target storage order: " << ( SO1 ? "column-major" : "row-major" ) << "\n"
+          << "   Size: " << (*result).rows() << "x" << (*result).columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the mapped dense matrix multiplications.
+//
+// \return void
+*/
+void runTest()
+{
+   FusedMapTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the fused map kernel test.
+*/
+#define RUN_KERNELS_FUSEDMAP_TEST \
+   blazetest::mathtest::kernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kernels
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
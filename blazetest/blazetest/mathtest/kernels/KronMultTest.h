@@ -0,0 +1,357 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kernels/KronMultTest.h
+//  \brief Header file for the Kronecker product multiplication kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_KERNELS_KRONMULTTEST_H_
+#define _BLAZETEST_MATHTEST_KERNELS_KRONMULTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the matrix-free Kronecker product multiplication.
+//
+// This class represents a test suite for the multiplication of (nested) Kronecker products with
+// dense vectors and matrices, which is evaluated without forming the Kronecker product. The
+// results are compared to the multiplication with the explicitly formed Kronecker product.
+*/
+class KronMultTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KronMultTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVectorMultiplication();
+   template< typename Type > void testMatrixMultiplication();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   static void initialize( blaze::DenseMatrix<MT,SO>& mat );
+
+   template< typename VT, bool TF >
+   static void initialize( blaze::DenseVector<VT,TF>& vec );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of Kronecker products with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix-free multiplication of single and nested
+// Kronecker products of row-major and column-major matrices with dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KronMultTest::testVectorMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   blaze::DynamicMatrix<Type,rowMajor> A( 3UL, 4UL );
+   blaze::DynamicMatrix<Type,columnMajor> B( 5UL, 2UL );
+   blaze::DynamicMatrix<Type,rowMajor> C( 2UL, 3UL );
+   blaze::DynamicVector<Type,blaze::columnVector> x( 24UL );
+   initialize( A );
+   initialize( B );
+   initialize( C );
+   initialize( x );
+
+   {
+      test_ = "Kronecker product/dense vector multiplication";
+
+      const blaze::DynamicMatrix<Type,rowMajor> K( kron( A, B ) );
+      const auto v( subvector( x, 0UL, 8UL ) );
+
+      blaze::DynamicVector<Type,blaze::columnVector> y( kron( A, B ) * v );
+      checkResult( y, K * v );
+
+      y = Type(2) * ( kron( A, B ) * v );
+      checkResult( y, Type(2) * ( K * v ) );
+   }
+
+   {
+      test_ = "Nested Kronecker product/dense vector multiplication";
+
+      const blaze::DynamicMatrix<Type,rowMajor> K( kron( kron( A, B ), C ) );
+
+      const blaze::DynamicVector<Type,blaze::columnVector> y( kron( kron( A, B ), C ) * x );
+      checkResult( y, K * x );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of Kronecker products with dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix-free multiplication of single and nested
+// Kronecker products with row-major and column-major dense matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KronMultTest::testMatrixMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   blaze::DynamicMatrix<Type,rowMajor> A( 3UL, 4UL );
+   blaze::DynamicMatrix<Type,columnMajor> B( 5UL, 2UL );
+   blaze::DynamicMatrix<Type,rowMajor> C( 2UL, 3UL );
+   blaze::DynamicMatrix<Type,rowMajor> X( 24UL, 7UL );
+   initialize( A );
+   initialize( B );
+   initialize( C );
+   initialize( X );
+
+   const blaze::DynamicMatrix<Type,columnMajor> TX( X );
+
+   {
+      test_ = "Kronecker product/dense matrix multiplication";
+
+      const blaze::DynamicMatrix<Type,rowMajor> K( kron( A, B ) );
+      const auto R( submatrix( X, 0UL, 0UL, 8UL, 7UL ) );
+      const auto TR( submatrix( TX, 0UL, 0UL, 8UL, 7UL ) );
+
+      blaze::DynamicMatrix<Type,rowMajor> Y( kron( A, B ) * R );
+      blaze::DynamicMatrix<Type,columnMajor> TY( kron( A, B ) * TR );
+      checkResult( Y, K * R );
+      checkResult( TY, K * R );
+   }
+
+   {
+      test_ = "Nested Kronecker product/dense matrix multiplication";
+
+      const blaze::DynamicMatrix<Type,rowMajor> K( kron( kron( A, B ), C ) );
+
+      blaze::DynamicMatrix<Type,rowMajor> Y( kron( kron( A, B ), C ) * X );
+      blaze::DynamicMatrix<Type,columnMajor> TY( kron( kron( A, B ), C ) * TX );
+      checkResult( Y, K * X );
+      checkResult( TY, K * X );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense matrix with small random integral values.
+//
+// \param mat The matrix to be initialized.
+// \return void
+//
+// This function initializes all elements of the given matrix with random integral values in
+// the range \f$ [-5..5] \f$. Therefore all products of the test are computed exactly.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void KronMultTest::initialize( blaze::DenseMatrix<MT,SO>& mat )
+{
+   for( size_t i=0UL; i<(*mat).rows(); ++i ) {
+      for( size_t j=0UL; j<(*mat).columns(); ++j ) {
+         (*mat)(i,j) = blaze::rand<int>( -5, 5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense vector with small random integral values.
+//
+// \param vec The vector to be initialized.
+// \return void
+//
+// This function initializes all elements of the given vector with random integral values in
+// the range \f$ [-5..5] \f$. Therefore all products of the test are computed exactly.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void KronMultTest::initialize( blaze::DenseVector<VT,TF>& vec )
+{
+   for( size_t i=0UL; i<(*vec).size(); ++i ) {
+      (*vec)[i] = blaze::rand<int>( -5, 5 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a Kronecker product multiplication.
+//
+// \param result The result of the matrix-free multiplication.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result does not match the result of the multiplication with the explicitly
+// formed Kronecker product, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void KronMultTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the matrix-free Kronecker product multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   KronMultTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Kronecker product multiplication kernel test.
+*/
+#define RUN_KERNELS_KRONMULT_TEST \
+   blazetest::mathtest::kernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kernels
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,381 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kernels/PackedMMMTest.h
+//  \brief Header file for the packed matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_KERNELS_PACKEDMMMTEST_H_
+#define _BLAZETEST_MATHTEST_KERNELS_PACKEDMMMTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the packed dense matrix multiplication kernel.
+//
+// This class represents a test suite for the packed dense matrix multiplication kernel, which
+// is used for all large multiplications of single and double precision matrices. Matrices of
+// other element types (such as extended precision and integral elements) are multiplied by the
+// default kernels.
+*/
+class PackedMMMTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit PackedMMMTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMultiplication();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   static void initialize( MT& mat );
+
+   template< typename MT >
+   static MT multiply( const MT& A, const MT& B );
+
+   template< typename MT1, typename MT2, typename MT3, typename MT4 >
+   void checkProducts( const MT1& A, const MT2& B, const MT3& C, const MT4& ref ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::DenseMatrix<MT1,SO1>& result,
+                     const blaze::DenseMatrix<MT2,SO2>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix multiplication kernels for the given element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense matrix multiplication for all combinations of
+// storage orders and a selection of matrix sizes. The multiplication threshold is lowered such
+// that all multiplications are performed by the kernels for large matrices, i.e. by the packed
+// kernel for single and double precision elements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void PackedMMMTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[] = { 1UL, 3UL, 8UL, 17UL, 48UL, 97UL, 301UL };
+
+   for( size_t m : sizes ) {
+      for( size_t k : { 1UL, 29UL, 300UL } ) {
+         for( size_t n : sizes )
+         {
+            if( m*k*n > 3000000UL )
+               continue;
+
+            blaze::DynamicMatrix<Type,rowMajor> A( m, k );
+            blaze::DynamicMatrix<Type,rowMajor> B( k, n );
+            initialize( A );
+            initialize( B );
+
+            const blaze::DynamicMatrix<Type,columnMajor> TA( A );
+            const blaze::DynamicMatrix<Type,columnMajor> TB( B );
+
+            blaze::DynamicMatrix<Type,rowMajor> C( m, n );
+            initialize( C );
+
+            const blaze::DynamicMatrix<Type,rowMajor> ref( multiply( A, B ) );
+
+            test_ = "Row-major/row-major multiplication";
+            checkProducts( A, B, C, ref );
+
+            test_ = "Row-major/column-major multiplication";
+            checkProducts( A, TB, C, ref );
+
+            test_ = "Column-major/row-major multiplication";
+            checkProducts( TA, B, C, ref );
+
+            test_ = "Column-major/column-major multiplication";
+            checkProducts( TA, TB, C, ref );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense matrix with small random integral values.
+//
+// \param mat The matrix to be initialized.
+// \return void
+//
+// This function initializes all elements of the given matrix with random integral values in
+// the range \f$ [-5..5] \f$. Therefore all products of the test are computed exactly.
+*/
+template< typename MT >  // Type of the dense matrix
+void PackedMMMTest::initialize( MT& mat )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = blaze::rand<int>( -5, 5 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reference result of a dense matrix multiplication.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \return The product of the two matrices.
+*/
+template< typename MT >  // Type of the dense matrices
+MT PackedMMMTest::multiply( const MT& A, const MT& B )
+{
+   MT C( A.rows(), B.columns(), 0 );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t l=0UL; l<A.columns(); ++l ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            C(i,j) += A(i,l) * B(l,j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the (compound) assignments of the product of the given matrices.
+//
+// \param A The left-hand side dense matrix.
+// \param B The right-hand side dense matrix.
+// \param C The initial value of the target matrices.
+// \param ref The reference result of the multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the assignment, the addition assignment, the subtraction assignment and
+// the scaled assignment of the product of the two given matrices to row-major and column-major
+// target matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , typename MT3  // Type of the initial target matrix
+        , typename MT4 >  // Type of the reference matrix
+void PackedMMMTest::checkProducts( const MT1& A, const MT2& B, const MT3& C, const MT4& ref ) const
+{
+   using Type = blaze::ElementType_t<MT1>;
+
+   {
+      MT3 D( C );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> E( C );
+
+      D = A * B;
+      E = A * B;
+      checkResult( "Assignment", D, ref );
+      checkResult( "Assignment", E, ref );
+
+      D = A * B * Type(2);
+      E = Type(2) * A * B;
+      checkResult( "Scaled assignment", D, ref * Type(2) );
+      checkResult( "Scaled assignment", E, ref * Type(2) );
+   }
+
+   {
+      MT3 D( C );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> E( C );
+
+      D += A * B;
+      E += A * B;
+      checkResult( "Addition assignment", D, C + ref );
+      checkResult( "Addition assignment", E, C + ref );
+   }
+
+   {
+      MT3 D( C );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> E( C );
+
+      D -= A * B;
+      E -= A * B;
+      checkResult( "Subtraction assignment", D, C - ref );
+      checkResult( "Subtraction assignment", E, C - ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a dense matrix multiplication.
+//
+// \param label The label of the performed operation.
+// \param result The result of the multiplication.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result does not match the expected result, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1  // Type of the resulting matrix
+        , bool SO1      // Storage order of the resulting matrix
+        , typename MT2  // Type of the expected result
+        , bool SO2 >    // Storage order of the expected result
+void PackedMMMTest::checkResult( const std::string& label,
+                                 const blaze::DenseMatrix<MT1,SO1>& result,
+                                 const blaze::DenseMatrix<MT2,SO2>& expected ) const
+{
+   if( (*result) != (*expected) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT1> ).name() << "\n"
+          << "   Target storage order: " << ( SO1 ? "column-major" : "row-major" ) << "\n"
+          << "   Size: " << (*result).rows() << "x" << (*result).columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the packed dense matrix multiplication kernel.
+//
+// \return void
+*/
+void runTest()
+{
+   PackedMMMTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the packed matrix multiplication kernel test.
+*/
+#define RUN_KERNELS_PACKEDMMM_TEST \
+   blazetest::mathtest::kernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kernels
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
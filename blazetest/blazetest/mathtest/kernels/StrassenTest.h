@@ -0,0 +1,369 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/kernels/StrassenTest.h
+//  \brief Header file for the Strassen-Winograd multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_KERNELS_STRASSENTEST_H_
+#define _BLAZETEST_MATHTEST_KERNELS_STRASSENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace kernels {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Strassen-Winograd matrix multiplication.
+//
+// This class represents a test suite for the Strassen-Winograd multiplication of dense matrices
+// (see the \c BLAZE_USE_STRASSEN switch). The results are compared to the results of the
+// classical multiplication kernels.
+*/
+class StrassenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit StrassenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMultiplication();
+   template< typename Type > void testViews();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO >
+   static void initialize( blaze::DynamicMatrix<Type,SO>& A );
+
+   template< typename MT1, typename MT2, typename MT3, typename MT4 >
+   void checkResult( const MT1& result, const MT2& expected, const MT3& A, const MT4& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Strassen-Winograd multiplication of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Strassen-Winograd multiplication for row-major and
+// column-major dense matrices of even and odd sizes. The STRASSEN_THRESHOLD is lowered such
+// that several levels of the recursion and the peeling of odd dimensions are exercised. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void StrassenTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[][3] = { { 64UL, 64UL, 64UL }, { 67UL, 65UL, 63UL },
+                               { 130UL, 40UL, 97UL }, { 33UL, 151UL, 48UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] );
+      const size_t k( size[1] );
+      const size_t n( size[2] );
+
+      for( size_t threshold : { 16UL, 32UL } )
+      {
+         {
+            test_ = "Row-major Strassen-Winograd multiplication";
+
+            blaze::DynamicMatrix<Type,rowMajor> A( m, k ), B( k, n ), C( m, n );
+            initialize( A );
+            initialize( B );
+
+            blaze::setThreshold( "STRASSEN_THRESHOLD", std::numeric_limits<size_t>::max() );
+            const blaze::DynamicMatrix<Type,rowMajor> ref( A * B );
+
+            blaze::setThreshold( "STRASSEN_THRESHOLD", threshold );
+            C = A * B;
+
+            checkResult( C, ref, A, B );
+         }
+
+         {
+            test_ = "Column-major Strassen-Winograd multiplication";
+
+            blaze::DynamicMatrix<Type,columnMajor> A( m, k ), B( k, n ), C( m, n );
+            initialize( A );
+            initialize( B );
+
+            blaze::setThreshold( "STRASSEN_THRESHOLD", std::numeric_limits<size_t>::max() );
+            const blaze::DynamicMatrix<Type,columnMajor> ref( A * B );
+
+            blaze::setThreshold( "STRASSEN_THRESHOLD", threshold );
+            C = A * B;
+
+            checkResult( C, ref, A, B );
+         }
+      }
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Strassen-Winograd multiplication with views and aliasing.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Strassen-Winograd multiplication with submatrix
+// operands and targets and with a target that aliases one of the operands. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void StrassenTest::testViews()
+{
+   using blaze::rowMajor;
+
+   {
+      test_ = "Strassen-Winograd multiplication with submatrices";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 80UL, 90UL ), B( 90UL, 75UL ), C( 100UL, 100UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      auto sA( blaze::submatrix( A, 3UL, 5UL, 70UL, 69UL ) );
+      auto sB( blaze::submatrix( B, 7UL, 2UL, 69UL, 65UL ) );
+      auto sC( blaze::submatrix( C, 11UL, 13UL, 70UL, 65UL ) );
+
+      blaze::setThreshold( "STRASSEN_THRESHOLD", std::numeric_limits<size_t>::max() );
+      blaze::DynamicMatrix<Type,rowMajor> ref( C );
+      blaze::submatrix( ref, 11UL, 13UL, 70UL, 65UL ) = sA * sB;
+
+      blaze::setThreshold( "STRASSEN_THRESHOLD", 16UL );
+      sC = sA * sB;
+
+      checkResult( C, ref, sA, sB );
+   }
+
+   {
+      test_ = "Aliased Strassen-Winograd multiplication";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( 71UL, 71UL ), B( 71UL, 71UL );
+      initialize( A );
+      initialize( B );
+
+      const blaze::DynamicMatrix<Type,rowMajor> A0( A );
+
+      blaze::setThreshold( "STRASSEN_THRESHOLD", std::numeric_limits<size_t>::max() );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( A * B );
+
+      blaze::setThreshold( "STRASSEN_THRESHOLD", 16UL );
+      A = A * B;
+
+      checkResult( A, ref, A0, B );
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given dense matrix.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , bool SO >      // Storage order
+void StrassenTest::initialize( blaze::DynamicMatrix<Type,SO>& A )
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   blaze::randomize( A, Real(-1), Real(1) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a Strassen-Winograd multiplication.
+//
+// \param result The computed result.
+// \param expected The result of the classical multiplication.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given result matches the result of the classical
+// multiplication. Since the Strassen-Winograd algorithm only satisfies a normwise error bound,
+// the tolerance is scaled by the inner dimension and the norms of both operands. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2    // Type of the expected result
+        , typename MT3    // Type of the left-hand side operand
+        , typename MT4 >  // Type of the right-hand side operand
+void StrassenTest::checkResult( const MT1& result, const MT2& expected,
+                                const MT3& A, const MT4& B ) const
+{
+   using blaze::ElementType_t;
+   using blaze::UnderlyingBuiltin_t;
+
+   using Real = UnderlyingBuiltin_t< ElementType_t<MT1> >;
+
+   const Real tolerance( Real(1E3) * std::numeric_limits<Real>::epsilon() * Real( A.columns() ) *
+                         blaze::maxNorm( A ) * blaze::maxNorm( B ) );
+
+   if( blaze::maxNorm( result - expected ) > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid Strassen-Winograd multiplication result\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ElementType_t<MT1> ).name() << "\n"
+          << "   Size: " << A.rows() << "x" << A.columns() << "x" << B.columns() << "\n"
+          << "   Maximum deviation: " << blaze::maxNorm( result - expected ) << "\n"
+          << "   Tolerance: " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Strassen-Winograd dense matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   StrassenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Strassen-Winograd multiplication test.
+*/
+#define RUN_KERNELS_STRASSEN_TEST \
+   blazetest::mathtest::kernels::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kernels
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
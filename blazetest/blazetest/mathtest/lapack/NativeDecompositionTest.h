@@ -0,0 +1,510 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/NativeDecompositionTest.h
+//  \brief Header file for the native LAPACK decomposition test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_NATIVEDECOMPOSITIONTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_NATIVEDECOMPOSITIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the native LAPACK decompositions.
+//
+// This class represents a test suite for the native LU, Cholesky, QR and LQ decompositions
+// that are used in case the LAPACK mode is disabled (i.e. \c BLAZE_LAPACK_MODE is set to 0).
+// The test sizes exceed the LAPACK block size such that the blocked kernels are exercised.
+*/
+class NativeDecompositionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeDecompositionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLU();
+   template< typename Type > void testLLH();
+   template< typename Type > void testQR();
+   template< typename Type > void testSolve();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::DynamicMatrix<Type> createGeneral( size_t n );
+
+   template< typename Type >
+   static blaze::DynamicMatrix<Type> createPositiveDefinite( size_t n );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::Matrix<MT1,SO1>& result,
+                     const blaze::Matrix<MT2,SO2>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LU decomposition of row-major and column-major dense
+// matrices computed by the native kernels. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void NativeDecompositionTest::testLU()
+{
+   for( size_t n : { 3UL, 17UL, 130UL } )
+   {
+      {
+         test_ = "Row-major LU decomposition";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createGeneral<Type>( n ) );
+         blaze::DynamicMatrix<Type,blaze::rowMajor> L, U, P;
+
+         blaze::lu( A, L, U, P );
+
+         checkResult( "LU decomposition", L*U*P, A );
+      }
+
+      {
+         test_ = "Column-major LU decomposition";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( createGeneral<Type>( n ) );
+         blaze::DynamicMatrix<Type,blaze::columnMajor> L, U, P;
+
+         blaze::lu( A, L, U, P );
+
+         checkResult( "LU decomposition", P*L*U, A );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Cholesky decomposition of row-major and column-major
+// positive definite matrices computed by the native kernels. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeDecompositionTest::testLLH()
+{
+   for( size_t n : { 3UL, 17UL, 130UL } )
+   {
+      {
+         test_ = "Row-major Cholesky decomposition";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createPositiveDefinite<Type>( n ) );
+         blaze::DynamicMatrix<Type,blaze::rowMajor> L;
+
+         blaze::llh( A, L );
+
+         checkResult( "Cholesky decomposition", L*ctrans( L ), A );
+      }
+
+      {
+         test_ = "Column-major Cholesky decomposition";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( createPositiveDefinite<Type>( n ) );
+         blaze::DynamicMatrix<Type,blaze::columnMajor> L;
+
+         blaze::llh( A, L );
+
+         checkResult( "Cholesky decomposition", L*ctrans( L ), A );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native QR and LQ decompositions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the QR and LQ decompositions of square and rectangular dense
+// matrices computed by the native kernels. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void NativeDecompositionTest::testQR()
+{
+   for( size_t n : { 3UL, 17UL, 130UL } )
+   {
+      {
+         test_ = "Row-major QR decomposition";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> A( n+5UL, n );
+         blaze::randomize( A );
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> Q, R;
+
+         blaze::qr( A, Q, R );
+
+         checkResult( "QR decomposition", Q*R, A );
+      }
+
+      {
+         test_ = "Column-major QR decomposition";
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n+5UL );
+         blaze::randomize( A );
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> Q, R;
+
+         blaze::qr( A, Q, R );
+
+         checkResult( "QR decomposition", Q*R, A );
+      }
+
+      {
+         test_ = "Row-major LQ decomposition";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> A( n, n+5UL );
+         blaze::randomize( A );
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> L, Q;
+
+         blaze::lq( A, L, Q );
+
+         checkResult( "LQ decomposition", L*Q, A );
+      }
+
+      {
+         test_ = "Column-major LQ decomposition";
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> A( n+5UL, n );
+         blaze::randomize( A );
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> L, Q;
+
+         blaze::lq( A, L, Q );
+
+         checkResult( "LQ decomposition", L*Q, A );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native inversion, determinant and linear system solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the matrix inversion, the determinant computation and the
+// solution of linear systems via the native kernels. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeDecompositionTest::testSolve()
+{
+   for( size_t n : { 3UL, 17UL, 130UL } )
+   {
+      const blaze::IdentityMatrix<Type> I( n );
+
+      {
+         test_ = "General matrix inversion";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createGeneral<Type>( n ) );
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> B( blaze::inv( A ) );
+
+         checkResult( "General matrix inversion", A*B, I );
+      }
+
+      {
+         test_ = "Positive definite matrix inversion";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( createPositiveDefinite<Type>( n ) );
+         blaze::DynamicMatrix<Type,blaze::columnMajor> B( A );
+
+         blaze::invert<blaze::byLLH>( B );
+
+         checkResult( "Positive definite matrix inversion", A*B, I );
+      }
+
+      {
+         test_ = "Determinant";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> L( n, n, Type(0) );
+         blaze::DynamicMatrix<Type,blaze::rowMajor> U( n, n, Type(0) );
+         Type ref( 1 );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<i; ++j ) {
+               L(i,j) = blaze::rand<Type>( -1, 1 ) / Type( n );
+            }
+            L(i,i) = Type(1);
+            for( size_t j=i+1UL; j<n; ++j ) {
+               U(i,j) = blaze::rand<Type>( -1, 1 ) / Type( n );
+            }
+            U(i,i) = ( i % 2UL ? Type(0.5) : Type(2) );
+            ref *= U(i,i);
+         }
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> A( L*U );
+
+         checkResult( "Determinant", blaze::DynamicMatrix<Type>( 1UL, 1UL, blaze::det( A ) ),
+                      blaze::DynamicMatrix<Type>( 1UL, 1UL, ref ) );
+      }
+
+      {
+         test_ = "Linear system solver";
+
+         const blaze::DynamicMatrix<Type,blaze::columnMajor> A( createGeneral<Type>( n ) );
+         blaze::DynamicVector<Type,blaze::columnVector> b( n );
+         blaze::randomize( b );
+
+         const blaze::DynamicVector<Type,blaze::columnVector> x( blaze::solve( A, b ) );
+
+         checkResult( "Linear system solver", blaze::expand( A*x, 1UL ), blaze::expand( b, 1UL ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a well-conditioned general square matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The resulting random matrix.
+//
+// This function creates a random \f$ n \times n \f$ matrix with a dominant diagonal.
+*/
+template< typename Type >
+blaze::DynamicMatrix<Type> NativeDecompositionTest::createGeneral( size_t n )
+{
+   blaze::DynamicMatrix<Type> A( n, n );
+   blaze::randomize( A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += Type( n );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a positive definite square matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The resulting random positive definite matrix.
+//
+// This function creates a random Hermitian positive definite \f$ n \times n \f$ matrix.
+*/
+template< typename Type >
+blaze::DynamicMatrix<Type> NativeDecompositionTest::createPositiveDefinite( size_t n )
+{
+   blaze::DynamicMatrix<Type> B( n, n );
+   blaze::randomize( B );
+
+   blaze::DynamicMatrix<Type> A( B * ctrans( B ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += Type( n );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a native decomposition.
+//
+// \param label The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given result matches the expected result up to a relative
+// tolerance. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1  // Type of the computed result
+        , bool SO1      // Storage order of the computed result
+        , typename MT2  // Type of the expected result
+        , bool SO2 >    // Storage order of the expected result
+void NativeDecompositionTest::checkResult( const std::string& label,
+                                           const blaze::Matrix<MT1,SO1>& result,
+                                           const blaze::Matrix<MT2,SO2>& expected ) const
+{
+   using blaze::ElementType_t;
+   using blaze::UnderlyingBuiltin_t;
+
+   using Real = UnderlyingBuiltin_t< ElementType_t<MT2> >;
+
+   const blaze::DynamicMatrix< ElementType_t<MT1> > res( *result );
+   const blaze::DynamicMatrix< ElementType_t<MT2> > ref( *expected );
+
+   const Real tolerance( Real(1E-10) * ( Real(1) + blaze::maxNorm( ref ) ) );
+
+   if( res.rows() != ref.rows() || res.columns() != ref.columns() ||
+       blaze::maxNorm( res - ref ) > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ElementType_t<MT2> ).name() << "\n"
+          << "   Size: " << ref.rows() << "x" << ref.columns() << "\n"
+          << "   Result:\n" << res << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native LU, Cholesky and QR decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeDecompositionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native LAPACK decomposition test.
+*/
+#define RUN_LAPACK_NATIVEDECOMPOSITION_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,652 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/NativeEigenTest.h
+//  \brief Header file for the native LAPACK eigenvalue test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_NATIVEEIGENTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_NATIVEEIGENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the native LAPACK eigenvalue and SVD functions.
+//
+// This class represents a test suite for the native symmetric and Hermitian eigensolvers and
+// the native singular value decomposition that are used in case the LAPACK mode is disabled
+// (i.e. \c BLAZE_LAPACK_MODE is set to 0). The test sizes exceed the LAPACK block size such
+// that the blocked kernels are exercised.
+*/
+class NativeEigenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeEigenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testEigen();
+                             void testSyevx();
+                             void testHeevx();
+   template< typename Type > void testSVD();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::DynamicMatrix<Type> createHermitian( size_t n );
+
+   template< typename Real >
+   static blaze::DynamicMatrix<Real> createDiagonal( const blaze::DynamicVector<Real>& d );
+
+   template< typename Real >
+   void checkAscending( const std::string& label, const blaze::DynamicVector<Real>& w ) const;
+
+   template< typename Real >
+   void checkDescending( const std::string& label, const blaze::DynamicVector<Real>& s ) const;
+
+   void checkCount( const std::string& label, size_t num, size_t expected ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::Matrix<MT1,SO1>& result,
+                     const blaze::Matrix<MT2,SO2>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native eigenvalue decomposition of symmetric and Hermitian matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the eigen() function for row-major and column-major
+// symmetric and Hermitian matrices computed by the native kernels. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeEigenTest::testEigen()
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   for( size_t n : { 3UL, 17UL, 130UL } )
+   {
+      {
+         test_ = "Row-major eigenvalue decomposition";
+
+         const blaze::HermitianMatrix< blaze::DynamicMatrix<Type,blaze::rowMajor> > A(
+            createHermitian<Type>( n ) );
+         blaze::DynamicVector<Real> w, w2;
+         blaze::DynamicMatrix<Type,blaze::rowMajor> V;
+
+         blaze::eigen( A, w, V );
+         blaze::eigen( A, w2 );
+
+         checkAscending( "eigenvalue decomposition", w );
+         checkResult( "eigenvalue decomposition", V*A, createDiagonal( w )*V );
+         checkResult( "eigenvalue decomposition", V*ctrans( V ), blaze::IdentityMatrix<Type>( n ) );
+         checkResult( "eigenvalue computation", blaze::expand( w2, 1UL ), blaze::expand( w, 1UL ) );
+      }
+
+      {
+         test_ = "Column-major eigenvalue decomposition";
+
+         const blaze::HermitianMatrix< blaze::DynamicMatrix<Type,blaze::columnMajor> > A(
+            createHermitian<Type>( n ) );
+         blaze::DynamicVector<Real> w, w2;
+         blaze::DynamicMatrix<Type,blaze::columnMajor> V;
+
+         blaze::eigen( A, w, V );
+         blaze::eigen( A, w2 );
+
+         checkAscending( "eigenvalue decomposition", w );
+         checkResult( "eigenvalue decomposition", A*V, V*createDiagonal( w ) );
+         checkResult( "eigenvalue decomposition", ctrans( V )*V, blaze::IdentityMatrix<Type>( n ) );
+         checkResult( "eigenvalue computation", blaze::expand( w2, 1UL ), blaze::expand( w, 1UL ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native selective eigenvalue computation of symmetric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the index range and value range variants of the syevx()
+// function computed by the native kernels. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void NativeEigenTest::testSyevx()
+{
+   const size_t n( 130UL );
+   const size_t k( 5UL );
+
+   {
+      test_ = "Row-major syevx() for the k largest eigenpairs";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( createHermitian<double>( n ) );
+      blaze::DynamicMatrix<double,blaze::rowMajor> B( A ), C( A ), Z;
+      blaze::DynamicVector<double> w, wk;
+
+      blaze::syevd( B, w, 'N', 'L' );
+      const size_t num( blaze::syevx( C, wk, Z, 'L', int( n-k ), int( n-1UL ) ) );
+
+      checkCount( "selective eigenvalue decomposition", num, k );
+      checkResult( "selective eigenvalue decomposition", blaze::expand( wk, 1UL ),
+                   blaze::expand( blaze::subvector( w, n-k, k ), 1UL ) );
+      checkResult( "selective eigenvalue decomposition", Z*A, createDiagonal( wk )*Z );
+      checkResult( "selective eigenvalue decomposition", Z*trans( Z ),
+                   blaze::IdentityMatrix<double>( k ) );
+   }
+
+   {
+      test_ = "Column-major syevx() for the k largest eigenpairs";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> A( createHermitian<double>( n ) );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( A ), C( A ), Z;
+      blaze::DynamicVector<double> w, wk;
+
+      blaze::syevd( B, w, 'N', 'U' );
+      const size_t num( blaze::syevx( C, wk, Z, 'U', int( n-k ), int( n-1UL ) ) );
+
+      checkCount( "selective eigenvalue decomposition", num, k );
+      checkResult( "selective eigenvalue decomposition", blaze::expand( wk, 1UL ),
+                   blaze::expand( blaze::subvector( w, n-k, k ), 1UL ) );
+      checkResult( "selective eigenvalue decomposition", A*Z, Z*createDiagonal( wk ) );
+      checkResult( "selective eigenvalue decomposition", trans( Z )*Z,
+                   blaze::IdentityMatrix<double>( k ) );
+   }
+
+   {
+      test_ = "syevx() for a value range";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( createHermitian<double>( n ) );
+      blaze::DynamicMatrix<double,blaze::rowMajor> B( A ), C( A );
+      blaze::DynamicVector<double> w, wr;
+
+      blaze::syev( B, w, 'N', 'L' );
+
+      const double low( ( w[n/4UL] + w[n/4UL+1UL] ) / 2.0 );
+      const double upp( ( w[n/2UL] + w[n/2UL+1UL] ) / 2.0 );
+      const size_t num( blaze::syevx( C, wr, 'L', low, upp ) );
+
+      checkCount( "selective eigenvalue computation", num, n/2UL - n/4UL );
+      checkResult( "selective eigenvalue computation",
+                   blaze::expand( blaze::subvector( wr, 0UL, num ), 1UL ),
+                   blaze::expand( blaze::subvector( w, n/4UL+1UL, num ), 1UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native selective eigenvalue computation of Hermitian matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the index range and value range variants of the heevx()
+// function computed by the native kernels. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void NativeEigenTest::testHeevx()
+{
+   using Type = blaze::complex<double>;
+
+   const size_t n( 130UL );
+   const size_t k( 5UL );
+
+   {
+      test_ = "Row-major heevx() for the k largest eigenpairs";
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createHermitian<Type>( n ) );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( A ), C( A ), Z;
+      blaze::DynamicVector<double> w, wk;
+
+      blaze::heevd( B, w, 'N', 'L' );
+      const size_t num( blaze::heevx( C, wk, Z, 'L', int( n-k ), int( n-1UL ) ) );
+
+      checkCount( "selective eigenvalue decomposition", num, k );
+      checkResult( "selective eigenvalue decomposition", blaze::expand( wk, 1UL ),
+                   blaze::expand( blaze::subvector( w, n-k, k ), 1UL ) );
+      checkResult( "selective eigenvalue decomposition", Z*A, createDiagonal( wk )*Z );
+      checkResult( "selective eigenvalue decomposition", Z*ctrans( Z ),
+                   blaze::IdentityMatrix<Type>( k ) );
+   }
+
+   {
+      test_ = "Column-major heevx() for the k largest eigenpairs";
+
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> A( createHermitian<Type>( n ) );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> B( A ), C( A ), Z;
+      blaze::DynamicVector<double> w, wk;
+
+      blaze::heevd( B, w, 'N', 'U' );
+      const size_t num( blaze::heevx( C, wk, Z, 'U', int( n-k ), int( n-1UL ) ) );
+
+      checkCount( "selective eigenvalue decomposition", num, k );
+      checkResult( "selective eigenvalue decomposition", blaze::expand( wk, 1UL ),
+                   blaze::expand( blaze::subvector( w, n-k, k ), 1UL ) );
+      checkResult( "selective eigenvalue decomposition", A*Z, Z*createDiagonal( wk ) );
+      checkResult( "selective eigenvalue decomposition", ctrans( Z )*Z,
+                   blaze::IdentityMatrix<Type>( k ) );
+   }
+
+   {
+      test_ = "heevx() for a value range";
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( createHermitian<Type>( n ) );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( A ), C( A );
+      blaze::DynamicVector<double> w, wr;
+
+      blaze::heev( B, w, 'N', 'L' );
+
+      const double low( ( w[n/4UL] + w[n/4UL+1UL] ) / 2.0 );
+      const double upp( ( w[n/2UL] + w[n/2UL+1UL] ) / 2.0 );
+      const size_t num( blaze::heevx( C, wr, 'L', low, upp ) );
+
+      checkCount( "selective eigenvalue computation", num, n/2UL - n/4UL );
+      checkResult( "selective eigenvalue computation",
+                   blaze::expand( blaze::subvector( wr, 0UL, num ), 1UL ),
+                   blaze::expand( blaze::subvector( w, n/4UL+1UL, num ), 1UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native singular value decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the svd() function for square and rectangular row-major
+// and column-major dense matrices computed by the native kernels. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeEigenTest::testSVD()
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   for( size_t m : { 3UL, 17UL, 130UL } ) {
+      for( size_t n : { 3UL, 17UL, 130UL } )
+      {
+         const size_t k( blaze::min( m, n ) );
+
+         {
+            test_ = "Row-major singular value decomposition";
+
+            blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+            blaze::randomize( A );
+            blaze::DynamicMatrix<Type,blaze::rowMajor> U, V;
+            blaze::DynamicVector<Real> s, s2;
+
+            blaze::svd( A, U, s, V );
+            blaze::svd( A, s2 );
+
+            checkDescending( "singular value decomposition", s );
+            checkResult( "singular value decomposition", U*createDiagonal( s )*V, A );
+            checkResult( "singular value decomposition", ctrans( U )*U,
+                         blaze::IdentityMatrix<Type>( k ) );
+            checkResult( "singular value decomposition", V*ctrans( V ),
+                         blaze::IdentityMatrix<Type>( k ) );
+            checkResult( "singular value computation",
+                         blaze::expand( s2, 1UL ), blaze::expand( s, 1UL ) );
+         }
+
+         {
+            test_ = "Column-major singular value decomposition";
+
+            blaze::DynamicMatrix<Type,blaze::columnMajor> A( m, n );
+            blaze::randomize( A );
+            blaze::DynamicMatrix<Type,blaze::columnMajor> U, V;
+            blaze::DynamicVector<Real> s, s2;
+
+            blaze::svd( A, U, s, V );
+            blaze::svd( A, s2 );
+
+            checkDescending( "singular value decomposition", s );
+            checkResult( "singular value decomposition", U*createDiagonal( s )*V, A );
+            checkResult( "singular value decomposition", ctrans( U )*U,
+                         blaze::IdentityMatrix<Type>( k ) );
+            checkResult( "singular value decomposition", V*ctrans( V ),
+                         blaze::IdentityMatrix<Type>( k ) );
+            checkResult( "singular value computation",
+                         blaze::expand( s2, 1UL ), blaze::expand( s, 1UL ) );
+         }
+
+         {
+            test_ = "Selective singular value decomposition";
+
+            blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+            blaze::randomize( A );
+            blaze::DynamicMatrix<Type,blaze::rowMajor> U, V;
+            blaze::DynamicVector<Real> s, sk;
+
+            blaze::svd( A, s );
+            const size_t num( blaze::svd( A, U, sk, V, 0, int( blaze::min( k, 3UL ) - 1UL ) ) );
+
+            checkCount( "selective singular value decomposition", num, blaze::min( k, 3UL ) );
+            checkResult( "selective singular value decomposition", blaze::expand( sk, 1UL ),
+                         blaze::expand( blaze::subvector( s, 0UL, num ), 1UL ) );
+            checkResult( "selective singular value decomposition", A*ctrans( V ),
+                         U*createDiagonal( sk ) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random Hermitian matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The resulting random Hermitian matrix.
+//
+// This function creates a random Hermitian \f$ n \times n \f$ matrix. For real element types
+// the resulting matrix is symmetric.
+*/
+template< typename Type >
+blaze::DynamicMatrix<Type> NativeEigenTest::createHermitian( size_t n )
+{
+   blaze::DynamicMatrix<Type> B( n, n );
+   blaze::randomize( B );
+
+   return B + ctrans( B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a diagonal matrix from the given vector.
+//
+// \param d The vector of diagonal elements.
+// \return The resulting diagonal matrix.
+*/
+template< typename Real >
+blaze::DynamicMatrix<Real> NativeEigenTest::createDiagonal( const blaze::DynamicVector<Real>& d )
+{
+   blaze::DynamicMatrix<Real> D( d.size(), d.size(), Real(0) );
+
+   for( size_t i=0UL; i<d.size(); ++i ) {
+      D(i,i) = d[i];
+   }
+
+   return D;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the ascending order of the given eigenvalues.
+//
+// \param label The label of the performed operation.
+// \param w The computed eigenvalues.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Real >
+void NativeEigenTest::checkAscending( const std::string& label,
+                                      const blaze::DynamicVector<Real>& w ) const
+{
+   for( size_t i=1UL; i<w.size(); ++i ) {
+      if( w[i] < w[i-1UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalues of the " << label << " are not in ascending order\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Real ).name() << "\n"
+             << "   Result:\n" << w << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the descending order of the given singular values.
+//
+// \param label The label of the performed operation.
+// \param s The computed singular values.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Real >
+void NativeEigenTest::checkDescending( const std::string& label,
+                                       const blaze::DynamicVector<Real>& s ) const
+{
+   for( size_t i=1UL; i<s.size(); ++i ) {
+      if( s[i] > s[i-1UL] || s[i] < Real(0) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular values of the " << label << " are not in descending order\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Real ).name() << "\n"
+             << "   Result:\n" << s << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of computed eigenvalues or singular values.
+//
+// \param label The label of the performed operation.
+// \param num The number of computed values.
+// \param expected The expected number of values.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void NativeEigenTest::checkCount( const std::string& label,
+                                         size_t num, size_t expected ) const
+{
+   if( num != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of values of the " << label << "\n"
+          << " Details:\n"
+          << "   Result: " << num << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a native decomposition.
+//
+// \param label The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given result matches the expected result up to a relative
+// tolerance. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1  // Type of the computed result
+        , bool SO1      // Storage order of the computed result
+        , typename MT2  // Type of the expected result
+        , bool SO2 >    // Storage order of the expected result
+void NativeEigenTest::checkResult( const std::string& label,
+                                   const blaze::Matrix<MT1,SO1>& result,
+                                   const blaze::Matrix<MT2,SO2>& expected ) const
+{
+   using blaze::ElementType_t;
+   using blaze::UnderlyingBuiltin_t;
+
+   using Real = UnderlyingBuiltin_t< ElementType_t<MT2> >;
+
+   const blaze::DynamicMatrix< ElementType_t<MT1> > res( *result );
+   const blaze::DynamicMatrix< ElementType_t<MT2> > ref( *expected );
+
+   const Real tolerance( Real(1E-10) * ( Real(1) + blaze::maxNorm( ref ) ) );
+
+   if( res.rows() != ref.rows() || res.columns() != ref.columns() ||
+       blaze::maxNorm( res - ref ) > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ElementType_t<MT2> ).name() << "\n"
+          << "   Size: " << ref.rows() << "x" << ref.columns() << "\n"
+          << "   Result:\n" << res << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native eigenvalue and singular value decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeEigenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native LAPACK eigenvalue test.
+*/
+#define RUN_LAPACK_NATIVEEIGEN_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
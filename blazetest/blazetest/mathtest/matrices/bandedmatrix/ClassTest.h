@@ -0,0 +1,416 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/bandedmatrix/ClassTest.h
+//  \brief Header file for the BandedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_BANDEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_BANDEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/BandedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace bandedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BandedMatrix class template.
+//
+// This class represents a test suite for the BandedMatrix class template. It performs a series
+// of multiplications and linear system solutions with row-major and column-major band matrices,
+// whose bandwidths are chosen such that both the vectorized loops and the scalar remainder loops
+// are exercised.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMultiplication();
+   template< typename Type > void testSolve();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::columnMajor>
+      band( size_t m, size_t n, size_t kl, size_t ku );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+
+   template< typename T1, typename T2 >
+   void checkResidual( const T1& lhs, const T2& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of band matrices with dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of row-major and column-major band
+// matrices with dense vectors and dense matrices for a selection of matrix sizes and bandwidths.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testMultiplication()
+{
+   const size_t sizes[][4] = { {  0UL,  0UL, 0UL, 0UL }, {  1UL,  1UL, 0UL, 0UL },
+                               {  7UL,  7UL, 1UL, 1UL }, { 33UL, 33UL, 2UL, 5UL },
+                               { 33UL, 20UL, 9UL, 0UL }, { 20UL, 33UL, 0UL, 9UL },
+                               { 130UL, 130UL, 17UL, 33UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] ), n( size[1] ), kl( size[2] ), ku( size[3] );
+
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> D( band<Type>( m, n, kl, ku ) );
+      const blaze::BandedMatrix<Type,blaze::rowMajor> A( D, kl, ku );
+      const blaze::BandedMatrix<Type,blaze::columnMajor> B( D, kl, ku );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n );
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X( n, 5UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         x[i] = Type( blaze::rand<int>( -5, 5 ) );
+         for( size_t j=0UL; j<5UL; ++j ) {
+            X(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+         }
+      }
+
+      const blaze::DynamicVector<Type,blaze::columnVector> y( D * x );
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> Y( D * X );
+
+      {
+         test_ = "Row-major band matrix/dense vector multiplication";
+
+         blaze::DynamicVector<Type,blaze::columnVector> z;
+         mult( z, A, x );
+         checkResult( z, y );
+      }
+
+      {
+         test_ = "Column-major band matrix/dense vector multiplication";
+
+         blaze::DynamicVector<Type,blaze::columnVector> z;
+         mult( z, B, x );
+         checkResult( z, y );
+      }
+
+      {
+         test_ = "Row-major band matrix/dense matrix multiplication";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> Z;
+         mult( Z, A, X );
+         checkResult( Z, Y );
+      }
+
+      {
+         test_ = "Column-major band matrix/dense matrix multiplication";
+
+         blaze::DynamicMatrix<Type,blaze::columnMajor> Z;
+         mult( Z, B, X );
+         checkResult( Z, Y );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of banded linear systems of equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solve() functions for row-major and column-major band
+// matrices, which are based on the band LU decomposition (gbtrf() and gbtrs()). In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testSolve()
+{
+   const size_t sizes[][3] = { { 1UL, 0UL, 0UL }, { 7UL, 1UL, 1UL }, { 33UL, 2UL, 5UL },
+                               { 130UL, 17UL, 3UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t n( size[0] ), kl( size[1] ), ku( size[2] );
+
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> D( band<Type>( n, n, kl, ku ) );
+      const blaze::BandedMatrix<Type,blaze::rowMajor> A( D, kl, ku );
+      const blaze::BandedMatrix<Type,blaze::columnMajor> B( D, kl, ku );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( n );
+      blaze::DynamicMatrix<Type,blaze::columnMajor> R( n, 3UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         b[i] = Type( blaze::rand<int>( -5, 5 ) );
+         for( size_t j=0UL; j<3UL; ++j ) {
+            R(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+         }
+      }
+
+      {
+         test_ = "Solving a row-major banded linear system";
+
+         blaze::DynamicVector<Type,blaze::columnVector> x;
+         solve( A, x, b );
+         checkResidual( D * x, b );
+      }
+
+      {
+         test_ = "Solving a column-major banded linear system";
+
+         blaze::DynamicVector<Type,blaze::columnVector> x;
+         solve( B, x, b );
+         checkResidual( D * x, b );
+      }
+
+      {
+         test_ = "Solving a column-major banded linear system with multiple right-hand sides";
+
+         blaze::DynamicMatrix<Type,blaze::rowMajor> X;
+         solve( B, X, R );
+         checkResidual( D * X, R );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random dense band matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The number of subdiagonals.
+// \param ku The number of superdiagonals.
+// \return The random band matrix.
+//
+// This function creates a dense matrix whose band consists of random integral values in the
+// range \f$ [-5..5] \f$. The diagonal elements are chosen such that the matrix is strictly
+// diagonally dominant. Therefore all products of the test are computed exactly and all linear
+// systems of the test are well-conditioned.
+*/
+template< typename Type >  // Data type of the elements
+blaze::DynamicMatrix<Type,blaze::columnMajor>
+   ClassTest::band( size_t m, size_t n, size_t kl, size_t ku )
+{
+   blaze::DynamicMatrix<Type,blaze::columnMajor> D( m, n, Type() );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const size_t ibegin( j > ku ? j-ku : 0UL );
+      const size_t iend  ( blaze::min( m, j+kl+1UL ) );
+      for( size_t i=ibegin; i<iend; ++i ) {
+         D(i,j) = ( i == j )?( Type( 6*( kl+ku+1UL ) ) ):( Type( blaze::rand<int>( -5, 5 ) ) );
+      }
+   }
+
+   return D;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a band matrix multiplication.
+//
+// \param result The result of the multiplication.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result does not match the expected result, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the residual of a solved linear system of equations.
+//
+// \param lhs The product of the system matrix and the computed solution.
+// \param rhs The right-hand side of the linear system.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the residual of the solution exceeds the tolerance of the test, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the left-hand side
+        , typename T2 >  // Type of the right-hand side
+void ClassTest::checkResidual( const T1& lhs, const T2& rhs ) const
+{
+   const double residual( maxNorm( lhs - rhs ) );
+
+   if( residual > 1E-10 * ( 1.0 + maxNorm( rhs ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the linear system failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BandedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BandedMatrix class test.
+*/
+#define RUN_BANDEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::bandedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace bandedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
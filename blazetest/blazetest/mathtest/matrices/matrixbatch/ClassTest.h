@@ -0,0 +1,721 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/matrixbatch/ClassTest.h
+//  \brief Header file for the MatrixBatch class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_MATRIXBATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_MATRIXBATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/VectorBatch.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace matrixbatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MatrixBatch and VectorBatch class templates.
+//
+// This class represents a test suite for the MatrixBatch and VectorBatch class templates and
+// the batched multiplication, inversion, determinant and solver functions. The batch sizes are
+// chosen such that full SIMD packs, partially filled packs and the parallel execution are
+// exercised.
+*/
+class ClassTest
+{
+ public:
+   //**Type definitions****************************************************************************
+   template< typename T >
+   using AlignedVector = std::vector< T, blaze::AlignedAllocator<T> >;  //!< Aligned vector type.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testAccess();
+   template< typename Type > void testMultiplication();
+   template< typename Type > void testInversion();
+                             void testSingular();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t M, size_t K, size_t N >
+   void checkMatrixMultiplication( size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   void checkVectorMultiplication( size_t n );
+
+   template< typename Type, size_t N >
+   void checkInversion( size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   static void initialize( blaze::MatrixBatch<Type,M,N>& A,
+                           AlignedVector< blaze::StaticMatrix<Type,M,N> >& ref );
+
+   template< typename Type, size_t N >
+   static void initialize( blaze::VectorBatch<Type,N>& x,
+                           AlignedVector< blaze::StaticVector<Type,N> >& ref );
+
+   template< typename Type, size_t N >
+   static void initializeRegular( blaze::MatrixBatch<Type,N,N>& A,
+                                  AlignedVector< blaze::StaticMatrix<Type,N,N> >& ref );
+
+   void checkSize( size_t size, size_t expected ) const;
+   void checkThrow( bool thrown ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, size_t k, const blaze::Matrix<MT1,SO1>& result,
+                     const blaze::Matrix<MT2,SO2>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element access functions of the MatrixBatch and VectorBatch class templates.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access, the get() and set() functions and the
+// resize() function of the MatrixBatch and VectorBatch class templates. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testAccess()
+{
+   for( size_t n : { 1UL, 7UL, 33UL } )
+   {
+      {
+         test_ = "MatrixBatch element access";
+
+         blaze::MatrixBatch<Type,3UL,2UL> A( n );
+         AlignedVector< blaze::StaticMatrix<Type,3UL,2UL> > ref( n );
+         initialize( A, ref );
+
+         checkSize( A.size(), n );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            for( size_t i=0UL; i<3UL; ++i ) {
+               for( size_t j=0UL; j<2UL; ++j ) {
+                  checkResult( "element access", k, blaze::StaticMatrix<Type,1UL,1UL>( A(k,i,j) ),
+                               blaze::StaticMatrix<Type,1UL,1UL>( ref[k](i,j) ) );
+               }
+            }
+         }
+
+         A.resize( 2UL*n+5UL );
+         checkSize( A.size(), 2UL*n+5UL );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            checkResult( "resize operation", k, A.get(k), ref[k] );
+         }
+
+         const blaze::MatrixBatch<Type,3UL,2UL> B( A );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            checkResult( "copy construction", k, B.get(k), ref[k] );
+         }
+      }
+
+      {
+         test_ = "VectorBatch element access";
+
+         blaze::VectorBatch<Type,3UL> x( n );
+         AlignedVector< blaze::StaticVector<Type,3UL> > ref( n );
+         initialize( x, ref );
+
+         checkSize( x.size(), n );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            for( size_t i=0UL; i<3UL; ++i ) {
+               checkResult( "element access", k, blaze::StaticMatrix<Type,1UL,1UL>( x(k,i) ),
+                            blaze::StaticMatrix<Type,1UL,1UL>( ref[k][i] ) );
+            }
+         }
+
+         x.resize( 2UL*n+5UL );
+         checkSize( x.size(), 2UL*n+5UL );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            checkResult( "resize operation", k, blaze::expand( x.get(k), 1UL ),
+                         blaze::expand( ref[k], 1UL ) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplication of matrix batches.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched matrix/matrix and matrix/vector multiplications
+// for various matrix and batch sizes. The largest batch size exceeds the default SMP batch
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testMultiplication()
+{
+   for( size_t n : { 1UL, 7UL, 33UL, 5000UL } )
+   {
+      test_ = "Batched matrix/matrix multiplication";
+
+      checkMatrixMultiplication<Type,2UL,2UL,2UL>( n );
+      checkMatrixMultiplication<Type,3UL,3UL,3UL>( n );
+      checkMatrixMultiplication<Type,2UL,3UL,4UL>( n );
+      checkMatrixMultiplication<Type,5UL,1UL,3UL>( n );
+
+      test_ = "Batched matrix/vector multiplication";
+
+      checkVectorMultiplication<Type,2UL,2UL>( n );
+      checkVectorMultiplication<Type,3UL,3UL>( n );
+      checkVectorMultiplication<Type,4UL,6UL>( n );
+   }
+
+   {
+      test_ = "Aliased batched matrix/matrix multiplication";
+
+      blaze::MatrixBatch<Type,3UL,3UL> A( 33UL ), B( 33UL );
+      AlignedVector< blaze::StaticMatrix<Type,3UL,3UL> > refA( 33UL ), refB( 33UL );
+      initialize( A, refA );
+      initialize( B, refB );
+
+      blaze::mult( A, A, B );
+
+      for( size_t k=0UL; k<33UL; ++k ) {
+         checkResult( "aliased multiplication", k, A.get(k), refA[k] * refB[k] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched inversion, determinant and linear system solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched invert(), det() and solve() functions for the
+// SIMD kernels of \f$ 2 \times 2 \f$ and \f$ 3 \times 3 \f$ matrices and the per-lane kernels
+// of larger matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testInversion()
+{
+   for( size_t n : { 1UL, 7UL, 33UL, 5000UL } )
+   {
+      checkInversion<Type,2UL>( n );
+      checkInversion<Type,3UL>( n );
+      checkInversion<Type,4UL>( n );
+      checkInversion<Type,6UL>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched inversion and solver for batches containing singular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the batched invert() and solve() functions throw an exception in
+// case the batch contains a singular matrix and that all other matrices of the batch are
+// processed correctly. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::testSingular()
+{
+   for( size_t n : { 33UL, 5000UL } )
+   {
+      const size_t singular( n / 2UL );
+
+      blaze::MatrixBatch<double,3UL,3UL> A( n );
+      blaze::VectorBatch<double,3UL> b( n ), x;
+      AlignedVector< blaze::StaticMatrix<double,3UL,3UL> > ref( n );
+      AlignedVector< blaze::StaticVector<double,3UL> > rhs( n );
+      initializeRegular( A, ref );
+      initialize( b, rhs );
+
+      ref[singular] = 0.0;
+      A.set( singular, ref[singular] );
+
+      {
+         test_ = "Batched solver with singular matrix";
+
+         bool thrown( false );
+
+         try {
+            blaze::solve( A, x, b );
+         }
+         catch( const std::runtime_error& ) {
+            thrown = true;
+         }
+
+         checkThrow( thrown );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( k == singular ) continue;
+            checkResult( "linear system solver", k, blaze::expand( ref[k] * x.get(k), 1UL ),
+                         blaze::expand( rhs[k], 1UL ) );
+         }
+      }
+
+      {
+         test_ = "Batched inversion with singular matrix";
+
+         bool thrown( false );
+
+         try {
+            blaze::invert( A );
+         }
+         catch( const std::runtime_error& ) {
+            thrown = true;
+         }
+
+         checkThrow( thrown );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( k == singular ) continue;
+            checkResult( "inversion", k, ref[k] * A.get(k),
+                         blaze::IdentityMatrix<double>( 3UL ) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the batched multiplication of matrix batches of the given size.
+//
+// \param n The size of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void ClassTest::checkMatrixMultiplication( size_t n )
+{
+   blaze::MatrixBatch<Type,M,K> A( n );
+   blaze::MatrixBatch<Type,K,N> B( n );
+   blaze::MatrixBatch<Type,M,N> C;
+   AlignedVector< blaze::StaticMatrix<Type,M,K> > refA( n );
+   AlignedVector< blaze::StaticMatrix<Type,K,N> > refB( n );
+   initialize( A, refA );
+   initialize( B, refB );
+
+   blaze::mult( C, A, B );
+
+   checkSize( C.size(), n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      checkResult( "multiplication", k, C.get(k), refA[k] * refB[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the batched multiplication of matrix and vector batches of the given size.
+//
+// \param n The size of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void ClassTest::checkVectorMultiplication( size_t n )
+{
+   blaze::MatrixBatch<Type,M,N> A( n );
+   blaze::VectorBatch<Type,N> x( n );
+   blaze::VectorBatch<Type,M> y;
+   AlignedVector< blaze::StaticMatrix<Type,M,N> > refA( n );
+   AlignedVector< blaze::StaticVector<Type,N> > refx( n );
+   initialize( A, refA );
+   initialize( x, refx );
+
+   blaze::mult( y, A, x );
+
+   checkSize( y.size(), n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      checkResult( "multiplication", k, blaze::expand( y.get(k), 1UL ),
+                   blaze::expand( refA[k] * refx[k], 1UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the batched inversion, determinant and solver for batches of the given size.
+//
+// \param n The size of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::checkInversion( size_t n )
+{
+   blaze::MatrixBatch<Type,N,N> A( n );
+   blaze::VectorBatch<Type,N> b( n ), x;
+   AlignedVector< blaze::StaticMatrix<Type,N,N> > ref( n );
+   AlignedVector< blaze::StaticVector<Type,N> > rhs( n );
+   initializeRegular( A, ref );
+   initialize( b, rhs );
+
+   {
+      test_ = "Batched determinant";
+
+      blaze::DynamicVector<Type> d;
+      blaze::det( A, d );
+
+      checkSize( d.size(), n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         checkResult( "determinant", k, blaze::StaticMatrix<Type,1UL,1UL>( d[k] ),
+                      blaze::StaticMatrix<Type,1UL,1UL>( blaze::det( ref[k] ) ) );
+      }
+   }
+
+   {
+      test_ = "Batched linear system solver";
+
+      blaze::solve( A, x, b );
+
+      checkSize( x.size(), n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         checkResult( "linear system solver", k, blaze::expand( ref[k] * x.get(k), 1UL ),
+                      blaze::expand( rhs[k], 1UL ) );
+      }
+   }
+
+   {
+      test_ = "Batched inversion";
+
+      blaze::invert( A );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         checkResult( "inversion", k, ref[k] * A.get(k), blaze::IdentityMatrix<Type>( N ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix batch and the corresponding reference matrices.
+//
+// \param A The matrix batch to be initialized.
+// \param ref The reference matrices.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void ClassTest::initialize( blaze::MatrixBatch<Type,M,N>& A,
+                            AlignedVector< blaze::StaticMatrix<Type,M,N> >& ref )
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      blaze::randomize( ref[k], Real(-10), Real(10) );
+      A.set( k, ref[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given vector batch and the corresponding reference vectors.
+//
+// \param x The vector batch to be initialized.
+// \param ref The reference vectors.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of elements of the vectors
+void ClassTest::initialize( blaze::VectorBatch<Type,N>& x,
+                            AlignedVector< blaze::StaticVector<Type,N> >& ref )
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   for( size_t k=0UL; k<x.size(); ++k ) {
+      blaze::randomize( ref[k], Real(-10), Real(10) );
+      x.set( k, ref[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given batch with well-conditioned square matrices.
+//
+// \param A The matrix batch to be initialized.
+// \param ref The reference matrices.
+// \return void
+*/
+template< typename Type  // Data type of the elements
+        , size_t N >     // Number of rows and columns of the matrices
+void ClassTest::initializeRegular( blaze::MatrixBatch<Type,N,N>& A,
+                                   AlignedVector< blaze::StaticMatrix<Type,N,N> >& ref )
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      blaze::randomize( ref[k], Real(-1), Real(1) );
+      for( size_t i=0UL; i<N; ++i ) {
+         ref[k](i,i) += Type( N );
+      }
+      A.set( k, ref[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of a batch.
+//
+// \param size The actual size of the batch.
+// \param expected The expected size of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkSize( size_t size, size_t expected ) const
+{
+   if( size != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Size         : " << size << "\n"
+          << "   Expected size: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a batch operation with a singular matrix failed.
+//
+// \param thrown \a true in case an exception was thrown, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkThrow( bool thrown ) const
+{
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Singular matrix not detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a batched operation for a single matrix of the batch.
+//
+// \param label The label of the performed operation.
+// \param k The index of the matrix within the batch.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given result matches the expected result up to a relative
+// tolerance, which depends on the precision of the element type. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1  // Type of the computed result
+        , bool SO1      // Storage order of the computed result
+        , typename MT2  // Type of the expected result
+        , bool SO2 >    // Storage order of the expected result
+void ClassTest::checkResult( const std::string& label, size_t k,
+                             const blaze::Matrix<MT1,SO1>& result,
+                             const blaze::Matrix<MT2,SO2>& expected ) const
+{
+   using blaze::ElementType_t;
+   using blaze::UnderlyingBuiltin_t;
+
+   using Real = UnderlyingBuiltin_t< ElementType_t<MT2> >;
+
+   const blaze::DynamicMatrix< ElementType_t<MT1> > res( *result );
+   const blaze::DynamicMatrix< ElementType_t<MT2> > ref( *expected );
+
+   const Real tolerance( Real(1E4) * std::numeric_limits<Real>::epsilon() *
+                         ( Real(1) + blaze::maxNorm( ref ) ) );
+
+   if( blaze::maxNorm( res - ref ) > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the batched " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ElementType_t<MT2> ).name() << "\n"
+          << "   Batch index: " << k << "\n"
+          << "   Result:\n" << res << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MatrixBatch and VectorBatch class templates.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MatrixBatch class test.
+*/
+#define RUN_MATRIXBATCH_CLASS_TEST \
+   blazetest::mathtest::matrices::matrixbatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixbatch
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
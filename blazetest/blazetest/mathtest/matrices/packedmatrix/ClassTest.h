@@ -0,0 +1,409 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/packedmatrix/ClassTest.h
+//  \brief Header file for the PackedMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_PACKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_PACKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PackedMatrix class template.
+//
+// This class represents a test suite for the PackedMatrix class template. It performs a series
+// of multiplications of symmetric, Hermitian, lower and upper packed matrices, whose sizes are
+// chosen such that both the vectorized loops and the scalar remainder loops are exercised.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVectorMultiplication();
+   template< typename Type > void testMatrixMultiplication();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, typename VT >
+   static void initialize( MT& L, VT& x );
+
+   template< typename Type >
+   static void randomize( Type& value );
+
+   template< typename Type >
+   static void randomize( blaze::complex<Type>& value );
+
+   template< blaze::PackedFlag PF, typename MT, typename VT >
+   void checkVectorProduct( const MT& ref, const VT& x ) const;
+
+   template< blaze::PackedFlag PF, typename MT1, typename MT2 >
+   void checkMatrixProduct( const MT1& ref, const MT2& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of packed matrices with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of symmetric, Hermitian, lower and upper
+// packed matrices with dense vectors for a selection of matrix sizes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testVectorMultiplication()
+{
+   for( size_t n : { 0UL, 1UL, 2UL, 7UL, 16UL, 33UL, 130UL } )
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> L( n, n, Type() );
+      blaze::DynamicVector<Type,blaze::columnVector> x( n );
+      initialize( L, x );
+
+      test_ = "Symmetric packed matrix/dense vector multiplication";
+      checkVectorProduct<blaze::packedSymmetric>( L + trans( L ), x );
+
+      test_ = "Hermitian packed matrix/dense vector multiplication";
+      checkVectorProduct<blaze::packedHermitian>( L + ctrans( L ), x );
+
+      test_ = "Lower packed matrix/dense vector multiplication";
+      checkVectorProduct<blaze::packedLower>( L, x );
+
+      test_ = "Upper packed matrix/dense vector multiplication";
+      checkVectorProduct<blaze::packedUpper>( trans( L ), x );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of packed matrices with dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of symmetric, Hermitian, lower and upper
+// packed matrices with row-major and column-major dense matrices for a selection of matrix
+// sizes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ClassTest::testMatrixMultiplication()
+{
+   for( size_t n : { 0UL, 1UL, 7UL, 65UL, 130UL } )
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> L( n, n, Type() );
+      blaze::DynamicVector<Type,blaze::columnVector> x( n );
+      initialize( L, x );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( n, 5UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            B(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+         }
+      }
+
+      test_ = "Symmetric packed matrix/dense matrix multiplication";
+      checkMatrixProduct<blaze::packedSymmetric>( L + trans( L ), B );
+
+      test_ = "Hermitian packed matrix/dense matrix multiplication";
+      checkMatrixProduct<blaze::packedHermitian>( L + ctrans( L ), B );
+
+      test_ = "Lower packed matrix/dense matrix multiplication";
+      checkMatrixProduct<blaze::packedLower>( L, B );
+
+      test_ = "Upper packed matrix/dense matrix multiplication";
+      checkMatrixProduct<blaze::packedUpper>( trans( L ), B );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given lower matrix and vector with small random integral values.
+//
+// \param L The lower matrix to be initialized.
+// \param x The vector to be initialized.
+// \return void
+//
+// This function initializes the lower part of the given matrix (with a real diagonal) and all
+// elements of the given vector with random integral values in the range \f$ [-5..5] \f$.
+// Therefore all products of the test are computed exactly.
+*/
+template< typename MT    // Type of the lower matrix
+        , typename VT >  // Type of the vector
+void ClassTest::initialize( MT& L, VT& x )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   for( size_t j=0UL; j<L.columns(); ++j ) {
+      L(j,j) = Type( blaze::rand<int>( -5, 5 ) );
+      for( size_t i=j+1UL; i<L.rows(); ++i ) {
+         randomize( L(i,j) );
+      }
+      randomize( x[j] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomizes the given value to a random integral value in the range \f$ [-5..5] \f$.
+//
+// \param value The value to be randomized.
+// \return void
+*/
+template< typename Type >  // Data type of the value
+void ClassTest::randomize( Type& value )
+{
+   value = Type( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Randomizes the given complex value to random integral values in the range \f$ [-5..5] \f$.
+//
+// \param value The complex value to be randomized.
+// \return void
+*/
+template< typename Type >  // Data type of the real and imaginary part
+void ClassTest::randomize( blaze::complex<Type>& value )
+{
+   value = blaze::complex<Type>( blaze::rand<int>( -5, 5 ), blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+/*!\brief Checking the product of a packed matrix and a dense vector.
+//
+// \param ref The dense reference matrix to be packed.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function packs the given dense matrix and compares the result of its multiplication with
+// the given vector to the result of the dense matrix/dense vector multiplication. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< blaze::PackedFlag PF  // Structure of the packed matrix
+        , typename MT           // Type of the dense reference matrix
+        , typename VT >         // Type of the right-hand side dense vector
+void ClassTest::checkVectorProduct( const MT& ref, const VT& x ) const
+{
+   using Type = blaze::ElementType_t<VT>;
+
+   const blaze::PackedMatrix<Type,PF> A( ref );
+
+   blaze::DynamicVector<Type,blaze::columnVector> y;
+   mult( y, A, x );
+
+   const blaze::DynamicVector<Type,blaze::columnVector> expected( ref * x );
+
+   if( y != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Size: " << A.rows() << "\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the product of a packed matrix and a dense matrix.
+//
+// \param ref The dense reference matrix to be packed.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function packs the given dense matrix and compares the result of its multiplication with
+// the given row-major matrix and its column-major copy to the result of the dense matrix/dense
+// matrix multiplication. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< blaze::PackedFlag PF  // Structure of the packed matrix
+        , typename MT1          // Type of the dense reference matrix
+        , typename MT2 >        // Type of the right-hand side dense matrix
+void ClassTest::checkMatrixProduct( const MT1& ref, const MT2& B ) const
+{
+   using Type = blaze::ElementType_t<MT2>;
+
+   const blaze::PackedMatrix<Type,PF> A( ref );
+   const blaze::DynamicMatrix<Type,blaze::columnMajor> TB( B );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> C;
+   blaze::DynamicMatrix<Type,blaze::columnMajor> D;
+   mult( C, A, B );
+   mult( D, A, TB );
+
+   const blaze::DynamicMatrix<Type,blaze::rowMajor> expected( ref * B );
+
+   if( C != expected || D != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Size: " << A.rows() << "x" << B.columns() << "\n"
+          << "   Row-major result:\n" << C << "\n"
+          << "   Column-major result:\n" << D << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PackedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PackedMatrix class test.
+*/
+#define RUN_PACKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,453 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/AsyncTest.h
+//  \brief Header file for the asynchronous evaluation test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/Column.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/smp/Async.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the asynchronous evaluation of expressions.
+//
+// This class represents a test suite for the asyncAssign() and async() functions, including the
+// ordering of dependent asynchronous operations and the propagation of exceptions.
+*/
+class AsyncTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AsyncTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testAssign();
+   template< typename Type > void testEvaluation();
+   template< typename Type > void testOrdering();
+                             void testException();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static void initialize( blaze::DynamicVector<Type>& v );
+
+   template< typename Type >
+   static void initialize( blaze::DynamicMatrix<Type>& A );
+
+   template< typename T >
+   static blaze::ResultType_t<T> evaluate( const T& expr );
+
+   template< typename T1, typename T2 >
+   void checkResult( const std::string& label, const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous assignment of expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the asyncAssign() functions for matrices, vectors and views.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void AsyncTest::testAssign()
+{
+   test_ = "asyncAssign()";
+
+   blaze::DynamicMatrix<Type> A( 67UL, 53UL ), B( 53UL, 71UL ), C;
+   blaze::DynamicVector<Type> a( 53UL ), c;
+   initialize( A );
+   initialize( B );
+   initialize( a );
+
+   {
+      std::shared_future<void> done( blaze::asyncAssign( C, A * B ) );
+      done.get();
+      checkResult( "Matrix assignment", C, evaluate( A * B ) );
+   }
+
+   {
+      std::shared_future<void> done( blaze::asyncAssign( c, A * a ) );
+      done.get();
+      checkResult( "Vector assignment", c, evaluate( A * a ) );
+   }
+
+   {
+      blaze::DynamicMatrix<Type> D( 67UL, 71UL, Type(0) );
+      blaze::asyncAssign( blaze::submatrix( D, 0UL, 0UL, 67UL, 53UL ), A ).get();
+      blaze::asyncAssign( blaze::column( D, 70UL ), A * a ).get();
+
+      blaze::DynamicMatrix<Type> ref( 67UL, 71UL, Type(0) );
+      blaze::submatrix( ref, 0UL, 0UL, 67UL, 53UL ) = A;
+      blaze::column( ref, 70UL ) = evaluate( A * a );
+
+      checkResult( "View assignment", D, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous evaluation of expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the async() functions for matrix and vector expressions. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void AsyncTest::testEvaluation()
+{
+   test_ = "async()";
+
+   blaze::DynamicMatrix<Type> A( 67UL, 53UL ), B( 53UL, 71UL );
+   blaze::DynamicVector<Type> a( 53UL );
+   initialize( A );
+   initialize( B );
+   initialize( a );
+
+   const blaze::DynamicMatrix<Type> ref1( evaluate( A * B ) );
+   const blaze::DynamicVector<Type> ref2( evaluate( A * a ) );
+
+   auto matrix( blaze::async( A * B ) );
+   auto vector( blaze::async( A * a ) );
+
+   checkResult( "Matrix evaluation", matrix.get(), ref1 );
+   checkResult( "Vector evaluation", vector.get(), ref2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ordering of dependent asynchronous operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of a chain of dependent asynchronous operations of one thread
+// and of asynchronous assignments of several threads to the same target. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void AsyncTest::testOrdering()
+{
+   test_ = "Ordering of asynchronous operations";
+
+   blaze::DynamicMatrix<Type> A( 50UL, 50UL ), B( 50UL, 50UL );
+   initialize( A );
+   initialize( B );
+
+   {
+      blaze::DynamicMatrix<Type> X( 50UL, 50UL ), Y( 50UL, 50UL ), Z;
+
+      blaze::asyncAssign( X, A + B );
+      blaze::asyncAssign( Y, X * A );
+      blaze::asyncAssign( X, Y - B );
+      auto result( blaze::async( X * Type(2) ) );
+      blaze::asyncAssign( Z, X + Y ).get();
+
+      const blaze::DynamicMatrix<Type> ref1( evaluate( A + B ) );
+      const blaze::DynamicMatrix<Type> ref2( evaluate( ref1 * A ) );
+      const blaze::DynamicMatrix<Type> ref3( evaluate( ref2 - B ) );
+
+      checkResult( "Chained evaluation", result.get(), evaluate( ref3 * Type(2) ) );
+      checkResult( "Chained assignment", Z, evaluate( ref3 + ref2 ) );
+   }
+
+   {
+      blaze::DynamicMatrix<Type> C( 50UL, 50UL );
+      const blaze::DynamicMatrix<Type> ref( evaluate( A * B ) );
+
+      std::vector<std::thread> threads;
+
+      for( size_t t=0UL; t<4UL; ++t ) {
+         threads.emplace_back( [&]() {
+            for( size_t i=0UL; i<10UL; ++i ) {
+               blaze::asyncAssign( C, A * B );
+            }
+            blaze::asyncAssign( C, A * B ).get();
+         } );
+      }
+
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      checkResult( "Concurrent assignment", C, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions of asynchronous operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during an asynchronous assignment is rethrown
+// by the returned handle. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void AsyncTest::testException()
+{
+   test_ = "Exception propagation";
+
+   blaze::DynamicMatrix<double> A( 5UL, 5UL, 1.0 );
+   blaze::LowerMatrix< blaze::DynamicMatrix<double> > L( 5UL );
+
+   std::shared_future<void> done( blaze::asyncAssign( L, A ) );
+
+   try {
+      done.get();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of a non-lower matrix to a lower matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << L << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   blaze::DynamicMatrix<double> C;
+   blaze::asyncAssign( C, A * A ).get();
+   checkResult( "Assignment after exception", C, evaluate( A * A ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< typename Type >  // Element type of the vector
+void AsyncTest::initialize( blaze::DynamicVector<Type>& v )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename Type >  // Element type of the matrix
+void AsyncTest::initialize( blaze::DynamicMatrix<Type>& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serial evaluation of the given expression.
+//
+// \param expr The expression to be evaluated.
+// \return The result of the expression.
+*/
+template< typename T >  // Type of the expression
+blaze::ResultType_t<T> AsyncTest::evaluate( const T& expr )
+{
+   blaze::ResultType_t<T> result;
+
+   BLAZE_SERIAL_SECTION {
+      result = expr;
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an asynchronous operation.
+//
+// \param label The label of the operation.
+// \param result The result of the asynchronous operation.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result differs from the expected result, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void AsyncTest::checkResult( const std::string& label, const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the asynchronous assignment and evaluation of expressions.
+//
+// \return void
+*/
+void runTest()
+{
+   AsyncTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the asynchronous evaluation test.
+*/
+#define RUN_SMP_ASYNC_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
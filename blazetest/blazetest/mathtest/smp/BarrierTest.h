@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/BarrierTest.h
+//  \brief Header file for the counting barrier test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_BARRIERTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_BARRIERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/CountingBarrier.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the counting barrier of the thread pools.
+//
+// This class represents a test suite for the CountingBarrier class template, which joins the
+// tasks of the thread pools, and for the join of a ThreadPool with parking and with spinning
+// worker threads (see the \c BLAZE_THREAD_SPIN_COUNT switch).
+*/
+class BarrierTest
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the tested counting barrier.
+   using Barrier = blaze::threadpool::CountingBarrier< std::mutex, std::unique_lock<std::mutex>
+                                                     , std::condition_variable >;
+   
+   //! Type of the tested thread pool.
+   using Pool = blaze::ThreadPool< std::thread, std::mutex, std::unique_lock<std::mutex>
+                                 , std::condition_variable >;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BarrierTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testCountingBarrier();
+   void testThreadPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void work( size_t n );
+
+   void checkCount( const std::string& label, size_t count, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CountingBarrier class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function registers a number of tasks at a CountingBarrier, completes them from several
+// threads and checks that the waiting thread is only released after all tasks are completed,
+// both for a parking and a spinning barrier. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void BarrierTest::testCountingBarrier()
+{
+   test_ = "CountingBarrier";
+
+   for( size_t spin : { 0UL, 100000UL } )
+   {
+      Barrier barrier( spin );
+      checkCount( "Spin count", barrier.spin(), spin );
+
+      barrier.wait();  // Must not block without outstanding tasks
+
+      for( size_t round=0UL; round<20UL; ++round )
+      {
+         std::atomic<size_t> count( 0UL );
+
+         barrier.add( 400UL );
+         checkCount( "Number of outstanding tasks", barrier.count(), 400UL );
+
+         std::vector<std::thread> threads;
+
+         for( size_t t=0UL; t<4UL; ++t ) {
+            threads.emplace_back( [&barrier,&count,t]() {
+               for( size_t i=0UL; i<100UL; ++i ) {
+                  work( ( ( i + t ) % 7UL ) * 100UL );
+                  ++count;
+                  barrier.arrive();
+               }
+            } );
+         }
+
+         barrier.wait();
+         checkCount( "Number of completed tasks", count, 400UL );
+         checkCount( "Number of outstanding tasks", barrier.count(), 0UL );
+
+         for( std::thread& thread : threads ) {
+            thread.join();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the join of a thread pool with spinning workers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules a small number of short tasks on a ThreadPool and joins
+// them via the wait() function, both with parking and spinning workers. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+inline void BarrierTest::testThreadPool()
+{
+   test_ = "ThreadPool::wait()";
+
+   for( size_t spin : { 0UL, 100000UL } )
+   {
+      Pool pool( 4UL, spin );
+
+      std::atomic<size_t> sum( 0UL );
+      size_t expected( 0UL );
+
+      for( size_t round=0UL; round<200UL; ++round )
+      {
+         for( size_t i=0UL; i<8UL; ++i ) {
+            pool.schedule( [&sum,i]() { work( i * 100UL ); sum += i; } );
+         }
+
+         pool.wait();
+
+         expected += 28UL;
+         checkCount( "Sum of all task indices", sum, expected );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Busy work of the given number of iterations.
+//
+// \param n The number of iterations.
+// \return void
+*/
+inline void BarrierTest::work( size_t n )
+{
+   volatile size_t dummy( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      dummy = dummy + i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param label The label of the count.
+// \param count The actual count.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given count does not match the expected count, a \a std::runtime_error exception
+// is thrown.
+*/
+inline void BarrierTest::checkCount( const std::string& label,
+                                     size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " is invalid\n"
+          << " Details:\n"
+          << "   Result: " << count << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the counting barrier and the spinning thread pool workers.
+//
+// \return void
+*/
+void runTest()
+{
+   BarrierTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the counting barrier test.
+*/
+#define RUN_SMP_BARRIER_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
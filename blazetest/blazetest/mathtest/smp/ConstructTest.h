@@ -0,0 +1,396 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ConstructTest.h
+//  \brief Header file for the SMP construction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_CONSTRUCTTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_CONSTRUCTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/util/Complex.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the construction of dense vectors and matrices.
+//
+// This class represents a test suite for the construction of dynamic vectors and matrices. The
+// SMP thresholds are lowered such that in NUMA mode all elements are initialized in parallel.
+*/
+class ConstructTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ConstructTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVector();
+   template< typename Type > void testMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT >
+   void checkVector( const VT& vec, const blaze::ElementType_t<VT>& value ) const;
+
+   template< typename MT >
+   void checkMatrix( const MT& mat, const blaze::ElementType_t<MT>& value ) const;
+
+   template< typename VT >
+   void checkVectorPadding( const VT& vec ) const;
+
+   template< typename MT >
+   void checkMatrixPadding( const MT& mat ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the construction of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the construction of dynamic vectors, which in NUMA mode are
+// initialized in parallel. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void ConstructTest::testVector()
+{
+   test_ = "Construction of dynamic vectors";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 1000UL, 10007UL } )
+   {
+      const blaze::DynamicVector<Type> a( n );
+      checkVectorPadding( a );
+
+      const blaze::DynamicVector<Type> b( n, Type(3) );
+      checkVector( b, Type(3) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the construction of dynamic matrices, which in NUMA mode are
+// initialized in parallel. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void ConstructTest::testMatrix()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Construction of dynamic matrices";
+
+   for( size_t m : { 0UL, 1UL, 13UL, 101UL } ) {
+      for( size_t n : { 0UL, 1UL, 17UL, 99UL } )
+      {
+         const blaze::DynamicMatrix<Type,rowMajor> A( m, n );
+         checkMatrixPadding( A );
+
+         const blaze::DynamicMatrix<Type,rowMajor> B( m, n, Type(5) );
+         checkMatrix( B, Type(5) );
+
+         const blaze::DynamicMatrix<Type,columnMajor> C( m, n );
+         checkMatrixPadding( C );
+
+         const blaze::DynamicMatrix<Type,columnMajor> D( m, n, Type(5) );
+         checkMatrix( D, Type(5) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the elements of a dense vector.
+//
+// \param vec The dense vector to be checked.
+// \param value The expected value of all elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all elements of the given dense vector are equal to the given value
+// and that all padding elements are zero. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename VT >  // Type of the dense vector
+void ConstructTest::checkVector( const VT& vec, const blaze::ElementType_t<VT>& value ) const
+{
+   for( size_t i=0UL; i<vec.size(); ++i ) {
+      if( vec[i] != value ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( blaze::ElementType_t<VT> ).name() << "\n"
+             << "   Size: " << vec.size() << "\n"
+             << "   Index: " << i << "\n"
+             << "   Result: " << vec[i] << "\n"
+             << "   Expected result: " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkVectorPadding( vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of a dense matrix.
+//
+// \param mat The dense matrix to be checked.
+// \param value The expected value of all elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all elements of the given dense matrix are equal to the given value
+// and that all padding elements are zero. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ConstructTest::checkMatrix( const MT& mat, const blaze::ElementType_t<MT>& value ) const
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         if( mat(i,j) != value ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( blaze::ElementType_t<MT> ).name() << "\n"
+                << "   Size: " << mat.rows() << "x" << mat.columns() << "\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Result: " << mat(i,j) << "\n"
+                << "   Expected result: " << value << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   checkMatrixPadding( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding elements of a dense vector.
+//
+// \param vec The dense vector to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all padding elements of the given dense vector are zero. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the dense vector
+void ConstructTest::checkVectorPadding( const VT& vec ) const
+{
+   using ET = blaze::ElementType_t<VT>;
+
+   for( size_t i=vec.size(); i<vec.spacing(); ++i ) {
+      if( vec.data()[i] != ET() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid padding element\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( ET ).name() << "\n"
+             << "   Size: " << vec.size() << "\n"
+             << "   Index: " << i << "\n"
+             << "   Result: " << vec.data()[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding elements of a dense matrix.
+//
+// \param mat The dense matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all padding elements of the given dense matrix are zero. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+void ConstructTest::checkMatrixPadding( const MT& mat ) const
+{
+   using ET = blaze::ElementType_t<MT>;
+
+   constexpr bool SO( blaze::IsColumnMajorMatrix_v<MT> );
+
+   const size_t M( SO ? mat.columns() : mat.rows()    );
+   const size_t N( SO ? mat.rows()    : mat.columns() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=N; j<mat.spacing(); ++j ) {
+         if( mat.data( i )[j] != ET() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid padding element\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( ET ).name() << "\n"
+                << "   Storage order: " << ( SO ? "column-major" : "row-major" ) << "\n"
+                << "   Size: " << mat.rows() << "x" << mat.columns() << "\n"
+                << "   " << ( SO ? "Column" : "Row" ) << ": " << i << "\n"
+                << "   Index: " << j << "\n"
+                << "   Result: " << mat.data( i )[j] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the construction of dense vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   ConstructTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP construction test.
+*/
+#define RUN_SMP_CONSTRUCT_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,612 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/PartitionTest.h
+//  \brief Header file for the SMP partitioning test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_PARTITIONTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_PARTITIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the cache line aligned SMP partitioning.
+//
+// This class represents a test suite for the partitioning of dense vectors and matrices into
+// the blocks of the parallel assignments, which aligns the block boundaries to cache lines, and
+// for the parallel assignment to targets whose blocks do not start at a cache line.
+*/
+class PartitionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit PartitionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVectorPartition();
+   template< typename Type > void testMatrixPartition();
+   template< typename Type > void testAssignment();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void checkMatrixPartition( size_t partitions, const blaze::DenseMatrix<MT,SO>& A );
+
+   void checkCoverage( const std::string& label, const blaze::BlockPartition& partition,
+                       size_t size ) const;
+
+   void checkBoundary( const std::string& label, size_t index, bool valid ) const;
+
+   template< typename Type >
+   static size_t address( const Type* ptr ) noexcept;
+
+   template< typename Type >
+   static void initialize( blaze::DynamicVector<Type>& v );
+
+   template< typename Type, bool SO >
+   static void initialize( blaze::DynamicMatrix<Type,SO>& A );
+
+   template< typename T1, typename T2 >
+   void checkResult( const std::string& label, const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the cache line aligned partitioning of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the createVectorPartition() function for vectors and
+// unaligned subvectors of various sizes. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void PartitionTest::testVectorPartition()
+{
+   using blaze::cacheLineSize;
+
+   constexpr size_t SIMDSIZE( blaze::SIMDTrait<Type>::size );
+
+   test_ = "Vector partitioning";
+
+   for( size_t size : { 1UL, 7UL, 100UL, 1000UL, 10007UL } ) {
+      for( size_t offset : { 0UL, 1UL, 3UL } ) {
+         for( size_t partitions : { 1UL, 2UL, 3UL, 4UL, 7UL } )
+         {
+            blaze::DynamicVector<Type> v( size+offset );
+            auto sv( blaze::subvector( v, offset, size, blaze::unaligned ) );
+
+            const blaze::BlockPartition p1( blaze::createVectorPartition( partitions, sv, false ) );
+            checkCoverage( "Scalar vector partitioning", p1, size );
+
+            for( size_t i=1UL; i<p1.blocks; ++i ) {
+               const size_t index( p1.begin( i ) );
+               if( index > 0UL && index < size ) {
+                  checkBoundary( "Scalar vector partitioning", index,
+                                 address( &sv[index] ) % cacheLineSize == 0UL );
+               }
+            }
+
+            const blaze::BlockPartition p2( blaze::createVectorPartition( partitions, sv, true ) );
+            checkCoverage( "Vectorized vector partitioning", p2, size );
+
+            for( size_t i=1UL; i<p2.blocks; ++i ) {
+               const size_t index( p2.begin( i ) );
+               if( index > 0UL && index < size ) {
+                  checkBoundary( "Vectorized vector partitioning", index, index % SIMDSIZE == 0UL );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the cache line aligned partitioning of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the createMatrixPartition() function for padded and unpadded
+// row-major and column-major matrices of various sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void PartitionTest::testMatrixPartition()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   for( size_t m : { 5UL, 33UL, 100UL } ) {
+      for( size_t n : { 3UL, 17UL, 64UL, 101UL } ) {
+         for( size_t partitions : { 1UL, 2UL, 4UL, 6UL } )
+         {
+            test_ = "Padded matrix partitioning";
+            {
+               blaze::DynamicMatrix<Type,rowMajor> A( m, n );
+               checkMatrixPartition( partitions, A );
+
+               blaze::DynamicMatrix<Type,columnMajor> B( m, n );
+               checkMatrixPartition( partitions, B );
+            }
+
+            test_ = "Unpadded matrix partitioning";
+            {
+               std::vector<Type> memory( m*n+1UL );
+
+               using RowMajorType    = blaze::CustomMatrix<Type,unaligned,unpadded,rowMajor>;
+               using ColumnMajorType = blaze::CustomMatrix<Type,unaligned,unpadded,columnMajor>;
+
+               RowMajorType A( memory.data()+1UL, m, n );
+               checkMatrixPartition( partitions, A );
+
+               ColumnMajorType B( memory.data()+1UL, m, n );
+               checkMatrixPartition( partitions, B );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment to unaligned targets.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel assignment of dense vector and matrix expressions
+// to unaligned subvectors, submatrices and unpadded custom matrices, whose partitions do not
+// start at the beginning of a cache line. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void PartitionTest::testAssignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   test_ = "Assignment to unaligned targets";
+
+   {
+      blaze::DynamicVector<Type> a( 1000UL ), b( 1000UL );
+      initialize( a );
+      initialize( b );
+
+      for( size_t offset : { 1UL, 3UL, 5UL } )
+      {
+         blaze::DynamicVector<Type> c( 1010UL, Type(0) ), ref( c );
+         auto sc  ( blaze::subvector( c  , offset, 1000UL ) );
+         auto sref( blaze::subvector( ref, offset, 1000UL ) );
+
+         sc = a + b;
+         sc += a * Type(2);
+
+         BLAZE_SERIAL_SECTION {
+            sref = a + b;
+            sref += a * Type(2);
+         }
+
+         checkResult( "Subvector assignment", c, ref );
+      }
+   }
+
+   {
+      blaze::DynamicMatrix<Type,rowMajor> A( 61UL, 77UL ), B( 61UL, 77UL );
+      blaze::DynamicMatrix<Type,columnMajor> C( 61UL, 77UL );
+      initialize( A );
+      initialize( B );
+      C = A;
+
+      blaze::DynamicMatrix<Type,rowMajor> D( 64UL, 81UL, Type(0) ), ref1( D );
+      blaze::DynamicMatrix<Type,columnMajor> E( 64UL, 81UL, Type(0) ), ref2( E );
+
+      blaze::submatrix( D, 1UL, 3UL, 61UL, 77UL ) = A + B;
+      blaze::submatrix( D, 1UL, 3UL, 61UL, 77UL ) += C;
+      blaze::submatrix( E, 3UL, 1UL, 61UL, 77UL ) = A + C;
+
+      BLAZE_SERIAL_SECTION {
+         blaze::submatrix( ref1, 1UL, 3UL, 61UL, 77UL ) = A + B;
+         blaze::submatrix( ref1, 1UL, 3UL, 61UL, 77UL ) += C;
+         blaze::submatrix( ref2, 3UL, 1UL, 61UL, 77UL ) = A + C;
+      }
+
+      checkResult( "Row-major submatrix assignment", D, ref1 );
+      checkResult( "Column-major submatrix assignment", E, ref2 );
+
+      std::vector<Type> memory1( 61UL*77UL+1UL ), memory2( 61UL*77UL+1UL );
+
+      blaze::CustomMatrix<Type,unaligned,unpadded,rowMajor> F( memory1.data()+1UL, 61UL, 77UL );
+      blaze::CustomMatrix<Type,unaligned,unpadded,columnMajor> G( memory2.data()+1UL, 61UL, 77UL );
+
+      F = A + B;
+      G = A - C;
+
+      BLAZE_SERIAL_SECTION {
+         ref1 = A + B;
+         ref2 = A - C;
+      }
+
+      checkResult( "Row-major custom matrix assignment", F, ref1 );
+      checkResult( "Column-major custom matrix assignment", G, ref2 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the partitioning of the given dense matrix.
+//
+// \param partitions The total number of partitions.
+// \param A The dense matrix to be partitioned.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the scalar and vectorized partitionings of the given matrix cover
+// the entire matrix, that all boundaries of vectorized partitionings are multiples of the SIMD
+// width, and that all boundaries of scalar partitionings start at a cache line whenever this
+// is possible.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void PartitionTest::checkMatrixPartition( size_t partitions, const blaze::DenseMatrix<MT,SO>& A )
+{
+   using blaze::cacheLineSize;
+
+   constexpr size_t SIMDSIZE( blaze::SIMDTrait< blaze::ElementType_t<MT> >::size );
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t major( SO ? n : m );
+
+   bool alignable( false );
+
+   for( size_t k=0UL; k<major && k<cacheLineSize; ++k ) {
+      if( address( SO ? &(*A)(0UL,k) : &(*A)(k,0UL) ) % cacheLineSize == 0UL )
+         alignable = true;
+   }
+
+   const blaze::MatrixPartition p1( blaze::createMatrixPartition( partitions, *A, *A, false ) );
+   checkCoverage( "Partitioning of the rows", p1.rows, m );
+   checkCoverage( "Partitioning of the columns", p1.columns, n );
+
+   for( size_t b=1UL; b<p1.rows.blocks; ++b ) {
+      const size_t i( p1.rows.begin( b ) );
+      if( i > 0UL && i < m ) {
+         checkBoundary( "Scalar partitioning of the rows", i,
+                        ( SO || !alignable ) || address( &(*A)(i,0UL) ) % cacheLineSize == 0UL );
+      }
+   }
+
+   for( size_t b=1UL; b<p1.columns.blocks; ++b ) {
+      const size_t j( p1.columns.begin( b ) );
+      if( j > 0UL && j < n ) {
+         checkBoundary( "Scalar partitioning of the columns", j,
+                        ( !SO || !alignable ) || address( &(*A)(0UL,j) ) % cacheLineSize == 0UL );
+      }
+   }
+
+   const blaze::MatrixPartition p2( blaze::createMatrixPartition( partitions, *A, *A, true ) );
+   checkCoverage( "Vectorized partitioning of the rows", p2.rows, m );
+   checkCoverage( "Vectorized partitioning of the columns", p2.columns, n );
+
+   for( size_t b=1UL; b<p2.rows.blocks; ++b ) {
+      const size_t i( p2.rows.begin( b ) );
+      if( i > 0UL && i < m ) {
+         checkBoundary( "Vectorized partitioning of the rows", i, i % SIMDSIZE == 0UL );
+      }
+   }
+
+   for( size_t b=1UL; b<p2.columns.blocks; ++b ) {
+      const size_t j( p2.columns.begin( b ) );
+      if( j > 0UL && j < n ) {
+         checkBoundary( "Vectorized partitioning of the columns", j, j % SIMDSIZE == 0UL );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given partitioning covers the given index range.
+//
+// \param label The label of the partitioning.
+// \param partition The partitioning to be checked.
+// \param size The size of the partitioned index range.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the blocks of the given partitioning do not cover the index range \f$ [0..size) \f$
+// without gaps and overlaps, a \a std::runtime_error exception is thrown.
+*/
+inline void PartitionTest::checkCoverage( const std::string& label,
+                                          const blaze::BlockPartition& partition,
+                                          size_t size ) const
+{
+   bool valid( partition.begin( 0UL ) == 0UL && partition.end( partition.blocks-1UL ) == size );
+
+   for( size_t i=0UL; valid && i<partition.blocks; ++i ) {
+      valid = ( partition.begin( i ) <= partition.end( i ) ) &&
+              ( i+1UL == partition.blocks || partition.end( i ) == partition.begin( i+1UL ) );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " does not cover the index range\n"
+          << " Details:\n"
+          << "   Size of the index range: " << size << "\n"
+          << "   Number of blocks: " << partition.blocks << "\n"
+          << "   Block boundaries:";
+      for( size_t i=0UL; i<partition.blocks; ++i ) {
+         oss << " [" << partition.begin( i ) << "," << partition.end( i ) << ")";
+      }
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a block boundary of a partitioning.
+//
+// \param label The label of the partitioning.
+// \param index The index of the block boundary.
+// \param valid \a true in case the block boundary is valid, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given block boundary is invalid, a \a std::runtime_error exception is thrown.
+*/
+inline void PartitionTest::checkBoundary( const std::string& label, size_t index, bool valid ) const
+{
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " has an invalid block boundary\n"
+          << " Details:\n"
+          << "   Block boundary: " << index << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the numeric value of the given address.
+//
+// \param ptr The address.
+// \return The numeric value of the address.
+*/
+template< typename Type >  // Type of the addressed element
+size_t PartitionTest::address( const Type* ptr ) noexcept
+{
+   return static_cast<size_t>( reinterpret_cast<std::uintptr_t>( ptr ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< typename Type >  // Element type of the vector
+void PartitionTest::initialize( blaze::DynamicVector<Type>& v )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Element type of the matrix
+        , bool SO >      // Storage order of the matrix
+void PartitionTest::initialize( blaze::DynamicMatrix<Type,SO>& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an assignment.
+//
+// \param label The label of the assignment.
+// \param result The result of the assignment.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result differs from the expected result, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void PartitionTest::checkResult( const std::string& label,
+                                 const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the cache line aligned partitioning of the SMP assignments.
+//
+// \return void
+*/
+void runTest()
+{
+   PartitionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP partitioning test.
+*/
+#define RUN_SMP_PARTITION_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,367 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ReductionTest.h
+//  \brief Header file for the SMP reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_REDUCTIONTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_REDUCTIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP total reductions.
+//
+// This class represents a test suite for the parallel total reductions, norms and inner products
+// of dense vectors and the parallel total reductions of dense matrices. The SMP thresholds are
+// lowered such that all reductions are executed in parallel in case a parallelization backend
+// is active.
+*/
+class ReductionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ReductionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVectorReduction();
+   template< typename Type > void testMatrixReduction();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2, typename T3 >
+   static void initialize( T1& a, T2& b, T3& c );
+
+   template< typename T1, typename T2, typename T3, typename T4 >
+   static void initialize( T1& A, T2& B, T3& C, T4& D );
+
+   template< typename OP >
+   void checkReduction( const std::string& label, OP reduction ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP reduction of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel total reductions, norms and inner products of
+// dense vectors and subvectors of various sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void ReductionTest::testVectorReduction()
+{
+   for( size_t n : { 1UL, 31UL, 1000UL, 10007UL } )
+   {
+      test_ = "Dense vector reduction (size " + std::to_string( n ) + ")";
+
+      blaze::DynamicVector<Type> a( n ), b( n ), c( n );
+      initialize( a, b, c );
+
+      const auto sa( blaze::subvector( a, 0UL, n, blaze::unaligned ) );
+      const auto sb( blaze::subvector( b, n/3UL, n-n/3UL, blaze::unaligned ) );
+      const auto sc( blaze::subvector( c, n/3UL, n-n/3UL, blaze::unaligned ) );
+
+      checkReduction( "sum()"      , [&]() { return blaze::sum( a ); } );
+      checkReduction( "prod()"     , [&]() { return blaze::prod( c ); } );
+      checkReduction( "min()"      , [&]() { return blaze::min( a ); } );
+      checkReduction( "max()"      , [&]() { return blaze::max( a ); } );
+      checkReduction( "reduce()"   , [&]() { return blaze::reduce( a, blaze::Add() ); } );
+      checkReduction( "dot()"      , [&]() { return blaze::dot( a, b ); } );
+      checkReduction( "norm()"     , [&]() { return blaze::norm( a ); } );
+      checkReduction( "sqrNorm()"  , [&]() { return blaze::sqrNorm( a ); } );
+      checkReduction( "l1Norm()"   , [&]() { return blaze::l1Norm( a ); } );
+      checkReduction( "maxNorm()"  , [&]() { return blaze::maxNorm( a ); } );
+      checkReduction( "sum(a+b)"   , [&]() { return blaze::sum( a + b ); } );
+      checkReduction( "dot(a,a+b)" , [&]() { return blaze::dot( a, a + b ); } );
+      checkReduction( "sum(sb)"    , [&]() { return blaze::sum( sb ); } );
+      checkReduction( "prod(sc)"   , [&]() { return blaze::prod( sc ); } );
+      checkReduction( "dot(sa,a)"  , [&]() { return blaze::dot( sa, a ); } );
+      checkReduction( "l1Norm(sb)" , [&]() { return blaze::l1Norm( sb ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP total reduction of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel total reductions of row-major and column-major
+// dense matrices and submatrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void ReductionTest::testMatrixReduction()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   for( size_t m : { 3UL, 67UL, 200UL } )
+   {
+      test_ = "Dense matrix reduction (" + std::to_string( m ) + " rows)";
+
+      blaze::DynamicMatrix<Type,rowMajor> A( m, 53UL ), C( m, 53UL );
+      blaze::DynamicMatrix<Type,columnMajor> B( m, 53UL ), D( m, 53UL );
+      initialize( A, B, C, D );
+
+      const auto SA( blaze::submatrix( A, 1UL, 3UL, m-1UL, 47UL, blaze::unaligned ) );
+      const auto SB( blaze::submatrix( B, 1UL, 3UL, m-1UL, 47UL, blaze::unaligned ) );
+
+      checkReduction( "sum(A)"   , [&]() { return blaze::sum( A ); } );
+      checkReduction( "sum(B)"   , [&]() { return blaze::sum( B ); } );
+      checkReduction( "prod(C)"  , [&]() { return blaze::prod( C ); } );
+      checkReduction( "prod(D)"  , [&]() { return blaze::prod( D ); } );
+      checkReduction( "min(A)"   , [&]() { return blaze::min( A ); } );
+      checkReduction( "max(B)"   , [&]() { return blaze::max( B ); } );
+      checkReduction( "sum(A+B)" , [&]() { return blaze::sum( A + B ); } );
+      checkReduction( "sum(SA)"  , [&]() { return blaze::sum( SA ); } );
+      checkReduction( "max(SB)"  , [&]() { return blaze::max( SB ); } );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given operands.
+//
+// \param a The first operand (small integral values).
+// \param b The second operand (small integral values).
+// \param c The third operand (values of -1 and 1).
+// \return void
+//
+// This function initializes the given vectors or matrices such that all reductions can be
+// computed exactly, independent of the order in which the partial results are combined.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2    // Type of the second operand
+        , typename T3 >  // Type of the third operand
+void ReductionTest::initialize( T1& a, T2& b, T3& c )
+{
+   using Type = blaze::ElementType_t<T1>;
+
+   for( auto& element : a ) element = Type( blaze::rand<int>( -9, 9 ) );
+   for( auto& element : b ) element = Type( blaze::rand<int>( -9, 9 ) );
+   for( auto& element : c ) element = Type( 2*blaze::rand<int>( 0, 1 ) - 1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix operands.
+//
+// \param A The first operand (small integral values).
+// \param B The second operand (small integral values).
+// \param C The third operand (values of -1 and 1).
+// \param D The fourth operand (values of -1 and 1).
+// \return void
+//
+// This function initializes the given matrices such that all reductions can be computed
+// exactly, independent of the order in which the partial results are combined.
+*/
+template< typename T1    // Type of the first operand
+        , typename T2    // Type of the second operand
+        , typename T3    // Type of the third operand
+        , typename T4 >  // Type of the fourth operand
+void ReductionTest::initialize( T1& A, T2& B, T3& C, T4& D )
+{
+   using Type = blaze::ElementType_t<T1>;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = Type( blaze::rand<int>( -9, 9 ) );
+         B(i,j) = Type( blaze::rand<int>( -9, 9 ) );
+         C(i,j) = Type( 2*blaze::rand<int>( 0, 1 ) - 1 );
+         D(i,j) = Type( 2*blaze::rand<int>( 0, 1 ) - 1 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a reduction.
+//
+// \param label The label of the reduction.
+// \param reduction The reduction to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the given reduction to the result of a serial evaluation
+// of the same reduction. In case the results differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename OP >  // Type of the reduction
+void ReductionTest::checkReduction( const std::string& label, OP reduction ) const
+{
+   using RT = std::decay_t< decltype( reduction() ) >;
+
+   RT ref{};
+
+   BLAZE_SERIAL_SECTION {
+      ref = reduction();
+   }
+
+   const RT result( reduction() );
+
+   if( !blaze::equal( result, ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << " reduction\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( RT ).name() << "\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP total reductions of dense vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   ReductionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP reduction test.
+*/
+#define RUN_SMP_REDUCTION_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
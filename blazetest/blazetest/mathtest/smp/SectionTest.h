@@ -0,0 +1,286 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SectionTest.h
+//  \brief Header file for the SMP section test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SECTIONTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SECTIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Loop.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/system/SMP.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the serial and parallel sections.
+//
+// This class represents a test suite for the activity flags of the serial and parallel sections
+// in combination with the active parallelization backend.
+*/
+class SectionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SectionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSerialSection();
+   void testParallelSection();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the serial section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the activity flag of the serial section and its visibility from other
+// threads. In combination with the C++11 and Boost thread parallelization the flag is expected
+// to be thread-specific, in combination with all other parallelizations it is expected to be
+// shared by all threads. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SectionTest::testSerialSection()
+{
+   test_ = "Serial section";
+
+   if( blaze::isSerialSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial section active outside a serial section\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   bool inner ( false );
+   bool shared( false );
+
+   BLAZE_SERIAL_SECTION
+   {
+      inner = blaze::isSerialSectionActive();
+
+      std::thread thread( [&shared]() { shared = blaze::isSerialSectionActive(); } );
+      thread.join();
+   }
+
+   if( !inner ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial section inactive inside a serial section\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( shared != !BLAZE_THREAD_LOCAL_SECTION_MODE ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid visibility of the serial section in other threads\n"
+          << " Details:\n"
+          << "   Result: " << shared << "\n"
+          << "   Expected result: " << !BLAZE_THREAD_LOCAL_SECTION_MODE << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::isSerialSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial section active after leaving the serial section\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel section within the tasks of the parallelization backend.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all tasks that are executed by threads of the active parallelization
+// backend observe an active parallel section. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SectionTest::testParallelSection()
+{
+   test_ = "Parallel section";
+
+   const size_t N( 1000UL );
+
+   std::vector<size_t> work( N+1UL );
+   for( size_t i=0UL; i<=N; ++i ) {
+      work[i] = i;
+   }
+
+   const std::thread::id caller( std::this_thread::get_id() );
+   std::atomic<size_t> invalid( 0UL );
+
+   blaze::smpLoop( work, [caller,&invalid]( size_t, size_t )
+   {
+      if( std::this_thread::get_id() != caller && !blaze::isParallelSectionActive() ) {
+         ++invalid;
+      }
+   } );
+
+   if( invalid != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel section inactive in " << invalid << " tasks\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 1UL );
+
+   blaze::DynamicVector<double> a( 10000UL, 1.0 ), b;
+   b = a * 2.0;
+
+   blaze::resetThresholds();
+
+   if( b.size() != 10000UL || blaze::sum( b ) != 20000.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel assignment failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::sum( b ) << "\n"
+          << "   Expected result: 20000\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::isParallelSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel section active after the parallel execution\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the serial and parallel sections.
+//
+// \return void
+*/
+void runTest()
+{
+   SectionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP section test.
+*/
+#define RUN_SMP_SECTION_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SparseAssignTest.h
+//  \brief Header file for the SMP sparse assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SPARSEASSIGNTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SPARSEASSIGNTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP assignment to compressed matrices and vectors.
+//
+// This class represents a test suite for the parallel assignment of dense and sparse matrices
+// and vectors to compressed matrices and vectors. The SMP thresholds are lowered such that
+// all assignments are executed in parallel in case a parallelization backend is active.
+*/
+class SparseAssignTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseAssignTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMatrixAssign();
+   template< typename Type > void testVectorAssign();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::SparseMatrix<MT1,SO1>& result,
+                     const blaze::Matrix<MT2,SO2>& rhs ) const;
+
+   template< typename VT1, typename VT2, bool TF >
+   void checkResult( const std::string& label, const blaze::SparseVector<VT1,TF>& result,
+                     const blaze::Vector<VT2,TF>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of matrices to compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SMP assignment of dense matrices, sparse matrices and
+// sparse matrix expressions to row-major and column-major compressed matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseAssignTest::testMatrixAssign()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   blaze::CompressedMatrix<Type,rowMajor> A( 67UL, 53UL );
+   blaze::randomize( A, 700UL );
+
+   const blaze::CompressedMatrix<Type,columnMajor> B( A );
+   const blaze::DynamicMatrix<Type,rowMajor> D( A );
+   const blaze::DynamicMatrix<Type,columnMajor> E( A );
+
+
+   //=====================================================================================
+   // Row-major compressed matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major compressed matrix assignment";
+
+      blaze::CompressedMatrix<Type,rowMajor> C;
+
+      C = D;
+      checkResult( "Row-major dense matrix", C, D );
+
+      C = E;
+      checkResult( "Column-major dense matrix", C, E );
+
+      C = A;
+      checkResult( "Row-major sparse matrix", C, A );
+
+      C = B;
+      checkResult( "Column-major sparse matrix", C, B );
+
+      C = A * Type(2);
+      checkResult( "Scaled row-major sparse matrix", C, A * Type(2) );
+
+      C = A + B;
+      checkResult( "Sparse matrix addition", C, A + B );
+
+      C = trans( trans( A ) );
+      checkResult( "Transposed sparse matrix", C, trans( trans( A ) ) );
+
+      const blaze::CompressedMatrix<Type,rowMajor> F( D );
+      checkResult( "Construction from a dense matrix", F, D );
+   }
+
+
+   //=====================================================================================
+   // Column-major compressed matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major compressed matrix assignment";
+
+      blaze::CompressedMatrix<Type,columnMajor> C;
+
+      C = D;
+      checkResult( "Row-major dense matrix", C, D );
+
+      C = E;
+      checkResult( "Column-major dense matrix", C, E );
+
+      C = A;
+      checkResult( "Row-major sparse matrix", C, A );
+
+      C = B;
+      checkResult( "Column-major sparse matrix", C, B );
+
+      C = B * Type(2);
+      checkResult( "Scaled column-major sparse matrix", C, B * Type(2) );
+
+      C = B - A;
+      checkResult( "Sparse matrix subtraction", C, B - A );
+
+      const blaze::CompressedMatrix<Type,columnMajor> F( E );
+      checkResult( "Construction from a dense matrix", F, E );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment of vectors to compressed vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SMP assignment of dense vectors, sparse vectors and
+// sparse vector expressions to compressed vectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseAssignTest::testVectorAssign()
+{
+   test_ = "Compressed vector assignment";
+
+   blaze::CompressedVector<Type> a( 1013UL );
+   blaze::randomize( a, 157UL );
+
+   const blaze::DynamicVector<Type> d( a );
+   const blaze::CompressedVector<Type> zero( 1013UL );
+
+   blaze::CompressedVector<Type> c;
+
+   c = d;
+   checkResult( "Dense vector", c, d );
+
+   c = a;
+   checkResult( "Sparse vector", c, a );
+
+   c = a * Type(3);
+   checkResult( "Scaled sparse vector", c, a * Type(3) );
+
+   c = a + a;
+   checkResult( "Sparse vector addition", c, a + a );
+
+   c = blaze::subvector( a, 17UL, 801UL );
+   checkResult( "Sparse subvector", c, blaze::subvector( a, 17UL, 801UL ) );
+
+   c = zero;
+   checkResult( "Zero vector", c, zero );
+
+   const blaze::CompressedVector<Type> e( d );
+   checkResult( "Construction from a dense vector", e, d );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a compressed matrix assignment.
+//
+// \param label The label of the assigned operand.
+// \param result The resulting compressed matrix.
+// \param rhs The assigned right-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given compressed matrix to the result of a serial assignment of
+// the given right-hand side matrix. Both the values and the number of non-zero elements of
+// every row (or column) have to match. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1  // Type of the resulting compressed matrix
+        , bool SO1      // Storage order of the resulting compressed matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void SparseAssignTest::checkResult( const std::string& label,
+                                    const blaze::SparseMatrix<MT1,SO1>& result,
+                                    const blaze::Matrix<MT2,SO2>& rhs ) const
+{
+   MT1 ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = *rhs;
+   }
+
+   const size_t major( SO1 ? ref.columns() : ref.rows() );
+
+   bool valid( (*result) == ref && (*result).nonZeros() == ref.nonZeros() );
+
+   for( size_t k=0UL; valid && k<major; ++k ) {
+      valid = ( (*result).nonZeros( k ) == ref.nonZeros( k ) );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the assignment of a " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT1> ).name() << "\n"
+          << "   Result:\n" << (*result) << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a compressed vector assignment.
+//
+// \param label The label of the assigned operand.
+// \param result The resulting compressed vector.
+// \param rhs The assigned right-hand side vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given compressed vector to the result of a serial assignment of
+// the given right-hand side vector. Both the values and the number of non-zero elements have
+// to match. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1  // Type of the resulting compressed vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF >     // Transpose flag of the vectors
+void SparseAssignTest::checkResult( const std::string& label,
+                                    const blaze::SparseVector<VT1,TF>& result,
+                                    const blaze::Vector<VT2,TF>& rhs ) const
+{
+   VT1 ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = *rhs;
+   }
+
+   if( (*result) != ref || (*result).nonZeros() != ref.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the assignment of a " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<VT1> ).name() << "\n"
+          << "   Result:\n" << (*result) << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to compressed matrices and vectors.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseAssignTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse assignment test.
+*/
+#define RUN_SMP_SPARSEASSIGN_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
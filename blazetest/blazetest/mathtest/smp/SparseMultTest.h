@@ -0,0 +1,389 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SparseMultTest.h
+//  \brief Header file for the SMP sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SPARSEMULTTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SPARSEMULTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SMP sparse matrix/sparse matrix multiplication.
+//
+// This class represents a test suite for the parallel multiplication of row-major and column-major
+// compressed matrices. The SMP thresholds are lowered such that all multiplications are executed
+// in parallel in case a parallelization backend is active.
+*/
+class SparseMultTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseMultTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testMultiplication();
+   template< typename Type > void testIrregularStructure();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   static void randomize( blaze::CompressedMatrix<MT,SO>& A, size_t nonzeros );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResult( const std::string& label, const blaze::SparseMatrix<MT1,SO1>& result,
+                     const blaze::Matrix<MT2,SO2>& rhs ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP sparse matrix/sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel multiplication of row-major and column-major
+// compressed matrices of various sizes and fill ratios. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseMultTest::testMultiplication()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t sizes[][5] = { {   1UL,   1UL,   1UL,    1UL,    1UL }
+                             , {  67UL,  53UL,  71UL,  400UL,  500UL }
+                             , { 200UL, 150UL, 180UL, 3000UL, 2500UL }
+                             , { 128UL, 128UL, 128UL, 8000UL, 8000UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] ), k( size[1] ), n( size[2] );
+
+      blaze::CompressedMatrix<Type,rowMajor> A( m, k ), B( k, n );
+      randomize( A, size[3] );
+      randomize( B, size[4] );
+
+      const blaze::CompressedMatrix<Type,columnMajor> TA( A ), TB( B );
+
+
+      //=====================================================================================
+      // Row-major sparse matrix/row-major sparse matrix multiplication
+      //=====================================================================================
+
+      {
+         test_ = "Row-major sparse matrix/row-major sparse matrix multiplication";
+
+         blaze::CompressedMatrix<Type,rowMajor> C;
+
+         C = A * B;
+         checkResult( "A*B", C, A * B );
+
+         C = blaze::submatrix( A, 0UL, 0UL, m, k ) * B;
+         checkResult( "submatrix(A)*B", C, blaze::submatrix( A, 0UL, 0UL, m, k ) * B );
+
+         C = ( A * B ) * Type(2);
+         checkResult( "(A*B)*2", C, ( A * B ) * Type(2) );
+
+         C += A * B;
+         checkResult( "C+=A*B", C, ( A * B ) * Type(3) );
+
+         C = A * TB;
+         checkResult( "A*TB", C, A * TB );
+      }
+
+
+      //=====================================================================================
+      // Column-major sparse matrix/column-major sparse matrix multiplication
+      //=====================================================================================
+
+      {
+         test_ = "Column-major sparse matrix/column-major sparse matrix multiplication";
+
+         blaze::CompressedMatrix<Type,columnMajor> C;
+
+         C = TA * TB;
+         checkResult( "TA*TB", C, TA * TB );
+
+         C = ( TA * TB ) * Type(2);
+         checkResult( "(TA*TB)*2", C, ( TA * TB ) * Type(2) );
+
+         C = TA * B;
+         checkResult( "TA*B", C, TA * B );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP sparse matrix/sparse matrix multiplication with an irregular structure.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the parallel multiplication of compressed matrices with
+// empty rows and columns, a few densely filled rows and columns and cancelling products. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseMultTest::testIrregularStructure()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Sparse matrix multiplication with irregular structure";
+
+   const size_t n( 150UL );
+
+   blaze::CompressedMatrix<Type,rowMajor> A( n, n ), B( n, n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      A(3UL,j) = Type( blaze::rand<int>( 1, 9 ) );
+      B(j,5UL) = Type( blaze::rand<int>( 1, 9 ) );
+   }
+
+   for( size_t i=10UL; i<n; i+=3UL ) {
+      A(i,i) = Type(1);
+      A(i,(i+7UL)%n) = Type(-1);
+      B(i,i) = Type(2);
+      B((i+7UL)%n,i) = Type(2);
+   }
+
+   const blaze::CompressedMatrix<Type,columnMajor> TA( A ), TB( B );
+
+   blaze::CompressedMatrix<Type,rowMajor> C( n, n );
+   blaze::CompressedMatrix<Type,columnMajor> D( n, n );
+
+   C = A * B;
+   checkResult( "A*B", C, A * B );
+
+   C = B * A;
+   checkResult( "B*A", C, B * A );
+
+   D = TA * TB;
+   checkResult( "TA*TB", D, TA * TB );
+
+   D = TB * TA;
+   checkResult( "TB*TA", D, TB * TA );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given compressed matrix.
+//
+// \param A The compressed matrix to be initialized.
+// \param nonzeros The number of non-zero elements.
+// \return void
+//
+// This function initializes the given compressed matrix with the given number of non-zero
+// elements of small integral values, such that all products can be computed exactly.
+*/
+template< typename MT  // Type of the compressed matrix
+        , bool SO >    // Storage order of the compressed matrix
+void SparseMultTest::randomize( blaze::CompressedMatrix<MT,SO>& A, size_t nonzeros )
+{
+   const size_t m( A.rows() ), n( A.columns() );
+
+   for( size_t i=0UL; i<nonzeros; ++i ) {
+      A( blaze::rand<size_t>( 0UL, m-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) =
+         MT( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a sparse matrix multiplication.
+//
+// \param label The label of the multiplication.
+// \param result The resulting compressed matrix.
+// \param rhs The assigned right-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given compressed matrix to the result of a serial assignment of
+// the given right-hand side matrix. Both the values and the number of non-zero elements of
+// every row (or column) have to match. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1  // Type of the resulting compressed matrix
+        , bool SO1      // Storage order of the resulting compressed matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void SparseMultTest::checkResult( const std::string& label,
+                                  const blaze::SparseMatrix<MT1,SO1>& result,
+                                  const blaze::Matrix<MT2,SO2>& rhs ) const
+{
+   MT1 ref;
+
+   BLAZE_SERIAL_SECTION {
+      ref = *rhs;
+   }
+
+   const size_t major( SO1 ? ref.columns() : ref.rows() );
+
+   bool valid( (*result) == ref && (*result).nonZeros() == ref.nonZeros() );
+
+   for( size_t k=0UL; valid && k<major; ++k ) {
+      valid = ( (*result).nonZeros( k ) == ref.nonZeros( k ) );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << " multiplication\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT1> ).name() << "\n"
+          << "   Result:\n" << (*result) << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP sparse matrix/sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseMultTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP sparse matrix multiplication test.
+*/
+#define RUN_SMP_SPARSEMULT_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
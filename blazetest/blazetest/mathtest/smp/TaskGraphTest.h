@@ -0,0 +1,440 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/TaskGraphTest.h
+//  \brief Header file for the task graph test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_TASKGRAPHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_TASKGRAPHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/TaskGraph.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the TaskGraph class.
+//
+// This class represents a test suite for the TaskGraph class, which evaluates a batch of
+// statements with respect to the dependencies between them.
+*/
+class TaskGraphTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TaskGraphTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+                             void testDependencies();
+   template< typename Type > void testRun();
+                             void testException();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static void initialize( blaze::DynamicVector<Type>& v );
+
+   template< typename Type >
+   static void initialize( blaze::DynamicMatrix<Type>& A );
+
+   void checkCount( const std::string& label, size_t count, size_t expected ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const std::string& label, const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dependency detection of the TaskGraph class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of predecessors of the statements of a task graph for all
+// kinds of dependencies between the statements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void TaskGraphTest::testDependencies()
+{
+   test_ = "TaskGraph dependencies";
+
+   blaze::DynamicMatrix<double> A( 40UL, 40UL, 1.0 ), B( 40UL, 40UL, 2.0 );
+   blaze::DynamicVector<double> x1( 40UL, 1.0 ), x2( 40UL, 2.0 ), w( 40UL, 3.0 );
+   blaze::DynamicVector<double> y1( 40UL ), y2( 40UL ), z( 40UL );
+
+   blaze::TaskGraph graph;
+   checkCount( "Size of an empty graph", graph.size(), 0UL );
+
+   auto sz( blaze::subvector( z, 0UL, 20UL ) );
+
+   graph.assign( y1, A * x1 );         // 0: Independent
+   graph.assign( y2, B * x2 );         // 1: Independent
+   graph.assign( z, trans( A ) * w );  // 2: Independent
+   graph.addAssign( y1, A * y2 );      // 3: Write-after-write on 0, read-after-write on 1
+   graph.assign( x1, y2 );             // 4: Write-after-read on 0, read-after-write on 1
+   graph.subAssign( sz, x2 );          // 5: Write-after-write on 2 (viewed vector)
+   graph.assign( A, B * 2.0 );         // 6: Write-after-read on 0, 2, and 3
+
+   checkCount( "Size of the graph", graph.size(), 7UL );
+   checkCount( "Predecessors of statement 0", graph.predecessors( 0UL ), 0UL );
+   checkCount( "Predecessors of statement 1", graph.predecessors( 1UL ), 0UL );
+   checkCount( "Predecessors of statement 2", graph.predecessors( 2UL ), 0UL );
+   checkCount( "Predecessors of statement 3", graph.predecessors( 3UL ), 2UL );
+   checkCount( "Predecessors of statement 4", graph.predecessors( 4UL ), 2UL );
+   checkCount( "Predecessors of statement 5", graph.predecessors( 5UL ), 1UL );
+   checkCount( "Predecessors of statement 6", graph.predecessors( 6UL ), 3UL );
+
+   try {
+      graph.predecessors( 7UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access to an invalid statement succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   graph.clear();
+   checkCount( "Size of a cleared graph", graph.size(), 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of a TaskGraph.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the evaluation of a task graph with dependent and independent
+// statements by comparing it to the serial evaluation of the same statements in program order.
+// The graph is evaluated repeatedly, as for instance in an iterative solver. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void TaskGraphTest::testRun()
+{
+   test_ = "TaskGraph::run()";
+
+   blaze::DynamicMatrix<Type> A( 67UL, 67UL ), B( 67UL, 67UL );
+   blaze::DynamicVector<Type> x1( 67UL ), x2( 67UL ), w( 67UL );
+   initialize( A );
+   initialize( B );
+   initialize( x1 );
+   initialize( x2 );
+   initialize( w );
+
+   blaze::DynamicVector<Type> y1( 67UL, Type(0) ), y2( 67UL, Type(0) ), z( 67UL, Type(0) );
+   blaze::DynamicMatrix<Type> C( 67UL, 67UL, Type(0) );
+
+   blaze::DynamicVector<Type> ry1( y1 ), ry2( y2 ), rz( z ), rx1( x1 );
+   blaze::DynamicMatrix<Type> rC( C );
+
+   auto sz( blaze::subvector( z, 10UL, 40UL ) );
+
+   blaze::TaskGraph graph;
+   graph.assign( y1, A * x1 );
+   graph.assign( y2, B * x2 );
+   graph.assign( z, trans( A ) * w );
+   graph.assign( C, A * B );
+   graph.addAssign( y1, A * y2 );
+   graph.subAssign( sz, blaze::subvector( y2, 0UL, 40UL ) );
+   graph.assign( x1, y2 / Type(3) );
+   graph.addAssign( C, B );
+
+   for( size_t iteration=0UL; iteration<3UL; ++iteration )
+   {
+      graph.run();
+
+      BLAZE_SERIAL_SECTION {
+         ry1 = A * rx1;
+         ry2 = B * x2;
+         rz = trans( A ) * w;
+         rC = A * B;
+         ry1 += A * ry2;
+         blaze::subvector( rz, 10UL, 40UL ) -= blaze::subvector( ry2, 0UL, 40UL );
+         rx1 = ry2 / Type(3);
+         rC += B;
+      }
+
+      checkResult( "First target vector", y1, ry1 );
+      checkResult( "Second target vector", y2, ry2 );
+      checkResult( "Third target vector", z, rz );
+      checkResult( "Fourth target vector", x1, rx1 );
+      checkResult( "Target matrix", C, rC );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions of a TaskGraph.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during the evaluation of a statement is rethrown
+// by the run() function and that all statements depending on the failed statement are skipped.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void TaskGraphTest::testException()
+{
+   test_ = "TaskGraph exception propagation";
+
+   blaze::DynamicMatrix<double> A( 5UL, 5UL, 1.0 ), B( 5UL, 5UL, 0.0 );
+   blaze::LowerMatrix< blaze::DynamicMatrix<double> > L( 5UL );
+   blaze::DynamicVector<double> x( 5UL, 1.0 ), y( 5UL, 0.0 );
+
+   blaze::TaskGraph graph;
+   graph.assign( L, A );       // Fails since A is not a lower matrix
+   graph.assign( B, L * A );   // Depends on the failed statement
+   graph.assign( y, A * x );   // Independent
+
+   try {
+      graph.run();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment of a non-lower matrix to a lower matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkResult( "Dependent statement", B, blaze::DynamicMatrix<double>( 5UL, 5UL, 0.0 ) );
+   checkResult( "Independent statement", y, blaze::DynamicVector<double>( 5UL, 5.0 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with small integral values.
+//
+// \param v The vector to be initialized.
+// \return void
+*/
+template< typename Type >  // Element type of the vector
+void TaskGraphTest::initialize( blaze::DynamicVector<Type>& v )
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = Type( blaze::rand<int>( -5, 5 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small integral values.
+//
+// \param A The matrix to be initialized.
+// \return void
+*/
+template< typename Type >  // Element type of the matrix
+void TaskGraphTest::initialize( blaze::DynamicMatrix<Type>& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = Type( blaze::rand<int>( -5, 5 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param label The label of the count.
+// \param count The actual count.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given count does not match the expected count, a \a std::runtime_error exception
+// is thrown.
+*/
+inline void TaskGraphTest::checkCount( const std::string& label,
+                                       size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " is invalid\n"
+          << " Details:\n"
+          << "   Result: " << count << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a statement of a task graph.
+//
+// \param label The label of the result.
+// \param result The result of the statement.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given result differs from the expected result, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void TaskGraphTest::checkResult( const std::string& label,
+                                 const T1& result, const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the " << label << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<T1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the deferred evaluation of statements by means of a task graph.
+//
+// \return void
+*/
+void runTest()
+{
+   TaskGraphTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the task graph test.
+*/
+#define RUN_SMP_TASKGRAPH_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
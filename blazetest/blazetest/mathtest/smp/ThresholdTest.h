@@ -0,0 +1,382 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ThresholdTest.h
+//  \brief Header file for the runtime threshold test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_THRESHOLDTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_THRESHOLDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime thresholds.
+//
+// This class represents a test suite for the runtime adjustment of the kernel and SMP thresholds
+// via the getThreshold(), setThreshold(), resetThreshold(), resetThresholds(), loadThresholds()
+// and saveThresholds() functions.
+*/
+class ThresholdTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThresholdTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testTable();
+   void testSetThreshold();
+   void testProfile();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void checkThreshold( const std::string& name, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the threshold table.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that every entry of the threshold table can be found by its name, that
+// the names are unique and that all thresholds are initialized to their default values. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testTable()
+{
+   test_ = "Threshold table";
+
+   blaze::resetThresholds();
+
+   const blaze::ThresholdEntry* table( blaze::thresholdTable() );
+
+   for( size_t i=0UL; i<blaze::thresholdCount(); ++i )
+   {
+      if( blaze::findThreshold( table[i].name ) != table + i ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid table entry\n"
+             << " Details:\n"
+             << "   Threshold: " << table[i].name << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( blaze::getThreshold( table[i].name ) != table[i].defaultValue ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid default value\n"
+             << " Details:\n"
+             << "   Threshold: " << table[i].name << "\n"
+             << "   Result: " << blaze::getThreshold( table[i].name ) << "\n"
+             << "   Expected result: " << table[i].defaultValue << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( blaze::findThreshold( "SMP_DVECASSIGN_THRESHOLD" ) == nullptr ||
+       blaze::findThreshold( "SMP_KRONMULT_THRESHOLD" ) == nullptr ||
+       blaze::findThreshold( "INVALID_THRESHOLD" ) != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold lookup failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the getThreshold(), setThreshold() and resetThreshold() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the runtime adjustment of individual thresholds. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testSetThreshold()
+{
+   test_ = "setThreshold() function";
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 12345UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 12345UL );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != 12345UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold was not updated\n"
+          << " Details:\n"
+          << "   Result: " << blaze::SMP_DVECASSIGN_THRESHOLD << "\n"
+          << "   Expected result: 12345\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::setThreshold( "INVALID_THRESHOLD", 100UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid threshold value succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 12345UL );
+
+
+   test_ = "resetThreshold() function";
+
+   blaze::resetThreshold( "SMP_DVECASSIGN_THRESHOLD" );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", blaze::SMP_DVECASSIGN_DEFAULT_THRESHOLD );
+
+
+   test_ = "resetThresholds() function";
+
+   blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 7UL );
+   blaze::setThreshold( "SMP_KRONMULT_THRESHOLD", 9UL );
+   blaze::resetThresholds();
+   checkThreshold( "DMATDVECMULT_THRESHOLD", blaze::DMATDVECMULT_DEFAULT_THRESHOLD );
+   checkThreshold( "SMP_KRONMULT_THRESHOLD", blaze::SMP_KRONMULT_DEFAULT_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() and saveThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the loading and saving of threshold profiles. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThresholdTest::testProfile()
+{
+   test_ = "saveThresholds() function";
+
+   const std::string filename( "thresholds.tmp" );
+
+   blaze::setThreshold( "SMP_DMATDMATMULT_THRESHOLD", 2500UL );
+   blaze::saveThresholds( filename );
+   blaze::resetThresholds();
+
+   blaze::loadThresholds( filename );
+   checkThreshold( "SMP_DMATDMATMULT_THRESHOLD", 2500UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", blaze::SMP_DVECASSIGN_DEFAULT_THRESHOLD );
+
+
+   test_ = "loadThresholds() function";
+
+   {
+      std::ofstream file( filename.c_str() );
+      file << "# Test profile\n"
+           << "\n"
+           << "SMP_DVECASSIGN_THRESHOLD = 48000\n"
+           << "SMP_DMATDMATMULT_THRESHOLD 100  # comment\n";
+   }
+
+   blaze::loadThresholds( filename );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 48000UL );
+   checkThreshold( "SMP_DMATDMATMULT_THRESHOLD", 100UL );
+
+   {
+      std::ofstream file( filename.c_str() );
+      file << "SMP_DVECASSIGN_THRESHOLD = 1000\n"
+           << "INVALID_THRESHOLD = 1000\n";
+   }
+
+   try {
+      blaze::loadThresholds( filename );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading an invalid threshold profile succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+         throw;
+   }
+
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 48000UL );
+
+   std::remove( filename.c_str() );
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given threshold.
+//
+// \param name The name of the threshold.
+// \param expected The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the current value of the given threshold. In case the value does not
+// correspond to the given expected value, a \a std::runtime_error exception is thrown.
+*/
+inline void ThresholdTest::checkThreshold( const std::string& name, size_t expected ) const
+{
+   if( blaze::getThreshold( name ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value\n"
+          << " Details:\n"
+          << "   Threshold: " << name << "\n"
+          << "   Result: " << blaze::getThreshold( name ) << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime adjustment of the kernel and SMP thresholds.
+//
+// \return void
+*/
+void runTest()
+{
+   ThresholdTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime threshold test.
+*/
+#define RUN_SMP_THRESHOLD_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,400 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/WorkStealingTest.h
+//  \brief Header file for the work-stealing scheduler test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_WORKSTEALINGTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_WORKSTEALINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/Thresholds.h>
+#include <blaze/util/WorkStealingPool.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the work-stealing scheduler.
+//
+// This class represents a test suite for the WorkStealingPool class template and for the SMP
+// assignments of the C++11 and Boost thread backends in case the work-stealing scheduler is
+// active (see the \c BLAZE_USE_WORK_STEALING switch).
+*/
+class WorkStealingTest
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the tested thread pool.
+   using Pool = blaze::WorkStealingPool< std::thread, std::mutex, std::unique_lock<std::mutex>
+                                       , std::condition_variable >;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit WorkStealingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSchedule();
+   void testTaskGroups();
+   void testResize();
+   void testAssignment();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void work( size_t n );
+
+   void checkCount( const std::string& label, size_t count, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks on a work-stealing thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of tasks of very different cost on a WorkStealingPool
+// and checks that every task is executed exactly once, both with and without spinning workers.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void WorkStealingTest::testSchedule()
+{
+   test_ = "WorkStealingPool::schedule()";
+
+   for( size_t spin : { 0UL, 1000UL } )
+   {
+      Pool pool( 4UL, spin );
+
+      std::atomic<size_t> sum( 0UL );
+
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         pool.schedule( [&sum,i]() {
+            work( ( i % 17UL ) * 1000UL );
+            sum += i;
+         } );
+      }
+
+      pool.wait();
+
+      checkCount( "Sum of all task indices", sum, 499500UL );
+      checkCount( "Number of threads", pool.size(), 4UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the task groups of a work-stealing thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks into two different task groups, partially directly onto
+// particular workers, and checks that waiting for a group waits for all of its tasks. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void WorkStealingTest::testTaskGroups()
+{
+   test_ = "WorkStealingPool task groups";
+
+   Pool pool( 3UL );
+
+   Pool::TaskGroup group1;
+   Pool::TaskGroup group2;
+
+   std::atomic<size_t> count1( 0UL );
+   std::atomic<size_t> count2( 0UL );
+
+   for( size_t i=0UL; i<200UL; ++i )
+   {
+      pool.schedule( group1, [&count1,i]() {
+         work( ( i % 5UL ) * 2000UL );
+         ++count1;
+      } );
+
+      if( i % 2UL == 0UL ) {
+         pool.scheduleOn( i, group2, [&count2]() {
+            work( 500UL );
+            ++count2;
+         } );
+      }
+   }
+
+   group1.wait();
+   checkCount( "Number of executed tasks of the first group", count1, 200UL );
+
+   group2.wait();
+   checkCount( "Number of executed tasks of the second group", count2, 100UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resizing of a work-stealing thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function resizes a WorkStealingPool while tasks are scheduled and checks that all tasks
+// are executed and that the pool has the requested number of workers afterwards. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void WorkStealingTest::testResize()
+{
+   test_ = "WorkStealingPool::resize()";
+
+   Pool pool( 2UL );
+
+   std::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( [&count]() { work( 1000UL ); ++count; } );
+   }
+
+   pool.resize( 5UL );
+   checkCount( "Number of threads after increasing the size", pool.size(), 5UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( [&count]() { work( 1000UL ); ++count; } );
+   }
+
+   pool.resize( 1UL );
+   checkCount( "Number of threads after decreasing the size", pool.size(), 1UL );
+
+   pool.wait();
+   checkCount( "Number of executed tasks", count, 200UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment with the work-stealing scheduler.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of parallel dense vector and dense matrix assignments in case
+// the work-stealing scheduler is active, i.e. in case every SMP assignment is split into several
+// tasks per thread. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void WorkStealingTest::testAssignment()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "SMP assignment with work stealing";
+
+   blaze::DynamicVector<double> a( 10007UL );
+   blaze::DynamicMatrix<double,rowMajor> A( 311UL, 173UL );
+   blaze::randomize( a );
+   blaze::randomize( A );
+
+   blaze::DynamicVector<double> b, bref;
+   blaze::DynamicMatrix<double,rowMajor> B, Bref;
+   blaze::DynamicMatrix<double,columnMajor> C, Cref;
+
+   b = a + a * 2.0;
+   B = A + A * 2.0;
+   C = A + A * 2.0;
+
+   BLAZE_SERIAL_SECTION {
+      bref = a + a * 2.0;
+      Bref = A + A * 2.0;
+      Cref = A + A * 2.0;
+   }
+
+   if( b != bref || B != Bref || C != Cref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of the parallel assignment\n"
+          << " Details:\n"
+          << "   Number of threads: " << blaze::getNumThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Busy work of the given number of iterations.
+//
+// \param n The number of iterations.
+// \return void
+*/
+inline void WorkStealingTest::work( size_t n )
+{
+   volatile size_t dummy( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      dummy = dummy + i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given count.
+//
+// \param label The label of the count.
+// \param count The actual count.
+// \param expected The expected count.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the given count does not match the expected count, a \a std::runtime_error exception
+// is thrown.
+*/
+inline void WorkStealingTest::checkCount( const std::string& label,
+                                          size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " is invalid\n"
+          << " Details:\n"
+          << "   Result: " << count << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the work-stealing scheduler.
+//
+// \return void
+*/
+void runTest()
+{
+   WorkStealingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the work-stealing scheduler test.
+*/
+#define RUN_SMP_WORKSTEALING_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
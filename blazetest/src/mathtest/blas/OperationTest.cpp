@@ -73,6 +73,7 @@ OperationTest::OperationTest()
    //testDotc< float >();
    //testAxpy< float >();
    //testTrsm< float >();
+   //testSyrk< float >();
 
 
    //=====================================================================================
@@ -83,6 +84,7 @@ OperationTest::OperationTest()
    testDotc< double >();
    testAxpy< double >();
    testTrsm< double >();
+   testSyrk< double >();
 
 
    //=====================================================================================
@@ -93,6 +95,7 @@ OperationTest::OperationTest()
    //testDotc< complex<float> >();
    //testAxpy< complex<float> >();
    //testTrsm< complex<float> >();
+   //testSyrk< complex<float> >();
 
 
    //=====================================================================================
@@ -103,6 +106,7 @@ OperationTest::OperationTest()
    testDotc< complex<double> >();
    testAxpy< complex<double> >();
    testTrsm< complex<double> >();
+   testSyrk< complex<double> >();
 }
 //*************************************************************************************************
 
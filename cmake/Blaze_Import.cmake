@@ -150,6 +150,12 @@ function(Blaze_Import)
          THRESHOLD_SMP_TSMATTSMATMULT
          THRESHOLD_SMP_DMATREDUCE
          THRESHOLD_SMP_SMATREDUCE
+         THRESHOLD_SMP_DVECREDUCE
+         THRESHOLD_SMP_DVECNORM
+         THRESHOLD_SMP_DVECDVECINNER
+         THRESHOLD_SMP_DMATFULLREDUCE
+         THRESHOLD_SMP_SMATASSIGN
+         THRESHOLD_SMP_SVECASSIGN
       )
       set(multiValueArgs )
 
@@ -318,6 +324,7 @@ function(Blaze_Import)
    #==================================================================================================
 
       if(${Blaze_Import_LAPACK})
+         target_compile_definitions( Blaze INTERFACE BLAZE_LAPACK_MODE=1 )
          find_package(LAPACK REQUIRED)
          target_link_libraries(Blaze INTERFACE $<BUILD_INTERFACE:${LAPACK_LIBRARIES}>)
          target_compile_options(Blaze INTERFACE $<BUILD_INTERFACE:${LAPACK_LINKER_FLAGS}>)
@@ -325,6 +332,7 @@ function(Blaze_Import)
       elseif("${Blaze_Import_LAPACK}" STREQUAL "")
          msg_db("Using default configuration for LAPACK.")
       else()
+         target_compile_definitions( Blaze INTERFACE BLAZE_LAPACK_MODE=0 )
          msg("Configuring LAPACK : OFF")
       endif()
 
@@ -954,6 +962,48 @@ function(Blaze_Import)
          msg_db("Using default configuration for SMP sparse matrix reduction Threshold.")
       endif()
 
+      if(Blaze_Import_THRESHOLD_SMP_DVECREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECREDUCE} )
+         msg_db("Configuring SMP dense vector reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense vector reduction Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DVECNORM)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECNORM_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECNORM} )
+         msg_db("Configuring SMP dense vector norm Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECNORM}")
+      else()
+         msg_db("Using default configuration for SMP dense vector norm Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DVECDVECINNER)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECDVECINNER_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECDVECINNER} )
+         msg_db("Configuring SMP dense vector/dense vector inner product Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECDVECINNER}")
+      else()
+         msg_db("Using default configuration for SMP dense vector/dense vector inner product Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DMATFULLREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE} )
+         msg_db("Configuring SMP dense matrix total reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense matrix total reduction Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_SMATASSIGN)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_SMATASSIGN_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_SMATASSIGN} )
+         msg_db("Configuring SMP compressed matrix assignment Threshold : ${Blaze_Import_THRESHOLD_SMP_SMATASSIGN}")
+      else()
+         msg_db("Using default configuration for SMP compressed matrix assignment Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_SVECASSIGN)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_SVECASSIGN_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_SVECASSIGN} )
+         msg_db("Configuring SMP compressed vector assignment Threshold : ${Blaze_Import_THRESHOLD_SMP_SVECASSIGN}")
+      else()
+         msg_db("Using default configuration for SMP compressed vector assignment Threshold.")
+      endif()
+
    #==================================================================================================
    #   MPI
    #==================================================================================================